@@ -6,9 +6,13 @@
 
 #include <djvAV/AVSystem.h>
 #include <djvAV/IOSystem.h>
+#include <djvAV/SequenceVerify.h>
 #include <djvAV/TimeFunc.h>
 
 #include <djvImage/InfoFunc.h>
+#include <djvImage/TypeFunc.h>
+
+#include <djvMath/FrameNumberFunc.h>
 
 #include <djvSystem/Context.h>
 #include <djvSystem/FileInfoFunc.h>
@@ -18,6 +22,12 @@
 #include <djvCore/ErrorFunc.h>
 #include <djvCore/StringFormat.h>
 
+#include <rapidjson/writer.h>
+
+#include <iomanip>
+#include <list>
+#include <thread>
+
 using namespace djv;
 
 class Application : public CmdLine::Application
@@ -30,6 +40,7 @@ protected:
         CmdLine::Application::_init(args);
 
         _textSystem = getSystemT<System::TextSystem>();
+        _threadCount = threadCountDefault();
 
         _parseCmdLine(args);
 
@@ -72,34 +83,102 @@ public:
 
     void run() override
     {
-        auto io = getSystemT<AV::IO::IOSystem>();
-        auto avSystem = getSystemT<AV::AVSystem>();
         for (const auto& i : _inputs)
         {
             switch (i.getType())
             {
             case System::File::Type::File:
             case System::File::Type::Sequence:
-                _print(i, io, avSystem);
+                _probe(i);
                 break;
             case System::File::Type::Directory:
+                _probeDirectory(i.getPath());
+                break;
+            default: break;
+            }
+        }
+        _flush(0);
+        if (_problems)
+        {
+            exit(1);
+        }
+    }
+
+protected:
+    void _parseCmdLine(std::list<std::string>& args) override
+    {
+        CmdLine::Application::_parseCmdLine(args);
+        auto i = args.begin();
+        while (i != args.end())
+        {
+            if ("-threads" == *i)
             {
-                std::cout << i.getPath() << ":" << std::endl;
-                System::File::DirectoryListOptions options;
-                options.sequences = true;
-                options.sequenceExtensions = io->getSequenceExtensions();
-                for (const auto& j : System::File::directoryList(i.getPath(), options))
+                i = args.erase(i);
+                if (args.end() == i)
                 {
-                    _print(j, io, avSystem);
+                    throw std::runtime_error(Core::String::Format("{0}: {1}").
+                        arg("-threads").
+                        arg(_textSystem->getText(DJV_TEXT("error_cannot_parse_argument"))));
                 }
-                break;
+                int value = 0;
+                std::stringstream ss(*i);
+                ss >> value;
+                i = args.erase(i);
+                _threadCount = static_cast<size_t>(std::max(value, 1));
             }
-            default: break;
+            else if ("-recursive" == *i)
+            {
+                i = args.erase(i);
+                _recursive = true;
+            }
+            else if ("-json" == *i)
+            {
+                i = args.erase(i);
+                _json = true;
+            }
+            else if ("-verify" == *i)
+            {
+                i = args.erase(i);
+                if (args.end() == i)
+                {
+                    throw std::runtime_error(Core::String::Format("{0}: {1}").
+                        arg("-verify").
+                        arg(_textSystem->getText(DJV_TEXT("error_cannot_parse_argument"))));
+                }
+                if ("stat" == *i)
+                {
+                    _verifyOptions.mode = AV::IO::VerifyMode::Stat;
+                }
+                else if ("header" == *i)
+                {
+                    _verifyOptions.mode = AV::IO::VerifyMode::Header;
+                }
+                else if ("decode" == *i)
+                {
+                    _verifyOptions.mode = AV::IO::VerifyMode::Decode;
+                }
+                else
+                {
+                    throw std::runtime_error(Core::String::Format("{0}: {1}").
+                        arg("-verify").
+                        arg(_textSystem->getText(DJV_TEXT("error_cannot_parse_argument"))));
+                }
+                i = args.erase(i);
+                _verify = true;
+            }
+            else if ("-checksums" == *i)
+            {
+                i = args.erase(i);
+                _verifyOptions.checksums = true;
+                _verify = true;
+            }
+            else
+            {
+                ++i;
             }
         }
     }
 
-protected:
     void _printUsage() override
     {
         auto textSystem = getSystemT<System::TextSystem>();
@@ -110,60 +189,307 @@ protected:
         std::cout << std::endl;
         std::cout << "   " << textSystem->getText(DJV_TEXT("djv_info_usage_format")) << std::endl;
         std::cout << std::endl;
+        std::cout << " " << textSystem->getText(DJV_TEXT("djv_info_options")) << std::endl;
+        std::cout << std::endl;
+        std::cout << "   " << textSystem->getText(DJV_TEXT("djv_info_option_threads")) << std::endl;
+        std::cout << "   " << textSystem->getText(DJV_TEXT("djv_info_option_threads_description")) << threadCountDefault() << std::endl;
+        std::cout << std::endl;
+        std::cout << "   " << textSystem->getText(DJV_TEXT("djv_info_option_recursive")) << std::endl;
+        std::cout << "   " << textSystem->getText(DJV_TEXT("djv_info_option_recursive_description")) << std::endl;
+        std::cout << std::endl;
+        std::cout << "   " << textSystem->getText(DJV_TEXT("djv_info_option_json")) << std::endl;
+        std::cout << "   " << textSystem->getText(DJV_TEXT("djv_info_option_json_description")) << std::endl;
+        std::cout << std::endl;
+        std::cout << "   " << textSystem->getText(DJV_TEXT("djv_info_option_verify")) << std::endl;
+        std::cout << "   " << textSystem->getText(DJV_TEXT("djv_info_option_verify_description")) << std::endl;
+        std::cout << std::endl;
+        std::cout << "   " << textSystem->getText(DJV_TEXT("djv_info_option_checksums")) << std::endl;
+        std::cout << "   " << textSystem->getText(DJV_TEXT("djv_info_option_checksums_description")) << std::endl;
+        std::cout << std::endl;
 
         CmdLine::Application::_printUsage();
     }
 
 private:
-    void _print(const System::File::Info& fileInfo, std::shared_ptr<AV::IO::IOSystem>& io, std::shared_ptr<AV::AVSystem>& avSystem)
+    static size_t threadCountDefault()
     {
+        return std::max(std::thread::hardware_concurrency(), 1U);
+    }
+
+    //! A file that is being read. The readers decode the file information
+    //! on their own threads, so keeping several of them in flight probes the
+    //! files in parallel while the output stays in order.
+    struct Probe
+    {
+        System::File::Info fileInfo;
+        std::shared_ptr<AV::IO::IRead> read;
+        std::string error;
+    };
+
+    void _probeDirectory(const System::File::Path& path)
+    {
+        auto io = getSystemT<AV::IO::IOSystem>();
+        if (!_json)
+        {
+            _flush(0);
+            std::cout << path << ":" << std::endl;
+        }
+        System::File::DirectoryListOptions options;
+        options.sequences = true;
+        options.sequenceExtensions = io->getSequenceExtensions();
+        std::vector<System::File::Path> directories;
+        for (const auto& i : System::File::directoryList(path, options))
+        {
+            if (System::File::Type::Directory == i.getType())
+            {
+                if (_recursive)
+                {
+                    directories.push_back(i.getPath());
+                }
+            }
+            else
+            {
+                _probe(i);
+            }
+        }
+        for (const auto& i : directories)
+        {
+            _probeDirectory(i);
+        }
+    }
+
+    void _probe(const System::File::Info& fileInfo)
+    {
+        auto io = getSystemT<AV::IO::IOSystem>();
         if (io->canRead(fileInfo))
         {
+            _flush(_threadCount - 1);
+            Probe probe;
+            probe.fileInfo = fileInfo;
             try
             {
-                const auto read = io->read(fileInfo);
-                const auto info = read->getInfo().get();
-                std::cout << fileInfo << std::endl;
-                std::cout.precision(2);
-                if (info.videoSequence.getFrameCount() > 1)
-                {
-                    std::cout << "    Speed: " << info.videoSpeed.toFloat() << std::endl;
-                    const AV::Time::Units timeUnits = avSystem->observeTimeUnits()->get();
-                    std::cout << "    Duration: " << AV::Time::toString(info.videoSequence.getFrameCount(), info.videoSpeed, timeUnits);
-                    if (AV::Time::Units::Frames == timeUnits)
-                    {
-                        std::cout << " " << "frames";
-                    }
-                    std::cout << std::endl;
-                }
-                for (const auto & video : info.video)
-                {
-                    std::cout << "    " << video.name << std::endl;
-                    std::cout << "        Size: " << video.size << " " << std::fixed << video.getAspectRatio() << std::endl;
-                    std::stringstream ss;
-                    ss << video.type;
-                    std::cout << "        Type: " << _textSystem->getText(ss.str()) << std::endl;
+                probe.read = io->read(fileInfo);
+            }
+            catch (const std::exception& e)
+            {
+                probe.error = e.what();
+            }
+            _probes.push_back(probe);
+        }
+    }
+
+    void _flush(size_t max)
+    {
+        while (_probes.size() > max)
+        {
+            const Probe probe = _probes.front();
+            _probes.pop_front();
+            AV::IO::Info info;
+            std::string error = probe.error;
+            if (probe.read)
+            {
+                try
+                {
+                    info = probe.read->getInfo().get();
                 }
-                if (info.audio.isValid())
+                catch (const std::exception& e)
                 {
-                    std::cout << "    " << info.audio.name << std::endl;
-                    std::cout << "        Channels: " << static_cast<int>(info.audio.channelCount) << std::endl;
-                    std::stringstream ss;
-                    ss << info.audio.type;
-                    std::cout << "        Type: " << _textSystem->getText(ss.str()) << std::endl;
-                    std::cout << "        Sample rate: " << info.audio.sampleRate << std::endl;
-                    std::cout << "        Duration: " << (info.audio.sampleRate > 0 ? (info.audioSampleCount / static_cast<float>(info.audio.sampleRate)) : 0.F) << " seconds" << std::endl;
+                    error = e.what();
                 }
             }
-            catch (const std::exception & e)
+            std::unique_ptr<AV::IO::VerifyReport> report;
+            if (_verify && error.empty())
             {
-                std::cout << Core::Error::format(e) << std::endl;
+                try
+                {
+                    _verifyOptions.threadCount = _threadCount;
+                    report.reset(new AV::IO::VerifyReport(AV::IO::verify(
+                        probe.fileInfo,
+                        _verifyOptions,
+                        getSystemT<AV::IO::IOSystem>())));
+                    _problems |= report->hasProblems();
+                }
+                catch (const std::exception& e)
+                {
+                    error = e.what();
+                }
+            }
+            _problems |= !error.empty();
+            if (_json)
+            {
+                _printJSON(probe.fileInfo, info, report.get(), error);
+            }
+            else if (error.empty())
+            {
+                _print(probe.fileInfo, info, report.get());
+            }
+            else
+            {
+                std::cout << Core::Error::format(error) << std::endl;
+            }
+        }
+    }
+
+    void _print(const System::File::Info& fileInfo, const AV::IO::Info& info, const AV::IO::VerifyReport* report)
+    {
+        std::cout << fileInfo << std::endl;
+        std::cout.precision(2);
+        const auto missingFrames = Math::Frame::getMissing(fileInfo.getSequence());
+        if (missingFrames.isValid())
+        {
+            std::cout << "    Missing frames: " << missingFrames << std::endl;
+        }
+        if (info.videoSequence.getFrameCount() > 1)
+        {
+            std::cout << "    Speed: " << info.videoSpeed.toFloat() << std::endl;
+            auto avSystem = getSystemT<AV::AVSystem>();
+            const AV::Time::Units timeUnits = avSystem->observeTimeUnits()->get();
+            std::cout << "    Duration: " << AV::Time::toString(info.videoSequence.getFrameCount(), info.videoSpeed, timeUnits);
+            if (AV::Time::Units::Frames == timeUnits)
+            {
+                std::cout << " " << "frames";
+            }
+            std::cout << std::endl;
+        }
+        for (const auto & video : info.video)
+        {
+            std::cout << "    " << video.name << std::endl;
+            std::cout << "        Size: " << video.size << " " << std::fixed << video.getAspectRatio() << std::endl;
+            std::stringstream ss;
+            ss << video.type;
+            std::cout << "        Type: " << _textSystem->getText(ss.str()) << std::endl;
+        }
+        if (info.audio.isValid())
+        {
+            std::cout << "    " << info.audio.name << std::endl;
+            std::cout << "        Channels: " << static_cast<int>(info.audio.channelCount) << std::endl;
+            std::stringstream ss;
+            ss << info.audio.type;
+            std::cout << "        Type: " << _textSystem->getText(ss.str()) << std::endl;
+            std::cout << "        Sample rate: " << info.audio.sampleRate << std::endl;
+            std::cout << "        Duration: " << (info.audio.sampleRate > 0 ? (info.audioSampleCount / static_cast<float>(info.audio.sampleRate)) : 0.F) << " seconds" << std::endl;
+        }
+        if (report)
+        {
+            if (report->truncated.isValid())
+            {
+                std::cout << "    Truncated frames: " << report->truncated << std::endl;
+            }
+            for (const auto& i : report->frames)
+            {
+                if (AV::IO::VerifyStatus::Error == i.status)
+                {
+                    std::cout << "    " << Core::Error::format(fileInfo.getFileName(i.number) + ": " + i.error) << std::endl;
+                }
+            }
+            if (_verifyOptions.checksums)
+            {
+                std::cout << "    Checksums:" << std::endl;
+                for (const auto& i : report->frames)
+                {
+                    std::cout << "        " << fileInfo.getFileName(i.number, false) << " " <<
+                        std::hex << std::setfill('0') << std::setw(16) << i.checksum << std::dec << std::endl;
+                }
+            }
+        }
+    }
+
+    //! Print the information as a single line of JSON.
+    void _printJSON(
+        const System::File::Info& fileInfo,
+        const AV::IO::Info& info,
+        const AV::IO::VerifyReport* report,
+        const std::string& error)
+    {
+        rapidjson::Document document;
+        document.SetObject();
+        auto& allocator = document.GetAllocator();
+        const std::string fileName = fileInfo.getFileName();
+        document.AddMember("fileName", rapidjson::Value(fileName.c_str(), fileName.size(), allocator), allocator);
+        document.AddMember("fileType", toJSON(fileInfo.getType(), allocator), allocator);
+        document.AddMember("byteCount", rapidjson::Value(static_cast<uint64_t>(fileInfo.getSize())), allocator);
+        if (System::File::Type::Sequence == fileInfo.getType())
+        {
+            document.AddMember("frames", toJSON(fileInfo.getSequence(), allocator), allocator);
+            document.AddMember("missingFrames", toJSON(Math::Frame::getMissing(fileInfo.getSequence()), allocator), allocator);
+        }
+        if (error.empty())
+        {
+            document.AddMember("frameCount", rapidjson::Value(static_cast<uint64_t>(info.videoSequence.getFrameCount())), allocator);
+            document.AddMember("speed", rapidjson::Value(info.videoSpeed.toFloat()), allocator);
+            rapidjson::Value video(rapidjson::kArrayType);
+            for (const auto& i : info.video)
+            {
+                rapidjson::Value object(rapidjson::kObjectType);
+                object.AddMember("name", rapidjson::Value(i.name.c_str(), i.name.size(), allocator), allocator);
+                object.AddMember("width", rapidjson::Value(static_cast<unsigned>(i.size.w)), allocator);
+                object.AddMember("height", rapidjson::Value(static_cast<unsigned>(i.size.h)), allocator);
+                object.AddMember("pixelAspectRatio", rapidjson::Value(i.pixelAspectRatio), allocator);
+                object.AddMember("type", toJSON(i.type, allocator), allocator);
+                video.PushBack(object, allocator);
+            }
+            document.AddMember("video", video, allocator);
+            if (info.audio.isValid())
+            {
+                rapidjson::Value audio(rapidjson::kObjectType);
+                audio.AddMember("name", rapidjson::Value(info.audio.name.c_str(), info.audio.name.size(), allocator), allocator);
+                audio.AddMember("channelCount", rapidjson::Value(static_cast<unsigned>(info.audio.channelCount)), allocator);
+                std::stringstream ss;
+                ss << info.audio.type;
+                const std::string type = ss.str();
+                audio.AddMember("type", rapidjson::Value(type.c_str(), type.size(), allocator), allocator);
+                audio.AddMember("sampleRate", rapidjson::Value(static_cast<uint64_t>(info.audio.sampleRate)), allocator);
+                audio.AddMember("sampleCount", rapidjson::Value(static_cast<uint64_t>(info.audioSampleCount)), allocator);
+                document.AddMember("audio", audio, allocator);
+            }
+        }
+        else
+        {
+            document.AddMember("error", rapidjson::Value(error.c_str(), error.size(), allocator), allocator);
+        }
+        if (report)
+        {
+            document.AddMember("truncatedFrames", toJSON(report->truncated, allocator), allocator);
+            document.AddMember("errorFrames", toJSON(report->errors, allocator), allocator);
+            rapidjson::Value frames(rapidjson::kArrayType);
+            for (const auto& i : report->frames)
+            {
+                rapidjson::Value object(rapidjson::kObjectType);
+                if (i.number != Math::Frame::invalid)
+                {
+                    object.AddMember("frame", rapidjson::Value(static_cast<int64_t>(i.number)), allocator);
+                }
+                object.AddMember("byteCount", rapidjson::Value(static_cast<uint64_t>(i.size)), allocator);
+                if (_verifyOptions.checksums)
+                {
+                    std::stringstream ss;
+                    ss << std::hex << std::setfill('0') << std::setw(16) << i.checksum;
+                    const std::string checksum = ss.str();
+                    object.AddMember("checksum", rapidjson::Value(checksum.c_str(), checksum.size(), allocator), allocator);
+                }
+                if (!i.error.empty())
+                {
+                    object.AddMember("error", rapidjson::Value(i.error.c_str(), i.error.size(), allocator), allocator);
+                }
+                frames.PushBack(object, allocator);
             }
+            document.AddMember("verify", frames, allocator);
         }
+        rapidjson::StringBuffer buffer;
+        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+        document.Accept(writer);
+        std::cout << buffer.GetString() << std::endl;
     }
 
     std::shared_ptr<System::TextSystem> _textSystem;
     std::vector<System::File::Info> _inputs;
+    size_t _threadCount = 1;
+    bool _recursive = false;
+    bool _json = false;
+    bool _verify = false;
+    AV::IO::VerifyOptions _verifyOptions;
+    bool _problems = false;
+    std::list<Probe> _probes;
 };
 
 DJV_MAIN()
@@ -6,6 +6,8 @@
 
 #include <djvAV/IOSystem.h>
 
+#include <djvMath/FrameNumberFunc.h>
+
 #include <djvSystem/Context.h>
 #include <djvSystem/FileInfoFunc.h>
 #include <djvSystem/PathFunc.h>
@@ -14,6 +16,12 @@
 #include <djvCore/ErrorFunc.h>
 #include <djvCore/StringFormat.h>
 
+#include <rapidjson/writer.h>
+
+#include <future>
+#include <list>
+#include <thread>
+
 using namespace djv;
 
 class Application : public CmdLine::Application
@@ -25,6 +33,8 @@ protected:
     {
         CmdLine::Application::_init(args);
 
+        _threadCount = threadCountDefault();
+
         _parseCmdLine(args);
 
         bool hasInputs = args.size();
@@ -64,32 +74,61 @@ public:
 
     void run() override
     {
-        auto io = getSystemT<AV::IO::IOSystem>();
         for (const auto& i : _inputs)
         {
             switch (i.getType())
             {
             case System::File::Type::File:
-                _print(std::string(i));
+                _print(i, false);
                 break;
             case System::File::Type::Directory:
+                _list(i.getPath());
+                break;
+            default: break;
+            }
+        }
+    }
+
+protected:
+    void _parseCmdLine(std::list<std::string>& args) override
+    {
+        CmdLine::Application::_parseCmdLine(args);
+        auto textSystem = getSystemT<System::TextSystem>();
+        auto i = args.begin();
+        while (i != args.end())
+        {
+            if ("-threads" == *i)
             {
-                std::cout << i.getPath() << ":" << std::endl;
-                System::File::DirectoryListOptions options;
-                options.sequences = true;
-                options.sequenceExtensions = io->getSequenceExtensions();
-                for (const auto& j : System::File::directoryList(i.getPath(), options))
+                i = args.erase(i);
+                if (args.end() == i)
                 {
-                    _print(j.getFileName(Math::Frame::invalid, false));
+                    throw std::runtime_error(Core::String::Format("{0}: {1}").
+                        arg("-threads").
+                        arg(textSystem->getText(DJV_TEXT("error_cannot_parse_argument"))));
                 }
-                break;
+                int value = 0;
+                std::stringstream ss(*i);
+                ss >> value;
+                i = args.erase(i);
+                _threadCount = static_cast<size_t>(std::max(value, 1));
             }
-            default: break;
+            else if ("-recursive" == *i)
+            {
+                i = args.erase(i);
+                _recursive = true;
+            }
+            else if ("-json" == *i)
+            {
+                i = args.erase(i);
+                _json = true;
+            }
+            else
+            {
+                ++i;
             }
         }
     }
 
-protected:
     void _printUsage() override
     {
         auto textSystem = getSystemT<System::TextSystem>();
@@ -100,6 +139,17 @@ protected:
         std::cout << std::endl;
         std::cout << "   " << textSystem->getText(DJV_TEXT("djv_ls_usage_format")) << std::endl;
         std::cout << std::endl;
+        std::cout << " " << textSystem->getText(DJV_TEXT("djv_ls_options")) << std::endl;
+        std::cout << std::endl;
+        std::cout << "   " << textSystem->getText(DJV_TEXT("djv_ls_option_threads")) << std::endl;
+        std::cout << "   " << textSystem->getText(DJV_TEXT("djv_ls_option_threads_description")) << threadCountDefault() << std::endl;
+        std::cout << std::endl;
+        std::cout << "   " << textSystem->getText(DJV_TEXT("djv_ls_option_recursive")) << std::endl;
+        std::cout << "   " << textSystem->getText(DJV_TEXT("djv_ls_option_recursive_description")) << std::endl;
+        std::cout << std::endl;
+        std::cout << "   " << textSystem->getText(DJV_TEXT("djv_ls_option_json")) << std::endl;
+        std::cout << "   " << textSystem->getText(DJV_TEXT("djv_ls_option_json_description")) << std::endl;
+        std::cout << std::endl;
 
         CmdLine::Application::_printUsage();
     }
@@ -107,10 +157,104 @@ protected:
     std::vector<System::File::Info> _inputs;
 
 private:
-    void _print(const std::string & fileName)
+    static size_t threadCountDefault()
     {
-        std::cout << fileName << std::endl;
+        return std::max(std::thread::hardware_concurrency(), 1U);
     }
+
+    //! List a directory and, when recursive, its sub-directories. Up to the
+    //! thread count directories are listed at the same time, and the results
+    //! are printed in order as they finish.
+    void _list(const System::File::Path& path)
+    {
+        auto io = getSystemT<AV::IO::IOSystem>();
+        System::File::DirectoryListOptions options;
+        options.sequences = true;
+        options.sequenceExtensions = io->getSequenceExtensions();
+        std::list<System::File::Path> directories = { path };
+        std::list<std::pair<System::File::Path, std::future<std::vector<System::File::Info> > > > futures;
+        while (directories.size() || futures.size())
+        {
+            while (directories.size() && futures.size() < _threadCount)
+            {
+                const System::File::Path directory = directories.front();
+                directories.pop_front();
+                futures.push_back(std::make_pair(
+                    directory,
+                    std::async(
+                        std::launch::async,
+                        [directory, options]
+                        {
+                            return System::File::directoryList(directory, options);
+                        })));
+            }
+            const System::File::Path directory = futures.front().first;
+            std::vector<System::File::Info> list;
+            try
+            {
+                list = futures.front().second.get();
+            }
+            catch (const std::exception& e)
+            {
+                std::cout << Core::Error::format(e) << std::endl;
+            }
+            futures.pop_front();
+            if (!_json)
+            {
+                std::cout << directory << ":" << std::endl;
+            }
+            for (const auto& i : list)
+            {
+                _print(i, true);
+                if (_recursive && System::File::Type::Directory == i.getType())
+                {
+                    directories.push_back(i.getPath());
+                }
+            }
+        }
+    }
+
+    void _print(const System::File::Info& fileInfo, bool directoryEntry)
+    {
+        if (_json)
+        {
+            _printJSON(fileInfo);
+        }
+        else if (directoryEntry)
+        {
+            std::cout << fileInfo.getFileName(Math::Frame::invalid, false) << std::endl;
+        }
+        else
+        {
+            std::cout << std::string(fileInfo) << std::endl;
+        }
+    }
+
+    //! Print the file information as a single line of JSON.
+    void _printJSON(const System::File::Info& fileInfo)
+    {
+        rapidjson::Document document;
+        document.SetObject();
+        auto& allocator = document.GetAllocator();
+        const std::string fileName = fileInfo.getFileName();
+        document.AddMember("fileName", rapidjson::Value(fileName.c_str(), fileName.size(), allocator), allocator);
+        document.AddMember("fileType", toJSON(fileInfo.getType(), allocator), allocator);
+        document.AddMember("byteCount", rapidjson::Value(static_cast<uint64_t>(fileInfo.getSize())), allocator);
+        if (System::File::Type::Sequence == fileInfo.getType())
+        {
+            document.AddMember("frames", toJSON(fileInfo.getSequence(), allocator), allocator);
+            document.AddMember("frameCount", rapidjson::Value(static_cast<uint64_t>(fileInfo.getSequence().getFrameCount())), allocator);
+            document.AddMember("missingFrames", toJSON(Math::Frame::getMissing(fileInfo.getSequence()), allocator), allocator);
+        }
+        rapidjson::StringBuffer buffer;
+        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+        document.Accept(writer);
+        std::cout << buffer.GetString() << std::endl;
+    }
+
+    size_t _threadCount = 1;
+    bool _recursive = false;
+    bool _json = false;
 };
 
 DJV_MAIN()
@@ -0,0 +1,210 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvCmdLineApp/Application.h>
+
+#include <djvAV/IOSystem.h>
+
+#include <djvImage/Data.h>
+#include <djvImage/DataFunc.h>
+
+#include <djvSystem/Context.h>
+#include <djvSystem/FileIO.h>
+#include <djvSystem/FileInfoFunc.h>
+#include <djvSystem/ResourcePack.h>
+#include <djvSystem/ResourceSystem.h>
+#include <djvSystem/TextSystem.h>
+
+#include <djvCore/ErrorFunc.h>
+#include <djvCore/StringFormat.h>
+
+#include <thread>
+
+using namespace djv;
+
+class Application : public CmdLine::Application
+{
+    DJV_NON_COPYABLE(Application);
+
+protected:
+    void _init(std::list<std::string>& args)
+    {
+        CmdLine::Application::_init(args);
+
+        _parseCmdLine(args);
+
+        if (args.size())
+        {
+            _output = args.front();
+            args.pop_front();
+        }
+        else if (0 == getExitCode())
+        {
+            _printUsage();
+            exit(1);
+        }
+    }
+
+    Application()
+    {}
+
+public:
+    static std::shared_ptr<Application> create(std::list<std::string>& args)
+    {
+        auto out = std::shared_ptr<Application>(new Application);
+        out->_init(args);
+        return out;
+    }
+
+    void run() override
+    {
+        auto resourceSystem = getSystemT<System::ResourceSystem>();
+        std::vector<std::pair<std::string, std::vector<uint8_t> > > entries;
+        try
+        {
+            // Add the fonts, shaders, and text as-is.
+            const std::vector<System::File::ResourcePath> resourcePaths =
+            {
+                System::File::ResourcePath::Fonts,
+                System::File::ResourcePath::Shaders,
+                System::File::ResourcePath::Text
+            };
+            for (const auto resourcePath : resourcePaths)
+            {
+                for (const auto& i : System::File::directoryList(resourceSystem->getPath(resourcePath)))
+                {
+                    if (System::File::Type::File == i.getType())
+                    {
+                        const std::string fileName = i.getPath().getFileName();
+                        entries.push_back(std::make_pair(
+                            System::ResourceSystem::getResourceName(resourcePath, fileName),
+                            _readFile(i.getPath())));
+                    }
+                }
+            }
+
+            // Add the icons pre-decoded.
+            auto io = getSystemT<AV::IO::IOSystem>();
+            const auto iconPath = resourceSystem->getPath(System::File::ResourcePath::Icons);
+            for (const auto& i : System::File::directoryList(iconPath))
+            {
+                const std::string dpi = i.getPath().getFileName();
+                if (System::File::Type::Directory == i.getType() &&
+                    dpi.size() > 3 &&
+                    0 == dpi.compare(dpi.size() - 3, 3, "DPI"))
+                {
+                    System::File::DirectoryListOptions options;
+                    options.extensions.insert(".png");
+                    for (const auto& j : System::File::directoryList(i.getPath(), options))
+                    {
+                        const auto& path = j.getPath();
+                        if (System::File::Type::File != j.getType())
+                        {
+                            continue;
+                        }
+                        if (auto image = _readImage(io, path))
+                        {
+                            std::vector<uint8_t> data(Image::getPackedByteCount(image->getInfo()));
+                            Image::pack(image, data.data());
+                            entries.push_back(std::make_pair(
+                                System::ResourceSystem::getResourceName(
+                                    System::File::ResourcePath::Icons,
+                                    dpi + "/" + path.getBaseName() + path.getNumber()),
+                                std::move(data)));
+                        }
+                    }
+                }
+            }
+
+            const size_t entryCount = entries.size();
+            System::File::writeResourcePack(_output, std::move(entries));
+            std::cout << _output << ": " << entryCount << std::endl;
+        }
+        catch (const std::exception& e)
+        {
+            std::cout << Core::Error::format(e) << std::endl;
+            exit(1);
+        }
+    }
+
+protected:
+    void _printUsage() override
+    {
+        auto textSystem = getSystemT<System::TextSystem>();
+        std::cout << std::endl;
+        std::cout << " " << textSystem->getText(DJV_TEXT("djv_resource_pack_description")) << std::endl;
+        std::cout << std::endl;
+        std::cout << " " << textSystem->getText(DJV_TEXT("djv_resource_pack_usage")) << std::endl;
+        std::cout << std::endl;
+        std::cout << "   " << textSystem->getText(DJV_TEXT("djv_resource_pack_usage_format")) << std::endl;
+        std::cout << std::endl;
+
+        CmdLine::Application::_printUsage();
+    }
+
+private:
+    std::vector<uint8_t> _readFile(const System::File::Path& path)
+    {
+        auto io = System::File::IO::create();
+        io->open(path.get(), System::File::Mode::Read);
+        std::vector<uint8_t> out(io->getSize());
+        if (out.size())
+        {
+            io->read(out.data(), out.size());
+        }
+        return out;
+    }
+
+    std::shared_ptr<Image::Data> _readImage(
+        const std::shared_ptr<AV::IO::IOSystem>& io,
+        const System::File::Path& path)
+    {
+        std::shared_ptr<Image::Data> out;
+        auto read = io->read(path);
+        while (!out)
+        {
+            {
+                std::lock_guard<std::mutex> lock(read->getMutex());
+                auto& queue = read->getVideoQueue();
+                if (!queue.isEmpty())
+                {
+                    out = queue.getFrame().data;
+                }
+                else if (queue.isFinished())
+                {
+                    throw System::File::Error(Core::String::Format("{0}: {1}").
+                        arg(path.get()).
+                        arg(getSystemT<System::TextSystem>()->getText(DJV_TEXT("error_file_read"))));
+                }
+            }
+            if (!out)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+        return out;
+    }
+
+    std::string _output;
+};
+
+DJV_MAIN()
+{
+    int r = 1;
+    try
+    {
+        auto args = Application::args(argc, argv);
+        auto app = Application::create(args);
+        if (0 == app->getExitCode())
+        {
+            app->run();
+        }
+        r = app->getExitCode();
+    }
+    catch (const std::exception& error)
+    {
+        std::cout << Core::Error::format(error) << std::endl;
+    }
+    return r;
+}
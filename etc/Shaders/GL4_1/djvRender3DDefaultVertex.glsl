@@ -4,9 +4,10 @@
 
 #version 410
 
-in vec3 aPos;
-in vec2 aTexture;
-in vec3 aNormal;
+layout(location = 0) in vec3 aPos;
+layout(location = 1) in vec2 aTexture;
+layout(location = 2) in vec3 aNormal;
+layout(location = 4) in mat4 aInstanceTransform;
 
 layout(location = 0) out vec3 Position;
 layout(location = 1) out vec2 Texture;
@@ -19,10 +20,21 @@ uniform struct Transform
     mat3 normals;
 } transform;
 
+uniform int instancing = 0;
+
 void main()
 {
-    gl_Position = transform.mvp * vec4(aPos, 1.0);
-    Position = vec3(transform.m * vec4(aPos, 1.0));
+    mat4 m = transform.m;
+    mat4 mvp = transform.mvp;
+    mat3 normals = transform.normals;
+    if (instancing != 0)
+    {
+        m = m * aInstanceTransform;
+        mvp = mvp * aInstanceTransform;
+        normals = normals * transpose(inverse(mat3(aInstanceTransform)));
+    }
+    gl_Position = mvp * vec4(aPos, 1.0);
+    Position = vec3(m * vec4(aPos, 1.0));
     Texture = aTexture;
-    Normal = vec3(transform.normals * aNormal);
+    Normal = vec3(normals * aNormal);
 }
@@ -5,12 +5,11 @@
 #version 410
 
 layout(location = 0) in vec3 Position;
+layout(location = 1) in vec4 Color;
 
 layout(location = 0) out vec4 FragColor;
 
-uniform vec4 color;
-
 void main()
 {
-    FragColor = color;
+    FragColor = Color;
 }
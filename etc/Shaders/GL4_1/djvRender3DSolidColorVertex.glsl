@@ -4,9 +4,12 @@
 
 #version 410
 
-in vec3 aPos;
+layout(location = 0) in vec3 aPos;
+layout(location = 4) in mat4 aInstanceTransform;
+layout(location = 8) in vec4 aInstanceColor;
 
 layout(location = 0) out vec3 Position;
+layout(location = 1) out vec4 Color;
 
 uniform struct Transform
 {
@@ -14,8 +17,21 @@ uniform struct Transform
     mat4 mvp;
 } transform;
 
+uniform vec4 color;
+uniform int  instancing = 0;
+
 void main()
 {
-    gl_Position = transform.mvp * vec4(aPos, 1.0);
-    Position = vec3(transform.m * vec4(aPos, 1.0));
+    if (instancing != 0)
+    {
+        gl_Position = transform.mvp * aInstanceTransform * vec4(aPos, 1.0);
+        Position = vec3(transform.m * aInstanceTransform * vec4(aPos, 1.0));
+        Color = aInstanceColor;
+    }
+    else
+    {
+        gl_Position = transform.mvp * vec4(aPos, 1.0);
+        Position = vec3(transform.m * vec4(aPos, 1.0));
+        Color = color;
+    }
 }
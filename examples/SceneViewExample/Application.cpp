@@ -8,6 +8,7 @@
 
 #include <djvUIComponents/UIComponentsSystem.h>
 
+#include <djvScene3D/LOD.h>
 #include <djvScene3D/Light.h>
 #include <djvScene3D/SceneSystem.h>
 
@@ -118,6 +119,17 @@ void Application::_open(const System::File::Info& fileInfo)
                                 //app->_scene->printPrimitives();
                                 //app->_scene->printLayers();
                                 app->_mainWindow->setScene(fileInfo, app->_scene);
+                                app->_sceneLODsFuture = app->_sceneRead->getLODs();
+                            }
+                            if (app->_sceneLODsFuture.valid() &&
+                                app->_sceneLODsFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+                            {
+                                const auto lods = app->_sceneLODsFuture.get();
+                                if (!lods.empty())
+                                {
+                                    Scene3D::LOD::apply(lods);
+                                    app->_mainWindow->updateScene();
+                                }
                             }
                         }
                         catch (const std::exception& e)
@@ -37,6 +37,7 @@ private:
     std::shared_ptr<djv::Scene3D::Scene> _scene;
     std::shared_ptr<djv::Scene3D::IO::IRead> _sceneRead;
     std::future<std::shared_ptr<djv::Scene3D::Scene> > _sceneReadFuture;
+    std::future<djv::Scene3D::LOD::PrimitiveLevels> _sceneLODsFuture;
 
     std::shared_ptr<djv::System::Timer> _futureTimer;
 
@@ -338,6 +338,11 @@ void MainWindow::setScene(
     _sceneWidget->frameView();
 }
 
+void MainWindow::updateScene()
+{
+    _sceneWidget->setScene(_sceneWidget->getScene());
+}
+
 void MainWindow::setOpenCallback(const std::function<void(const System::File::Info)>& value)
 {
     _openCallback = value;
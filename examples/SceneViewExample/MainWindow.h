@@ -41,6 +41,8 @@ public:
         const djv::System::File::Info&,
         const std::shared_ptr<djv::Scene3D::Scene>&);
 
+    void updateScene();
+
     void setOpenCallback(const std::function<void(const djv::System::File::Info)>&);
     void setReloadCallback(const std::function<void(void)>&);
     void setExitCallback(const std::function<void(void)>&);
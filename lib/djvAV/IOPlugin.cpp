@@ -116,6 +116,7 @@ namespace djv
             {
                 IIO::_init(fileInfo, options, textSystem, resourceSystem, logSystem);
                 _info = info;
+                _options = options;
             }
 
             IWrite::~IWrite()
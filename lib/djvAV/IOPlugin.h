@@ -6,6 +6,8 @@
 
 #include <djvAV/IO.h>
 
+#include <djvOCIO/OCIO.h>
+
 #include <djvSystem/FileInfo.h>
 
 namespace djv
@@ -157,6 +159,11 @@ namespace djv
             struct WriteOptions : IOOptions
             {
                 std::string colorSpace;
+
+                //! The color space conversion applied to images before they
+                //! are written. The conversion is done on the CPU so no OpenGL
+                //! context is required.
+                OCIO::Convert colorConvert;
             };
 
             //! This class provides the interface for writing.
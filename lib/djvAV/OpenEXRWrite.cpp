@@ -165,7 +165,12 @@ namespace djv
                     addDwaCompressionLevel(header, p.options.dwaCompressionLevel);
                     writeTags(image->getTags(), _info.videoSpeed, header);
 
-                    auto out = std::unique_ptr<Imf::OutputFile>(new Imf::OutputFile(fileName.c_str(), header));
+                    // Give each writer as many line buffers as threads so all
+                    // of the threads can compress chunks of the image at once.
+                    auto out = std::unique_ptr<Imf::OutputFile>(new Imf::OutputFile(
+                        fileName.c_str(),
+                        header,
+                        static_cast<int>(p.options.threadCount)));
                     const uint8_t* data = image->getData();
                     const uint8_t cb = Image::getByteCount(Image::getDataType(info.type));
                     Imf::FrameBuffer frameBuffer;
@@ -18,7 +18,23 @@ namespace djv
         {
             namespace PNG
             {
-                Plugin::Plugin()
+                bool Options::operator == (const Options& other) const
+                {
+                    return
+                        compressionLevel == other.compressionLevel &&
+                        threadCount == other.threadCount;
+                }
+
+                struct Plugin::Private
+                {
+                    Options options;
+                };
+
+                Plugin::Plugin() :
+                    _p(new Private)
+                {}
+
+                Plugin::~Plugin()
                 {}
 
                 std::shared_ptr<Plugin> Plugin::create(const std::shared_ptr<System::Context>& context)
@@ -32,6 +48,16 @@ namespace djv
                     return out;
                 }
 
+                rapidjson::Value Plugin::getOptions(rapidjson::Document::AllocatorType& allocator) const
+                {
+                    return toJSON(_p->options, allocator);
+                }
+
+                void Plugin::setOptions(const rapidjson::Value& value)
+                {
+                    fromJSON(value, _p->options);
+                }
+
                 std::shared_ptr<IRead> Plugin::read(const System::File::Info& fileInfo, const ReadOptions& options) const
                 {
                     return Read::create(fileInfo, options, _textSystem, _resourceSystem, _logSystem);
@@ -39,7 +65,7 @@ namespace djv
 
                 std::shared_ptr<IWrite> Plugin::write(const System::File::Info& fileInfo, const Info& info, const WriteOptions& options) const
                 {
-                    return Write::create(fileInfo, info, options, _textSystem, _resourceSystem, _logSystem);
+                    return Write::create(fileInfo, info, options, _p->options, _textSystem, _resourceSystem, _logSystem);
                 }
 
             } // namespace PNG
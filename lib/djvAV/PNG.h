@@ -23,6 +23,17 @@ namespace djv
                 static const std::string pluginName = "PNG";
                 static const std::set<std::string> fileExtensions = { ".png" };
 
+                //! This struct provides the PNG file I/O options.
+                struct Options
+                {
+                    int    compressionLevel = 6; //!< zlib compression level (0-9)
+
+                    //! The number of threads used to compress the image data.
+                    size_t threadCount      = 4;
+
+                    bool operator == (const Options&) const;
+                };
+
                 //! This struct provides a PNG error message.
                 struct ErrorStruct
                 {
@@ -71,6 +82,7 @@ namespace djv
                         const System::File::Info&,
                         const Info&,
                         const WriteOptions&,
+                        const Options&,
                         const std::shared_ptr<System::TextSystem>&,
                         const std::shared_ptr<System::ResourceSystem>&,
                         const std::shared_ptr<System::LogSystem>&);
@@ -92,10 +104,18 @@ namespace djv
                     Plugin();
 
                 public:
+                    ~Plugin() override;
+
                     static std::shared_ptr<Plugin> create(const std::shared_ptr<System::Context>&);
 
+                    rapidjson::Value getOptions(rapidjson::Document::AllocatorType&) const override;
+                    void setOptions(const rapidjson::Value&) override;
+
                     std::shared_ptr<IRead> read(const System::File::Info&, const ReadOptions&) const override;
                     std::shared_ptr<IWrite> write(const System::File::Info&, const Info&, const WriteOptions&) const override;
+
+                private:
+                    DJV_PRIVATE();
                 };
 
             } // namespace PNG
@@ -23,3 +23,39 @@ extern "C"
 
 } // extern "C"
 
+namespace djv
+{
+    rapidjson::Value toJSON(const AV::IO::PNG::Options& value, rapidjson::Document::AllocatorType& allocator)
+    {
+        rapidjson::Value out(rapidjson::kObjectType);
+        {
+            out.AddMember("CompressionLevel", rapidjson::Value(value.compressionLevel), allocator);
+            out.AddMember("ThreadCount", toJSON(value.threadCount, allocator), allocator);
+        }
+        return out;
+    }
+
+    void fromJSON(const rapidjson::Value& value, AV::IO::PNG::Options& out)
+    {
+        if (value.IsObject())
+        {
+            for (const auto& i : value.GetObject())
+            {
+                if (0 == strcmp("CompressionLevel", i.name.GetString()) && i.value.IsInt())
+                {
+                    out.compressionLevel = i.value.GetInt();
+                }
+                else if (0 == strcmp("ThreadCount", i.name.GetString()))
+                {
+                    fromJSON(i.value, out.threadCount);
+                }
+            }
+        }
+        else
+        {
+            //! \todo How can we translate this?
+            throw std::invalid_argument(DJV_TEXT("error_cannot_parse_the_value"));
+        }
+    }
+
+} // namespace djv
@@ -4,6 +4,10 @@
 
 #pragma once
 
+#include <djvAV/PNG.h>
+
+#include <djvCore/RapidJSONFunc.h>
+
 #include <png.h>
 
 extern "C"
@@ -12,3 +16,13 @@ extern "C"
     void djvPngWarning(png_structp, png_const_charp);
 
 } // extern "C"
+
+namespace djv
+{
+    rapidjson::Value toJSON(const AV::IO::PNG::Options&, rapidjson::Document::AllocatorType&);
+
+    //! Throws:
+    //! - std::exception
+    void fromJSON(const rapidjson::Value&, AV::IO::PNG::Options&);
+
+} // namespace djv
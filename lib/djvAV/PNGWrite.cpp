@@ -12,9 +12,16 @@
 #include <djvSystem/LogSystem.h>
 #include <djvSystem/TextSystem.h>
 
+#include <djvCore/MemoryFunc.h>
 #include <djvCore/StringFormat.h>
 #include <djvCore/StringFunc.h>
 
+#include <zlib.h>
+
+#include <algorithm>
+#include <cstring>
+#include <future>
+
 using namespace djv::Core;
 
 namespace djv
@@ -27,6 +34,7 @@ namespace djv
             {
                 struct Write::Private
                 {
+                    Options options;
                 };
 
                 Write::Write() :
@@ -42,11 +50,13 @@ namespace djv
                     const System::File::Info& fileInfo,
                     const Info& info,
                     const WriteOptions& writeOptions,
+                    const Options& options,
                     const std::shared_ptr<System::TextSystem>& textSystem,
                     const std::shared_ptr<System::ResourceSystem>& resourceSystem,
                     const std::shared_ptr<System::LogSystem>& logSystem)
                 {
                     auto out = std::shared_ptr<Write>(new Write);
+                    out->_p->options = options;
                     out->_init(fileInfo, info, writeOptions, textSystem, resourceSystem, logSystem);
                     return out;
                 }
@@ -105,7 +115,8 @@ namespace djv
                         FILE *              f,
                         png_structp         png,
                         png_infop *         pngInfo,
-                        const Image::Info & info)
+                        const Image::Info & info,
+                        int                 compressionLevel)
                     {
                         if (setjmp(png_jmpbuf(png)))
                         {
@@ -117,6 +128,7 @@ namespace djv
                             return false;
                         }
                         png_init_io(png, f);
+                        png_set_compression_level(png, compressionLevel);
 
                         int colorType = 0;
                         switch (info.getGLFormat())
@@ -169,6 +181,151 @@ namespace djv
                         return true;
                     }
 
+                    bool pngChunk(png_structp png, const char* name, const uint8_t* data, size_t size)
+                    {
+                        if (setjmp(png_jmpbuf(png)))
+                            return false;
+                        png_write_chunk(png, reinterpret_cast<png_const_bytep>(name), data, size);
+                        return true;
+                    }
+
+                    //! \todo Should this be configurable?
+                    const size_t bandRowsMin = 16;
+                    const size_t deflateChunk = 65536;
+
+                    //! This struct provides a band of compressed scanlines.
+                    struct Band
+                    {
+                        std::vector<uint8_t> data;
+                        size_t               dataSize = 0;
+                        uLong                adler    = 1;
+                        size_t               size     = 0;
+                        bool                 error    = false;
+                    };
+
+                    // Copy a scanline and convert it to big endian.
+                    void bandScanline(const Image::Data& image, uint16_t y, std::vector<uint8_t>& out)
+                    {
+                        const uint8_t* p = image.getData(y);
+                        if (Image::getBitDepth(image.getType()) > 8 && Memory::Endian::LSB == Memory::getEndian())
+                        {
+                            Memory::endian(p, out.data(), out.size() / 2, 2);
+                        }
+                        else
+                        {
+                            memcpy(out.data(), p, out.size());
+                        }
+                    }
+
+                    // Filter a scanline with the Paeth predictor.
+                    void bandFilter(const uint8_t* in, const uint8_t* prev, size_t size, size_t bpp, uint8_t* out)
+                    {
+                        out[0] = 4;
+                        ++out;
+                        for (size_t x = 0; x < size; ++x)
+                        {
+                            const int a = x >= bpp ? in[x - bpp] : 0;
+                            const int b = prev[x];
+                            const int c = x >= bpp ? prev[x - bpp] : 0;
+                            const int pa = std::abs(b - c);
+                            const int pb = std::abs(a - c);
+                            const int pc = std::abs(a + b - c - c);
+                            const int predictor = (pa <= pb && pa <= pc) ? a : (pb <= pc ? b : c);
+                            out[x] = static_cast<uint8_t>(in[x] - predictor);
+                        }
+                    }
+
+                    bool bandDeflate(z_stream& z, Band& band, int flush)
+                    {
+                        int r = Z_OK;
+                        do
+                        {
+                            if (band.data.size() - band.dataSize < deflateChunk)
+                            {
+                                band.data.resize(band.dataSize + deflateChunk);
+                            }
+                            z.next_out = band.data.data() + band.dataSize;
+                            z.avail_out = static_cast<uInt>(band.data.size() - band.dataSize);
+                            r = deflate(&z, flush);
+                            band.dataSize = band.data.size() - z.avail_out;
+                        } while (0 == z.avail_out && r != Z_STREAM_ERROR);
+                        return r != Z_STREAM_ERROR;
+                    }
+
+                    // Compress a band of scanlines into a raw deflate stream.
+                    // Bands other than the last end with a sync flush so they
+                    // can be concatenated.
+                    void bandCompress(
+                        const Image::Data& image,
+                        size_t             begin,
+                        size_t             end,
+                        bool               last,
+                        int                compressionLevel,
+                        Band&              band)
+                    {
+                        const size_t bpp = image.getPixelByteCount();
+                        const size_t size = image.getWidth() * bpp;
+                        std::vector<uint8_t> prev(size, 0);
+                        std::vector<uint8_t> scanline(size);
+                        std::vector<uint8_t> filtered(size + 1);
+                        if (begin > 0)
+                        {
+                            bandScanline(image, static_cast<uint16_t>(begin - 1), prev);
+                        }
+                        z_stream z;
+                        memset(&z, 0, sizeof(z_stream));
+                        if (deflateInit2(&z, compressionLevel, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+                        {
+                            band.error = true;
+                            return;
+                        }
+                        for (size_t y = begin; y < end && !band.error; ++y)
+                        {
+                            bandScanline(image, static_cast<uint16_t>(y), scanline);
+                            bandFilter(scanline.data(), prev.data(), size, bpp, filtered.data());
+                            band.adler = adler32(band.adler, filtered.data(), static_cast<uInt>(filtered.size()));
+                            band.size += filtered.size();
+                            z.next_in = filtered.data();
+                            z.avail_in = static_cast<uInt>(filtered.size());
+                            band.error = !bandDeflate(z, band, Z_NO_FLUSH);
+                            std::swap(scanline, prev);
+                        }
+                        if (!band.error)
+                        {
+                            band.error = !bandDeflate(z, band, last ? Z_FINISH : Z_SYNC_FLUSH);
+                        }
+                        deflateEnd(&z);
+                        band.data.resize(band.dataSize);
+                    }
+
+                    // Write the bands as IDAT chunks wrapped in a zlib header
+                    // and trailer.
+                    bool bandWrite(png_structp png, const std::vector<Band>& bands, int compressionLevel)
+                    {
+                        const uint8_t level =
+                            compressionLevel < 2 ? 0 :
+                            (compressionLevel < 6 ? 1 :
+                            (6 == compressionLevel ? 2 : 3));
+                        uint8_t header[2] = { 0x78, static_cast<uint8_t>(level << 6) };
+                        header[1] += 31 - (header[0] * 256 + header[1]) % 31;
+                        bool out = pngChunk(png, "IDAT", header, 2);
+                        uLong adler = 1;
+                        for (const auto& i : bands)
+                        {
+                            out &= pngChunk(png, "IDAT", i.data.data(), i.data.size());
+                            adler = adler32_combine(adler, i.adler, static_cast<z_off_t>(i.size));
+                        }
+                        const uint8_t trailer[4] =
+                        {
+                            static_cast<uint8_t>(adler >> 24),
+                            static_cast<uint8_t>(adler >> 16),
+                            static_cast<uint8_t>(adler >> 8),
+                            static_cast<uint8_t>(adler)
+                        };
+                        out &= pngChunk(png, "IDAT", trailer, 4);
+                        return out;
+                    }
+
                 } // namespace
 
                 Image::Type Write::_getImageType(Image::Type value) const
@@ -204,6 +361,8 @@ namespace djv
 
                 void Write::_write(const std::string& fileName, const std::shared_ptr<Image::Data>& image)
                 {
+                    DJV_PRIVATE_PTR();
+
                     // Open the file.
                     auto f = File::create();
                     if (!f->png)
@@ -225,7 +384,7 @@ namespace djv
                             arg(_textSystem->getText(DJV_TEXT("error_file_open"))));
                     }
                     const auto& info = image->getInfo();
-                    if (!pngOpen(f->f, f->png, &f->pngInfo, info))
+                    if (!pngOpen(f->f, f->png, &f->pngInfo, info, p.options.compressionLevel))
                     {
                         std::vector<std::string> messages;
                         messages.push_back(String::Format("{0}: {1}").
@@ -239,22 +398,60 @@ namespace djv
                     }
 
                     // Write the file.
-                    for (uint16_t y = 0; y < info.size.h; ++y)
+                    const size_t bandCount = std::min(
+                        std::max(p.options.threadCount, static_cast<size_t>(1)),
+                        std::max(static_cast<size_t>(info.size.h) / bandRowsMin, static_cast<size_t>(1)));
+                    bool r = true;
+                    if (bandCount > 1)
                     {
-                        if (!pngScanline(f->png, image->getData(y)))
+                        // Compress bands of scanlines in parallel, libpng is
+                        // only used for the header.
+                        std::vector<Band> bands(bandCount);
+                        const size_t bandRows = (info.size.h + bandCount - 1) / bandCount;
+                        std::vector<std::future<void> > futures;
+                        for (size_t i = 0; i < bandCount; ++i)
                         {
-                            std::vector<std::string> messages;
-                            messages.push_back(String::Format("{0}: {1}").
-                                arg(fileName).
-                                arg(_textSystem->getText(DJV_TEXT("error_write_scanline"))));
-                            for (const auto& i : f->pngError.messages)
-                            {
-                                messages.push_back(i);
-                            }
-                            throw System::File::Error(String::join(messages, ' '));
+                            const size_t begin = std::min(i * bandRows, static_cast<size_t>(info.size.h));
+                            const size_t end = std::min(begin + bandRows, static_cast<size_t>(info.size.h));
+                            const bool last = i == bandCount - 1;
+                            const int compressionLevel = p.options.compressionLevel;
+                            futures.push_back(std::async(
+                                std::launch::async,
+                                [&image, &bands, i, begin, end, last, compressionLevel]
+                                {
+                                    bandCompress(*image, begin, end, last, compressionLevel, bands[i]);
+                                }));
+                        }
+                        for (auto& i : futures)
+                        {
+                            i.get();
+                        }
+                        for (const auto& i : bands)
+                        {
+                            r &= !i.error;
                         }
+                        r = r && bandWrite(f->png, bands, p.options.compressionLevel);
+                    }
+                    else
+                    {
+                        for (uint16_t y = 0; y < info.size.h && r; ++y)
+                        {
+                            r = pngScanline(f->png, image->getData(y));
+                        }
+                    }
+                    if (!r)
+                    {
+                        std::vector<std::string> messages;
+                        messages.push_back(String::Format("{0}: {1}").
+                            arg(fileName).
+                            arg(_textSystem->getText(DJV_TEXT("error_write_scanline"))));
+                        for (const auto& i : f->pngError.messages)
+                        {
+                            messages.push_back(i);
+                        }
+                        throw System::File::Error(String::join(messages, ' '));
                     }
-                    if (!pngEnd(f->png, f->pngInfo))
+                    if (!(bandCount > 1 ? pngChunk(f->png, "IEND", nullptr, 0) : pngEnd(f->png, f->pngInfo)))
                     {
                         std::vector<std::string> messages;
                         messages.push_back(String::Format("{0}: {1}").
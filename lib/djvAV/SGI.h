@@ -53,11 +53,7 @@ namespace djv
                     std::shared_ptr<Image::Data> _readImage(const std::string& fileName) override;
 
                 private:
-                    Info _open(const std::string&, const std::shared_ptr<System::File::IO>&);
-
-                    bool _compression = false;
-                    std::vector<uint32_t> _rleOffset;
-                    std::vector<uint32_t> _rleSize;
+                    Info _open(const std::string&, const std::shared_ptr<System::File::IO>&, bool& compression);
                 };
                 
                 //! This class provides the SGI file I/O plugin.
@@ -10,6 +10,8 @@
 
 #include <djvCore/StringFormat.h>
 
+#include <atomic>
+
 using namespace djv::Core;
 
 namespace djv
@@ -43,7 +45,8 @@ namespace djv
                 Info Read::_readInfo(const std::string& fileName)
                 {
                     auto io = System::File::IO::create();
-                    return _open(fileName, io);
+                    bool compression = false;
+                    return _open(fileName, io, compression);
                 }
 
                 namespace
@@ -140,16 +143,17 @@ namespace djv
 
                     void planarInterleave(
                         const std::shared_ptr<Image::Data>& in,
-                        std::shared_ptr<Image::Data>& out)
+                        std::shared_ptr<Image::Data>& out,
+                        size_t yBegin,
+                        size_t yEnd)
                     {
                         const size_t w = out->getWidth();
-                        const size_t h = out->getHeight();
                         const size_t channels = Image::getChannelCount(out->getType());
                         const size_t pixelByteCount = out->getPixelByteCount();
                         const size_t channelByteCount = Image::getByteCount(Image::getDataType(out->getType()));
                         for (size_t c = 0; c < channels; ++c)
                         {
-                            for (size_t y = 0; y < h; ++y)
+                            for (size_t y = yBegin; y < yEnd; ++y)
                             {
                                 const uint8_t* inP = in->getData() + (c * in->getHeight() + y) * in->getWidth() * channelByteCount;
                                 uint8_t* outP = out->getData(0, y) + c * channelByteCount;
@@ -192,57 +196,78 @@ namespace djv
                 {
                     std::shared_ptr<Image::Data> out;
                     auto io = System::File::IO::create();
-                    const auto info = _open(fileName, io);
+                    bool compression = false;
+                    const auto info = _open(fileName, io, compression);
                     out = Image::Data::create(info.video[0]);
                     out->setPluginName(pluginName);
 
-                    const size_t pos = io->getPos();
-                    const size_t size = io->getSize() - pos;
                     const Image::Info& imageInfo = info.video[0];
+                    const size_t w = imageInfo.size.w;
+                    const size_t h = imageInfo.size.h;
                     const size_t channels = Image::getChannelCount(imageInfo.type);
                     const size_t bytes = Image::getByteCount(Image::getDataType(imageInfo.type));
                     const size_t dataByteCount = out->getDataByteCount();
                     std::shared_ptr<Image::Data> tmp = Image::Data::create(imageInfo);
-                    if (!_compression)
+                    if (!compression)
                     {
-                        if (1 == bytes)
-                        {
-                            io->readU8(tmp->getData(), dataByteCount);
-                        }
-                        else
-                        {
-                            io->read(tmp->getData(), size / bytes, bytes);
-                        }
+                        // The data is read without endian conversion since
+                        // the image layout is big endian.
+                        io->readU8(tmp->getData(), dataByteCount);
                     }
                     else
                     {
+                        // Read the scanline offset table, the offsets are
+                        // from the start of the file.
+                        std::vector<uint32_t> rleOffset(h * channels);
+                        io->readU32(rleOffset.data(), rleOffset.size());
+                        io->seek(h * channels * 4);
+                        const size_t pos = io->getPos();
+                        const size_t size = io->getSize() - pos;
                         std::vector<uint8_t> rleData(size);
                         io->read(rleData.data(), size / bytes, bytes);
-                        const uint8_t* inP = rleData.data();
-                        const uint8_t* end = inP + size;
-                        uint8_t* outP = tmp->getData();
-                        for (size_t c = 0; c < channels; ++c)
-                        {
-                            for (size_t y = 0; y < imageInfo.size.h; ++y, outP += imageInfo.size.w * bytes)
+
+                        // Each scanline is compressed separately so they can
+                        // be decoded in parallel.
+                        const uint8_t* const rleP = rleData.data();
+                        const uint8_t* const rleEnd = rleP + size;
+                        uint8_t* const outP = tmp->getData();
+                        const bool endian = io->hasEndianConversion();
+                        std::atomic<bool> error(false);
+                        _forEachRowBand(
+                            h * channels,
+                            [&rleOffset, rleP, rleEnd, outP, w, bytes, pos, size, endian, &error](size_t begin, size_t end)
                             {
-                                if (!readRle(
-                                    inP + _rleOffset[y + imageInfo.size.h * c] - pos,
-                                    end,
-                                    outP,
-                                    imageInfo.size.w,
-                                    bytes,
-                                    io->hasEndianConversion()))
+                                for (size_t i = begin; i < end && !error; ++i)
                                 {
-                                    throw System::File::Error(String::Format("{0}: {1}").
-                                        arg(fileName).
-                                        arg(_textSystem->getText(DJV_TEXT("error_read_scanline"))));
+                                    if (rleOffset[i] < pos ||
+                                        rleOffset[i] - pos >= size ||
+                                        !readRle(
+                                        rleP + (rleOffset[i] - pos),
+                                        rleEnd,
+                                        outP + i * w * bytes,
+                                        w,
+                                        bytes,
+                                        endian))
+                                    {
+                                        error = true;
+                                    }
                                 }
-                            }
+                            });
+                        if (error)
+                        {
+                            throw System::File::Error(String::Format("{0}: {1}").
+                                arg(fileName).
+                                arg(_textSystem->getText(DJV_TEXT("error_read_scanline"))));
                         }
                     }
 
                     // Interleave the image channels.
-                    planarInterleave(tmp, out);
+                    _forEachRowBand(
+                        h,
+                        [tmp, &out](size_t begin, size_t end)
+                        {
+                            planarInterleave(tmp, out, begin, end);
+                        });
 
                     return out;
                 }
@@ -331,12 +356,15 @@ namespace djv
                 
                 } // namespace
 
-                Info Read::_open(const std::string& fileName, const std::shared_ptr<System::File::IO>& io)
+                Info Read::_open(
+                    const std::string& fileName,
+                    const std::shared_ptr<System::File::IO>& io,
+                    bool& compression)
                 {
                     io->setEndianConversion(Memory::getEndian() != Memory::Endian::MSB);
                     io->open(fileName, System::File::Mode::Read);
                     Image::Info imageInfo;
-                    Header().read(io, imageInfo, _compression, _textSystem);
+                    Header().read(io, imageInfo, compression, _textSystem);
                     Info info;
                     info.fileName = fileName;
                     info.videoSpeed = _speed;
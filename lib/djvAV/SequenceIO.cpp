@@ -6,6 +6,8 @@
 
 #include <djvGL/ImageConvert.h>
 
+#include <djvOCIO/CPUProcessor.h>
+
 #include <djvAV/SpeedFunc.h>
 
 #include <djvSystem/Context.h>
@@ -23,7 +25,9 @@
 #define GLFW_INCLUDE_NONE
 #include <GLFW/glfw3.h>
 
+#include <algorithm>
 #include <future>
+#include <thread>
 
 using namespace djv::Core;
 
@@ -38,6 +42,9 @@ namespace djv
                 //! \todo Should this be configurable?
                 const double infoTimeout = 0.5;
 
+                //! \todo Should this be configurable?
+                const size_t rowBandMin = 32;
+
             } // namespace
 
             struct ISequenceRead::Future
@@ -56,6 +63,7 @@ namespace djv
                 Math::Frame::Number seek = Math::Frame::invalid;
                 std::thread thread;
                 std::atomic<bool> running;
+                std::atomic<size_t> imageThreadCount;
                 std::chrono::steady_clock::time_point infoTimer;
             };
 
@@ -69,6 +77,7 @@ namespace djv
                 IRead::_init(fileInfo, options, textSystem, resourceSystem, logSystem);
                 _speed = fromSpeed(getDefaultSpeed());
                 _p->running = true;
+                _p->imageThreadCount = 1;
                 _p->thread = std::thread(
                     [this]
                 {
@@ -144,6 +153,15 @@ namespace djv
                         {
                             _cache.clear();
                         }
+
+                        // Divide the hardware threads between the frames
+                        // being decoded in parallel.
+                        const size_t frameThreadCount = std::max(
+                            playback ? (threadCount / 2) : (cacheEnabled ? threadCount : 1),
+                            static_cast<size_t>(1));
+                        p.imageThreadCount = std::max(
+                            static_cast<size_t>(std::thread::hardware_concurrency()) / frameThreadCount,
+                            static_cast<size_t>(1));
                         if (info.video.size() && _options.layer < info.video.size())
                         {
                             const size_t dataByteCount = info.video[_options.layer].getDataByteCount();
@@ -282,6 +300,39 @@ namespace djv
                 return queue || seek || direction;
             }
 
+            size_t ISequenceRead::_getImageThreadCount() const
+            {
+                return _p->imageThreadCount;
+            }
+
+            void ISequenceRead::_forEachRowBand(size_t rowCount, const std::function<void(size_t, size_t)>& value) const
+            {
+                const size_t bandCount = std::max(
+                    std::min(_p->imageThreadCount.load(), rowCount / rowBandMin),
+                    static_cast<size_t>(1));
+                const size_t bandSize = (rowCount + bandCount - 1) / bandCount;
+                std::vector<std::future<void> > futures;
+                for (size_t i = 1; i < bandCount; ++i)
+                {
+                    const size_t begin = i * bandSize;
+                    if (begin < rowCount)
+                    {
+                        const size_t end = std::min(begin + bandSize, rowCount);
+                        futures.push_back(std::async(
+                            std::launch::async,
+                            [value, begin, end]
+                            {
+                                value(begin, end);
+                            }));
+                    }
+                }
+                value(0, std::min(bandSize, rowCount));
+                for (auto& i : futures)
+                {
+                    i.get();
+                }
+            }
+
             size_t ISequenceRead::_getQueueCount(size_t threadCount) const
             {
                 const size_t queueMax = _videoQueue.getMax() - _videoQueue.getCount();
@@ -508,6 +559,7 @@ namespace djv
                 Math::Frame::Number frameNumber = Math::Frame::invalid;
                 GLFWwindow * glfwWindow = nullptr;
                 std::shared_ptr<GL::ImageConvert> convert;
+                std::shared_ptr<OCIO::CPUProcessor> cpuProcessor;
                 std::thread thread;
                 std::atomic<bool> running;
             };
@@ -580,6 +632,10 @@ namespace djv
                         }
 
                         p.convert = GL::ImageConvert::create(_textSystem, _resourceSystem);
+                        if (_options.colorConvert.isValid())
+                        {
+                            p.cpuProcessor = OCIO::CPUProcessor::create();
+                        }
 
                         const auto timeout = System::getTimerValue(System::TimerValue::VeryFast);
                         while (p.running)
@@ -622,6 +678,10 @@ namespace djv
                                         ++p.frameNumber;
                                     }
                                     auto image = images[i];
+                                    if (p.cpuProcessor)
+                                    {
+                                        image = p.cpuProcessor->process(image, _options.colorConvert);
+                                    }
                                     const Image::Type imageType = _getImageType(image->getType());
                                     if (Image::Type::None == imageType)
                                     {
@@ -6,6 +6,8 @@
 
 #include <djvAV/IOPlugin.h>
 
+#include <functional>
+
 namespace djv
 {
     namespace AV
@@ -39,6 +41,18 @@ namespace djv
                 virtual std::shared_ptr<Image::Data> _readImage(const std::string& fileName) = 0;
                 void _finish();
 
+                //! Get the number of threads a plugin may use to decode the
+                //! rows of a single image. This is the hardware concurrency
+                //! divided by the number of frames being decoded in parallel,
+                //! so that intra-frame and inter-frame threads do not
+                //! oversubscribe the machine.
+                size_t _getImageThreadCount() const;
+
+                //! Split the rows of an image into bands and call the given
+                //! function for each band in parallel. The function is passed
+                //! the first row and one past the last row of the band.
+                void _forEachRowBand(size_t rowCount, const std::function<void(size_t, size_t)>&) const;
+
                 Math::IntRational _speed;
                 Math::Frame::Sequence _sequence;
 
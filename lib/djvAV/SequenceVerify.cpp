@@ -0,0 +1,267 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAV/SequenceVerify.h>
+
+#include <djvAV/IOSystem.h>
+
+#include <djvSystem/FileIO.h>
+
+#include <djvMath/FrameNumberFunc.h>
+
+#include <djvCore/MemoryFunc.h>
+
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <thread>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace IO
+        {
+            namespace
+            {
+                uint64_t getChecksum(const std::string& fileName)
+                {
+                    auto io = System::File::IO::create();
+                    io->open(fileName, System::File::Mode::Read);
+#if defined(DJV_MMAP)
+                    const uint8_t* p = io->mmapP();
+                    return Memory::xxHash64(p, io->mmapEnd() - p);
+#else // DJV_MMAP
+                    // Hash the file in chunks so that large frames are not
+                    // read into memory all at once.
+                    Memory::XXHash64State state;
+                    Memory::xxHash64Reset(state);
+                    std::vector<uint8_t> buf(static_cast<size_t>(Memory::megabyte));
+                    size_t size = io->getSize();
+                    while (size > 0)
+                    {
+                        const size_t chunk = std::min(size, buf.size());
+                        io->read(buf.data(), chunk);
+                        Memory::xxHash64Update(state, buf.data(), chunk);
+                        size -= chunk;
+                    }
+                    return Memory::xxHash64Digest(state);
+#endif // DJV_MMAP
+                }
+
+                void verifyFrame(
+                    const std::string& fileName,
+                    const VerifyOptions& options,
+                    const std::shared_ptr<IOSystem>& io,
+                    VerifyFrame& out)
+                {
+                    System::File::Info fileInfo(System::File::Path(fileName), false);
+                    if (!fileInfo.stat(&out.error))
+                    {
+                        out.status = VerifyStatus::Error;
+                        return;
+                    }
+                    out.size = fileInfo.getSize();
+                    try
+                    {
+                        if (options.checksums)
+                        {
+                            out.checksum = getChecksum(fileName);
+                        }
+                        switch (options.mode)
+                        {
+                        case VerifyMode::Header:
+                        {
+                            // A zero sized queue reads the header without
+                            // decoding any frames.
+                            ReadOptions readOptions;
+                            readOptions.videoQueueSize = 0;
+                            readOptions.audioQueueSize = 0;
+                            io->read(fileInfo, readOptions)->getInfo().get();
+                            break;
+                        }
+                        case VerifyMode::Decode:
+                        {
+                            auto read = io->read(fileInfo);
+                            read->getInfo().get();
+                            bool decoded = false;
+                            bool finished = false;
+                            while (!decoded && !finished)
+                            {
+                                {
+                                    std::lock_guard<std::mutex> lock(read->getMutex());
+                                    auto& queue = read->getVideoQueue();
+                                    if (!queue.isEmpty())
+                                    {
+                                        decoded = queue.popFrame().data != nullptr;
+                                        finished = true;
+                                    }
+                                    else
+                                    {
+                                        finished = queue.isFinished();
+                                    }
+                                }
+                                if (!finished)
+                                {
+                                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                                }
+                            }
+                            if (!decoded)
+                            {
+                                throw std::runtime_error("Cannot decode the frame.");
+                            }
+                            break;
+                        }
+                        default: break;
+                        }
+                    }
+                    catch (const std::exception& e)
+                    {
+                        out.status = VerifyStatus::Error;
+                        out.error = e.what();
+                    }
+                }
+
+            } // namespace
+
+            bool VerifyReport::hasProblems() const
+            {
+                bool out = missing.isValid();
+                for (const auto& i : frames)
+                {
+                    out |= i.status != VerifyStatus::OK;
+                }
+                return out;
+            }
+
+            Math::Frame::Sequence VerifyReport::getProblemIndices(const Math::Frame::Sequence& sequence) const
+            {
+                std::vector<Math::Frame::Index> indices;
+                for (const auto& i : missing.getRanges())
+                {
+                    const Math::Frame::Index index = sequence.getIndex(i.getMax() + 1);
+                    if (index != Math::Frame::invalidIndex)
+                    {
+                        indices.push_back(index);
+                    }
+                }
+                for (const auto& sequence2 : { truncated, errors })
+                {
+                    for (const auto& i : Math::Frame::toFrames(sequence2))
+                    {
+                        const Math::Frame::Index index = sequence.getIndex(i);
+                        if (index != Math::Frame::invalidIndex)
+                        {
+                            indices.push_back(index);
+                        }
+                    }
+                }
+                std::sort(indices.begin(), indices.end());
+                indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+                return Math::Frame::fromFrames(indices);
+            }
+
+            VerifyReport verify(
+                const System::File::Info& fileInfo,
+                const VerifyOptions& options,
+                const std::shared_ptr<IOSystem>& io)
+            {
+                VerifyReport out;
+
+                // Get the frames to verify.
+                std::vector<std::string> fileNames;
+                if (System::File::Type::Sequence == fileInfo.getType())
+                {
+                    const auto& sequence = fileInfo.getSequence();
+                    out.missing = Math::Frame::getMissing(sequence);
+                    for (const auto i : Math::Frame::toFrames(sequence))
+                    {
+                        VerifyFrame frame;
+                        frame.number = i;
+                        out.frames.push_back(frame);
+                        fileNames.push_back(fileInfo.getFileName(i));
+                    }
+                }
+                else
+                {
+                    out.frames.push_back(VerifyFrame());
+                    fileNames.push_back(fileInfo.getFileName());
+                }
+
+                // Verify the frames in parallel. Each thread takes the next
+                // frame until there are none left.
+                const size_t count = out.frames.size();
+                std::atomic<size_t> next(0);
+                std::vector<std::future<void> > futures;
+                const size_t threadCount = std::min(std::max(options.threadCount, static_cast<size_t>(1)), count);
+                for (size_t i = 0; i < threadCount; ++i)
+                {
+                    futures.push_back(std::async(
+                        std::launch::async,
+                        [&out, &fileNames, &options, &io, &next, count]
+                        {
+                            size_t index = next++;
+                            while (index < count && !(options.cancel && *options.cancel))
+                            {
+                                verifyFrame(fileNames[index], options, io, out.frames[index]);
+                                index = next++;
+                            }
+                        }));
+                }
+                for (auto& i : futures)
+                {
+                    i.get();
+                }
+                if (options.cancel && *options.cancel)
+                {
+                    out.cancelled = true;
+                    return out;
+                }
+
+                // Find the frames that are much smaller than the median, these
+                // are usually truncated by failed copies or renders.
+                std::vector<uint64_t> sizes;
+                for (const auto& i : out.frames)
+                {
+                    if (i.status != VerifyStatus::Error)
+                    {
+                        sizes.push_back(i.size);
+                    }
+                }
+                uint64_t median = 0;
+                if (sizes.size())
+                {
+                    std::nth_element(sizes.begin(), sizes.begin() + sizes.size() / 2, sizes.end());
+                    median = sizes[sizes.size() / 2];
+                }
+                std::vector<Math::Frame::Number> truncated;
+                std::vector<Math::Frame::Number> errors;
+                for (auto& i : out.frames)
+                {
+                    if (VerifyStatus::OK == i.status &&
+                        (0 == i.size || i.size < static_cast<uint64_t>(median * options.sizeOutlier)))
+                    {
+                        i.status = VerifyStatus::Truncated;
+                    }
+                    if (i.number != Math::Frame::invalid)
+                    {
+                        switch (i.status)
+                        {
+                        case VerifyStatus::Truncated: truncated.push_back(i.number); break;
+                        case VerifyStatus::Error: errors.push_back(i.number); break;
+                        default: break;
+                        }
+                    }
+                }
+                out.truncated = Math::Frame::fromFrames(truncated);
+                out.errors = Math::Frame::fromFrames(errors);
+
+                return out;
+            }
+
+        } // namespace IO
+    } // namespace AV
+} // namespace djv
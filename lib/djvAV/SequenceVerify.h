@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvSystem/FileInfo.h>
+
+#include <djvMath/FrameNumber.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace IO
+        {
+            class IOSystem;
+
+            //! This enumeration provides how thoroughly frames are verified.
+            enum class VerifyMode
+            {
+                Stat,   //!< Check that the frames exist and their sizes
+                Header, //!< Also read the frame headers
+                Decode  //!< Also decode the frames
+            };
+
+            //! This struct provides sequence verification options.
+            struct VerifyOptions
+            {
+                VerifyMode mode        = VerifyMode::Stat;
+                bool       checksums   = false;
+                size_t     threadCount = 4;
+
+                //! Frames smaller than this fraction of the median frame size
+                //! are reported as truncated.
+                float      sizeOutlier = .5F;
+
+                //! Set to true from another thread to stop the verification.
+                //! The frames that are already being checked are finished
+                //! first.
+                std::shared_ptr<std::atomic<bool> > cancel;
+            };
+
+            //! This enumeration provides the verification status of a frame.
+            enum class VerifyStatus
+            {
+                OK,
+                Truncated,
+                Error
+            };
+
+            //! This struct provides the verification results of a frame.
+            struct VerifyFrame
+            {
+                Math::Frame::Number number   = Math::Frame::invalid;
+                VerifyStatus        status   = VerifyStatus::OK;
+                uint64_t            size     = 0;
+                uint64_t            checksum = 0;
+                std::string         error;
+            };
+
+            //! This struct provides the verification results of a sequence.
+            struct VerifyReport
+            {
+                std::vector<VerifyFrame> frames;
+                Math::Frame::Sequence    missing;
+                Math::Frame::Sequence    truncated;
+                Math::Frame::Sequence    errors;
+                bool                     cancelled = false;
+
+                //! Get whether any problems were found.
+                bool hasProblems() const;
+
+                //! Get the frame indices of the problems, for display on a
+                //! timeline. Missing frames are not part of the sequence so
+                //! the frame following each gap is used instead.
+                Math::Frame::Sequence getProblemIndices(const Math::Frame::Sequence&) const;
+            };
+
+            //! Verify the frames of a file or file sequence. The frames are
+            //! checked in parallel and the checksums are XXH64 hashes of the
+            //! file contents.
+            //! Throws:
+            //! - std::exception
+            VerifyReport verify(
+                const System::File::Info&,
+                const VerifyOptions&,
+                const std::shared_ptr<IOSystem>&);
+
+        } // namespace IO
+    } // namespace AV
+} // namespace djv
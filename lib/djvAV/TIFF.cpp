@@ -18,7 +18,10 @@ namespace djv
             {
                 bool Options::operator == (const Options& other) const
                 {
-                    return compression == other.compression;
+                    return
+                        compression == other.compression &&
+                        compressionLevel == other.compressionLevel &&
+                        threadCount == other.threadCount;
                 }
                 
                 struct Plugin::Private
@@ -29,6 +29,7 @@ namespace djv
                     None,
                     RLE,
                     LZW,
+                    Deflate,
 
                     Count,
                     First
@@ -37,8 +38,13 @@ namespace djv
                 //! This struct provides the TIFF file I/O options.
                 struct Options
                 {
-                    Compression compression = Compression::LZW;
-                    
+                    Compression compression      = Compression::LZW;
+                    int         compressionLevel = 6; //!< Deflate compression level (1-9)
+
+                    //! The number of threads used to compress the strips. RLE
+                    //! and Deflate strips are compressed in parallel.
+                    size_t      threadCount      = 4;
+
                     bool operator == (const Options&) const;
                 };
 
@@ -67,6 +73,7 @@ namespace djv
                 private:
                     struct File;
                     Info _open(const std::string&, File&);
+                    void _readTiles(const std::string&, const File&, const std::shared_ptr<Image::Data>&);
                 };
                 
                 //! This class provides the TIFF file writer.
@@ -70,6 +70,8 @@ namespace djv
             const std::string& s = ss.str();
             out.AddMember("Compression", rapidjson::Value(s.c_str(), s.size(), allocator), allocator);
         }
+        out.AddMember("CompressionLevel", rapidjson::Value(value.compressionLevel), allocator);
+        out.AddMember("ThreadCount", toJSON(value.threadCount, allocator), allocator);
         return out;
     }
 
@@ -84,6 +86,14 @@ namespace djv
                     std::stringstream ss(i.value.GetString());
                     ss >> out.compression;
                 }
+                else if (0 == strcmp("CompressionLevel", i.name.GetString()) && i.value.IsInt())
+                {
+                    out.compressionLevel = i.value.GetInt();
+                }
+                else if (0 == strcmp("ThreadCount", i.name.GetString()))
+                {
+                    fromJSON(i.value, out.threadCount);
+                }
             }
         }
         else
@@ -98,7 +108,8 @@ namespace djv
         Compression,
         DJV_TEXT("tiff_compression_none"),
         DJV_TEXT("tiff_compression_rle"),
-        DJV_TEXT("tiff_compression_lzw"));
+        DJV_TEXT("tiff_compression_lzw"),
+        DJV_TEXT("tiff_compression_deflate"));
 
 } // namespace djv
 
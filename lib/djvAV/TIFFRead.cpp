@@ -12,6 +12,10 @@
 
 #include <djvCore/StringFormat.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
 using namespace djv::Core;
 
 namespace djv
@@ -33,10 +37,15 @@ namespace djv
                         }
                     }
 
-                    ::TIFF * f           = nullptr;
-                    bool     compression = false;
-                    bool     palette     = false;
-                    uint16 * colormap[3] = { nullptr, nullptr, nullptr };
+                    ::TIFF * f            = nullptr;
+                    bool     compression  = false;
+                    bool     palette      = false;
+                    bool     contiguous   = false;
+                    bool     tiled        = false;
+                    uint32   rowsPerStrip = 0;
+                    uint32   tileWidth    = 0;
+                    uint32   tileLength   = 0;
+                    uint16 * colormap[3]  = { nullptr, nullptr, nullptr };
                 };
 
                 Read::Read()
@@ -72,7 +81,56 @@ namespace djv
                     const auto info = _open(fileName, f);
                     out = Image::Data::create(info.video[0]);
                     out->setPluginName(pluginName);
-                    for (uint16_t y = 0; y < info.video[0].size.h; ++y)
+                    const uint16_t h = info.video[0].size.h;
+                    const uint16_t w = info.video[0].size.w;
+                    const int channelCount = static_cast<int>(Image::getChannelCount(info.video[0].type));
+                    if (f.tiled)
+                    {
+                        _readTiles(fileName, f, out);
+                        return out;
+                    }
+                    const tstrip_t stripCount = TIFFNumberOfStrips(f.f);
+                    if (!f.palette &&
+                        f.contiguous &&
+                        f.rowsPerStrip > 0 &&
+                        stripCount > 1 &&
+                        static_cast<size_t>(TIFFScanlineSize(f.f)) == out->getScanlineByteCount())
+                    {
+                        // Decode the strips in parallel, each band of strips
+                        // uses a separate file handle since libtiff handles
+                        // are not thread safe.
+                        const uint32 rowsPerStrip = f.rowsPerStrip;
+                        std::atomic<bool> error(false);
+                        _forEachRowBand(
+                            stripCount,
+                            [fileName, &out, rowsPerStrip, &error](size_t begin, size_t end)
+                            {
+                                File bandFile;
+                                bandFile.f = TIFFOpen(fileName.data(), "r");
+                                if (!bandFile.f)
+                                {
+                                    error = true;
+                                    return;
+                                }
+                                for (size_t strip = begin; strip < end && !error; ++strip)
+                                {
+                                    const uint16_t y = static_cast<uint16_t>(strip * rowsPerStrip);
+                                    if (TIFFReadEncodedStrip(bandFile.f, static_cast<tstrip_t>(strip), out->getData(y), -1) == -1)
+                                    {
+                                        error = true;
+                                        break;
+                                    }
+                                }
+                            });
+                        if (error)
+                        {
+                            throw System::File::Error(String::Format("{0}: {1}").
+                                arg(fileName).
+                                arg(_textSystem->getText(DJV_TEXT("error_read_scanline"))));
+                        }
+                        return out;
+                    }
+                    for (uint16_t y = 0; y < h; ++y)
                     {
                         if (TIFFReadScanline(f.f, (tdata_t *)out->getData(y), y) == -1)
                         {
@@ -84,14 +142,84 @@ namespace djv
                         {
                             readPalette(
                                 out->getData(y),
-                                info.video[0].size.w,
-                                static_cast<int>(Image::getChannelCount(info.video[0].type)),
+                                w,
+                                channelCount,
                                 f.colormap[0], f.colormap[1], f.colormap[2]);
                         }
                     }
                     return out;
                 }
 
+                void Read::_readTiles(const std::string& fileName, const File& f, const std::shared_ptr<Image::Data>& out)
+                {
+                    const uint32 w = out->getWidth();
+                    const uint32 h = out->getHeight();
+                    const uint32 tileWidth = f.tileWidth;
+                    const uint32 tileLength = f.tileLength;
+                    const bool palette = f.palette;
+                    const size_t pixelByteCount = palette ? 1 : out->getPixelByteCount();
+                    if (!f.contiguous ||
+                        0 == tileWidth ||
+                        0 == tileLength ||
+                        static_cast<size_t>(TIFFTileRowSize(f.f)) != tileWidth * pixelByteCount)
+                    {
+                        throw System::File::Error(String::Format("{0}: {1}").
+                            arg(fileName).
+                            arg(_textSystem->getText(DJV_TEXT("error_unsupported_image_type"))));
+                    }
+
+                    // Decode the tiles in parallel, each band of tiles uses a
+                    // separate file handle since libtiff handles are not
+                    // thread safe.
+                    const size_t tileColumnCount = (w + tileWidth - 1) / tileWidth;
+                    const size_t tileCount = tileColumnCount * ((h + tileLength - 1) / tileLength);
+                    std::atomic<bool> error(false);
+                    _forEachRowBand(
+                        tileCount,
+                        [fileName, &f, &out, w, h, tileWidth, tileLength, tileColumnCount, palette, pixelByteCount, &error]
+                        (size_t begin, size_t end)
+                        {
+                            File bandFile;
+                            bandFile.f = TIFFOpen(fileName.data(), "r");
+                            if (!bandFile.f)
+                            {
+                                error = true;
+                                return;
+                            }
+                            std::vector<uint8_t> tile(TIFFTileSize(bandFile.f));
+                            for (size_t i = begin; i < end && !error; ++i)
+                            {
+                                const uint32 x = static_cast<uint32>(i % tileColumnCount * tileWidth);
+                                const uint32 y = static_cast<uint32>(i / tileColumnCount * tileLength);
+                                if (TIFFReadTile(bandFile.f, tile.data(), x, y, 0, 0) == -1)
+                                {
+                                    error = true;
+                                    break;
+                                }
+
+                                // Copy the part of the tile that is inside the
+                                // image.
+                                const uint32 columns = std::min(tileWidth, w - x);
+                                const uint32 rows = std::min(tileLength, h - y);
+                                for (uint32 j = 0; j < rows; ++j)
+                                {
+                                    uint8_t* p = out->getData(static_cast<uint16_t>(x), static_cast<uint16_t>(y + j));
+                                    memcpy(p, tile.data() + j * tileWidth * pixelByteCount, columns * pixelByteCount);
+                                    if (palette)
+                                    {
+                                        readPalette(p, columns, 1, f.colormap[0], f.colormap[1], f.colormap[2]);
+                                    }
+                                }
+                            }
+                        });
+                    if (error)
+                    {
+                        throw System::File::Error(String::Format("{0}: {1}").
+                            arg(fileName).
+                            arg(_textSystem->getText(DJV_TEXT("error_read_scanline"))));
+                    }
+                }
+
                 Info Read::_open(const std::string& fileName, File& f)
                 {
 #if defined(DJV_PLATFORM_WINDOWS)
@@ -116,7 +244,8 @@ namespace djv
                     uint16   extraSamplesSize = 0;
                     uint16   orient           = 0;
                     uint16   compression      = 0;
-                    uint16   channels         = 0;
+                    uint16   planarConfig     = 0;
+                    uint32   rowsPerStrip     = 0;
                     TIFFGetFieldDefaulted(f.f, TIFFTAG_IMAGEWIDTH, &width);
                     TIFFGetFieldDefaulted(f.f, TIFFTAG_IMAGELENGTH, &height);
                     TIFFGetFieldDefaulted(f.f, TIFFTAG_PHOTOMETRIC, &photometric);
@@ -126,7 +255,8 @@ namespace djv
                     TIFFGetFieldDefaulted(f.f, TIFFTAG_EXTRASAMPLES, &extraSamplesSize, &extraSamples);
                     TIFFGetFieldDefaulted(f.f, TIFFTAG_ORIENTATION, &orient);
                     TIFFGetFieldDefaulted(f.f, TIFFTAG_COMPRESSION, &compression);
-                    TIFFGetFieldDefaulted(f.f, TIFFTAG_PLANARCONFIG, &channels);
+                    TIFFGetFieldDefaulted(f.f, TIFFTAG_PLANARCONFIG, &planarConfig);
+                    TIFFGetFieldDefaulted(f.f, TIFFTAG_ROWSPERSTRIP, &rowsPerStrip);
                     TIFFGetFieldDefaulted(f.f, TIFFTAG_COLORMAP, &f.colormap[0], &f.colormap[1], &f.colormap[2]);
 
                     Image::Type imageType = Image::Type::None;
@@ -168,6 +298,14 @@ namespace djv
 
                     f.compression = compression != COMPRESSION_NONE;
                     f.palette = PHOTOMETRIC_PALETTE == photometric;
+                    f.contiguous = PLANARCONFIG_CONTIG == planarConfig;
+                    f.tiled = TIFFIsTiled(f.f) != 0;
+                    f.rowsPerStrip = rowsPerStrip;
+                    if (f.tiled)
+                    {
+                        TIFFGetField(f.f, TIFFTAG_TILEWIDTH, &f.tileWidth);
+                        TIFFGetField(f.f, TIFFTAG_TILELENGTH, &f.tileLength);
+                    }
 
                     Image::Tags tags;
                     char * tag = 0;
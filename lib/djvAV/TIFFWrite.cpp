@@ -9,6 +9,12 @@
 
 #include <djvCore/StringFormat.h>
 
+#include <zlib.h>
+
+#include <algorithm>
+#include <atomic>
+#include <future>
+
 using namespace djv::Core;
 
 namespace djv
@@ -63,7 +69,73 @@ namespace djv
 
                         ::TIFF * f = nullptr;
                     };
-                }
+
+                    //! \todo Should this be configurable?
+                    const uint32 stripRows = 16;
+
+                    //! Compress a scanline with PackBits.
+                    void packBits(const uint8_t* in, size_t size, std::vector<uint8_t>& out)
+                    {
+                        size_t i = 0;
+                        while (i < size)
+                        {
+                            size_t run = 1;
+                            while (i + run < size && run < 128 && in[i + run] == in[i])
+                            {
+                                ++run;
+                            }
+                            if (run > 1)
+                            {
+                                out.push_back(static_cast<uint8_t>(257 - run));
+                                out.push_back(in[i]);
+                                i += run;
+                            }
+                            else
+                            {
+                                const size_t start = i;
+                                while (i < size && i - start < 128 && !(i + 1 < size && in[i] == in[i + 1]))
+                                {
+                                    ++i;
+                                }
+                                out.push_back(static_cast<uint8_t>(i - start - 1));
+                                out.insert(out.end(), in + start, in + i);
+                            }
+                        }
+                    }
+
+                    //! Compress a strip, returns false on error.
+                    bool compressStrip(
+                        const uint8_t*        in,
+                        size_t                rows,
+                        size_t                scanlineByteCount,
+                        Compression           compression,
+                        int                   compressionLevel,
+                        std::vector<uint8_t>& out)
+                    {
+                        bool r = true;
+                        switch (compression)
+                        {
+                        case Compression::RLE:
+                            for (size_t y = 0; y < rows; ++y, in += scanlineByteCount)
+                            {
+                                packBits(in, scanlineByteCount, out);
+                            }
+                            break;
+                        case Compression::Deflate:
+                        {
+                            const uLong size = static_cast<uLong>(rows * scanlineByteCount);
+                            uLongf outSize = compressBound(size);
+                            out.resize(outSize);
+                            r = Z_OK == compress2(out.data(), &outSize, in, size, compressionLevel);
+                            out.resize(outSize);
+                            break;
+                        }
+                        default: break;
+                        }
+                        return r;
+                    }
+
+                } // namespace
 
                 Image::Type Write::_getImageType(Image::Type value) const
                 {
@@ -105,6 +177,7 @@ namespace djv
 
                 void Write::_write(const std::string& fileName, const std::shared_ptr<Image::Data>& image)
                 {
+                    DJV_PRIVATE_PTR();
                     File f;
 #if defined(DJV_PLATFORM_WINDOWS)
                     f.f = TIFFOpen(fileName.data(), "w");
@@ -168,7 +241,7 @@ namespace djv
                         break;
                     default: break;
                     }
-                    switch (_p->options.compression)
+                    switch (p.options.compression)
                     {
                     case Compression::None:
                         compression = COMPRESSION_NONE;
@@ -179,6 +252,9 @@ namespace djv
                     case Compression::LZW:
                         compression = COMPRESSION_LZW;
                         break;
+                    case Compression::Deflate:
+                        compression = COMPRESSION_ADOBE_DEFLATE;
+                        break;
                     default: break;
                     }
                     TIFFSetField(f.f, TIFFTAG_IMAGEWIDTH, info.size.w);
@@ -191,6 +267,11 @@ namespace djv
                     TIFFSetField(f.f, TIFFTAG_ORIENTATION, ORIENTATION_TOPLEFT);
                     TIFFSetField(f.f, TIFFTAG_COMPRESSION, compression);
                     TIFFSetField(f.f, TIFFTAG_PLANARCONFIG, PLANARCONFIG_CONTIG);
+                    TIFFSetField(f.f, TIFFTAG_ROWSPERSTRIP, stripRows);
+                    if (Compression::Deflate == p.options.compression)
+                    {
+                        TIFFSetField(f.f, TIFFTAG_ZIPQUALITY, p.options.compressionLevel);
+                    }
 
                     std::string tag = _info.tags.get("Creator");
                     if (!tag.empty())
@@ -213,15 +294,73 @@ namespace djv
                         TIFFSetField(f.f, TIFFTAG_IMAGEDESCRIPTION, tag.data());
                     }
 
-                    for (uint16_t y = 0; y < info.size.h; ++y)
+                    // Write the strips. RLE and Deflate strips are compressed
+                    // in parallel and then written in order, the other
+                    // compression types are left to libtiff.
+                    const uint32 stripCount = (info.size.h + stripRows - 1) / stripRows;
+                    const size_t scanlineByteCount = image->getScanlineByteCount();
+                    const size_t threadCount = std::min(
+                        std::max(p.options.threadCount, static_cast<size_t>(1)),
+                        static_cast<size_t>(stripCount));
+                    const bool parallel =
+                        threadCount > 1 &&
+                        (Compression::RLE == p.options.compression || Compression::Deflate == p.options.compression);
+                    std::vector<std::vector<uint8_t> > strips(parallel ? stripCount : 0);
+                    std::atomic<bool> error(false);
+                    if (parallel)
+                    {
+                        std::atomic<size_t> next(0);
+                        std::vector<std::future<void> > futures;
+                        for (size_t i = 0; i < threadCount; ++i)
+                        {
+                            futures.push_back(std::async(
+                                std::launch::async,
+                                [&p, &image, &info, &strips, &next, &error, stripCount, scanlineByteCount]
+                                {
+                                    size_t strip = next++;
+                                    while (strip < stripCount && !error)
+                                    {
+                                        const uint16_t y = static_cast<uint16_t>(strip * stripRows);
+                                        const size_t rows = std::min(static_cast<size_t>(stripRows), static_cast<size_t>(info.size.h - y));
+                                        if (!compressStrip(
+                                            image->getData(y),
+                                            rows,
+                                            scanlineByteCount,
+                                            p.options.compression,
+                                            p.options.compressionLevel,
+                                            strips[strip]))
+                                        {
+                                            error = true;
+                                        }
+                                        strip = next++;
+                                    }
+                                }));
+                        }
+                        for (auto& i : futures)
+                        {
+                            i.get();
+                        }
+                    }
+                    for (uint32 strip = 0; strip < stripCount && !error; ++strip)
                     {
-                        if (TIFFWriteScanline(f.f, (tdata_t *)image->getData(y), y) == -1)
+                        const uint16_t y = static_cast<uint16_t>(strip * stripRows);
+                        const size_t rows = std::min(static_cast<size_t>(stripRows), static_cast<size_t>(info.size.h - y));
+                        if (parallel)
+                        {
+                            error = TIFFWriteRawStrip(f.f, strip, strips[strip].data(), strips[strip].size()) == -1;
+                            std::vector<uint8_t>().swap(strips[strip]);
+                        }
+                        else
                         {
-                            throw System::File::Error(String::Format("{0}: {1}").
-                                arg(fileName).
-                                arg(_textSystem->getText(DJV_TEXT("error_write_scanline"))));
+                            error = TIFFWriteEncodedStrip(f.f, strip, (tdata_t *)image->getData(y), rows * scanlineByteCount) == -1;
                         }
                     }
+                    if (error)
+                    {
+                        throw System::File::Error(String::Format("{0}: {1}").
+                            arg(fileName).
+                            arg(_textSystem->getText(DJV_TEXT("error_write_scanline"))));
+                    }
                 }
 
             } // namespace TIFF
@@ -176,16 +176,22 @@ namespace djv
 
                     if (_bgr)
                     {
-                        for (uint16_t y = 0; y < imageInfo.size.h; ++y)
-                        {
-                            uint8_t* p = out->getData(0, y);
-                            for (uint16_t x = 0; x < imageInfo.size.w; ++x, p += channels)
+                        const uint16_t w = imageInfo.size.w;
+                        _forEachRowBand(
+                            imageInfo.size.h,
+                            [&out, w, channels](size_t begin, size_t end)
                             {
-                                const uint8_t tmp = p[0];
-                                p[0] = p[2];
-                                p[2] = tmp;
-                            }
-                        }
+                                for (size_t y = begin; y < end; ++y)
+                                {
+                                    uint8_t* p = out->getData(0, static_cast<uint16_t>(y));
+                                    for (uint16_t x = 0; x < w; ++x, p += channels)
+                                    {
+                                        const uint8_t tmp = p[0];
+                                        p[0] = p[2];
+                                        p[2] = tmp;
+                                    }
+                                }
+                            });
                     }
 
                     return out;
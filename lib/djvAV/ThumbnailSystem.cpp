@@ -12,6 +12,7 @@
 
 #include <djvSystem/Context.h>
 #include <djvSystem/LogSystem.h>
+#include <djvSystem/MemorySystem.h>
 #include <djvSystem/ResourceSystem.h>
 #include <djvSystem/TextSystem.h>
 #include <djvSystem/TimerFunc.h>
@@ -23,6 +24,7 @@
 #define GLFW_INCLUDE_NONE
 #include <GLFW/glfw3.h>
 
+#include <algorithm>
 #include <atomic>
 #include <mutex>
 #include <thread>
@@ -41,6 +43,16 @@ namespace djv
             const size_t infoCacheMax    = 1000;
             const size_t imageCacheMax   = 1000;
 
+            size_t getByteCount(const std::vector<std::shared_ptr<Image::Data> >& value)
+            {
+                size_t out = 0;
+                for (const auto& i : value)
+                {
+                    out += i->getDataByteCount();
+                }
+                return out;
+            }
+
             struct InfoRequest
             {
                 InfoRequest() :
@@ -173,7 +185,11 @@ namespace djv
             std::atomic<float> infoCachePercentage;
             Memory::Cache<size_t, std::shared_ptr<Image::Data> > imageCache;
             std::atomic<float> imageCachePercentage;
+            std::atomic<size_t> imageCacheByteCount;
+            std::atomic<float> imageCacheScale;
             std::atomic<bool> clearCache;
+            std::shared_ptr<System::MemorySystem> memorySystem;
+            UID memoryCacheUID = 0;
             std::shared_ptr<Observer::Value<bool> > ioOptionsObserver;
 
             GLFWwindow * glfwWindow = nullptr;
@@ -196,6 +212,8 @@ namespace djv
             p.infoCachePercentage = 0.F;
             p.imageCache.setMax(imageCacheMax);
             p.imageCachePercentage = 0.F;
+            p.imageCacheByteCount = 0;
+            p.imageCacheScale = 1.F;
             p.clearCache = false;
 
 #if defined(DJV_GL_ES2)
@@ -266,6 +284,18 @@ namespace djv
                             p.infoCachePercentage = 0.F;
                             p.imageCache.clear();
                             p.imageCachePercentage = 0.F;
+                            p.imageCacheByteCount = 0;
+                        }
+
+                        const size_t imageCacheScaledMax = std::max(
+                            static_cast<size_t>(imageCacheMax * p.imageCacheScale),
+                            static_cast<size_t>(1));
+                        if (imageCacheScaledMax != p.imageCache.getMax())
+                        {
+                            std::vector<std::shared_ptr<Image::Data> > removed;
+                            p.imageCache.setMax(imageCacheScaledMax, removed);
+                            p.imageCachePercentage = p.imageCache.getPercentageUsed();
+                            p.imageCacheByteCount -= getByteCount(removed);
                         }
 
                         bool infoRequests  = p.pendingInfoRequests.size();
@@ -315,6 +345,31 @@ namespace djv
                     }
                 });
 
+            p.memorySystem = context->getSystemT<System::MemorySystem>();
+            if (p.memorySystem)
+            {
+                System::MemoryCacheData memoryCacheData;
+                memoryCacheData.name = DJV_TEXT("av_memory_cache_thumbnails");
+                memoryCacheData.priority = System::MemoryCachePriority::Low;
+                memoryCacheData.byteCount = [weak]
+                {
+                    size_t out = 0;
+                    if (auto system = weak.lock())
+                    {
+                        out = system->_p->imageCacheByteCount;
+                    }
+                    return out;
+                };
+                memoryCacheData.scale = [weak](float value)
+                {
+                    if (auto system = weak.lock())
+                    {
+                        system->_p->imageCacheScale = value;
+                    }
+                };
+                p.memoryCacheUID = p.memorySystem->addCache(memoryCacheData);
+            }
+
             _logInitTime();
         }
 
@@ -325,6 +380,10 @@ namespace djv
         ThumbnailSystem::~ThumbnailSystem()
         {
             DJV_PRIVATE_PTR();
+            if (p.memorySystem)
+            {
+                p.memorySystem->removeCache(p.memoryCacheUID);
+            }
             p.running = false;
             if (p.thread.joinable())
             {
@@ -620,8 +679,11 @@ namespace djv
                             convert->process(*image, info, *tmp);
                             image = tmp;
                         }
-                        p.imageCache.add(getImageCacheKey(i->fileInfo, i->size, i->type), image);
+                        std::vector<std::shared_ptr<Image::Data> > removed;
+                        p.imageCache.add(getImageCacheKey(i->fileInfo, i->size, i->type), image, removed);
                         p.imageCachePercentage = p.imageCache.getPercentageUsed();
+                        p.imageCacheByteCount += image->getDataByteCount();
+                        p.imageCacheByteCount -= getByteCount(removed);
                         i->promise.set_value(image);
                     }
                     catch (const std::exception&)
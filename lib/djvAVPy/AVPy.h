@@ -0,0 +1,13 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+namespace pybind11
+{
+    class module;
+
+} // pybind11
+
+void wrapAudio(pybind11::module&);
+void wrapImage(pybind11::module&);
+void wrapIO(pybind11::module&);
@@ -0,0 +1,76 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAVPy/AVPy.h>
+
+#include <djvAudio/Data.h>
+#include <djvAudio/TypeFunc.h>
+
+#include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
+#include <pybind11/stl.h>
+
+using namespace djv;
+
+namespace py = pybind11;
+
+namespace
+{
+    py::buffer_info getBufferInfo(const Audio::Data& data)
+    {
+        std::string format;
+        switch (data.getType())
+        {
+        case Audio::Type::S8:  format = "b"; break;
+        case Audio::Type::S16: format = "h"; break;
+        case Audio::Type::S32: format = "i"; break;
+        case Audio::Type::F32: format = "f"; break;
+        case Audio::Type::F64: format = "d"; break;
+        default: throw py::buffer_error("Invalid audio type.");
+        }
+        const ssize_t sampleCount = static_cast<ssize_t>(data.getSampleCount());
+        const ssize_t channelCount = data.getChannelCount();
+        const ssize_t byteCount = Audio::getByteCount(data.getType());
+        return py::buffer_info(
+            const_cast<uint8_t*>(data.getData()),
+            byteCount,
+            format,
+            2,
+            { sampleCount, channelCount },
+            { channelCount * byteCount, byteCount },
+            true);
+    }
+
+} // namespace
+
+void wrapAudio(pybind11::module& m)
+{
+    py::enum_<Audio::Type>(m, "Type")
+        .value("None", Audio::Type::None)
+        .value("S8", Audio::Type::S8)
+        .value("S16", Audio::Type::S16)
+        .value("S32", Audio::Type::S32)
+        .value("F32", Audio::Type::F32)
+        .value("F64", Audio::Type::F64);
+
+    py::class_<Audio::Info>(m, "Info")
+        .def(py::init<>())
+        .def_readwrite("name", &Audio::Info::name)
+        .def_readwrite("channelCount", &Audio::Info::channelCount)
+        .def_readwrite("type", &Audio::Info::type)
+        .def_readwrite("sampleRate", &Audio::Info::sampleRate)
+        .def_readwrite("codec", &Audio::Info::codec)
+        .def("isValid", &Audio::Info::isValid);
+
+    // The buffer protocol exposes the interleaved samples without copying
+    // them, see the image bindings.
+    py::class_<Audio::Data, std::shared_ptr<Audio::Data> >(m, "Data", py::buffer_protocol())
+        .def_buffer(&getBufferInfo)
+        .def("getInfo", &Audio::Data::getInfo)
+        .def("getChannelCount", &Audio::Data::getChannelCount)
+        .def("getType", &Audio::Data::getType)
+        .def("getSampleRate", &Audio::Data::getSampleRate)
+        .def("getSampleCount", &Audio::Data::getSampleCount)
+        .def("toNumPy", [](py::object self) { return py::array(self); });
+}
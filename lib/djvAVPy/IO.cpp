@@ -0,0 +1,149 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAVPy/AVPy.h>
+
+#include <djvAV/AVSystem.h>
+#include <djvAV/IOSystem.h>
+
+#include <djvSystem/Context.h>
+#include <djvSystem/FileInfo.h>
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <algorithm>
+#include <thread>
+
+using namespace djv;
+
+namespace py = pybind11;
+
+namespace
+{
+    //! This class provides batched reading of video frames.
+    class Reader
+    {
+    public:
+        Reader(const std::string& fileName, size_t layer) :
+            _fileInfo(fileName)
+        {
+            _context = getContext();
+            _io = _context->getSystemT<AV::IO::IOSystem>();
+            _options.layer = layer;
+            _info = _io->read(_fileInfo, _options)->getInfo().get();
+        }
+
+        const AV::IO::Info& getInfo() const
+        {
+            return _info;
+        }
+
+        //! Read the frames in the given range of indices. Frames that cannot
+        //! be read are returned as null pointers.
+        std::vector<std::shared_ptr<Image::Data> > readFrames(
+            Math::Frame::Index first,
+            Math::Frame::Index last,
+            size_t threadCount)
+        {
+            std::vector<std::shared_ptr<Image::Data> > out;
+            if (last < first)
+            {
+                return out;
+            }
+            const size_t count = static_cast<size_t>(last - first + 1);
+            out.resize(count);
+
+            // Use a new reader so the queue only contains the requested
+            // frames. The reader decodes half of its threads worth of frames
+            // in parallel during playback.
+            threadCount = std::max(threadCount, static_cast<size_t>(1));
+            AV::IO::ReadOptions options = _options;
+            options.videoQueueSize = std::min(count, threadCount);
+            auto read = _io->read(_fileInfo, options);
+            read->setThreadCount(threadCount * 2);
+            read->setPlayback(true);
+            read->seek(first, AV::IO::Direction::Forward);
+
+            // Frames are added to the queue in order, so once a frame past
+            // the end of the range is received any frames that are missing
+            // could not be read.
+            std::vector<bool> frames(count, false);
+            size_t received = 0;
+            bool finished = false;
+            while (received < count && !finished)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(read->getMutex());
+                    auto& queue = read->getVideoQueue();
+                    while (!queue.isEmpty() && !finished)
+                    {
+                        const auto frame = queue.popFrame();
+                        if (frame.frame > last)
+                        {
+                            finished = true;
+                        }
+                        else if (frame.frame >= first && !frames[frame.frame - first])
+                        {
+                            out[frame.frame - first] = frame.data;
+                            frames[frame.frame - first] = true;
+                            ++received;
+                        }
+                    }
+                    finished |= queue.isFinished();
+                }
+                if (received < count && !finished)
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+            }
+            return out;
+        }
+
+    private:
+        static std::shared_ptr<System::Context> getContext()
+        {
+            // Share one context between the readers.
+            static std::weak_ptr<System::Context> context;
+            auto out = context.lock();
+            if (!out)
+            {
+                out = System::Context::create("djvAVPy");
+                AV::AVSystem::create(out);
+                context = out;
+            }
+            return out;
+        }
+
+        std::shared_ptr<System::Context> _context;
+        std::shared_ptr<AV::IO::IOSystem> _io;
+        System::File::Info _fileInfo;
+        AV::IO::ReadOptions _options;
+        AV::IO::Info _info;
+    };
+
+} // namespace
+
+void wrapIO(pybind11::module& m)
+{
+    py::class_<AV::IO::Info>(m, "Info")
+        .def(py::init<>())
+        .def_readwrite("fileName", &AV::IO::Info::fileName)
+        .def_property_readonly("videoSpeed", [](const AV::IO::Info& value) { return value.videoSpeed.toFloat(); })
+        .def_property_readonly("videoFrameCount", [](const AV::IO::Info& value) { return value.videoSequence.getFrameCount(); })
+        .def_readwrite("video", &AV::IO::Info::video)
+        .def_readwrite("audio", &AV::IO::Info::audio)
+        .def_readwrite("audioSampleCount", &AV::IO::Info::audioSampleCount);
+
+    py::class_<Reader>(m, "Reader")
+        .def(py::init<const std::string&, size_t>(), py::arg("fileName"), py::arg("layer") = 0)
+        .def("getInfo", &Reader::getInfo)
+        .def(
+            "readFrames",
+            &Reader::readFrames,
+            py::arg("first"),
+            py::arg("last"),
+            py::arg("threadCount") = 4,
+            py::call_guard<py::gil_scoped_release>());
+}
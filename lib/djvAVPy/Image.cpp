@@ -0,0 +1,137 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAVPy/AVPy.h>
+
+#include <djvImage/Data.h>
+#include <djvImage/TypeFunc.h>
+
+#include <djvCore/MemoryFunc.h>
+
+#include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
+#include <pybind11/stl.h>
+
+using namespace djv;
+
+namespace py = pybind11;
+
+namespace
+{
+    std::string getFormat(Image::DataType type, Core::Memory::Endian endian)
+    {
+        std::string out;
+        switch (type)
+        {
+        case Image::DataType::U8:  out = "B"; break;
+        case Image::DataType::U10: out = "I"; break;
+        case Image::DataType::U16: out = "H"; break;
+        case Image::DataType::U32: out = "I"; break;
+        case Image::DataType::F16: out = "e"; break;
+        case Image::DataType::F32: out = "f"; break;
+        default: break;
+        }
+        if (endian != Core::Memory::getEndian() && type != Image::DataType::U8)
+        {
+            out = (Core::Memory::Endian::MSB == endian ? ">" : "<") + out;
+        }
+        return out;
+    }
+
+    // The const data accessors are used since images that wrap memory
+    // mapped files have no mutable data.
+    py::buffer_info getBufferInfo(const Image::Data& data)
+    {
+        const auto& info = data.getInfo();
+        const Image::DataType dataType = Image::getDataType(info.type);
+        const std::string format = getFormat(dataType, info.layout.endian);
+        if (format.empty())
+        {
+            throw py::buffer_error("Invalid image type.");
+        }
+        const ssize_t h = info.size.h;
+        const ssize_t w = info.size.w;
+        const ssize_t scanlineByteCount = static_cast<ssize_t>(data.getScanlineByteCount());
+        const ssize_t pixelByteCount = static_cast<ssize_t>(data.getPixelByteCount());
+
+        // The 10-bit type packs the pixel into a single 32-bit word, so it
+        // is exposed as a two dimensional array.
+        if (Image::DataType::U10 == dataType)
+        {
+            return py::buffer_info(
+                const_cast<uint8_t*>(data.getData()),
+                pixelByteCount,
+                format,
+                2,
+                { h, w },
+                { scanlineByteCount, pixelByteCount },
+                true);
+        }
+        const ssize_t channelCount = Image::getChannelCount(info.type);
+        const ssize_t channelByteCount = static_cast<ssize_t>(Image::getByteCount(dataType));
+        return py::buffer_info(
+            const_cast<uint8_t*>(data.getData()),
+            channelByteCount,
+            format,
+            3,
+            { h, w, channelCount },
+            { scanlineByteCount, pixelByteCount, channelByteCount },
+            true);
+    }
+
+} // namespace
+
+void wrapImage(pybind11::module& m)
+{
+    py::enum_<Image::Type>(m, "Type")
+        .value("None", Image::Type::None)
+        .value("L_U8", Image::Type::L_U8)
+        .value("L_U16", Image::Type::L_U16)
+        .value("L_U32", Image::Type::L_U32)
+        .value("L_F16", Image::Type::L_F16)
+        .value("L_F32", Image::Type::L_F32)
+        .value("LA_U8", Image::Type::LA_U8)
+        .value("LA_U16", Image::Type::LA_U16)
+        .value("LA_U32", Image::Type::LA_U32)
+        .value("LA_F16", Image::Type::LA_F16)
+        .value("LA_F32", Image::Type::LA_F32)
+        .value("RGB_U8", Image::Type::RGB_U8)
+        .value("RGB_U10", Image::Type::RGB_U10)
+        .value("RGB_U16", Image::Type::RGB_U16)
+        .value("RGB_U32", Image::Type::RGB_U32)
+        .value("RGB_F16", Image::Type::RGB_F16)
+        .value("RGB_F32", Image::Type::RGB_F32)
+        .value("RGBA_U8", Image::Type::RGBA_U8)
+        .value("RGBA_U16", Image::Type::RGBA_U16)
+        .value("RGBA_U32", Image::Type::RGBA_U32)
+        .value("RGBA_F16", Image::Type::RGBA_F16)
+        .value("RGBA_F32", Image::Type::RGBA_F32);
+
+    py::class_<Image::Info>(m, "Info")
+        .def(py::init<>())
+        .def_readwrite("name", &Image::Info::name)
+        .def_property_readonly("width", [](const Image::Info& value) { return value.size.w; })
+        .def_property_readonly("height", [](const Image::Info& value) { return value.size.h; })
+        .def_readwrite("pixelAspectRatio", &Image::Info::pixelAspectRatio)
+        .def_readwrite("type", &Image::Info::type)
+        .def_property_readonly("mirrorX", [](const Image::Info& value) { return value.layout.mirror.x; })
+        .def_property_readonly("mirrorY", [](const Image::Info& value) { return value.layout.mirror.y; })
+        .def_readwrite("codec", &Image::Info::codec)
+        .def("getAspectRatio", &Image::Info::getAspectRatio)
+        .def("isValid", &Image::Info::isValid)
+        .def("getDataByteCount", &Image::Info::getDataByteCount);
+
+    // The buffer protocol exposes the image data without copying it. The
+    // Python object holds a reference to the shared pointer so the data stays
+    // valid for as long as any array created from the buffer.
+    py::class_<Image::Data, std::shared_ptr<Image::Data> >(m, "Data", py::buffer_protocol())
+        .def_buffer(&getBufferInfo)
+        .def("getInfo", &Image::Data::getInfo)
+        .def("getWidth", &Image::Data::getWidth)
+        .def("getHeight", &Image::Data::getHeight)
+        .def("getType", &Image::Data::getType)
+        .def("getDataByteCount", &Image::Data::getDataByteCount)
+        .def("getPluginName", &Image::Data::getPluginName)
+        .def("toNumPy", [](py::object self) { return py::array(self); });
+}
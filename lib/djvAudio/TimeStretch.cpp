@@ -0,0 +1,457 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAudio/TimeStretch.h>
+
+#include <djvAudio/TypeFunc.h>
+
+#include <djvMath/Math.h>
+#include <djvMath/MathFunc.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#define _CONVERT(a) \
+    { \
+        const a##_T* inP = reinterpret_cast<const a##_T*>(data); \
+        for (size_t i = 0; i < size; ++i, ++inP, ++outP) \
+        { \
+            a##ToF32(*inP, *outP); \
+        } \
+    }
+
+namespace djv
+{
+    namespace Audio
+    {
+        namespace
+        {
+            //! \todo Should these be configurable?
+            const float windowSeconds = .03F;
+            const float seekSeconds   = .01F;
+            const float bufferSeconds = 2.F;
+            const size_t coarseSeek   = 4;
+
+            //! This class provides a buffer of interleaved samples that can be
+            //! appended to the back and consumed from the front.
+            //!
+            //! The memory is allocated up front so that the buffer can be
+            //! used from an audio callback. Consumed samples are reclaimed by
+            //! moving the remaining samples to the front when more space is
+            //! needed. The buffer only grows if the samples do not fit after
+            //! that, which means the initial size was too small.
+            class Buffer
+            {
+            public:
+                void init(uint8_t channelCount, size_t sampleCount)
+                {
+                    _channelCount = channelCount;
+                    _data.resize(sampleCount * channelCount);
+                    _offset = 0;
+                    _size = 0;
+                }
+
+                size_t getSampleCount() const
+                {
+                    return (_size - _offset) / _channelCount;
+                }
+
+                const F32_T* getData(size_t sample = 0) const
+                {
+                    return _data.data() + _offset + sample * _channelCount;
+                }
+
+                F32_T* append(size_t sampleCount)
+                {
+                    const size_t count = sampleCount * _channelCount;
+                    if (_size + count > _data.size() && _offset > 0)
+                    {
+                        memmove(_data.data(), _data.data() + _offset, (_size - _offset) * sizeof(F32_T));
+                        _size -= _offset;
+                        _offset = 0;
+                    }
+                    if (_size + count > _data.size())
+                    {
+                        _data.resize(_size + count);
+                    }
+                    F32_T* out = _data.data() + _size;
+                    _size += count;
+                    return out;
+                }
+
+                void consume(size_t sampleCount)
+                {
+                    _offset = std::min(_offset + sampleCount * _channelCount, _size);
+                    if (_offset == _size)
+                    {
+                        _offset = 0;
+                        _size = 0;
+                    }
+                }
+
+                void clear()
+                {
+                    _offset = 0;
+                    _size = 0;
+                }
+
+            private:
+                uint8_t _channelCount = 1;
+                std::vector<F32_T> _data;
+                size_t _offset = 0;
+                size_t _size = 0;
+            };
+
+            //! Compute the dot product of two arrays. Independent accumulators
+            //! are used so that the compiler can vectorize the loop.
+            F32_T dot(const F32_T* a, const F32_T* b, size_t size)
+            {
+                F32_T s0 = 0.F;
+                F32_T s1 = 0.F;
+                F32_T s2 = 0.F;
+                F32_T s3 = 0.F;
+                size_t i = 0;
+                for (; i + 3 < size; i += 4)
+                {
+                    s0 += a[i]     * b[i];
+                    s1 += a[i + 1] * b[i + 1];
+                    s2 += a[i + 2] * b[i + 2];
+                    s3 += a[i + 3] * b[i + 3];
+                }
+                for (; i < size; ++i)
+                {
+                    s0 += a[i] * b[i];
+                }
+                return (s0 + s1) + (s2 + s3);
+            }
+
+        } // namespace
+
+        struct TimeStretch::Private
+        {
+            uint8_t channelCount = 0;
+            size_t inputSampleRate = 0;
+            size_t outputSampleRate = 0;
+            float speed = 1.F;
+
+            Buffer input;
+            Buffer inputMono;
+
+            size_t overlapSize = 0;
+            size_t windowSize = 0;
+            size_t seekSize = 0;
+            std::vector<F32_T> window;
+            std::vector<F32_T> overlap;
+            double stretchPosition = 0.0;
+            size_t segment = 0;
+            bool first = true;
+
+            Buffer stretched;
+            double resamplePosition = 0.0;
+
+            double position = 0.0;
+
+            float correlate(size_t offset) const;
+            bool stretch();
+            size_t resample(F32_T*, size_t sampleCount);
+        };
+
+        void TimeStretch::_init(uint8_t channelCount, size_t inputSampleRate, size_t outputSampleRate)
+        {
+            DJV_PRIVATE_PTR();
+            p.channelCount = std::max(channelCount, static_cast<uint8_t>(1));
+            p.inputSampleRate = std::max(inputSampleRate, static_cast<size_t>(1));
+            p.outputSampleRate = std::max(outputSampleRate, static_cast<size_t>(1));
+
+            const size_t bufferSampleCount = static_cast<size_t>(p.inputSampleRate * bufferSeconds);
+            p.input.init(p.channelCount, bufferSampleCount);
+            p.inputMono.init(1, bufferSampleCount);
+            p.stretched.init(p.channelCount, bufferSampleCount);
+
+            // The window is split into two halves that are cross-faded with
+            // the neighboring windows. The rising half uses a squared sine so
+            // that it sums to one with the falling half.
+            p.overlapSize = std::max(static_cast<size_t>(p.inputSampleRate * windowSeconds / 2.F), static_cast<size_t>(1));
+            p.windowSize = p.overlapSize * 2;
+            p.seekSize = static_cast<size_t>(p.inputSampleRate * seekSeconds);
+            p.window.resize(p.overlapSize);
+            for (size_t i = 0; i < p.overlapSize; ++i)
+            {
+                const float s = sinf((i + .5F) / static_cast<float>(p.overlapSize) * Math::pi / 2.F);
+                p.window[i] = s * s;
+            }
+            p.overlap.resize(p.overlapSize * p.channelCount);
+
+            reset();
+        }
+
+        TimeStretch::TimeStretch() :
+            _p(new Private)
+        {}
+
+        TimeStretch::~TimeStretch()
+        {}
+
+        std::shared_ptr<TimeStretch> TimeStretch::create(
+            uint8_t channelCount,
+            size_t inputSampleRate,
+            size_t outputSampleRate)
+        {
+            auto out = std::shared_ptr<TimeStretch>(new TimeStretch);
+            out->_init(channelCount, inputSampleRate, outputSampleRate);
+            return out;
+        }
+
+        uint8_t TimeStretch::getChannelCount() const
+        {
+            return _p->channelCount;
+        }
+
+        size_t TimeStretch::getInputSampleRate() const
+        {
+            return _p->inputSampleRate;
+        }
+
+        size_t TimeStretch::getOutputSampleRate() const
+        {
+            return _p->outputSampleRate;
+        }
+
+        float TimeStretch::getSpeed() const
+        {
+            return _p->speed;
+        }
+
+        void TimeStretch::setSpeed(float value)
+        {
+            _p->speed = std::max(value, .01F);
+        }
+
+        void TimeStretch::addInput(const uint8_t* data, size_t size, Type type)
+        {
+            DJV_PRIVATE_PTR();
+            const size_t channelCount = static_cast<size_t>(p.channelCount);
+            F32_T* const out = p.input.append(size);
+            F32_T* outP = out;
+            size *= channelCount;
+            switch (type)
+            {
+            case Type::S8:  _CONVERT(S8);  break;
+            case Type::S16: _CONVERT(S16); break;
+            case Type::S32: _CONVERT(S32); break;
+            case Type::F32: memcpy(out, data, size * sizeof(F32_T)); break;
+            case Type::F64: _CONVERT(F64); break;
+            default: memset(out, 0, size * sizeof(F32_T)); break;
+            }
+
+            // Mix the channels down to mono for the waveform similarity search.
+            size /= channelCount;
+            F32_T* monoP = p.inputMono.append(size);
+            const F32_T* inP = out;
+            const F32_T scale = 1.F / static_cast<F32_T>(channelCount);
+            for (size_t i = 0; i < size; ++i, ++monoP)
+            {
+                F32_T sum = 0.F;
+                for (size_t c = 0; c < channelCount; ++c, ++inP)
+                {
+                    sum += *inP;
+                }
+                *monoP = sum * scale;
+            }
+        }
+
+        size_t TimeStretch::getInputSampleCount() const
+        {
+            return _p->input.getSampleCount();
+        }
+
+        size_t TimeStretch::render(F32_T* data, size_t sampleCount)
+        {
+            DJV_PRIVATE_PTR();
+            size_t out = 0;
+            while (out < sampleCount)
+            {
+                out += p.resample(data + out * p.channelCount, sampleCount - out);
+                if (out < sampleCount && !p.stretch())
+                {
+                    break;
+                }
+            }
+            p.position += out * (p.inputSampleRate / static_cast<double>(p.outputSampleRate)) * p.speed;
+            return out;
+        }
+
+        double TimeStretch::getPosition() const
+        {
+            return _p->position;
+        }
+
+        void TimeStretch::reset()
+        {
+            DJV_PRIVATE_PTR();
+            p.input.clear();
+            p.inputMono.clear();
+            std::fill(p.overlap.begin(), p.overlap.end(), 0.F);
+            p.stretchPosition = 0.0;
+            p.segment = 0;
+            p.first = true;
+            p.stretched.clear();
+            p.resamplePosition = 0.0;
+            p.position = 0.0;
+        }
+
+        float TimeStretch::Private::correlate(size_t offset) const
+        {
+            // Compare the start of the candidate segment with the part of the
+            // input that follows the previous segment.
+            const F32_T* reference = inputMono.getData(segment + overlapSize);
+            const F32_T* candidate = inputMono.getData(offset);
+            const F32_T energy = dot(candidate, candidate, overlapSize);
+            return dot(reference, candidate, overlapSize) / sqrtf(energy + std::numeric_limits<F32_T>::epsilon());
+        }
+
+        bool TimeStretch::Private::stretch()
+        {
+            const size_t inputCount = input.getSampleCount();
+            if (1.F == speed)
+            {
+                if (0 == inputCount)
+                {
+                    return false;
+                }
+                memcpy(stretched.append(inputCount), input.getData(), inputCount * channelCount * sizeof(F32_T));
+                input.consume(inputCount);
+                inputMono.consume(inputCount);
+                return true;
+            }
+
+            // Find the segment closest to the nominal position that best
+            // continues the previous segment.
+            const size_t nominal = static_cast<size_t>(stretchPosition + .5);
+            size_t best = nominal;
+            if (first)
+            {
+                if (nominal + windowSize > inputCount)
+                {
+                    return false;
+                }
+            }
+            else
+            {
+                const size_t min = nominal > seekSize ? (nominal - seekSize) : 0;
+                const size_t max = nominal + seekSize;
+                if (max + windowSize > inputCount)
+                {
+                    return false;
+                }
+                float bestScore = -std::numeric_limits<float>::max();
+                for (size_t i = min; i <= max; i += coarseSeek)
+                {
+                    const float score = correlate(i);
+                    if (score > bestScore)
+                    {
+                        bestScore = score;
+                        best = i;
+                    }
+                }
+                const size_t fineMin = best > min + coarseSeek ? (best - coarseSeek + 1) : min;
+                const size_t fineMax = std::min(best + coarseSeek - 1, max);
+                for (size_t i = fineMin; i <= fineMax; ++i)
+                {
+                    const float score = correlate(i);
+                    if (score > bestScore)
+                    {
+                        bestScore = score;
+                        best = i;
+                    }
+                }
+            }
+
+            // Overlap-add the first half of the segment with the second half
+            // of the previous segment.
+            const F32_T* in = input.getData(best);
+            F32_T* out = stretched.append(overlapSize);
+            const F32_T* overlapP = overlap.data();
+            for (size_t i = 0; i < overlapSize; ++i)
+            {
+                const F32_T w = window[i];
+                for (size_t c = 0; c < channelCount; ++c, ++in, ++out, ++overlapP)
+                {
+                    *out = *overlapP + *in * w;
+                }
+            }
+            F32_T* overlapP2 = overlap.data();
+            for (size_t i = 0; i < overlapSize; ++i)
+            {
+                const F32_T w = 1.F - window[i];
+                for (size_t c = 0; c < channelCount; ++c, ++in, ++overlapP2)
+                {
+                    *overlapP2 = *in * w;
+                }
+            }
+            first = false;
+            segment = best;
+            stretchPosition += overlapSize * static_cast<double>(speed);
+
+            // Discard the input that is no longer needed.
+            const size_t next = static_cast<size_t>(stretchPosition + .5);
+            const size_t discard = std::min(segment, next > seekSize ? (next - seekSize) : 0);
+            input.consume(discard);
+            inputMono.consume(discard);
+            segment -= discard;
+            stretchPosition -= discard;
+            return true;
+        }
+
+        size_t TimeStretch::Private::resample(F32_T* data, size_t sampleCount)
+        {
+            const size_t stretchedCount = stretched.getSampleCount();
+            if (inputSampleRate == outputSampleRate)
+            {
+                const size_t size = std::min(sampleCount, stretchedCount);
+                memcpy(data, stretched.getData(), size * channelCount * sizeof(F32_T));
+                stretched.consume(size);
+                return size;
+            }
+
+            // Cubic (Catmull-Rom) interpolation.
+            const double ratio = inputSampleRate / static_cast<double>(outputSampleRate);
+            const F32_T* in = stretched.getData();
+            F32_T* out = data;
+            size_t size = 0;
+            for (; size < sampleCount; ++size)
+            {
+                const size_t i = static_cast<size_t>(resamplePosition);
+                if (i + 2 >= stretchedCount)
+                {
+                    break;
+                }
+                const F32_T f = static_cast<F32_T>(resamplePosition - i);
+                const F32_T* y0 = in + (i > 0 ? (i - 1) : 0) * channelCount;
+                const F32_T* y1 = in + i * channelCount;
+                const F32_T* y2 = y1 + channelCount;
+                const F32_T* y3 = y2 + channelCount;
+                for (size_t c = 0; c < channelCount; ++c, ++out)
+                {
+                    const F32_T c1 = .5F * (y2[c] - y0[c]);
+                    const F32_T c2 = y0[c] - 2.5F * y1[c] + 2.F * y2[c] - .5F * y3[c];
+                    const F32_T c3 = .5F * (y3[c] - y0[c]) + 1.5F * (y1[c] - y2[c]);
+                    *out = ((c3 * f + c2) * f + c1) * f + y1[c];
+                }
+                resamplePosition += ratio;
+            }
+
+            // Keep one sample of history for the interpolation.
+            const size_t i = static_cast<size_t>(resamplePosition);
+            const size_t discard = std::min(i > 0 ? (i - 1) : 0, stretchedCount);
+            stretched.consume(discard);
+            resamplePosition -= discard;
+            return size;
+        }
+
+    } // namespace Audio
+} // namespace djv
@@ -0,0 +1,87 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvAudio/Type.h>
+
+#include <memory>
+
+namespace djv
+{
+    namespace Audio
+    {
+        //! This class provides real-time time-stretching and sample rate
+        //! conversion of audio data.
+        //!
+        //! Speed changes use WSOLA (waveform similarity overlap-add) so that
+        //! the pitch is preserved, and sample rate conversion uses cubic
+        //! interpolation. Input is interleaved audio of any type, output is
+        //! interleaved 32-bit floating point audio at the output sample rate.
+        //!
+        //! Memory is allocated up front so that rendering can be done from
+        //! an audio callback. This class is not thread safe.
+        class TimeStretch
+        {
+            DJV_NON_COPYABLE(TimeStretch);
+            void _init(uint8_t channelCount, size_t inputSampleRate, size_t outputSampleRate);
+            TimeStretch();
+
+        public:
+            ~TimeStretch();
+
+            static std::shared_ptr<TimeStretch> create(
+                uint8_t channelCount,
+                size_t inputSampleRate,
+                size_t outputSampleRate);
+
+            //! \name Information
+            ///@{
+
+            uint8_t getChannelCount() const;
+            size_t getInputSampleRate() const;
+            size_t getOutputSampleRate() const;
+
+            ///@}
+
+            //! \name Speed
+            ///@{
+
+            float getSpeed() const;
+
+            //! Set the speed, where 1.0 is normal speed. Changing the speed
+            //! while audio is buffered may cause a discontinuity, call reset()
+            //! first to avoid this.
+            void setSpeed(float);
+
+            ///@}
+
+            //! \name Processing
+            ///@{
+
+            //! Add input audio data.
+            void addInput(const uint8_t*, size_t sampleCount, Type);
+
+            //! Get the number of buffered input samples.
+            size_t getInputSampleCount() const;
+
+            //! Render output audio data. The return value is the number of
+            //! samples rendered, which is less than requested when more input
+            //! is needed.
+            size_t render(F32_T*, size_t sampleCount);
+
+            //! Get the input position of the rendered output in samples.
+            double getPosition() const;
+
+            //! Clear the buffered audio and reset the position.
+            void reset();
+
+            ///@}
+
+        private:
+            DJV_PRIVATE();
+        };
+
+    } // namespace Audio
+} // namespace djv
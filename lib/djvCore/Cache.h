@@ -31,6 +31,9 @@ namespace djv
 
                 void setMax(size_t);
 
+                //! Set the maximum size and get the values that were removed.
+                void setMax(size_t, std::vector<U>& removed);
+
                 ///@}
 
                 //! \name Contents
@@ -40,6 +43,10 @@ namespace djv
                 bool get(const T& key, U& value) const;
                 
                 void add(const T& key, const U& value);
+
+                //! Add a value and get the values that were removed to make
+                //! room for it, including the value it replaced.
+                void add(const T& key, const U& value, std::vector<U>& removed);
                 void remove(const T& key);
                 void clear();
 
@@ -49,7 +56,7 @@ namespace djv
                 ///@}
 
             private:
-                void _maxUpdate();
+                void _maxUpdate(std::vector<U>* removed = nullptr);
 
                 size_t _max = 10000;
                 std::map<T, U> _map;
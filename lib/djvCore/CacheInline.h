@@ -35,6 +35,13 @@ namespace djv
                 _maxUpdate();
             }
 
+            template<typename T, typename U>
+            inline void Cache<T, U>::setMax(size_t value, std::vector<U>& removed)
+            {
+                _max = value;
+                _maxUpdate(&removed);
+            }
+
             template<typename T, typename U>
             inline bool Cache<T, U>::contains(const T& key) const
             {
@@ -68,6 +75,24 @@ namespace djv
                 _maxUpdate();
             }
 
+            template<typename T, typename U>
+            inline void Cache<T, U>::add(const T& key, const U& value, std::vector<U>& removed)
+            {
+                auto i = _map.find(key);
+                if (i != _map.end())
+                {
+                    removed.push_back(i->second);
+                    i->second = value;
+                }
+                else
+                {
+                    _map[key] = value;
+                }
+                ++_counter;
+                _counts[key] = _counter;
+                _maxUpdate(&removed);
+            }
+
             template<typename T, typename U>
             inline void Cache<T, U>::remove(const T& key)
             {
@@ -88,6 +113,7 @@ namespace djv
             inline void Cache<T, U>::clear()
             {
                 _map.clear();
+                _counts.clear();
             }
 
             template<typename T, typename U>
@@ -113,7 +139,7 @@ namespace djv
             }
 
             template<typename T, typename U>
-            inline void Cache<T, U>::_maxUpdate()
+            inline void Cache<T, U>::_maxUpdate(std::vector<U>* removed)
             {
                 if (_map.size() > _max)
                 {
@@ -128,6 +154,10 @@ namespace djv
                         auto i = _map.find(begin->second);
                         if (i != _map.end())
                         {
+                            if (removed)
+                            {
+                                removed->push_back(i->second);
+                            }
                             _map.erase(i);
                         }
                         auto j = _counts.find(begin->second);
@@ -6,6 +6,7 @@
 
 #include <djvCore/Core.h>
 
+#include <cstddef>
 #include <stdint.h>
 
 namespace djv
@@ -42,6 +43,17 @@ namespace djv
                 First = MSB
             };
 
+            //! This struct provides the state of an incremental XXH64 hash, for
+            //! data that is not in memory all at once.
+            struct XXHash64State
+            {
+                uint64_t seed       = 0;
+                uint64_t v[4]       = { 0, 0, 0, 0 };
+                uint64_t size       = 0;
+                uint8_t  buffer[32];
+                size_t   bufferSize = 0;
+            };
+
         } // namespace Memory
     } // namespace Core
 } // namespace djv
@@ -16,6 +16,64 @@ namespace djv
     {
         namespace Memory
         {
+            namespace
+            {
+                const uint64_t xxPrime1 = 0x9E3779B185EBCA87ULL;
+                const uint64_t xxPrime2 = 0xC2B2AE3D27D4EB4FULL;
+                const uint64_t xxPrime3 = 0x165667B19E3779F9ULL;
+                const uint64_t xxPrime4 = 0x85EBCA77C2B2AE63ULL;
+                const uint64_t xxPrime5 = 0x27D4EB2F165667C5ULL;
+
+                inline uint64_t rotl64(uint64_t value, int bits) noexcept
+                {
+                    return (value << bits) | (value >> (64 - bits));
+                }
+
+                inline uint64_t readLE64(const uint8_t* p) noexcept
+                {
+                    uint64_t out = 0;
+                    memcpy(&out, p, 8);
+                    if (Endian::MSB == getEndian())
+                    {
+                        endian(&out, 1, 8);
+                    }
+                    return out;
+                }
+
+                inline uint32_t readLE32(const uint8_t* p) noexcept
+                {
+                    uint32_t out = 0;
+                    memcpy(&out, p, 4);
+                    if (Endian::MSB == getEndian())
+                    {
+                        endian(&out, 1, 4);
+                    }
+                    return out;
+                }
+
+                inline uint64_t xxRound(uint64_t acc, uint64_t input) noexcept
+                {
+                    acc += input * xxPrime2;
+                    acc = rotl64(acc, 31);
+                    return acc * xxPrime1;
+                }
+
+                inline uint64_t xxMergeRound(uint64_t acc, uint64_t value) noexcept
+                {
+                    acc ^= xxRound(0, value);
+                    return acc * xxPrime1 + xxPrime4;
+                }
+
+                inline void xxStripe(uint64_t* v, const uint8_t* p) noexcept
+                {
+                    v[0] = xxRound(v[0], readLE64(p));
+                    v[1] = xxRound(v[1], readLE64(p + 8));
+                    v[2] = xxRound(v[2], readLE64(p + 16));
+                    v[3] = xxRound(v[3], readLE64(p + 24));
+                }
+
+            } // namespace
+
             std::string getSizeLabel(uint64_t value)
             {
                 std::stringstream ss;
@@ -167,6 +225,112 @@ namespace djv
                 }
             }
 
+            uint64_t xxHash64(const void* in, size_t size, uint64_t seed) noexcept
+            {
+                XXHash64State state;
+                xxHash64Reset(state, seed);
+                xxHash64Update(state, in, size);
+                return xxHash64Digest(state);
+            }
+
+            void xxHash64Reset(XXHash64State& state, uint64_t seed) noexcept
+            {
+                state.seed = seed;
+                state.v[0] = seed + xxPrime1 + xxPrime2;
+                state.v[1] = seed + xxPrime2;
+                state.v[2] = seed;
+                state.v[3] = seed - xxPrime1;
+                state.size = 0;
+                state.bufferSize = 0;
+            }
+
+            void xxHash64Update(XXHash64State& state, const void* in, size_t size) noexcept
+            {
+                const uint8_t* p = reinterpret_cast<const uint8_t*>(in);
+                const uint8_t* const end = p + size;
+                state.size += size;
+
+                // Complete a partial stripe from the previous update.
+                if (state.bufferSize + size < 32)
+                {
+                    if (size)
+                    {
+                        memcpy(state.buffer + state.bufferSize, p, size);
+                        state.bufferSize += size;
+                    }
+                    return;
+                }
+                if (state.bufferSize)
+                {
+                    const size_t fill = 32 - state.bufferSize;
+                    memcpy(state.buffer + state.bufferSize, p, fill);
+                    xxStripe(state.v, state.buffer);
+                    p += fill;
+                    state.bufferSize = 0;
+                }
+
+                // Process 32 byte stripes with four independent
+                // accumulators.
+                for (; end - p >= 32; p += 32)
+                {
+                    xxStripe(state.v, p);
+                }
+
+                // Keep the remaining bytes for the next update.
+                state.bufferSize = end - p;
+                if (state.bufferSize)
+                {
+                    memcpy(state.buffer, p, state.bufferSize);
+                }
+            }
+
+            uint64_t xxHash64Digest(const XXHash64State& state) noexcept
+            {
+                uint64_t out = 0;
+                if (state.size >= 32)
+                {
+                    const uint64_t* v = state.v;
+                    out = rotl64(v[0], 1) + rotl64(v[1], 7) + rotl64(v[2], 12) + rotl64(v[3], 18);
+                    out = xxMergeRound(out, v[0]);
+                    out = xxMergeRound(out, v[1]);
+                    out = xxMergeRound(out, v[2]);
+                    out = xxMergeRound(out, v[3]);
+                }
+                else
+                {
+                    out = state.seed + xxPrime5;
+                }
+                out += state.size;
+
+                // Process the remaining bytes.
+                const uint8_t* p = state.buffer;
+                const uint8_t* const end = p + state.bufferSize;
+                for (; p + 8 <= end; p += 8)
+                {
+                    out ^= xxRound(0, readLE64(p));
+                    out = rotl64(out, 27) * xxPrime1 + xxPrime4;
+                }
+                if (p + 4 <= end)
+                {
+                    out ^= static_cast<uint64_t>(readLE32(p)) * xxPrime1;
+                    out = rotl64(out, 23) * xxPrime2 + xxPrime3;
+                    p += 4;
+                }
+                for (; p < end; ++p)
+                {
+                    out ^= static_cast<uint64_t>(*p) * xxPrime5;
+                    out = rotl64(out, 11) * xxPrime1;
+                }
+
+                // Final mix.
+                out ^= out >> 33;
+                out *= xxPrime2;
+                out ^= out >> 29;
+                out *= xxPrime3;
+                out ^= out >> 32;
+                return out;
+            }
+
             DJV_ENUM_HELPERS_IMPLEMENTATION(Unit);
             DJV_ENUM_HELPERS_IMPLEMENTATION(Endian);
 
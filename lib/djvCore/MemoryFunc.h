@@ -57,6 +57,23 @@ namespace djv
             //! - http://www.boost.org/doc/libs/1_65_1/doc/html/hash/combine.html
             template <class T>
             void hashCombine(std::size_t&, const T&);
+
+            //! Get a 64-bit checksum of a block of memory with the XXH64
+            //! algorithm.
+            //!
+            //! References:
+            //! - https://github.com/Cyan4973/xxHash/blob/dev/doc/xxhash_spec.md
+            uint64_t xxHash64(const void*, size_t, uint64_t seed = 0) noexcept;
+
+            //! \name Incremental XXH64
+            //! The result is the same as xxHash64() of the concatenated data.
+            ///@{
+
+            void xxHash64Reset(XXHash64State&, uint64_t seed = 0) noexcept;
+            void xxHash64Update(XXHash64State&, const void*, size_t) noexcept;
+            uint64_t xxHash64Digest(const XXHash64State&) noexcept;
+
+            ///@}
             
             DJV_ENUM_HELPERS(Unit);
             DJV_ENUM_HELPERS(Endian);
@@ -6,6 +6,8 @@
 
 #include <djvCore/Core.h>
 
+#include <cstddef>
+
 namespace djv
 {
     namespace Core
@@ -20,6 +22,27 @@ namespace djv
                 Unix,
                 Windows
             };
+
+            //! This struct provides the system memory status.
+            struct MemoryStatus
+            {
+                //! The total amount of RAM in bytes.
+                size_t total = 0;
+
+                //! The amount of RAM available to new allocations without
+                //! swapping, in bytes.
+                size_t available = 0;
+
+                //! The resident size of the current process in bytes.
+                size_t process = 0;
+
+                //! The percentage of time that tasks were stalled waiting for
+                //! memory over the last ten seconds, or zero if this is not
+                //! available (Linux pressure stall information).
+                float pressure = 0.F;
+
+                bool operator == (const MemoryStatus&) const;
+            };
             
         } // namespace OS
     } // namespace Core
@@ -14,6 +14,15 @@ namespace djv
     {
         namespace OS
         {
+            bool MemoryStatus::operator == (const MemoryStatus& other) const
+            {
+                return
+                    total == other.total &&
+                    available == other.available &&
+                    process == other.process &&
+                    pressure == other.pressure;
+            }
+
             bool getStringListEnv(const std::string& name, std::vector<std::string>& out)
             {
                 std::string value;
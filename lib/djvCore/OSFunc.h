@@ -25,6 +25,9 @@ namespace djv
             //! Get the total amount of RAM available.
             size_t getRAMSize();
 
+            //! Get the current memory status.
+            MemoryStatus getMemoryStatus();
+
             //! Get the current user.
             //! Throws:
             //! - std::exception
@@ -14,8 +14,12 @@
 #include <CoreServices/CoreServices.h>
 #endif // DJV_PLATFORM_MACOS
 
+#include <fstream>
 #include <sstream>
 
+#if defined(DJV_PLATFORM_MACOS)
+#include <mach/mach.h>
+#endif // DJV_PLATFORM_MACOS
 #include <sys/ioctl.h>
 #if defined(DJV_PLATFORM_MACOS)
 #include <sys/types.h>
@@ -68,6 +72,107 @@ namespace djv
                 return out;
             }
 
+            MemoryStatus getMemoryStatus()
+            {
+                MemoryStatus out;
+#if defined(DJV_PLATFORM_MACOS)
+                out.total = getRAMSize();
+                vm_statistics64_data_t vmStats;
+                mach_msg_type_number_t vmStatsCount = HOST_VM_INFO64_COUNT;
+                if (KERN_SUCCESS == host_statistics64(
+                    mach_host_self(),
+                    HOST_VM_INFO64,
+                    reinterpret_cast<host_info64_t>(&vmStats),
+                    &vmStatsCount))
+                {
+                    out.available =
+                        (static_cast<size_t>(vmStats.free_count) + static_cast<size_t>(vmStats.inactive_count)) *
+                        static_cast<size_t>(vm_page_size);
+                }
+                mach_task_basic_info_data_t taskInfo;
+                mach_msg_type_number_t taskInfoCount = MACH_TASK_BASIC_INFO_COUNT;
+                if (KERN_SUCCESS == task_info(
+                    mach_task_self(),
+                    MACH_TASK_BASIC_INFO,
+                    reinterpret_cast<task_info_t>(&taskInfo),
+                    &taskInfoCount))
+                {
+                    out.process = taskInfo.resident_size;
+                }
+#else // DJV_PLATFORM_MACOS
+                // The values in "/proc/meminfo" are in kilobytes. Kernels
+                // older than 3.14 do not provide "MemAvailable", so fall back
+                // to "MemFree".
+                std::ifstream memInfo("/proc/meminfo");
+                std::string line;
+                size_t memFree = 0;
+                bool hasAvailable = false;
+                while (std::getline(memInfo, line))
+                {
+                    std::istringstream ss(line);
+                    std::string key;
+                    size_t value = 0;
+                    ss >> key >> value;
+                    if ("MemTotal:" == key)
+                    {
+                        out.total = value * 1024;
+                    }
+                    else if ("MemAvailable:" == key)
+                    {
+                        out.available = value * 1024;
+                        hasAvailable = true;
+                    }
+                    else if ("MemFree:" == key)
+                    {
+                        memFree = value * 1024;
+                    }
+                }
+                if (!hasAvailable)
+                {
+                    out.available = memFree;
+                }
+                if (!out.total)
+                {
+                    out.total = getRAMSize();
+                }
+
+                // The second value in "/proc/self/statm" is the resident size
+                // in pages.
+                std::ifstream statm("/proc/self/statm");
+                size_t size = 0;
+                size_t resident = 0;
+                if (statm >> size >> resident)
+                {
+                    out.process = resident * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+                }
+
+                // Pressure stall information is available with Linux 4.20
+                // and later, for example:
+                // "some avg10=0.00 avg60=0.00 avg300=0.00 total=0"
+                std::ifstream pressure("/proc/pressure/memory");
+                while (std::getline(pressure, line))
+                {
+                    std::istringstream ss(line);
+                    std::string token;
+                    ss >> token;
+                    if ("some" == token)
+                    {
+                        while (ss >> token)
+                        {
+                            if (0 == token.compare(0, 6, "avg10="))
+                            {
+                                std::istringstream ss2(token.substr(6));
+                                ss2 >> out.pressure;
+                                break;
+                            }
+                        }
+                        break;
+                    }
+                }
+#endif // DJV_PLATFORM_MACOS
+                return out;
+            }
+
             int getTerminalWidth()
             {
                 int out = 80;
@@ -14,6 +14,7 @@
 #define NOMINMAX
 #endif // NOMINMAX
 #include <windows.h>
+#include <psapi.h>
 #include <Shlobj.h>
 #include <shellapi.h>
 #include <stdlib.h>
@@ -96,6 +97,24 @@ namespace djv
                 return statex.ullTotalPhys;
             }
 
+            MemoryStatus getMemoryStatus()
+            {
+                MemoryStatus out;
+                MEMORYSTATUSEX statex;
+                statex.dwLength = sizeof(statex);
+                if (GlobalMemoryStatusEx(&statex))
+                {
+                    out.total = statex.ullTotalPhys;
+                    out.available = statex.ullAvailPhys;
+                }
+                PROCESS_MEMORY_COUNTERS counters;
+                if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+                {
+                    out.process = counters.WorkingSetSize;
+                }
+                return out;
+            }
+
             std::string getUserName()
             {
                 WCHAR tmp[String::cStringLength] = { 0 };
@@ -6,9 +6,11 @@
 
 #include <djvCore/RandomFunc.h>
 
+#include <algorithm>
 #include <cctype>
 #include <codecvt>
 #include <iomanip>
+#include <limits>
 #include <locale>
 #include <regex>
 
@@ -485,6 +487,164 @@ namespace djv
                 }
             }
 
+            namespace
+            {
+                inline bool isDigit(char value)
+                {
+                    return value >= '0' && value <= '9';
+                }
+
+            } // namespace
+
+            const char* fromChars(const char* first, const char* last, int64_t& out)
+            {
+                const char* p = first;
+
+                // Find the sign.
+                bool negativeSign = false;
+                if (p < last && ('-' == *p || '+' == *p))
+                {
+                    negativeSign = '-' == *p;
+                    ++p;
+                }
+
+                // Add up the digits as an unsigned magnitude, saturating at
+                // the range of the result.
+                const uint64_t valueMax = negativeSign ?
+                    static_cast<uint64_t>(std::numeric_limits<int64_t>::max()) + 1 :
+                    static_cast<uint64_t>(std::numeric_limits<int64_t>::max());
+                const char* digits = p;
+                uint64_t value = 0;
+                for (; p < last && isDigit(*p); ++p)
+                {
+                    const uint64_t digit = static_cast<uint64_t>(*p - '0');
+                    value = value > (valueMax - digit) / 10 ? valueMax : value * 10 + digit;
+                }
+                if (p == digits)
+                    return first;
+
+                // Apply the sign. The magnitude of the smallest value does
+                // not fit in an int64_t, so it is negated one less than the
+                // magnitude.
+                out = negativeSign ?
+                    (value ? -static_cast<int64_t>(value - 1) - 1 : 0) :
+                    static_cast<int64_t>(value);
+                return p;
+            }
+
+            const char* fromChars(const char* first, const char* last, float& out)
+            {
+                const char* p = first;
+
+                // Find the sign.
+                bool negativeSign = false;
+                if (p < last && ('-' == *p || '+' == *p))
+                {
+                    negativeSign = '-' == *p;
+                    ++p;
+                }
+
+                // Add up the digits. Only the first 19 significant digits are
+                // kept so that the mantissa fits in 64 bits, the remainder
+                // only change the exponent.
+                const int mantissaDigitsMax = 19;
+
+                // The exponent is limited so that it cannot overflow for
+                // very long strings of digits. Numbers this large or small
+                // are infinity or zero as a float anyway.
+                const int exponentMax = 100000;
+                uint64_t mantissa = 0;
+                int mantissaDigits = 0;
+                int exponent = 0;
+                bool hasDigits = false;
+                for (; p < last && isDigit(*p); ++p)
+                {
+                    hasDigits = true;
+                    if (mantissaDigits < mantissaDigitsMax)
+                    {
+                        mantissa = mantissa * 10 + static_cast<uint64_t>(*p - '0');
+                        if (mantissa)
+                        {
+                            ++mantissaDigits;
+                        }
+                    }
+                    else if (exponent < exponentMax)
+                    {
+                        ++exponent;
+                    }
+                }
+
+                // Add up the decimal digits.
+                if (p < last && '.' == *p)
+                {
+                    ++p;
+                    for (; p < last && isDigit(*p); ++p)
+                    {
+                        hasDigits = true;
+                        if (mantissaDigits < mantissaDigitsMax)
+                        {
+                            mantissa = mantissa * 10 + static_cast<uint64_t>(*p - '0');
+                            if (mantissa)
+                            {
+                                ++mantissaDigits;
+                            }
+                            if (exponent > -exponentMax)
+                            {
+                                --exponent;
+                            }
+                        }
+                    }
+                }
+                if (!hasDigits)
+                    return first;
+
+                // Find the engineering notation.
+                if (p < last && ('e' == *p || 'E' == *p))
+                {
+                    int64_t e = 0;
+                    const char* eEnd = fromChars(p + 1, last, e);
+                    if (eEnd != p + 1)
+                    {
+                        exponent += static_cast<int>(std::max(std::min(e, int64_t(1000)), int64_t(-1000)));
+                        p = eEnd;
+                    }
+                }
+
+                // Apply the exponent. The powers of ten up to 22 are exactly
+                // representable as doubles.
+                static const double powersOfTen[] =
+                {
+                    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                    1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                    1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+                };
+                const int powersOfTenMax = 22;
+                double value = static_cast<double>(mantissa);
+                if (mantissa)
+                {
+                    for (; exponent > powersOfTenMax && value < 1e300; exponent -= powersOfTenMax)
+                    {
+                        value *= powersOfTen[powersOfTenMax];
+                    }
+                    for (; exponent < -powersOfTenMax && value > 1e-300; exponent += powersOfTenMax)
+                    {
+                        value /= powersOfTen[powersOfTenMax];
+                    }
+                    if (exponent > 0)
+                    {
+                        value *= powersOfTen[std::min(exponent, powersOfTenMax)];
+                    }
+                    else if (exponent < 0)
+                    {
+                        value /= powersOfTen[std::min(-exponent, powersOfTenMax)];
+                    }
+                }
+
+                // Apply the sign.
+                out = static_cast<float>(negativeSign ? -value : value);
+                return p;
+            }
+
             std::wstring toWide(const std::string& value)
             {
                 std::wstring_convert<std::codecvt_utf8<wchar_t>, wchar_t> converter;
@@ -84,6 +84,19 @@ namespace djv
             //! Low-level function for converting a string to a floating-point type.
             void fromString(const char *, size_t size, float&);
 
+            //! Low-level function for parsing an integer from a range of
+            //! characters. Returns a pointer to the first character that was
+            //! not parsed, or the start of the range if there was no number.
+            const char* fromChars(const char* first, const char* last, int64_t&);
+
+            //! Low-level function for parsing a floating-point number from a
+            //! range of characters. The digits are accumulated in a single
+            //! pass and scaled with a table of powers of ten, which is much
+            //! faster than fromString() for large text files. Returns a
+            //! pointer to the first character that was not parsed, or the
+            //! start of the range if there was no number.
+            const char* fromChars(const char* first, const char* last, float&);
+
             //! Convert a regular string to a wide string.
             //! Throws:
             //! - std::exception
@@ -4,6 +4,7 @@
 
 #include <djvDesktopApp/EventSystem.h>
 
+#include <djvUI/SpatialIndex.h>
 #include <djvUI/Style.h>
 #include <djvUI/UISystem.h>
 #include <djvUI/Widget.h>
@@ -179,15 +180,22 @@ namespace djv
             DJV_PRIVATE_PTR();
 
             const bool resizeRequest = _resizeRequestReset();
+            bool fullRedrawRequest = _fullRedrawRequestReset();
             if (resizeRequest)
             {
+                // The offscreen buffer is only re-created when the size
+                // changes so that the contents can be partially repainted.
                 const Image::Size size(p.resize.x, p.resize.y);
                 if (size.isValid())
                 {
-                    p.offscreenBuffer = GL::OffscreenBuffer::create(
-                        size,
-                        Image::Type::RGBA_U8,
-                        _getTextSystem());
+                    if (!p.offscreenBuffer || p.offscreenBuffer->getSize() != size)
+                    {
+                        p.offscreenBuffer = GL::OffscreenBuffer::create(
+                            size,
+                            Image::Type::RGBA_U8,
+                            _getTextSystem());
+                        fullRedrawRequest = true;
+                    }
                 }
                 else
                 {
@@ -242,27 +250,46 @@ namespace djv
                             }
                         }
                     }
+                    _spatialIndexUpdate();
                 }
 
-                if (resizeRequest || redrawRequest)
+                if (resizeRequest || redrawRequest || fullRedrawRequest)
                 {
-                    p.offscreenBuffer->bind();
-                    p.render->beginFrame(size);
+                    // Find the region that has changed since the last paint.
+                    const Math::BBox2f bbox(0.F, 0.F, static_cast<float>(size.w), static_cast<float>(size.h));
+                    Math::BBox2f paintRect(0.F, 0.F, 0.F, 0.F);
                     for (const auto& i : _getWindows())
                     {
                         if (auto window = i.lock())
                         {
-                            if (window->isVisible())
+                            _paintRectRecursive(window, bbox, 1.F, fullRedrawRequest, paintRect);
+                        }
+                    }
+                    if (fullRedrawRequest)
+                    {
+                        paintRect = bbox;
+                    }
+
+                    if (paintRect.isValid())
+                    {
+                        p.offscreenBuffer->bind();
+                        p.render->beginFrame(size, paintRect);
+                        for (const auto& i : _getWindows())
+                        {
+                            if (auto window = i.lock())
                             {
-                                System::Event::Paint paintEvent(Math::BBox2f(0.F, 0.F, static_cast<float>(size.w), static_cast<float>(size.h)));
-                                System::Event::PaintOverlay paintOverlayEvent(Math::BBox2f(0.F, 0.F, static_cast<float>(size.w), static_cast<float>(size.h)));
-                                _paintRecursive(window, paintEvent, paintOverlayEvent);
+                                if (window->isVisible())
+                                {
+                                    System::Event::Paint paintEvent(bbox);
+                                    System::Event::PaintOverlay paintOverlayEvent(bbox);
+                                    _paintRecursive(window, paintEvent, paintOverlayEvent, paintRect);
+                                }
                             }
                         }
-                    }
-                    p.render->endFrame();
+                        p.render->endFrame();
 
-                    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+                        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+                    }
                 }
             }
 
@@ -409,7 +436,32 @@ namespace djv
                 {
                     if (window->isVisible())
                     {
-                        _hover(window, event, hover);
+                        if (auto spatialIndex = _getSpatialIndex(window))
+                        {
+                            // Use the spatial index to find the widgets under
+                            // the pointer instead of walking the hierarchy.
+                            for (const auto& widget : spatialIndex->getWidgets(event.getPointerInfo().projectedPos))
+                            {
+                                widget->event(event);
+                                if (event.isAccepted())
+                                {
+                                    hover = widget;
+                                    break;
+                                }
+                            }
+                            if (!event.isAccepted())
+                            {
+                                window->event(event);
+                                if (event.isAccepted())
+                                {
+                                    hover = window;
+                                }
+                            }
+                        }
+                        else
+                        {
+                            _hover(window, event, hover);
+                        }
                         if (event.isAccepted())
                         {
                             break;
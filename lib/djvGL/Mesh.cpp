@@ -6,6 +6,7 @@
 
 #include <djvGL/MeshFunc.h>
 
+#include <djvGeom/IndexedTriangleMesh.h>
 #include <djvGeom/TriangleMesh.h>
 
 #include <djvMath/MathFunc.h>
@@ -313,6 +314,131 @@ namespace djv
             return out;
         }
 
+        std::vector<uint8_t> VBO::convert(const Geom::IndexedTriangleMesh& mesh, VBOType type)
+        {
+            std::vector<uint8_t> out(mesh.indices.size() * getVertexByteCount(type));
+            convert(mesh, type, out.data());
+            return out;
+        }
+
+        void VBO::convert(const Geom::IndexedTriangleMesh& mesh, VBOType type, uint8_t* p)
+        {
+            const bool hasC = mesh.c.size() == mesh.v.size();
+            const bool hasT = mesh.t.size() == mesh.v.size();
+            const bool hasN = mesh.n.size() == mesh.v.size();
+            switch (type)
+            {
+            case VBOType::Pos3_F32_UV_U16:
+                for (const auto i : mesh.indices)
+                {
+                    float* pf = reinterpret_cast<float*>(p);
+                    pf[0] = mesh.v[i][0];
+                    pf[1] = mesh.v[i][1];
+                    pf[2] = mesh.v[i][2];
+                    p += 3 * sizeof(float);
+
+                    uint16_t* pu16 = reinterpret_cast<uint16_t*>(p);
+                    pu16[0] = hasT ? Math::clamp(static_cast<int>(mesh.t[i][0] * 65535.F), 0, 65535) : 0;
+                    pu16[1] = hasT ? Math::clamp(static_cast<int>(mesh.t[i][1] * 65535.F), 0, 65535) : 0;
+                    p += 2 * sizeof(uint16_t);
+                }
+                break;
+            case VBOType::Pos3_F32_UV_U16_Normal_U10:
+                for (const auto i : mesh.indices)
+                {
+                    float* pf = reinterpret_cast<float*>(p);
+                    pf[0] = mesh.v[i][0];
+                    pf[1] = mesh.v[i][1];
+                    pf[2] = mesh.v[i][2];
+                    p += 3 * sizeof(float);
+
+                    uint16_t* pu16 = reinterpret_cast<uint16_t*>(p);
+                    pu16[0] = hasT ? Math::clamp(static_cast<int>(mesh.t[i][0] * 65535.F), 0, 65535) : 0;
+                    pu16[1] = hasT ? Math::clamp(static_cast<int>(mesh.t[i][1] * 65535.F), 0, 65535) : 0;
+                    p += 2 * sizeof(uint16_t);
+
+                    auto packedNormal = reinterpret_cast<PackedNormal*>(p);
+                    packedNormal->x = hasN ? Math::clamp(static_cast<int>(mesh.n[i][0] * 511.F), -512, 511) : 0;
+                    packedNormal->y = hasN ? Math::clamp(static_cast<int>(mesh.n[i][1] * 511.F), -512, 511) : 0;
+                    packedNormal->z = hasN ? Math::clamp(static_cast<int>(mesh.n[i][2] * 511.F), -512, 511) : 0;
+                    p += sizeof(PackedNormal);
+                }
+                break;
+            case VBOType::Pos3_F32_UV_U16_Normal_U10_Color_U8:
+                for (const auto i : mesh.indices)
+                {
+                    float* pf = reinterpret_cast<float*>(p);
+                    pf[0] = mesh.v[i][0];
+                    pf[1] = mesh.v[i][1];
+                    pf[2] = mesh.v[i][2];
+                    p += 3 * sizeof(float);
+
+                    uint16_t* pu16 = reinterpret_cast<uint16_t*>(p);
+                    pu16[0] = hasT ? Math::clamp(static_cast<int>(mesh.t[i][0] * 65535.F), 0, 65535) : 0;
+                    pu16[1] = hasT ? Math::clamp(static_cast<int>(mesh.t[i][1] * 65535.F), 0, 65535) : 0;
+                    p += 2 * sizeof(uint16_t);
+
+                    auto packedNormal = reinterpret_cast<PackedNormal*>(p);
+                    packedNormal->x = hasN ? Math::clamp(static_cast<int>(mesh.n[i][0] * 511.F), -512, 511) : 0;
+                    packedNormal->y = hasN ? Math::clamp(static_cast<int>(mesh.n[i][1] * 511.F), -512, 511) : 0;
+                    packedNormal->z = hasN ? Math::clamp(static_cast<int>(mesh.n[i][2] * 511.F), -512, 511) : 0;
+                    p += sizeof(PackedNormal);
+
+                    auto packedColor = reinterpret_cast<PackedColor*>(p);
+                    packedColor->r = hasC ? Math::clamp(static_cast<int>(mesh.c[i][0] * 255.F), 0, 255) : 255;
+                    packedColor->g = hasC ? Math::clamp(static_cast<int>(mesh.c[i][1] * 255.F), 0, 255) : 255;
+                    packedColor->b = hasC ? Math::clamp(static_cast<int>(mesh.c[i][2] * 255.F), 0, 255) : 255;
+                    packedColor->a = 255;
+                    p += sizeof(PackedColor);
+                }
+                break;
+            case VBOType::Pos3_F32_UV_F32_Normal_F32:
+                for (const auto i : mesh.indices)
+                {
+                    float* pf = reinterpret_cast<float*>(p);
+                    pf[0] = mesh.v[i][0];
+                    pf[1] = mesh.v[i][1];
+                    pf[2] = mesh.v[i][2];
+                    pf[3] = hasT ? mesh.t[i][0] : 0.F;
+                    pf[4] = hasT ? mesh.t[i][1] : 0.F;
+                    pf[5] = hasN ? mesh.n[i][0] : 0.F;
+                    pf[6] = hasN ? mesh.n[i][1] : 0.F;
+                    pf[7] = hasN ? mesh.n[i][2] : 0.F;
+                    p += 8 * sizeof(float);
+                }
+                break;
+            case VBOType::Pos3_F32_UV_F32_Normal_F32_Color_F32:
+                for (const auto i : mesh.indices)
+                {
+                    float* pf = reinterpret_cast<float*>(p);
+                    pf[0] = mesh.v[i][0];
+                    pf[1] = mesh.v[i][1];
+                    pf[2] = mesh.v[i][2];
+                    pf[3] = hasT ? mesh.t[i][0] : 0.F;
+                    pf[4] = hasT ? mesh.t[i][1] : 0.F;
+                    pf[5] = hasN ? mesh.n[i][0] : 0.F;
+                    pf[6] = hasN ? mesh.n[i][1] : 0.F;
+                    pf[7] = hasN ? mesh.n[i][2] : 0.F;
+                    pf[8] = hasC ? mesh.c[i][0] : 1.F;
+                    pf[9] = hasC ? mesh.c[i][1] : 1.F;
+                    pf[10] = hasC ? mesh.c[i][2] : 1.F;
+                    p += 11 * sizeof(float);
+                }
+                break;
+            case VBOType::Pos3_F32:
+                for (const auto i : mesh.indices)
+                {
+                    float* pf = reinterpret_cast<float*>(p);
+                    pf[0] = mesh.v[i][0];
+                    pf[1] = mesh.v[i][1];
+                    pf[2] = mesh.v[i][2];
+                    p += 3 * sizeof(float);
+                }
+                break;
+            default: break;
+            }
+        }
+
         void VAO::_init(VBOType type, GLuint vbo)
         {
 #if defined(DJV_GL_ES2)
@@ -428,6 +554,17 @@ namespace djv
             glDrawArrays(mode, static_cast<GLsizei>(offset), static_cast<GLsizei>(size));
         }
 
+#if !defined(DJV_GL_ES2)
+        void VAO::drawInstanced(GLenum mode, size_t offset, size_t size, size_t instanceCount)
+        {
+            glDrawArraysInstanced(
+                mode,
+                static_cast<GLint>(offset),
+                static_cast<GLsizei>(size),
+                static_cast<GLsizei>(instanceCount));
+        }
+#endif // DJV_GL_ES2
+
     } // namespace GL
 } // namespace djv
 
@@ -6,6 +6,7 @@
 
 #include <djvGL/GL.h>
 
+#include <djvGeom/IndexedTriangleMesh.h>
 #include <djvGeom/PointList.h>
 #include <djvGeom/TriangleMesh.h>
 
@@ -69,6 +70,12 @@ namespace djv
             static std::vector<uint8_t> convert(const Geom::PointList&, VBOType);
             static std::vector<uint8_t> convert(const Geom::TriangleMesh&, VBOType);
             static std::vector<uint8_t> convert(const Geom::TriangleMesh&, VBOType, const Math::SizeTRange&);
+            static std::vector<uint8_t> convert(const Geom::IndexedTriangleMesh&, VBOType);
+
+            //! Convert an indexed mesh directly into memory, for example a
+            //! mapped buffer. The memory must hold the number of indices
+            //! multiplied by the vertex byte count.
+            static void convert(const Geom::IndexedTriangleMesh&, VBOType, uint8_t*);
 
             ///@}
 
@@ -94,6 +101,9 @@ namespace djv
 
             void bind();
             void draw(GLenum mode, size_t offset, size_t size);
+#if !defined(DJV_GL_ES2)
+            void drawInstanced(GLenum mode, size_t offset, size_t size, size_t instanceCount);
+#endif // DJV_GL_ES2
 
         private:
             GLuint _vao = 0;
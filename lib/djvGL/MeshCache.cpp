@@ -10,8 +10,10 @@
 
 #include <djvCore/UIDFunc.h>
 
+#include <algorithm>
+#include <iterator>
+#include <list>
 #include <map>
-#include <set>
 
 using namespace djv::Core;
 
@@ -21,39 +23,221 @@ namespace djv
     {
         namespace
         {
-            uint64_t _timestamp = 0;
+            struct Page
+            {
+                std::shared_ptr<VBO> vbo;
+                std::shared_ptr<VAO> vao;
+
+                //! The free ranges, mapped from offset to size. Adjacent
+                //! ranges are always merged.
+                std::map<size_t, size_t> free;
+
+                //! The used ranges, mapped from offset to mesh.
+                std::map<size_t, UID> used;
+            };
+
+            struct Entry
+            {
+                size_t page = 0;
+                Math::SizeTRange range;
+                size_t references = 0;
+                std::list<UID>::iterator lru;
+            };
+
+            size_t getSize(const Math::SizeTRange& value)
+            {
+                return value.getMax() - value.getMin() + 1;
+            }
 
         } // namespace
 
         struct MeshCache::Private
         {
-            size_t vboSize = 0;
+            size_t pageSize = 0;
             VBOType vboType = VBOType::Pos3_F32_UV_U16_Normal_U10;
-            std::shared_ptr<VBO> vbo;
-            std::shared_ptr<VAO> vao;
-            std::map<Math::SizeTRange, UID> ranges;
-            std::map<UID, Math::SizeTRange> uids;
-            std::set<Math::SizeTRange> empty;
-            std::map<uint64_t, UID> timestamps;
+            size_t pageCountMax = 1;
+            std::vector<Page> pages;
+            std::map<UID, Entry> entries;
+
+            //! The meshes ordered from least to most recently used.
+            std::list<UID> lru;
+
+            size_t evictionCount = 0;
+            bool fragmented = false;
+#if !defined(DJV_GL_ES2)
+            GLuint copyBuffer = 0;
+            size_t copyBufferSize = 0;
+#endif // DJV_GL_ES2
+
+            void addPage();
+            bool hasFreeSize(size_t) const;
+            void free(size_t page, size_t offset, size_t size);
+            void move(size_t page, size_t from, size_t to, size_t size);
+            void remove(std::map<UID, Entry>::iterator);
+            void removePages();
         };
 
-        MeshCache::MeshCache(size_t vboSize, VBOType vboType) :
+        void MeshCache::Private::addPage()
+        {
+            Page page;
+            page.vbo = VBO::create(pageSize, vboType);
+            page.vao = VAO::create(page.vbo->getType(), page.vbo->getID());
+            page.free[0] = pageSize;
+            pages.push_back(page);
+        }
+
+        bool MeshCache::Private::hasFreeSize(size_t value) const
+        {
+            // Check whether any page has enough free space, even if it is
+            // not contiguous.
+            const size_t pageCount = std::min(pages.size(), pageCountMax);
+            for (size_t i = 0; i < pageCount; ++i)
+            {
+                size_t size = 0;
+                for (const auto& j : pages[i].free)
+                {
+                    size += j.second;
+                }
+                if (size >= value)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void MeshCache::Private::free(size_t page, size_t offset, size_t size)
+        {
+            // Merge the range with the adjacent free ranges.
+            auto& free = pages[page].free;
+            auto next = free.lower_bound(offset);
+            if (next != free.end() && offset + size == next->first)
+            {
+                size += next->second;
+                next = free.erase(next);
+            }
+            if (next != free.begin())
+            {
+                auto prev = std::prev(next);
+                if (prev->first + prev->second == offset)
+                {
+                    prev->second += size;
+                    return;
+                }
+            }
+            free[offset] = size;
+        }
+
+        void MeshCache::Private::move(size_t page, size_t from, size_t to, size_t size)
+        {
+#if !defined(DJV_GL_ES2)
+            const size_t vertexByteCount = getVertexByteCount(vboType);
+            const GLuint vbo = pages[page].vbo->getID();
+            const GLsizeiptr byteCount = static_cast<GLsizeiptr>(size * vertexByteCount);
+            if (from - to >= size)
+            {
+                glBindBuffer(GL_COPY_READ_BUFFER, vbo);
+                glBindBuffer(GL_COPY_WRITE_BUFFER, vbo);
+                glCopyBufferSubData(
+                    GL_COPY_READ_BUFFER,
+                    GL_COPY_WRITE_BUFFER,
+                    static_cast<GLintptr>(from * vertexByteCount),
+                    static_cast<GLintptr>(to * vertexByteCount),
+                    byteCount);
+            }
+            else
+            {
+                // The ranges overlap so copy through a temporary buffer.
+                if (!copyBuffer)
+                {
+                    glGenBuffers(1, &copyBuffer);
+                }
+                glBindBuffer(GL_COPY_WRITE_BUFFER, copyBuffer);
+                if (size * vertexByteCount > copyBufferSize)
+                {
+                    copyBufferSize = size * vertexByteCount;
+                    glBufferData(GL_COPY_WRITE_BUFFER, byteCount, NULL, GL_STREAM_COPY);
+                }
+                glBindBuffer(GL_COPY_READ_BUFFER, vbo);
+                glCopyBufferSubData(
+                    GL_COPY_READ_BUFFER,
+                    GL_COPY_WRITE_BUFFER,
+                    static_cast<GLintptr>(from * vertexByteCount),
+                    0,
+                    byteCount);
+                glBindBuffer(GL_COPY_READ_BUFFER, copyBuffer);
+                glBindBuffer(GL_COPY_WRITE_BUFFER, vbo);
+                glCopyBufferSubData(
+                    GL_COPY_READ_BUFFER,
+                    GL_COPY_WRITE_BUFFER,
+                    0,
+                    static_cast<GLintptr>(to * vertexByteCount),
+                    byteCount);
+            }
+#endif // DJV_GL_ES2
+        }
+
+        void MeshCache::Private::remove(std::map<UID, Entry>::iterator value)
+        {
+            const size_t page = value->second.page;
+            const size_t offset = value->second.range.getMin();
+            const size_t size = getSize(value->second.range);
+            pages[page].used.erase(offset);
+            lru.erase(value->second.lru);
+            entries.erase(value);
+            free(page, offset, size);
+            fragmented = true;
+        }
+
+        void MeshCache::Private::removePages()
+        {
+            // Evict the meshes in the pages above the maximum and remove the
+            // pages once they are empty. Meshes that are in use are evicted
+            // later, after they have been released.
+            if (pages.size() > pageCountMax)
+            {
+                auto i = entries.begin();
+                while (i != entries.end())
+                {
+                    auto next = std::next(i);
+                    if (i->second.page >= pageCountMax && 0 == i->second.references)
+                    {
+                        remove(i);
+                        ++evictionCount;
+                    }
+                    i = next;
+                }
+                while (pages.size() > pageCountMax && pages.back().used.empty())
+                {
+                    pages.pop_back();
+                }
+            }
+        }
+
+        MeshCache::MeshCache(size_t pageSize, VBOType vboType, size_t pageCountMax) :
             _p(new Private)
         {
             DJV_PRIVATE_PTR();
-            p.vboSize = vboSize;
+            p.pageSize = pageSize;
             p.vboType = vboType;
-            p.vbo = VBO::create(vboSize, vboType);
-            p.vao = VAO::create(p.vbo->getType(), p.vbo->getID());
-            p.empty.insert(Math::SizeTRange(0, p.vboSize));
+            p.pageCountMax = std::max(pageCountMax, static_cast<size_t>(1));
+            p.addPage();
         }
 
         MeshCache::~MeshCache()
-        {}
+        {
+#if !defined(DJV_GL_ES2)
+            DJV_PRIVATE_PTR();
+            if (p.copyBuffer)
+            {
+                glDeleteBuffers(1, &p.copyBuffer);
+            }
+#endif // DJV_GL_ES2
+        }
 
         size_t MeshCache::getVBOSize() const
         {
-            return _p->vboSize;
+            return _p->pageSize;
         }
 
         VBOType MeshCache::getVBOType() const
@@ -61,129 +245,292 @@ namespace djv
             return _p->vboType;
         }
 
+        size_t MeshCache::getPageCount() const
+        {
+            return _p->pages.size();
+        }
+
+        size_t MeshCache::getPageCountMax() const
+        {
+            return _p->pageCountMax;
+        }
+
+        void MeshCache::setPageCountMax(size_t value)
+        {
+            DJV_PRIVATE_PTR();
+            p.pageCountMax = std::max(value, static_cast<size_t>(1));
+            p.removePages();
+        }
+
         float MeshCache::getPercentageUsed() const
         {
             DJV_PRIVATE_PTR();
             size_t used = 0;
-            for (const auto& i : p.ranges)
+            for (const auto& i : p.entries)
             {
-                used += i.first.getMax() - i.first.getMin() + 1;
+                used += getSize(i.second.range);
             }
-            return static_cast<float>(used) / static_cast<float>(p.vboSize) * 100.F;
+            const size_t size = p.pages.size() * p.pageSize;
+            return size > 0 ? (static_cast<float>(used) / static_cast<float>(size) * 100.F) : 0.F;
         }
 
-        const std::shared_ptr<VBO>& MeshCache::getVBO() const
+        float MeshCache::getFragmentation() const
         {
-            return _p->vbo;
+            DJV_PRIVATE_PTR();
+            size_t free = 0;
+            size_t largest = 0;
+            for (const auto& i : p.pages)
+            {
+                for (const auto& j : i.free)
+                {
+                    free += j.second;
+                    largest = std::max(largest, j.second);
+                }
+            }
+            return free > 0 ? ((1.F - static_cast<float>(largest) / static_cast<float>(free)) * 100.F) : 0.F;
+        }
+
+        size_t MeshCache::getEvictionCount() const
+        {
+            return _p->evictionCount;
+        }
+
+        size_t MeshCache::getByteCount() const
+        {
+            DJV_PRIVATE_PTR();
+            return p.pages.size() * p.pageSize * getVertexByteCount(p.vboType);
+        }
+
+        const std::shared_ptr<VBO>& MeshCache::getVBO(size_t page) const
+        {
+            return _p->pages[page].vbo;
         }
 
-        const std::shared_ptr<VAO>& MeshCache::getVAO() const
+        const std::shared_ptr<VAO>& MeshCache::getVAO(size_t page) const
         {
-            return _p->vao;
+            return _p->pages[page].vao;
         }
 
-        bool MeshCache::get(UID uid, Math::SizeTRange& range)
+        bool MeshCache::get(UID uid, size_t& page, Math::SizeTRange& range)
         {
             DJV_PRIVATE_PTR();
-            const auto i = p.uids.find(uid);
-            if (i != p.uids.end())
+            const auto i = p.entries.find(uid);
+            if (i != p.entries.end())
             {
-                const auto j = p.timestamps.find(uid);
-                if (j != p.timestamps.end())
-                {
-                    j->second = ++_timestamp;
-                }
-                range = i->second;
+                p.lru.splice(p.lru.end(), p.lru, i->second.lru);
+                page = i->second.page;
+                range = i->second.range;
                 return true;
             }
             return false;
         }
 
-        UID MeshCache::add(const std::vector<uint8_t>& data, Math::SizeTRange& range)
+        bool MeshCache::contains(UID uid) const
+        {
+            return _p->entries.find(uid) != _p->entries.end();
+        }
+
+        UID MeshCache::add(const std::vector<uint8_t>& data, size_t& page, Math::SizeTRange& range)
         {
             DJV_PRIVATE_PTR();
-            
-            UID out = 0;
+            const size_t vertexByteCount = getVertexByteCount(p.vboType);
+            const UID out = _add(data.size() / vertexByteCount, page, range);
+            if (out)
+            {
+                p.pages[page].vbo->copy(data, range.getMin() * vertexByteCount);
+            }
+            return out;
+        }
 
+        UID MeshCache::add(const Geom::IndexedTriangleMesh& mesh, size_t& page, Math::SizeTRange& range)
+        {
+            DJV_PRIVATE_PTR();
             const size_t vertexByteCount = getVertexByteCount(p.vboType);
-            const size_t dataSize = data.size() / vertexByteCount;
-            if (_find(dataSize, range))
+            const size_t size = mesh.indices.size();
+            const UID out = _add(size, page, range);
+            if (out)
             {
-                out = createUID();
-                p.ranges[range] = out;
-                p.uids[out] = range;
-                ++_timestamp;
-                p.timestamps[_timestamp] = out;
-                p.vbo->copy(data, range.getMin() * vertexByteCount);
+                const auto& vbo = p.pages[page].vbo;
+#if defined(DJV_GL_ES2)
+                vbo->copy(VBO::convert(mesh, p.vboType), range.getMin() * vertexByteCount);
+#else // DJV_GL_ES2
+                // Convert the mesh directly into the buffer to avoid an
+                // intermediate copy.
+                glBindBuffer(GL_ARRAY_BUFFER, vbo->getID());
+                if (void* data = glMapBufferRange(
+                    GL_ARRAY_BUFFER,
+                    static_cast<GLintptr>(range.getMin() * vertexByteCount),
+                    static_cast<GLsizeiptr>(size * vertexByteCount),
+                    GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT))
+                {
+                    VBO::convert(mesh, p.vboType, reinterpret_cast<uint8_t*>(data));
+                    glUnmapBuffer(GL_ARRAY_BUFFER);
+                }
+                else
+                {
+                    vbo->copy(VBO::convert(mesh, p.vboType), range.getMin() * vertexByteCount);
+                }
+#endif // DJV_GL_ES2
             }
-            else
+            return out;
+        }
+
+        void MeshCache::acquire(UID uid)
+        {
+            DJV_PRIVATE_PTR();
+            const auto i = p.entries.find(uid);
+            if (i != p.entries.end())
+            {
+                ++i->second.references;
+            }
+        }
+
+        void MeshCache::release(UID uid)
+        {
+            DJV_PRIVATE_PTR();
+            const auto i = p.entries.find(uid);
+            if (i != p.entries.end() && i->second.references > 0)
+            {
+                --i->second.references;
+            }
+        }
+
+        size_t MeshCache::defragment(size_t vertexCountMax)
+        {
+            DJV_PRIVATE_PTR();
+            size_t out = 0;
+#if !defined(DJV_GL_ES2)
+            if (p.fragmented)
             {
-                auto i = p.timestamps.begin();
-                while (i != p.timestamps.end())
+                bool done = true;
+                for (size_t i = 0; i < p.pages.size(); ++i)
                 {
-                    const auto j = p.uids.find(i->second);
-                    if (j != p.uids.end())
+                    auto& page = p.pages[i];
+                    size_t offset = 0;
+                    auto j = page.used.begin();
+                    while (j != page.used.end())
                     {
-                        const auto k = p.ranges.find(j->second);
-                        if (k != p.ranges.end())
+                        auto& entry = p.entries[j->second];
+                        const size_t size = getSize(entry.range);
+                        if (j->first > offset)
                         {
-                            bool intersects = false;
-                            for (auto l = p.empty.begin(); l != p.empty.end(); ++l)
+                            if (entry.references > 0 || out >= vertexCountMax)
                             {
-                                if (k->first.intersects(*l))
-                                {
-                                    intersects = true;
-                                    Math::SizeTRange newRange = k->first;
-                                    newRange.expand(*l);
-                                    p.empty.erase(l);
-                                    p.empty.insert(newRange);
-                                }
+                                // The mesh is in use or the limit has been
+                                // reached, try again later.
+                                done = false;
                             }
-                            if (!intersects)
+                            else
                             {
-                                p.empty.insert(k->first);
+                                // The free range before the mesh starts at
+                                // the offset, since adjacent free ranges are
+                                // merged.
+                                const size_t gap = j->first - offset;
+                                p.move(i, j->first, offset, size);
+                                page.free.erase(offset);
+                                const UID uid = j->second;
+                                j = page.used.erase(j);
+                                page.used[offset] = uid;
+                                entry.range = Math::SizeTRange(offset, offset + size - 1);
+                                p.free(i, offset + size, gap);
+                                offset += size;
+                                out += size;
+                                continue;
                             }
-                            p.ranges.erase(k);
                         }
-                        p.uids.erase(j);
+                        offset = j->first + size;
+                        ++j;
                     }
-                    i = p.timestamps.erase(i);
+                }
+                p.fragmented = !done;
+            }
+#endif // DJV_GL_ES2
+            p.removePages();
+            while (p.pages.size() > 1 && p.pages.back().used.empty())
+            {
+                p.pages.pop_back();
+            }
+            return out;
+        }
+
+        UID MeshCache::_add(size_t size, size_t& page, Math::SizeTRange& range)
+        {
+            DJV_PRIVATE_PTR();
 
-                    if (_find(dataSize, range))
+            UID out = 0;
+            if (0 == size || size > p.pageSize)
+                return out;
+
+            bool found = _find(size, page, range);
+            if (!found && p.pages.size() < p.pageCountMax)
+            {
+                p.addPage();
+                found = _find(size, page, range);
+            }
+            if (!found && p.hasFreeSize(size))
+            {
+                // Merge the free space before evicting anything.
+                defragment(p.pages.size() * p.pageSize);
+                found = _find(size, page, range);
+            }
+            while (!found)
+            {
+                // Evict the least recently used mesh that is not in use.
+                auto i = p.lru.begin();
+                for (; i != p.lru.end(); ++i)
+                {
+                    if (0 == p.entries[*i].references)
                     {
-                        out = createUID();
-                        p.ranges[range] = out;
-                        p.uids[out] = range;
-                        ++_timestamp;
-                        p.timestamps[_timestamp] = out;
-                        p.vbo->copy(data, range.getMin() * vertexByteCount);
                         break;
                     }
                 }
+                if (i == p.lru.end())
+                    break;
+                p.remove(p.entries.find(*i));
+                ++p.evictionCount;
+                found = _find(size, page, range);
+                if (!found && p.hasFreeSize(size))
+                {
+                    defragment(p.pages.size() * p.pageSize);
+                    found = _find(size, page, range);
+                }
+            }
+
+            if (found)
+            {
+                out = createUID();
+                Entry entry;
+                entry.page = page;
+                entry.range = range;
+                entry.lru = p.lru.insert(p.lru.end(), out);
+                p.entries[out] = entry;
+                p.pages[page].used[range.getMin()] = out;
             }
-            
             return out;
         }
 
-        bool MeshCache::_find(size_t size, Math::SizeTRange& range)
+        bool MeshCache::_find(size_t size, size_t& page, Math::SizeTRange& range)
         {
             DJV_PRIVATE_PTR();
-            for (auto i = p.empty.begin(); i != p.empty.end(); ++i)
+            const size_t pageCount = std::min(p.pages.size(), p.pageCountMax);
+            for (size_t i = 0; i < pageCount; ++i)
             {
-                const size_t emptySize = i->getMax() - i->getMin() + 1;
-                if (size == emptySize)
+                auto& free = p.pages[i].free;
+                for (auto j = free.begin(); j != free.end(); ++j)
                 {
-                    range = *i;
-                    p.empty.erase(i);
-                    return true;
-                }
-                else if (size < emptySize)
-                {
-                    range = Math::SizeTRange(i->getMin(), i->getMin() + size - 1);
-                    Math::SizeTRange empty(range.getMax() + 1, i->getMax());
-                    p.empty.erase(i);
-                    p.empty.insert(empty);
-                    return true;
+                    if (size <= j->second)
+                    {
+                        const size_t offset = j->first;
+                        const size_t remaining = j->second - size;
+                        free.erase(j);
+                        if (remaining > 0)
+                        {
+                            free[offset + size] = remaining;
+                        }
+                        page = i;
+                        range = Math::SizeTRange(offset, offset + size - 1);
+                        return true;
+                    }
                 }
             }
             return false;
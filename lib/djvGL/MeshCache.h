@@ -2,6 +2,8 @@
 // Copyright (c) 2019-2020 Darby Johnston
 // All rights reserved.
 
+#pragma once
+
 #include <djvGL/Mesh.h>
 
 #include <djvMath/Range.h>
@@ -16,12 +18,18 @@ namespace djv
         class VAO;
 
         //! This class provides a mesh cache.
+        //!
+        //! Meshes are stored in pages, where each page is a VBO and VAO.
+        //! Pages are added as needed up to the maximum page count, after
+        //! which the least recently used meshes are evicted. Meshes that are
+        //! acquired are not evicted or moved until they are released.
         class MeshCache
         {
             DJV_NON_COPYABLE(MeshCache);
 
         public:
-            MeshCache(size_t vboSize, VBOType);
+            //! The page size is given in vertices.
+            MeshCache(size_t pageSize, VBOType, size_t pageCountMax = 1);
             ~MeshCache();
 
             //! \name Information
@@ -29,26 +37,83 @@ namespace djv
 
             size_t getVBOSize() const;
             VBOType getVBOType() const;
+            size_t getPageCount() const;
+            size_t getPageCountMax() const;
+
+            ///@}
+
+            //! \name Options
+            ///@{
+
+            //! Set the maximum page count. Meshes in the pages above the
+            //! maximum are evicted, and the pages are removed once they are
+            //! empty.
+            void setPageCountMax(size_t);
+
+            ///@}
+
+            //! \name Statistics
+            ///@{
+
+            //! Get the percentage of the allocated pages that is used.
             float getPercentageUsed() const;
 
+            //! Get the percentage of the free space that is not part of the
+            //! largest free range.
+            float getFragmentation() const;
+
+            //! Get the number of meshes that have been evicted.
+            size_t getEvictionCount() const;
+
+            //! Get the size of the allocated pages in bytes.
+            size_t getByteCount() const;
+
             ///@}
 
             //! \name Data
             ///@{
 
-            const std::shared_ptr<VBO>& getVBO() const;
-            const std::shared_ptr<VAO>& getVAO() const;
+            const std::shared_ptr<VBO>& getVBO(size_t page = 0) const;
+            const std::shared_ptr<VAO>& getVAO(size_t page = 0) const;
+
+            //! Get the page and vertex range of a mesh. This also marks the
+            //! mesh as the most recently used.
+            bool get(Core::UID, size_t& page, Math::SizeTRange&);
+
+            //! Get whether a mesh is in the cache. This does not change the
+            //! least recently used order.
+            bool contains(Core::UID) const;
+
+            //! Add a mesh. A null UID is returned if there is no room for
+            //! the mesh.
+            Core::UID add(const std::vector<uint8_t>&, size_t& page, Math::SizeTRange&);
+
+            //! Add an indexed mesh, converting it directly into the VBO.
+            Core::UID add(const Geom::IndexedTriangleMesh&, size_t& page, Math::SizeTRange&);
 
-            bool get(Core::UID, Math::SizeTRange&);
+            //! Acquire a reference to a mesh so that it is not evicted or
+            //! moved, for example while it is waiting to be drawn.
+            void acquire(Core::UID);
 
-            Core::UID add(const std::vector<uint8_t>&, Math::SizeTRange&);
+            //! Release a reference to a mesh.
+            void release(Core::UID);
 
             ///@}
 
-        private:
-            class BoxPackingNode;
+            //! \name Defragmentation
+            ///@{
+
+            //! Move meshes towards the start of their pages to merge the free
+            //! space, stopping after the given number of vertices have been
+            //! moved. Empty pages at the end are removed. Returns the number of
+            //! vertices moved.
+            size_t defragment(size_t vertexCountMax);
 
-            bool _find(size_t, Math::SizeTRange&);
+            ///@}
+
+        private:
+            Core::UID _add(size_t, size_t& page, Math::SizeTRange&);
+            bool _find(size_t, size_t& page, Math::SizeTRange&);
 
             DJV_PRIVATE();
         };
@@ -0,0 +1,293 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvGL/PixelBufferRing.h>
+
+#include <djvGL/Texture.h>
+
+#include <djvCore/MemoryFunc.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace GL
+    {
+        namespace
+        {
+            //! \todo Should this be configurable?
+            const size_t copyThreadCount    = 4;
+            const size_t copyThreadMinBytes = 16 * Memory::megabyte;
+            const GLuint64 fenceTimeout     = 1000000000;
+
+        } // namespace
+
+        struct PixelBufferRing::Private
+        {
+#if !defined(DJV_GL_ES2)
+            struct Buffer
+            {
+                GLuint id        = 0;
+                size_t byteCount = 0;
+                GLsync fence     = 0;
+            };
+            std::vector<Buffer> buffers;
+            size_t index = 0;
+
+            // Large frames are copied in parallel by worker threads that are
+            // started once, instead of starting new threads for every copy.
+            struct CopyJob
+            {
+                uint8_t*       out       = nullptr;
+                const uint8_t* in        = nullptr;
+                size_t         byteCount = 0;
+            };
+            std::vector<CopyJob> copyJobs;
+            size_t copyJobsPending = 0;
+            size_t copyGeneration = 0;
+            std::condition_variable copyCV;
+            std::condition_variable copyDoneCV;
+            std::mutex copyMutex;
+            std::vector<std::thread> copyThreads;
+            std::atomic<bool> running;
+
+            void copyMemory(uint8_t* out, const uint8_t* in, size_t byteCount);
+#endif // DJV_GL_ES2
+        };
+
+        void PixelBufferRing::_init(size_t count)
+        {
+#if !defined(DJV_GL_ES2)
+            DJV_PRIVATE_PTR();
+            p.buffers.resize(std::max(count, static_cast<size_t>(1)));
+            for (auto& i : p.buffers)
+            {
+                glGenBuffers(1, &i.id);
+            }
+
+            // The calling thread copies the first chunk, so one less worker
+            // thread is needed.
+            p.copyJobs.resize(copyThreadCount - 1);
+            p.running = true;
+            for (size_t i = 0; i < copyThreadCount - 1; ++i)
+            {
+                p.copyThreads.push_back(std::thread(
+                    [this, i]
+                    {
+                        DJV_PRIVATE_PTR();
+                        size_t generation = 0;
+                        while (p.running)
+                        {
+                            Private::CopyJob job;
+                            {
+                                std::unique_lock<std::mutex> lock(p.copyMutex);
+                                p.copyCV.wait(
+                                    lock,
+                                    [&p, &generation]
+                                    {
+                                        return !p.running || p.copyGeneration != generation;
+                                    });
+                                if (!p.running)
+                                {
+                                    break;
+                                }
+                                generation = p.copyGeneration;
+                                job = p.copyJobs[i];
+                            }
+                            if (job.byteCount > 0)
+                            {
+                                memcpy(job.out, job.in, job.byteCount);
+                            }
+                            {
+                                std::unique_lock<std::mutex> lock(p.copyMutex);
+                                --p.copyJobsPending;
+                            }
+                            p.copyDoneCV.notify_one();
+                        }
+                    }));
+            }
+#endif // DJV_GL_ES2
+        }
+
+        PixelBufferRing::PixelBufferRing() :
+            _p(new Private)
+        {}
+
+        PixelBufferRing::~PixelBufferRing()
+        {
+#if !defined(DJV_GL_ES2)
+            DJV_PRIVATE_PTR();
+            {
+                std::unique_lock<std::mutex> lock(p.copyMutex);
+                p.running = false;
+            }
+            p.copyCV.notify_all();
+            for (auto& i : p.copyThreads)
+            {
+                if (i.joinable())
+                {
+                    i.join();
+                }
+            }
+            for (auto& i : p.buffers)
+            {
+                if (i.fence)
+                {
+                    glDeleteSync(i.fence);
+                }
+                if (i.id)
+                {
+                    glDeleteBuffers(1, &i.id);
+                }
+            }
+#endif // DJV_GL_ES2
+        }
+
+        std::shared_ptr<PixelBufferRing> PixelBufferRing::create(size_t count)
+        {
+            auto out = std::shared_ptr<PixelBufferRing>(new PixelBufferRing);
+            out->_init(count);
+            return out;
+        }
+
+        size_t PixelBufferRing::getCount() const
+        {
+#if !defined(DJV_GL_ES2)
+            return _p->buffers.size();
+#else // DJV_GL_ES2
+            return 0;
+#endif // DJV_GL_ES2
+        }
+
+        size_t PixelBufferRing::getByteCount() const
+        {
+            size_t out = 0;
+#if !defined(DJV_GL_ES2)
+            for (const auto& i : _p->buffers)
+            {
+                out += i.byteCount;
+            }
+#endif // DJV_GL_ES2
+            return out;
+        }
+
+        void PixelBufferRing::copy(const Image::Data& data, Texture& texture)
+        {
+#if !defined(DJV_GL_ES2)
+            DJV_PRIVATE_PTR();
+            auto& buffer = p.buffers[p.index];
+            p.index = (p.index + 1) % p.buffers.size();
+
+            // Wait for the previous transfer from this buffer to finish. If
+            // the wait times out or fails the GPU may still be reading from
+            // the buffer, so it is orphaned and mapped with synchronization.
+            bool finished = true;
+            if (buffer.fence)
+            {
+                const GLenum result = glClientWaitSync(buffer.fence, GL_SYNC_FLUSH_COMMANDS_BIT, fenceTimeout);
+                finished = GL_ALREADY_SIGNALED == result || GL_CONDITION_SATISFIED == result;
+                glDeleteSync(buffer.fence);
+                buffer.fence = 0;
+            }
+
+            const auto& info = data.getInfo();
+            const size_t byteCount = data.getDataByteCount();
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer.id);
+            if (byteCount > buffer.byteCount || !finished)
+            {
+                buffer.byteCount = std::max(byteCount, buffer.byteCount);
+                glBufferData(GL_PIXEL_UNPACK_BUFFER, buffer.byteCount, NULL, GL_STREAM_DRAW);
+            }
+            GLbitfield access = GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT;
+            if (finished)
+            {
+                access |= GL_MAP_UNSYNCHRONIZED_BIT;
+            }
+            else
+            {
+                access |= GL_MAP_INVALIDATE_BUFFER_BIT;
+            }
+            if (void* ptr = glMapBufferRange(
+                GL_PIXEL_UNPACK_BUFFER,
+                0,
+                byteCount,
+                access))
+            {
+                p.copyMemory(reinterpret_cast<uint8_t*>(ptr), data.getData(), byteCount);
+                glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+
+                texture.bind();
+                glPixelStorei(GL_UNPACK_ALIGNMENT, info.layout.alignment);
+                glPixelStorei(GL_UNPACK_SWAP_BYTES, info.layout.endian != Memory::getEndian());
+                glPixelStorei(GL_UNPACK_SKIP_ROWS, 0);
+                glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0);
+                glTexSubImage2D(
+                    GL_TEXTURE_2D,
+                    0,
+                    0,
+                    0,
+                    info.size.w,
+                    info.size.h,
+                    info.getGLFormat(),
+                    info.getGLType(),
+                    0);
+                buffer.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+                glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+            }
+            else
+            {
+                glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+                texture.copy(data);
+            }
+#else // DJV_GL_ES2
+            texture.copy(data);
+#endif // DJV_GL_ES2
+        }
+
+#if !defined(DJV_GL_ES2)
+        void PixelBufferRing::Private::copyMemory(uint8_t* out, const uint8_t* in, size_t byteCount)
+        {
+            if (byteCount < copyThreadMinBytes)
+            {
+                memcpy(out, in, byteCount);
+                return;
+            }
+
+            // Give each worker thread a chunk and copy the first chunk on
+            // this thread.
+            const size_t chunk = (byteCount + copyThreadCount - 1) / copyThreadCount;
+            {
+                std::unique_lock<std::mutex> lock(copyMutex);
+                for (size_t i = 0; i < copyJobs.size(); ++i)
+                {
+                    const size_t offset = std::min((i + 1) * chunk, byteCount);
+                    copyJobs[i].out = out + offset;
+                    copyJobs[i].in = in + offset;
+                    copyJobs[i].byteCount = std::min(chunk, byteCount - offset);
+                }
+                copyJobsPending = copyJobs.size();
+                ++copyGeneration;
+            }
+            copyCV.notify_all();
+            memcpy(out, in, std::min(chunk, byteCount));
+            std::unique_lock<std::mutex> lock(copyMutex);
+            copyDoneCV.wait(
+                lock,
+                [this]
+                {
+                    return 0 == copyJobsPending;
+                });
+        }
+#endif // DJV_GL_ES2
+
+    } // namespace GL
+} // namespace djv
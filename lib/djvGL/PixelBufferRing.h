@@ -0,0 +1,65 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvGL/GL.h>
+
+#include <djvImage/Data.h>
+
+#include <memory>
+
+namespace djv
+{
+    namespace GL
+    {
+        class Texture;
+
+        //! This class provides a ring of pixel buffer objects for
+        //! asynchronous texture uploads.
+        //!
+        //! Image data is copied into the next buffer in the ring and the
+        //! texture is updated from the buffer, so the transfer to the GPU
+        //! happens in the background instead of stalling the caller. Each
+        //! buffer is protected by a fence so it is not overwritten while a
+        //! previous transfer is still in progress. Large images are copied
+        //! into the buffers by worker threads that are owned by the ring.
+        //!
+        //! On OpenGL ES 2.0 the data is copied directly to the texture.
+        class PixelBufferRing
+        {
+            DJV_NON_COPYABLE(PixelBufferRing);
+            void _init(size_t count);
+            PixelBufferRing();
+
+        public:
+            ~PixelBufferRing();
+
+            static std::shared_ptr<PixelBufferRing> create(size_t count = 3);
+
+            //! \name Information
+            ///@{
+
+            size_t getCount() const;
+
+            //! Get the total size of the buffers in bytes.
+            size_t getByteCount() const;
+
+            ///@}
+
+            //! \name Copy
+            ///@{
+
+            //! Copy image data to a texture. The texture must have the same
+            //! information as the image data.
+            void copy(const Image::Data&, Texture&);
+
+            ///@}
+
+        private:
+            DJV_PRIVATE();
+        };
+
+    } // namespace GL
+} // namespace djv
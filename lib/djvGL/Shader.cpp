@@ -64,6 +64,9 @@ namespace djv
             }
 
             _program = glCreateProgram();
+#if !defined(DJV_GL_ES2)
+            glProgramParameteri(_program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+#endif // DJV_GL_ES2
             glAttachShader(_program, _vertex);
             glAttachShader(_program, _fragment);
             glLinkProgram(_program);
@@ -133,6 +136,29 @@ namespace djv
             return out;
         }
 
+#if !defined(DJV_GL_ES2)
+        std::shared_ptr<Shader> Shader::create(
+            const std::vector<uint8_t>& binary,
+            GLenum                      binaryFormat)
+        {
+            auto out = std::shared_ptr<Shader>(new Shader);
+            out->_program = glCreateProgram();
+            glProgramBinary(
+                out->_program,
+                binaryFormat,
+                binary.data(),
+                static_cast<GLsizei>(binary.size()));
+            int success = 0;
+            glGetProgramiv(out->_program, GL_LINK_STATUS, &success);
+            if (!success)
+            {
+                //! \todo How can we translate this?
+                throw ShaderError(DJV_TEXT("error_gl_program_binary"));
+            }
+            return out;
+        }
+#endif // DJV_GL_ES2
+
         const std::string& Shader::getVertexName() const
         {
             return _vertexSource.first;
@@ -168,6 +194,23 @@ namespace djv
             return _program;
         }
 
+#if !defined(DJV_GL_ES2)
+        void Shader::getBinary(std::vector<uint8_t>& out, GLenum& binaryFormat) const
+        {
+            GLint size = 0;
+            glGetProgramiv(_program, GL_PROGRAM_BINARY_LENGTH, &size);
+            if (size <= 0)
+            {
+                //! \todo How can we translate this?
+                throw ShaderError(DJV_TEXT("error_gl_program_binary"));
+            }
+            out.resize(static_cast<size_t>(size));
+            GLsizei length = 0;
+            glGetProgramBinary(_program, size, &length, &binaryFormat, out.data());
+            out.resize(static_cast<size_t>(length));
+        }
+#endif // DJV_GL_ES2
+
         void Shader::bind()
         {
             glUseProgram(_program);
@@ -65,6 +65,17 @@ namespace djv
                 const System::File::Path& vertexSource,
                 const System::File::Path& fragmentSource);
 
+#if !defined(DJV_GL_ES2)
+            //! Create a shader from a program binary previously returned by
+            //! getBinary(). The binary may be rejected by the driver if it has
+            //! changed since the binary was created.
+            //! Throws:
+            //! - ShaderError
+            static std::shared_ptr<Shader> create(
+                const std::vector<uint8_t>& binary,
+                GLenum                      binaryFormat);
+#endif // DJV_GL_ES2
+
             //! \name Source
             ///@{
 
@@ -83,6 +94,13 @@ namespace djv
             
             GLuint getProgram() const;
 
+#if !defined(DJV_GL_ES2)
+            //! Get the program binary.
+            //! Throws:
+            //! - ShaderError
+            void getBinary(std::vector<uint8_t>&, GLenum& binaryFormat) const;
+#endif // DJV_GL_ES2
+
             void bind();
 
             ///@}
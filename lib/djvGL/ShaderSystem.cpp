@@ -8,8 +8,6 @@
 
 #include <djvSystem/Context.h>
 #include <djvSystem/CoreSystem.h>
-#include <djvSystem/FileIO.h>
-#include <djvSystem/FileIOFunc.h>
 #include <djvSystem/LogSystem.h>
 #include <djvSystem/ResourceSystem.h>
 
@@ -72,16 +70,17 @@ namespace djv
                     auto resourceSystem = context->getSystemT<System::ResourceSystem>();
                     const System::File::Path shaderPath = resourceSystem->getPath(System::File::ResourcePath::Shaders);
 
-                    auto io = System::File::IO::create();
-                    std::string vertexFileName = std::string(System::File::Path(shaderPath, vertexSource));
-                    io->open(vertexFileName, System::File::Mode::Read);
-                    std::string vertexSource = System::File::readContents(io);
+                    const std::string vertexFileName = std::string(System::File::Path(shaderPath, vertexSource));
+                    const std::string vertexContents = resourceSystem->readContents(
+                        System::File::ResourcePath::Shaders,
+                        vertexSource);
 
-                    std::string fragmentFileName = std::string(System::File::Path(shaderPath, fragmentSource));
-                    io->open(fragmentFileName, System::File::Mode::Read);
-                    std::string fragmentSource = System::File::readContents(io);
+                    const std::string fragmentFileName = std::string(System::File::Path(shaderPath, fragmentSource));
+                    const std::string fragmentContents = resourceSystem->readContents(
+                        System::File::ResourcePath::Shaders,
+                        fragmentSource);
 
-                    out = Shader::create(vertexSource, fragmentSource);
+                    out = Shader::create(vertexContents, fragmentContents);
                     out->setVertexName(vertexFileName);
                     out->setFragmentName(fragmentFileName);
                     p.shaders[key] = out;
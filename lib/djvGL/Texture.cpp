@@ -6,6 +6,8 @@
 
 #include <djvGL/TextureFunc.h>
 
+#include <cstring>
+
 //#pragma optimize("", off)
 
 using namespace djv::Core;
@@ -223,6 +225,58 @@ namespace djv
 #endif // DJV_GL_ES2
         }
 
+        void Texture::copyRegion(const Image::Data& data, uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+        {
+            const auto& info = data.getInfo();
+
+#if defined(DJV_GL_ES2)
+            // OpenGL ES 2.0 does not support the unpack row length, so the
+            // region is copied into a temporary buffer.
+            const size_t pixelByteCount = info.getPixelByteCount();
+            const size_t regionScanlineByteCount = w * pixelByteCount;
+            std::vector<uint8_t> region(regionScanlineByteCount * h);
+            for (uint16_t i = 0; i < h; ++i)
+            {
+                memcpy(
+                    region.data() + i * regionScanlineByteCount,
+                    data.getData(x, y + i),
+                    regionScanlineByteCount);
+            }
+            glBindTexture(GL_TEXTURE_2D, _id);
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+            glTexSubImage2D(
+                GL_TEXTURE_2D,
+                0,
+                0,
+                0,
+                w,
+                h,
+                info.getGLFormat(),
+                info.getGLType(),
+                region.data());
+#else // DJV_GL_ES2
+            glBindTexture(GL_TEXTURE_2D, _id);
+            glPixelStorei(GL_UNPACK_ALIGNMENT, info.layout.alignment);
+            glPixelStorei(GL_UNPACK_SWAP_BYTES, info.layout.endian != Memory::getEndian());
+            glPixelStorei(GL_UNPACK_ROW_LENGTH, info.size.w);
+            glPixelStorei(GL_UNPACK_SKIP_ROWS, y);
+            glPixelStorei(GL_UNPACK_SKIP_PIXELS, x);
+            glTexSubImage2D(
+                GL_TEXTURE_2D,
+                0,
+                0,
+                0,
+                w,
+                h,
+                info.getGLFormat(),
+                info.getGLType(),
+                data.getData());
+            glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+            glPixelStorei(GL_UNPACK_SKIP_ROWS, 0);
+            glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0);
+#endif // DJV_GL_ES2
+        }
+
         void Texture::bind()
         {
             glBindTexture(GL_TEXTURE_2D, _id);
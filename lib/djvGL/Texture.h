@@ -46,6 +46,9 @@ namespace djv
             void copy(const Image::Data&);
             void copy(const Image::Data&, uint16_t x, uint16_t y);
 
+            //! Copy a region of the image data to the origin of the texture.
+            void copyRegion(const Image::Data&, uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+
             void bind();
 
             ///@}
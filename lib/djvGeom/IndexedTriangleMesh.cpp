@@ -0,0 +1,61 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvGeom/IndexedTriangleMesh.h>
+
+#include <djvCore/UIDFunc.h>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace Geom
+    {
+        IndexedTriangleMesh::IndexedTriangleMesh() :
+            _uid(createUID())
+        {}
+
+        size_t IndexedTriangleMesh::getByteCount() const
+        {
+            return
+                v.capacity() * sizeof(glm::vec3) +
+                c.capacity() * sizeof(glm::vec3) +
+                t.capacity() * sizeof(glm::vec2) +
+                n.capacity() * sizeof(glm::vec3) +
+                indices.capacity() * sizeof(uint32_t);
+        }
+
+        void IndexedTriangleMesh::clear()
+        {
+            v.clear();
+            c.clear();
+            t.clear();
+            n.clear();
+            indices.clear();
+        }
+
+        void IndexedTriangleMesh::shrink()
+        {
+            v.shrink_to_fit();
+            c.shrink_to_fit();
+            t.shrink_to_fit();
+            n.shrink_to_fit();
+            indices.shrink_to_fit();
+        }
+
+        void IndexedTriangleMesh::bboxUpdate()
+        {
+            bbox.zero();
+            if (v.size())
+            {
+                bbox = Math::BBox3f(v[0]);
+                for (const auto& i : v)
+                {
+                    bbox.expand(i);
+                }
+            }
+        }
+
+    } // namespace Geom
+} // namespace djv
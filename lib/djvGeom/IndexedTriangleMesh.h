@@ -0,0 +1,72 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvCore/Core.h>
+
+#include <djvMath/BBox.h>
+
+#include <djvCore/UID.h>
+
+#include <vector>
+
+namespace djv
+{
+    namespace Geom
+    {
+        //! This class provides a compact triangle mesh.
+        //!
+        //! Each vertex is unique, and the position, color, texture coordinate,
+        //! and normal are stored in separate arrays with the same index. The
+        //! color, texture coordinate, and normal arrays are either empty or
+        //! the same size as the position array. Triangles are stored as three
+        //! 32-bit indices starting at zero.
+        class IndexedTriangleMesh
+        {
+        public:
+            IndexedTriangleMesh();
+
+            Core::UID getUID() const;
+
+            std::vector<glm::vec3> v;
+            std::vector<glm::vec3> c;
+            std::vector<glm::vec2> t;
+            std::vector<glm::vec3> n;
+            std::vector<uint32_t>  indices;
+
+            Math::BBox3f bbox = Math::BBox3f(0.F, 0.F, 0.F, 0.F, 0.F, 0.F);
+
+            //! \name Information
+            ///@{
+
+            size_t getVertexCount() const;
+            size_t getTriangleCount() const;
+
+            //! Get the number of bytes used by the mesh.
+            size_t getByteCount() const;
+
+            ///@}
+
+            //! \name Utility
+            ///@{
+
+            void clear();
+
+            //! Release unused memory.
+            void shrink();
+
+            //! Compute the bounding-box of the mesh.
+            void bboxUpdate();
+
+            ///@}
+
+        private:
+            Core::UID _uid = 0;
+        };
+
+    } // namespace Geom
+} // namespace djv
+
+#include <djvGeom/IndexedTriangleMeshInline.h>
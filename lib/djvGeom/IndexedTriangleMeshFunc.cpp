@@ -0,0 +1,629 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvGeom/IndexedTriangleMeshFunc.h>
+
+#include <djvCore/MemoryFunc.h>
+
+#include <glm/geometric.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <queue>
+#include <unordered_map>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace Geom
+    {
+        namespace
+        {
+            //! The weight of the planes used to preserve the mesh boundary.
+            const double boundaryWeight = 1000.0;
+
+            //! The minimum cosine of the angle between a triangle's normal
+            //! before and after a collapse.
+            const float flipThreshold = .2F;
+
+            //! This struct provides a symmetric 4x4 error quadric. Only the
+            //! upper triangle of the matrix is stored.
+            struct Quadric
+            {
+                Quadric()
+                {}
+
+                Quadric(const glm::vec3& n, float d, double weight)
+                {
+                    const double a = n.x;
+                    const double b = n.y;
+                    const double c = n.z;
+                    m[0] = a * a * weight;
+                    m[1] = a * b * weight;
+                    m[2] = a * c * weight;
+                    m[3] = a * d * weight;
+                    m[4] = b * b * weight;
+                    m[5] = b * c * weight;
+                    m[6] = b * d * weight;
+                    m[7] = c * c * weight;
+                    m[8] = c * d * weight;
+                    m[9] = static_cast<double>(d) * d * weight;
+                }
+
+                double m[10] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+
+                Quadric& operator += (const Quadric& other)
+                {
+                    for (size_t i = 0; i < 10; ++i)
+                    {
+                        m[i] += other.m[i];
+                    }
+                    return *this;
+                }
+
+                double getError(const glm::vec3& p) const
+                {
+                    const double x = p.x;
+                    const double y = p.y;
+                    const double z = p.z;
+                    const double out =
+                        m[0] * x * x + 2.0 * m[1] * x * y + 2.0 * m[2] * x * z + 2.0 * m[3] * x +
+                        m[4] * y * y + 2.0 * m[5] * y * z + 2.0 * m[6] * y +
+                        m[7] * z * z + 2.0 * m[8] * z +
+                        m[9];
+                    return std::max(out, 0.0);
+                }
+
+                //! Get the position that minimizes the error. False is
+                //! returned if the matrix is close to singular, for example
+                //! when all of the planes are parallel.
+                bool getOptimal(glm::vec3& out) const
+                {
+                    const double det =
+                        m[0] * (m[4] * m[7] - m[5] * m[5]) -
+                        m[1] * (m[1] * m[7] - m[5] * m[2]) +
+                        m[2] * (m[1] * m[5] - m[4] * m[2]);
+                    const double trace = m[0] + m[4] + m[7];
+                    if (std::abs(det) <= 1.0e-9 * trace * trace * trace)
+                        return false;
+                    const double b0 = -m[3];
+                    const double b1 = -m[6];
+                    const double b2 = -m[8];
+                    out.x = static_cast<float>((
+                        b0 * (m[4] * m[7] - m[5] * m[5]) -
+                        m[1] * (b1 * m[7] - m[5] * b2) +
+                        m[2] * (b1 * m[5] - m[4] * b2)) / det);
+                    out.y = static_cast<float>((
+                        m[0] * (b1 * m[7] - m[5] * b2) -
+                        b0 * (m[1] * m[7] - m[5] * m[2]) +
+                        m[2] * (m[1] * b2 - b1 * m[2])) / det);
+                    out.z = static_cast<float>((
+                        m[0] * (m[4] * b2 - b1 * m[5]) -
+                        m[1] * (m[1] * b2 - b1 * m[2]) +
+                        b0 * (m[1] * m[5] - m[4] * m[2])) / det);
+                    return true;
+                }
+            };
+
+            //! This struct provides an edge collapse. The vertex versions are
+            //! used to discard collapses that are out of date.
+            struct Collapse
+            {
+                double    error     = 0.0;
+                uint32_t  a         = 0;
+                uint32_t  b         = 0;
+                uint32_t  aVersion  = 0;
+                uint32_t  bVersion  = 0;
+                glm::vec3 position  = glm::vec3(0.F, 0.F, 0.F);
+            };
+
+            struct CollapseCompare
+            {
+                bool operator () (const Collapse& a, const Collapse& b) const
+                {
+                    return a.error > b.error;
+                }
+            };
+
+            struct Edge
+            {
+                uint64_t key      = 0;
+                uint32_t triangle = 0;
+
+                bool operator < (const Edge& other) const
+                {
+                    return key < other.key;
+                }
+            };
+
+            struct PositionHash
+            {
+                size_t operator () (const glm::vec3& value) const
+                {
+                    size_t out = 0;
+                    Memory::hashCombine(out, value.x);
+                    Memory::hashCombine(out, value.y);
+                    Memory::hashCombine(out, value.z);
+                    return out;
+                }
+            };
+
+            //! This struct provides an output vertex. Output vertices are
+            //! merged when they have the same position and attributes.
+            struct OutputVertex
+            {
+                uint32_t position = 0;
+                uint32_t original = 0;
+            };
+
+            struct OutputVertexHash
+            {
+                const IndexedTriangleMesh* mesh = nullptr;
+
+                size_t operator () (const OutputVertex& value) const
+                {
+                    size_t out = 0;
+                    Memory::hashCombine(out, value.position);
+                    if (mesh->t.size() == mesh->v.size())
+                    {
+                        Memory::hashCombine(out, mesh->t[value.original].x);
+                        Memory::hashCombine(out, mesh->t[value.original].y);
+                    }
+                    if (mesh->n.size() == mesh->v.size())
+                    {
+                        Memory::hashCombine(out, mesh->n[value.original].x);
+                        Memory::hashCombine(out, mesh->n[value.original].y);
+                        Memory::hashCombine(out, mesh->n[value.original].z);
+                    }
+                    return out;
+                }
+            };
+
+            struct OutputVertexEqual
+            {
+                const IndexedTriangleMesh* mesh = nullptr;
+                bool hasColors = false;
+                bool hasTextures = false;
+                bool hasNormals = false;
+
+                void setMesh(const IndexedTriangleMesh& value)
+                {
+                    mesh = &value;
+                    hasColors = value.c.size() == value.v.size();
+                    hasTextures = value.t.size() == value.v.size();
+                    hasNormals = value.n.size() == value.v.size();
+                }
+
+                bool operator () (const OutputVertex& a, const OutputVertex& b) const
+                {
+                    return a.position == b.position &&
+                        (a.original == b.original || (
+                            (!hasColors || mesh->c[a.original] == mesh->c[b.original]) &&
+                            (!hasTextures || mesh->t[a.original] == mesh->t[b.original]) &&
+                            (!hasNormals || mesh->n[a.original] == mesh->n[b.original])));
+                }
+            };
+
+            inline uint64_t getEdgeKey(uint32_t a, uint32_t b)
+            {
+                return a < b ?
+                    (static_cast<uint64_t>(a) << 32) | b :
+                    (static_cast<uint64_t>(b) << 32) | a;
+            }
+
+            //! This class provides the state of a simplification.
+            class Simplify
+            {
+            public:
+                std::vector<glm::vec3> positions;
+                std::vector<bool> moved;
+                std::vector<Quadric> quadrics;
+                std::vector<uint32_t> versions;
+                std::vector<bool> vertexAlive;
+                std::vector<std::vector<uint32_t> > vertexTriangles;
+                std::vector<uint32_t> corners;
+                std::vector<bool> triangleAlive;
+                size_t aliveCount = 0;
+
+                Collapse getCollapse(uint32_t a, uint32_t b) const
+                {
+                    Collapse out;
+                    out.a = a;
+                    out.b = b;
+                    out.aVersion = versions[a];
+                    out.bVersion = versions[b];
+                    Quadric q = quadrics[a];
+                    q += quadrics[b];
+                    const glm::vec3& pa = positions[a];
+                    const glm::vec3& pb = positions[b];
+                    const glm::vec3 mid = (pa + pb) * .5F;
+                    out.position = mid;
+                    out.error = q.getError(mid);
+                    for (const auto& i : { pa, pb })
+                    {
+                        const double error = q.getError(i);
+                        if (error < out.error)
+                        {
+                            out.position = i;
+                            out.error = error;
+                        }
+                    }
+
+                    // The optimal position is ignored if it is far away from
+                    // the edge, which happens when the matrix is poorly
+                    // conditioned.
+                    glm::vec3 optimal(0.F, 0.F, 0.F);
+                    if (q.getOptimal(optimal) &&
+                        glm::distance(optimal, mid) <= glm::distance(pa, pb))
+                    {
+                        const double error = q.getError(optimal);
+                        if (error < out.error)
+                        {
+                            out.position = optimal;
+                            out.error = error;
+                        }
+                    }
+                    return out;
+                }
+
+                void getNeighbors(uint32_t v, std::vector<uint32_t>& out) const
+                {
+                    out.clear();
+                    for (const auto t : vertexTriangles[v])
+                    {
+                        if (triangleAlive[t])
+                        {
+                            for (size_t i = 0; i < 3; ++i)
+                            {
+                                const uint32_t c = corners[t * 3 + i];
+                                if (c != v)
+                                {
+                                    out.push_back(c);
+                                }
+                            }
+                        }
+                    }
+                    std::sort(out.begin(), out.end());
+                    out.erase(std::unique(out.begin(), out.end()), out.end());
+                }
+
+                size_t getSharedTriangleCount(uint32_t a, uint32_t b) const
+                {
+                    size_t out = 0;
+                    for (const auto t : vertexTriangles[a])
+                    {
+                        if (triangleAlive[t])
+                        {
+                            const uint32_t* c = &corners[t * 3];
+                            if (c[0] == b || c[1] == b || c[2] == b)
+                            {
+                                ++out;
+                            }
+                        }
+                    }
+                    return out;
+                }
+
+                //! Check whether moving the vertex would flip any of the
+                //! triangles that are not removed by the collapse.
+                bool isFlipped(uint32_t v, uint32_t other, const glm::vec3& position) const
+                {
+                    for (const auto t : vertexTriangles[v])
+                    {
+                        if (triangleAlive[t])
+                        {
+                            const uint32_t* c = &corners[t * 3];
+                            if (c[0] == other || c[1] == other || c[2] == other)
+                                continue;
+                            glm::vec3 p[3] = { positions[c[0]], positions[c[1]], positions[c[2]] };
+                            const glm::vec3 n0 = glm::cross(p[1] - p[0], p[2] - p[0]);
+                            const float n0Length = glm::length(n0);
+                            if (n0Length <= 0.F)
+                                continue;
+                            for (size_t i = 0; i < 3; ++i)
+                            {
+                                if (c[i] == v)
+                                {
+                                    p[i] = position;
+                                }
+                            }
+                            const glm::vec3 n1 = glm::cross(p[1] - p[0], p[2] - p[0]);
+                            const float n1Length = glm::length(n1);
+                            if (n1Length <= 0.F ||
+                                glm::dot(n0, n1) < flipThreshold * n0Length * n1Length)
+                            {
+                                return true;
+                            }
+                        }
+                    }
+                    return false;
+                }
+
+                void collapse(const Collapse& value)
+                {
+                    const uint32_t a = value.a;
+                    const uint32_t b = value.b;
+                    positions[a] = value.position;
+                    moved[a] = true;
+                    quadrics[a] += quadrics[b];
+                    auto& aTriangles = vertexTriangles[a];
+                    for (const auto t : vertexTriangles[b])
+                    {
+                        if (triangleAlive[t])
+                        {
+                            uint32_t* c = &corners[t * 3];
+                            if (c[0] == a || c[1] == a || c[2] == a)
+                            {
+                                triangleAlive[t] = false;
+                                --aliveCount;
+                            }
+                            else
+                            {
+                                for (size_t i = 0; i < 3; ++i)
+                                {
+                                    if (c[i] == b)
+                                    {
+                                        c[i] = a;
+                                    }
+                                }
+                                aTriangles.push_back(t);
+                            }
+                        }
+                    }
+                    std::vector<uint32_t>().swap(vertexTriangles[b]);
+                    vertexAlive[b] = false;
+                    ++versions[a];
+                    aTriangles.erase(
+                        std::remove_if(
+                            aTriangles.begin(),
+                            aTriangles.end(),
+                            [this](uint32_t t)
+                            {
+                                return !triangleAlive[t];
+                            }),
+                        aTriangles.end());
+                }
+            };
+
+        } // namespace
+
+        void simplify(
+            const IndexedTriangleMesh& mesh,
+            size_t                     triangleCount,
+            IndexedTriangleMesh&       out)
+        {
+            out.clear();
+            const size_t vertexCount = mesh.v.size();
+            const size_t inTriangleCount = mesh.indices.size() / 3;
+            if (!vertexCount || !inTriangleCount)
+                return;
+
+            // The positions are normalized so that the error thresholds do
+            // not depend on the size of the mesh.
+            Math::BBox3f bbox(mesh.v[0]);
+            for (const auto& i : mesh.v)
+            {
+                bbox.expand(i);
+            }
+            const glm::vec3 center = bbox.getCenter();
+            const glm::vec3 size = bbox.getSize();
+            const float scale = std::max(std::max(size.x, size.y), size.z);
+            const float normalize = scale > 0.F ? (1.F / scale) : 1.F;
+
+            // Weld the vertices with the same position.
+            Simplify s;
+            std::vector<uint32_t> weld(vertexCount);
+            {
+                std::unordered_map<glm::vec3, uint32_t, PositionHash> positions;
+                positions.reserve(vertexCount);
+                for (size_t i = 0; i < vertexCount; ++i)
+                {
+                    const auto j = positions.insert(std::make_pair(mesh.v[i], static_cast<uint32_t>(s.positions.size())));
+                    if (j.second)
+                    {
+                        s.positions.push_back((mesh.v[i] - center) * normalize);
+                    }
+                    weld[i] = j.first->second;
+                }
+            }
+            const size_t positionCount = s.positions.size();
+            s.moved.resize(positionCount, false);
+            s.quadrics.resize(positionCount);
+            s.versions.resize(positionCount, 0);
+            s.vertexAlive.resize(positionCount, true);
+            s.vertexTriangles.resize(positionCount);
+
+            // Setup the triangles and the face quadrics. Triangles that are
+            // degenerate after welding are discarded.
+            s.corners.resize(inTriangleCount * 3);
+            s.triangleAlive.resize(inTriangleCount, false);
+            for (size_t t = 0; t < inTriangleCount; ++t)
+            {
+                const uint32_t* indices = &mesh.indices[t * 3];
+                if (indices[0] >= vertexCount || indices[1] >= vertexCount || indices[2] >= vertexCount)
+                    continue;
+                uint32_t* c = &s.corners[t * 3];
+                for (size_t i = 0; i < 3; ++i)
+                {
+                    c[i] = weld[indices[i]];
+                }
+                if (c[0] != c[1] && c[1] != c[2] && c[2] != c[0])
+                {
+                    s.triangleAlive[t] = true;
+                    ++s.aliveCount;
+                    const glm::vec3& p0 = s.positions[c[0]];
+                    const glm::vec3& p1 = s.positions[c[1]];
+                    const glm::vec3& p2 = s.positions[c[2]];
+                    const glm::vec3 n = glm::cross(p1 - p0, p2 - p0);
+                    const float length = glm::length(n);
+                    const Quadric q = length > 0.F ?
+                        Quadric(n / length, -glm::dot(n / length, p0), length * .5) :
+                        Quadric();
+                    for (size_t i = 0; i < 3; ++i)
+                    {
+                        s.quadrics[c[i]] += q;
+                        s.vertexTriangles[c[i]].push_back(static_cast<uint32_t>(t));
+                    }
+                }
+            }
+
+            if (s.aliveCount > triangleCount)
+            {
+                // Find the edges. Edges that are only used by one triangle
+                // are on the boundary and are preserved by adding planes that
+                // are perpendicular to the triangle.
+                std::vector<Edge> edges;
+                edges.reserve(s.aliveCount * 3);
+                for (size_t t = 0; t < inTriangleCount; ++t)
+                {
+                    if (s.triangleAlive[t])
+                    {
+                        const uint32_t* c = &s.corners[t * 3];
+                        for (size_t i = 0; i < 3; ++i)
+                        {
+                            Edge edge;
+                            edge.key = getEdgeKey(c[i], c[(i + 1) % 3]);
+                            edge.triangle = static_cast<uint32_t>(t);
+                            edges.push_back(edge);
+                        }
+                    }
+                }
+                std::sort(edges.begin(), edges.end());
+                std::vector<Collapse> collapses;
+                const size_t edgesSize = edges.size();
+                for (size_t i = 0; i < edgesSize;)
+                {
+                    size_t j = i + 1;
+                    while (j < edgesSize && edges[j].key == edges[i].key)
+                    {
+                        ++j;
+                    }
+                    const uint32_t a = static_cast<uint32_t>(edges[i].key >> 32);
+                    const uint32_t b = static_cast<uint32_t>(edges[i].key & 0xffffffff);
+                    if (j - i == 1)
+                    {
+                        const uint32_t* c = &s.corners[edges[i].triangle * 3];
+                        const glm::vec3& pa = s.positions[a];
+                        const glm::vec3& pb = s.positions[b];
+                        const glm::vec3 e = pb - pa;
+                        const glm::vec3 n = glm::cross(
+                            s.positions[c[1]] - s.positions[c[0]],
+                            s.positions[c[2]] - s.positions[c[0]]);
+                        const glm::vec3 m = glm::cross(e, n);
+                        const float length = glm::length(m);
+                        if (length > 0.F)
+                        {
+                            const Quadric q(m / length, -glm::dot(m / length, pa), boundaryWeight * glm::dot(e, e));
+                            s.quadrics[a] += q;
+                            s.quadrics[b] += q;
+                        }
+                    }
+                    i = j;
+                }
+                for (size_t i = 0; i < edgesSize; ++i)
+                {
+                    if (0 == i || edges[i].key != edges[i - 1].key)
+                    {
+                        collapses.push_back(s.getCollapse(
+                            static_cast<uint32_t>(edges[i].key >> 32),
+                            static_cast<uint32_t>(edges[i].key & 0xffffffff)));
+                    }
+                }
+                std::vector<Edge>().swap(edges);
+                std::priority_queue<Collapse, std::vector<Collapse>, CollapseCompare> queue(
+                    CollapseCompare(),
+                    std::move(collapses));
+
+                // Collapse the edges with the smallest error first.
+                std::vector<uint32_t> aNeighbors;
+                std::vector<uint32_t> bNeighbors;
+                std::vector<uint32_t> sharedNeighbors;
+                while (s.aliveCount > triangleCount && !queue.empty())
+                {
+                    const Collapse collapse = queue.top();
+                    queue.pop();
+                    if (!s.vertexAlive[collapse.a] ||
+                        !s.vertexAlive[collapse.b] ||
+                        s.versions[collapse.a] != collapse.aVersion ||
+                        s.versions[collapse.b] != collapse.bVersion)
+                        continue;
+
+                    // The vertices may only share the neighbors opposite the
+                    // edge, otherwise the collapse would pinch the surface.
+                    s.getNeighbors(collapse.a, aNeighbors);
+                    s.getNeighbors(collapse.b, bNeighbors);
+                    sharedNeighbors.clear();
+                    std::set_intersection(
+                        aNeighbors.begin(), aNeighbors.end(),
+                        bNeighbors.begin(), bNeighbors.end(),
+                        std::back_inserter(sharedNeighbors));
+                    if (sharedNeighbors.size() != s.getSharedTriangleCount(collapse.a, collapse.b))
+                        continue;
+
+                    if (s.isFlipped(collapse.a, collapse.b, collapse.position) ||
+                        s.isFlipped(collapse.b, collapse.a, collapse.position))
+                        continue;
+
+                    s.collapse(collapse);
+                    s.getNeighbors(collapse.a, aNeighbors);
+                    for (const auto i : aNeighbors)
+                    {
+                        queue.push(s.getCollapse(collapse.a, i));
+                    }
+                }
+            }
+
+            // Create the output mesh. The attributes come from the original
+            // vertex of each corner, so a welded vertex is split again where
+            // the attributes differ.
+            OutputVertexHash hash;
+            hash.mesh = &mesh;
+            OutputVertexEqual equal;
+            equal.setMesh(mesh);
+            std::unordered_map<OutputVertex, uint32_t, OutputVertexHash, OutputVertexEqual> outIndices(
+                s.aliveCount * 3,
+                hash,
+                equal);
+            out.indices.reserve(s.aliveCount * 3);
+            for (size_t t = 0; t < inTriangleCount; ++t)
+            {
+                if (s.triangleAlive[t])
+                {
+                    for (size_t i = 0; i < 3; ++i)
+                    {
+                        OutputVertex vertex;
+                        vertex.position = s.corners[t * 3 + i];
+                        vertex.original = mesh.indices[t * 3 + i];
+                        const auto j = outIndices.insert(std::make_pair(
+                            vertex,
+                            static_cast<uint32_t>(out.v.size())));
+                        if (j.second)
+                        {
+                            out.v.push_back(s.moved[vertex.position] ?
+                                (s.positions[vertex.position] * (scale > 0.F ? scale : 1.F) + center) :
+                                mesh.v[vertex.original]);
+                            if (equal.hasColors)
+                            {
+                                out.c.push_back(mesh.c[vertex.original]);
+                            }
+                            if (equal.hasTextures)
+                            {
+                                out.t.push_back(mesh.t[vertex.original]);
+                            }
+                            if (equal.hasNormals)
+                            {
+                                out.n.push_back(mesh.n[vertex.original]);
+                            }
+                        }
+                        out.indices.push_back(j.first->second);
+                    }
+                }
+            }
+            out.bboxUpdate();
+        }
+
+    } // namespace Geom
+} // namespace djv
@@ -0,0 +1,31 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvGeom/IndexedTriangleMesh.h>
+
+namespace djv
+{
+    namespace Geom
+    {
+        //! \name Simplification
+        ///@{
+
+        //! Simplify a mesh by collapsing edges in order of the quadric error
+        //! metric (Garland and Heckbert). Vertices with the same position are
+        //! collapsed together so that texture coordinate and normal seams
+        //! stay closed, and edges on the mesh boundary are penalized so that
+        //! the outline is preserved. The simplification stops when the
+        //! triangle count is reached or no more edges can be collapsed
+        //! without folding the surface.
+        void simplify(
+            const IndexedTriangleMesh& mesh,
+            size_t                     triangleCount,
+            IndexedTriangleMesh&       out);
+
+        ///@}
+
+    } // namespace Geom
+} // namespace djv
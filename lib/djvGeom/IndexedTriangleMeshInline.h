@@ -0,0 +1,25 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+namespace djv
+{
+    namespace Geom
+    {
+        inline Core::UID IndexedTriangleMesh::getUID() const
+        {
+            return _uid;
+        }
+
+        inline size_t IndexedTriangleMesh::getVertexCount() const
+        {
+            return v.size();
+        }
+
+        inline size_t IndexedTriangleMesh::getTriangleCount() const
+        {
+            return indices.size() / 3;
+        }
+
+    } // namespace Geom
+} // namespace djv
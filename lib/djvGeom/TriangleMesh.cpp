@@ -22,6 +22,16 @@ namespace djv
         TriangleMesh::Triangle::Triangle()
         {}
 
+        size_t TriangleMesh::getByteCount() const
+        {
+            return
+                v.capacity() * sizeof(glm::vec3) +
+                c.capacity() * sizeof(glm::vec3) +
+                t.capacity() * sizeof(glm::vec2) +
+                n.capacity() * sizeof(glm::vec3) +
+                triangles.capacity() * sizeof(Triangle);
+        }
+
         void TriangleMesh::clear()
         {
             v.clear();
@@ -24,15 +24,17 @@ namespace djv
 
             Core::UID getUID() const;
 
-            //! This struct provides a vertex.
+            //! This struct provides a vertex. The indices start at one, zero
+            //! means the component is not used. 32-bit indices are used to
+            //! keep large meshes compact.
             struct Vertex
             {
                 Vertex();
-                explicit constexpr Vertex(size_t v, size_t t = 0, size_t n = 0);
+                explicit constexpr Vertex(uint32_t v, uint32_t t = 0, uint32_t n = 0);
 
-                size_t v = 0;
-                size_t t = 0;
-                size_t n = 0;
+                uint32_t v = 0;
+                uint32_t t = 0;
+                uint32_t n = 0;
 
                 bool operator == (const Vertex&) const;
             };
@@ -65,6 +67,14 @@ namespace djv
 
             Math::BBox3f bbox = Math::BBox3f(0.F, 0.F, 0.F, 0.F, 0.F, 0.F);
 
+            //! \name Information
+            ///@{
+
+            //! Get the number of bytes used by the mesh.
+            size_t getByteCount() const;
+
+            ///@}
+
             //! \name Utility
             ///@{
 
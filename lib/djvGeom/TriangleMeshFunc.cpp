@@ -4,14 +4,34 @@
 
 #include <djvGeom/TriangleMeshFunc.h>
 
+#include <djvCore/MemoryFunc.h>
+
 #include <glm/geometric.hpp>
 
+#include <unordered_map>
+
 using namespace djv::Core;
 
 namespace djv
 {
     namespace Geom
     {
+        namespace
+        {
+            struct VertexHash
+            {
+                size_t operator () (const TriangleMesh::Vertex& value) const
+                {
+                    size_t out = 0;
+                    Memory::hashCombine(out, value.v);
+                    Memory::hashCombine(out, value.t);
+                    Memory::hashCombine(out, value.n);
+                    return out;
+                }
+            };
+
+        } // namespace
+
         void calcNormals(TriangleMesh& mesh)
         {
             const size_t trianglesSize = mesh.triangles.size();
@@ -28,9 +48,9 @@ namespace djv
                     const auto& v1 = mesh.v[p1 - 1];
                     const auto& v2 = mesh.v[p2 - 1];
                     mesh.n[i] = glm::normalize(glm::cross(v1 - v0, v2 - v0));
-                    tri.v0.n = i + 1;
-                    tri.v1.n = i + 1;
-                    tri.v2.n = i + 1;
+                    tri.v0.n = static_cast<uint32_t>(i + 1);
+                    tri.v1.n = static_cast<uint32_t>(i + 1);
+                    tri.v2.n = static_cast<uint32_t>(i + 1);
                 }
             }
         }
@@ -54,7 +74,7 @@ namespace djv
             mesh.t.push_back(glm::vec3(0.F, 0.F, 0.F));
 
             // Back
-            const size_t offset = 1;
+            const uint32_t offset = 1;
             TriangleMesh::Triangle a;
             TriangleMesh::Triangle b;
             a.v0.v = 0 + offset;
@@ -311,5 +331,81 @@ namespace djv
             }
         }
 
+        void toIndexedMesh(const TriangleMesh& mesh, IndexedTriangleMesh& out)
+        {
+            out.clear();
+            const size_t vSize = mesh.v.size();
+            const size_t cSize = mesh.c.size();
+            const size_t tSize = mesh.t.size();
+            const size_t nSize = mesh.n.size();
+            const bool hasC = cSize > 0;
+            bool hasT = false;
+            bool hasN = false;
+            for (const auto& triangle : mesh.triangles)
+            {
+                hasT |= triangle.v0.t || triangle.v1.t || triangle.v2.t;
+                hasN |= triangle.v0.n || triangle.v1.n || triangle.v2.n;
+            }
+            out.v.reserve(vSize);
+            if (hasC)
+            {
+                out.c.reserve(vSize);
+            }
+            if (hasT)
+            {
+                out.t.reserve(vSize);
+            }
+            if (hasN)
+            {
+                out.n.reserve(vSize);
+            }
+            out.indices.reserve(mesh.triangles.size() * 3);
+
+            std::unordered_map<TriangleMesh::Vertex, uint32_t, VertexHash> vertexToIndex;
+            vertexToIndex.reserve(vSize);
+            for (const auto& triangle : mesh.triangles)
+            {
+                const TriangleMesh::Vertex* vertices[] =
+                {
+                    &triangle.v0,
+                    &triangle.v1,
+                    &triangle.v2
+                };
+                for (size_t i = 0; i < 3; ++i)
+                {
+                    const auto& vertex = *vertices[i];
+                    const auto j = vertexToIndex.find(vertex);
+                    if (j != vertexToIndex.end())
+                    {
+                        out.indices.push_back(j->second);
+                    }
+                    else
+                    {
+                        const uint32_t index = static_cast<uint32_t>(out.v.size());
+                        const size_t v = vertex.v;
+                        const size_t t = vertex.t;
+                        const size_t n = vertex.n;
+                        out.v.push_back(v && v <= vSize ? mesh.v[v - 1] : glm::vec3(0.F, 0.F, 0.F));
+                        if (hasC)
+                        {
+                            out.c.push_back(v && v <= cSize ? mesh.c[v - 1] : glm::vec3(1.F, 1.F, 1.F));
+                        }
+                        if (hasT)
+                        {
+                            out.t.push_back(t && t <= tSize ? mesh.t[t - 1] : glm::vec2(0.F, 0.F));
+                        }
+                        if (hasN)
+                        {
+                            out.n.push_back(n && n <= nSize ? mesh.n[n - 1] : glm::vec3(0.F, 0.F, 0.F));
+                        }
+                        vertexToIndex[vertex] = index;
+                        out.indices.push_back(index);
+                    }
+                }
+            }
+            out.shrink();
+            out.bboxUpdate();
+        }
+
     } // namespace Geom
 } // namespace djv
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <djvGeom/IndexedTriangleMesh.h>
 #include <djvGeom/TriangleMesh.h>
 
 #include <djvMath/BBox.h>
@@ -67,6 +68,10 @@ namespace djv
             const TriangleMesh::Face&,
             std::vector<TriangleMesh::Triangle>&);
 
+        //! Convert a mesh into an indexed mesh. Vertices with the same
+        //! position, texture coordinate, and normal indices are merged.
+        void toIndexedMesh(const TriangleMesh&, IndexedTriangleMesh&);
+
         ///@}
 
     } // namespace Geom
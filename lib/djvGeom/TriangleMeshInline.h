@@ -11,7 +11,7 @@ namespace djv
             return _uid;
         }
 
-        constexpr TriangleMesh::Vertex::Vertex(size_t v, size_t t, size_t n) :
+        constexpr TriangleMesh::Vertex::Vertex(uint32_t v, uint32_t t, uint32_t n) :
             v(v),
             t(t),
             n(n)
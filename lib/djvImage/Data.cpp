@@ -24,6 +24,17 @@ namespace djv
             }
         }
 
+        void Data::_init(const Info& info, const uint8_t* data, const std::shared_ptr<void>& owner)
+        {
+            _uid = Core::createUID();
+            _info = info;
+            _pixelByteCount = info.getPixelByteCount();
+            _scanlineByteCount = info.getScanlineByteCount();
+            _dataByteCount = info.getDataByteCount();
+            _p = data;
+            _owner = owner;
+        }
+
         Data::Data()
         {}
 
@@ -39,6 +50,13 @@ namespace djv
             return out;
         }
 
+        std::shared_ptr<Data> Data::create(const Info& info, const uint8_t* data, const std::shared_ptr<void>& owner)
+        {
+            auto out = std::shared_ptr<Data>(new Data);
+            out->_init(info, data, owner);
+            return out;
+        }
+
         void Data::setPluginName(const std::string& value)
         {
             _pluginName = value;
@@ -51,7 +69,10 @@ namespace djv
 
         void Data::zero()
         {
-            memset(_data, 0, _dataByteCount);
+            if (_data)
+            {
+                memset(_data, 0, _dataByteCount);
+            }
         }
 
         bool Data::operator == (const Data& other) const
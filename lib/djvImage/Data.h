@@ -22,6 +22,7 @@ namespace djv
 
         protected:
             void _init(const Info&);
+            void _init(const Info&, const uint8_t*, const std::shared_ptr<void>&);
             Data();
 
         public:
@@ -29,6 +30,14 @@ namespace djv
 
             static std::shared_ptr<Data> create(const Info&);
 
+            //! Create image data that references external memory instead of
+            //! allocating it. The owner is kept alive for the lifetime of the
+            //! image data. The non-const accessors return the same memory
+            //! so that callers holding a non-const pointer can still read
+            //! it, but the data must not be written to since the memory may
+            //! be shared or mapped read-only.
+            static std::shared_ptr<Data> create(const Info&, const uint8_t*, const std::shared_ptr<void>& owner);
+
             //! \name Information
             ///@{
 
@@ -96,6 +105,7 @@ namespace djv
             std::string _pluginName;
             uint8_t* _data = nullptr;
             const uint8_t* _p = nullptr;
+            std::shared_ptr<void> _owner;
             Tags _tags;
         };
 
@@ -7,6 +7,8 @@
 #include <djvImage/Color.h>
 #include <djvImage/Data.h>
 
+#include <cstring>
+
 namespace djv
 {
     namespace Image
@@ -35,6 +37,9 @@ namespace djv
                 }
             }
 
+            const char packedMagic[] = { 'D', 'J', 'V', 'I' };
+            const size_t packedHeaderSize = 16;
+
             void getAverageColorU10(const uint8_t* data, uint16_t width, uint16_t height, uint8_t* out)
             {
                 uint64_t average[3] = { 0, 0, 0 };
@@ -82,6 +87,51 @@ namespace djv
             return out;
         }
 
+        size_t getPackedByteCount(const Info& info)
+        {
+            return packedHeaderSize + info.getDataByteCount();
+        }
+
+        void pack(const std::shared_ptr<Data>& data, uint8_t* out)
+        {
+            const auto& info = data->getInfo();
+            uint8_t header[packedHeaderSize];
+            memset(header, 0, packedHeaderSize);
+            memcpy(header, packedMagic, sizeof(packedMagic));
+            memcpy(header + 4, &info.size.w, sizeof(uint16_t));
+            memcpy(header + 6, &info.size.h, sizeof(uint16_t));
+            header[8] = static_cast<uint8_t>(info.type);
+            header[9] = info.layout.mirror.x;
+            header[10] = info.layout.mirror.y;
+            header[11] = static_cast<uint8_t>(info.layout.alignment);
+            header[12] = static_cast<uint8_t>(info.layout.endian);
+            memcpy(out, header, packedHeaderSize);
+            memcpy(out + packedHeaderSize, data->getData(), data->getDataByteCount());
+        }
+
+        std::shared_ptr<Data> unpack(const uint8_t* in, size_t size, const std::shared_ptr<void>& owner)
+        {
+            std::shared_ptr<Data> out;
+            if (size >= packedHeaderSize && 0 == memcmp(in, packedMagic, sizeof(packedMagic)))
+            {
+                Info info;
+                memcpy(&info.size.w, in + 4, sizeof(uint16_t));
+                memcpy(&info.size.h, in + 6, sizeof(uint16_t));
+                info.type = in[8] < static_cast<uint8_t>(Type::Count) ? static_cast<Type>(in[8]) : Type::None;
+                info.layout.mirror.x = in[9] != 0;
+                info.layout.mirror.y = in[10] != 0;
+                info.layout.alignment = in[11];
+                info.layout.endian = in[12] < static_cast<uint8_t>(Core::Memory::Endian::Count) ?
+                    static_cast<Core::Memory::Endian>(in[12]) :
+                    Core::Memory::getEndian();
+                if (info.isValid() && packedHeaderSize + info.getDataByteCount() <= size)
+                {
+                    out = Data::create(info, in + packedHeaderSize, owner);
+                }
+            }
+            return out;
+        }
+
     } // namespace Image
 } // namespace djv
 
@@ -6,12 +6,16 @@
 
 #include <memory>
 
+#include <stddef.h>
+#include <stdint.h>
+
 namespace djv
 {
     namespace Image
     {
         class Color;
         class Data;
+        class Info;
 
         //! \name Utility
         ///@{
@@ -19,6 +23,25 @@ namespace djv
         Color getAverageColor(const std::shared_ptr<Data>&);
 
         ///@}
+
+        //! \name Packing
+        //! Packed image data is a small header followed by the pixels, it
+        //! is used to store pre-decoded images in a resource pack.
+        ///@{
+
+        //! Get the number of bytes required to pack image data.
+        size_t getPackedByteCount(const Info&);
+
+        //! Pack image data. The output must be at least getPackedByteCount()
+        //! bytes in size.
+        void pack(const std::shared_ptr<Data>&, uint8_t*);
+
+        //! Create image data that references packed image data without copying
+        //! it. The owner is kept alive for the lifetime of the image data. Returns
+        //! nullptr if the packed image data is not valid.
+        std::shared_ptr<Data> unpack(const uint8_t*, size_t, const std::shared_ptr<void>& owner);
+
+        ///@}
     
     } // namespace Image
 } // namespace djv
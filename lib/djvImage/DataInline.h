@@ -100,17 +100,17 @@ namespace djv
 
         inline uint8_t* Data::getData()
         {
-            return _data;
+            return const_cast<uint8_t*>(_p);
         }
 
         inline uint8_t* Data::getData(uint16_t y)
         {
-            return _data + y * _scanlineByteCount;
+            return const_cast<uint8_t*>(_p) + y * _scanlineByteCount;
         }
 
         inline uint8_t* Data::getData(uint16_t x, uint16_t y)
         {
-            return _data + y * _scanlineByteCount + x * static_cast<size_t>(_pixelByteCount);
+            return const_cast<uint8_t*>(_p) + y * _scanlineByteCount + x * static_cast<size_t>(_pixelByteCount);
         }
 
         inline const Tags& Data::getTags() const
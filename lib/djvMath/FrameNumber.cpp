@@ -16,103 +16,118 @@ namespace djv
     {
         namespace Frame
         {
+            namespace
+            {
+                size_t getSize(const Range& value)
+                {
+                    return static_cast<size_t>(value.getMax() - value.getMin() + 1);
+                }
+
+            } // namespace
+
             Sequence::Sequence()
             {}
        
             Sequence::Sequence(Number number)
             {
                 _ranges.push_back(Range(number));
+                _update();
             }
        
             Sequence::Sequence(Number min, Number max, size_t pad) :
                 _pad(pad)
             {
                 _ranges.push_back(Range(min, max));
+                _update();
             }
 
             Sequence::Sequence(const Range& range, size_t pad) :
                 _pad(pad)
             {
                 _ranges.push_back(range);
+                _update();
             }
 
             Sequence::Sequence(const std::vector<Range>& ranges, size_t pad) :
                 _pad(pad)
             {
-                for (const auto& i : ranges)
-                {
-                    add(i);
-                }
-            }
-            
-            void Sequence::add(const Range& value)
-            {
-                Range newRange(value);
-                auto i = _ranges.begin();
-                while (i != _ranges.end())
-                {
-                    if (newRange.intersects(*i))
+                // Sort the ranges and merge them in a single pass.
+                std::vector<Range> sorted = ranges;
+                std::sort(
+                    sorted.begin(),
+                    sorted.end(),
+                    [](const Range& a, const Range& b)
                     {
-                        newRange.expand(*i);
-                        i = _ranges.erase(i);
-                    }
-                    else if (newRange.getMin() == i->getMax() + 1)
-                    {
-                        newRange = Range(i->getMin(), newRange.getMax());
-                        i = _ranges.erase(i);
-                    }
-                    else if (newRange.getMax() == i->getMin() - 1)
+                        return a.getMin() < b.getMin();
+                    });
+                _ranges.reserve(sorted.size());
+                for (const auto& i : sorted)
+                {
+                    if (_ranges.size() && i.getMin() <= _ranges.back().getMax() + 1)
                     {
-                        newRange = Range(newRange.getMin(), i->getMax());
-                        i = _ranges.erase(i);
+                        _ranges.back() = Range(_ranges.back().getMin(), std::max(_ranges.back().getMax(), i.getMax()));
                     }
                     else
                     {
-                        ++i;
+                        _ranges.push_back(i);
                     }
                 }
-                i = _ranges.begin();
-                for (; i != _ranges.end() && *i < newRange; ++i)
-                    ;
-                _ranges.insert(i, newRange);
+                _update();
             }
-
-            bool Sequence::contains(Index value) const noexcept
+            
+            void Sequence::add(const Range& value)
             {
-                bool out = false;
-                for (const auto& i : _ranges)
-                {
-                    if (i.contains(value))
+                // Find the ranges that intersect or are adjacent to the new
+                // range and merge them.
+                Number min = value.getMin();
+                Number max = value.getMax();
+                auto first = std::lower_bound(
+                    _ranges.begin(),
+                    _ranges.end(),
+                    min,
+                    [](const Range& range, Number value)
                     {
-                        out = true;
-                        break;
-                    }
+                        return range.getMax() + 1 < value;
+                    });
+                auto last = first;
+                for (; last != _ranges.end() && last->getMin() <= max + 1; ++last)
+                {
+                    min = std::min(min, last->getMin());
+                    max = std::max(max, last->getMax());
                 }
-                return out;
+                const size_t index = first - _ranges.begin();
+                if (first != last)
+                {
+                    *first = Range(min, max);
+                    _ranges.erase(first + 1, last);
+                }
+                else
+                {
+                    _ranges.insert(first, Range(min, max));
+                }
+                _update(index);
             }
 
-            size_t Sequence::getFrameCount() const noexcept
+            bool Sequence::contains(Index value) const noexcept
             {
-                size_t out = 0;
-                for (const auto& i : _ranges)
-                {
-                    out += i.getMax() - i.getMin() + 1;
-                }
-                return out;
+                const auto i = std::lower_bound(
+                    _ranges.begin(),
+                    _ranges.end(),
+                    value,
+                    [](const Range& range, Number value)
+                    {
+                        return range.getMax() < value;
+                    });
+                return i != _ranges.end() && i->contains(value);
             }
 
             Number Sequence::getFrame(Index value) const noexcept
             {
                 Number out = invalid;
-                for (const auto& j : _ranges)
+                if (value >= 0 && static_cast<size_t>(value) < _frameCount)
                 {
-                    const size_t size = j.getMax() - j.getMin() + 1;
-                    if (value < size)
-                    {
-                        out = j.getMin() + value;
-                        break;
-                    }
-                    value -= size;
+                    const auto i = std::upper_bound(_offsets.begin(), _offsets.end(), static_cast<size_t>(value)) - 1;
+                    out = _ranges[i - _offsets.begin()].getMin() + value - static_cast<Index>(*i);
                 }
                 return out;
             }
@@ -120,27 +135,32 @@ namespace djv
             Index Sequence::getIndex(Number value) const noexcept
             {
                 Index out = invalidIndex;
-                Index tmp = 0;
-                for (const auto& j : _ranges)
-                {
-                    if (j.contains(value))
+                const auto i = std::lower_bound(
+                    _ranges.begin(),
+                    _ranges.end(),
+                    value,
+                    [](const Range& range, Number value)
                     {
-                        out = tmp + value - j.getMin();
-                        break;
-                    }
-                    tmp += j.getMax() - j.getMin() + 1;
+                        return range.getMax() < value;
+                    });
+                if (i != _ranges.end() && i->contains(value))
+                {
+                    out = static_cast<Index>(_offsets[i - _ranges.begin()]) + value - i->getMin();
                 }
                 return out;
             }
 
-            Index Sequence::getLastIndex() const noexcept
+            void Sequence::_update(size_t index)
             {
-                Index tmp = 0;
-                for (const auto& i : _ranges)
+                const size_t size = _ranges.size();
+                _offsets.resize(size);
+                size_t offset = index > 0 ? (_offsets[index - 1] + getSize(_ranges[index - 1])) : 0;
+                for (size_t i = index; i < size; ++i)
                 {
-                    tmp += i.getMax() - i.getMin() + 1;
+                    _offsets[i] = offset;
+                    offset += getSize(_ranges[i]);
                 }
-                return _ranges.size() ? (tmp - 1) : invalidIndex;
+                _frameCount = offset;
             }
             
         } // namespace Frame
@@ -32,6 +32,10 @@ namespace djv
             
             //! This class provides a sequence of frame numbers. A sequence is
             //! composed of multiple frame number ranges (e.g., 1-10,20-30).
+            //!
+            //! The ranges are kept sorted and merged, and the frame offset of
+            //! each range is cached so that frame and index lookups use a
+            //! binary search.
             class Sequence
             {
             public:
@@ -78,8 +82,12 @@ namespace djv
                 bool operator != (const Sequence&) const;
 
             private:
+                void _update(size_t index = 0);
+
                 std::vector<Range>  _ranges;
-                size_t              _pad    = 0;
+                std::vector<size_t> _offsets;
+                size_t              _frameCount = 0;
+                size_t              _pad        = 0;
             };
 
         } // namespace Frame
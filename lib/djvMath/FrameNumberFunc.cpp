@@ -16,6 +16,22 @@ namespace djv
     {
         namespace Frame
         {
+            Sequence getMissing(const Sequence& value)
+            {
+                std::vector<Range> ranges;
+                const auto& valueRanges = value.getRanges();
+                for (size_t i = 1; i < valueRanges.size(); ++i)
+                {
+                    const Number min = valueRanges[i - 1].getMax() + 1;
+                    const Number max = valueRanges[i].getMin() - 1;
+                    if (min <= max)
+                    {
+                        ranges.push_back(Range(min, max));
+                    }
+                }
+                return Sequence(ranges, value.getPad());
+            }
+
             std::vector<Number> toFrames(const Range& value)
             {
                 std::vector<Number> out;
@@ -29,9 +45,10 @@ namespace djv
             std::vector<Number> toFrames(const Sequence& value)
             {
                 std::vector<Number> out;
+                out.reserve(value.getFrameCount());
                 for (const auto& range : value.getRanges())
                 {
-                    for (const auto& i : toFrames(range))
+                    for (auto i = range.getMin(); i <= range.getMax(); ++i)
                     {
                         out.push_back(i);
                     }
@@ -41,31 +58,24 @@ namespace djv
             
             Sequence fromFrames(const std::vector<Number> & frames)
             {
-                Sequence out;
+                // Collect the ranges and construct the sequence in bulk.
+                std::vector<Range> ranges;
                 const size_t size = frames.size();
                 if (size)
                 {
-                    Frame::Number rangeStart = frames[0];
-                    Frame::Number prevFrame = frames[0];
-                    size_t i = 1;
-                    for (; i < size; prevFrame = frames[i], ++i)
+                    Number rangeStart = frames[0];
+                    Number prevFrame = frames[0];
+                    for (size_t i = 1; i < size; prevFrame = frames[i], ++i)
                     {
                         if (frames[i] != prevFrame + 1)
                         {
-                            out.add(Range(rangeStart, prevFrame));
+                            ranges.push_back(Range(rangeStart, prevFrame));
                             rangeStart = frames[i];
                         }
                     }
-                    if (size > 1)
-                    {
-                        out.add(Range(rangeStart, prevFrame));
-                    }
-                    else
-                    {
-                        out.add(Range(rangeStart));
-                    }
+                    ranges.push_back(Range(rangeStart, prevFrame));
                 }
-                return out;
+                return Sequence(ranges);
             }
 
             std::string toString(Number frame, size_t pad)
@@ -19,6 +19,10 @@ namespace djv
 
             bool isValid(const Range&);
 
+            //! Get the frames that are missing between the ranges of a
+            //! sequence.
+            Sequence getMissing(const Sequence&);
+
             ///@}
 
             //! \name Conversion
@@ -18,6 +18,16 @@ namespace djv
                 return _ranges.size() > 0;
             }
 
+            inline size_t Sequence::getFrameCount() const noexcept
+            {
+                return _frameCount;
+            }
+
+            inline Index Sequence::getLastIndex() const noexcept
+            {
+                return _ranges.size() ? (static_cast<Index>(_frameCount) - 1) : invalidIndex;
+            }
+
             inline size_t Sequence::getPad() const noexcept
             {
                 return _pad;
@@ -0,0 +1,309 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+#include <djvOCIO/CPUProcessor.h>
+
+#include <djvOCIO/CPUProcessorFunc.h>
+
+#include <djvImage/Data.h>
+#include <djvImage/TypeFunc.h>
+
+#include <djvCore/Cache.h>
+#include <djvCore/MemoryFunc.h>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include <future>
+#include <mutex>
+#include <thread>
+
+using namespace djv::Core;
+namespace _OCIO = OCIO_NAMESPACE;
+
+namespace djv
+{
+    namespace OCIO
+    {
+        namespace
+        {
+            // Sample the transform into a 3D LUT. The red index changes
+            // fastest.
+            void sampleLUT3D(const _OCIO::ConstProcessorRcPtr& processor, size_t size, std::vector<float>& out)
+            {
+                out.resize(size * size * size * 3);
+                float* p = out.data();
+                const float scale = 1.F / static_cast<float>(size - 1);
+                for (size_t b = 0; b < size; ++b)
+                {
+                    for (size_t g = 0; g < size; ++g)
+                    {
+                        for (size_t r = 0; r < size; ++r, p += 3)
+                        {
+                            p[0] = r * scale;
+                            p[1] = g * scale;
+                            p[2] = b * scale;
+                        }
+                    }
+                }
+                _OCIO::PackedImageDesc desc(out.data(), static_cast<long>(size * size * size), 1, 3);
+                processor->apply(desc);
+            }
+
+        } // namespace
+
+        struct CPUProcessor::Private
+        {
+            struct Transform
+            {
+                _OCIO::ConstProcessorRcPtr processor;
+                bool                       noOp      = false;
+                size_t                     lut3DSize = 0;
+                std::vector<float>         lut3D;
+            };
+
+            typedef std::pair<std::string, Convert> TransformKey;
+
+            size_t threadCount = 1;
+            bool lut3D = true;
+            size_t lut3DSize = cpuLUT3DSizeDefault;
+            Memory::Cache<TransformKey, std::shared_ptr<Transform> > cache;
+            std::mutex mutex;
+
+            std::shared_ptr<Transform> getTransform(const Convert&, bool lut3D);
+
+            void process(
+                const std::shared_ptr<const Image::Data>& in,
+                const std::shared_ptr<Image::Data>& out,
+                uint16_t y0,
+                uint16_t y1,
+                const std::shared_ptr<Transform>&,
+                bool lut3D);
+        };
+
+        void CPUProcessor::_init()
+        {
+            DJV_PRIVATE_PTR();
+            p.threadCount = std::max(std::thread::hardware_concurrency(), 1U);
+            p.cache.setMax(cpuProcessorCacheMaxDefault);
+        }
+
+        CPUProcessor::CPUProcessor() :
+            _p(new Private)
+        {}
+
+        CPUProcessor::~CPUProcessor()
+        {}
+
+        std::shared_ptr<CPUProcessor> CPUProcessor::create()
+        {
+            auto out = std::shared_ptr<CPUProcessor>(new CPUProcessor);
+            out->_init();
+            return out;
+        }
+
+        size_t CPUProcessor::getThreadCount() const
+        {
+            std::lock_guard<std::mutex> lock(_p->mutex);
+            return _p->threadCount;
+        }
+
+        bool CPUProcessor::hasLUT3D() const
+        {
+            std::lock_guard<std::mutex> lock(_p->mutex);
+            return _p->lut3D;
+        }
+
+        size_t CPUProcessor::getLUT3DSize() const
+        {
+            std::lock_guard<std::mutex> lock(_p->mutex);
+            return _p->lut3DSize;
+        }
+
+        size_t CPUProcessor::getCacheMax() const
+        {
+            std::lock_guard<std::mutex> lock(_p->mutex);
+            return _p->cache.getMax();
+        }
+
+        size_t CPUProcessor::getCacheSize() const
+        {
+            std::lock_guard<std::mutex> lock(_p->mutex);
+            return _p->cache.getSize();
+        }
+
+        void CPUProcessor::setThreadCount(size_t value)
+        {
+            std::lock_guard<std::mutex> lock(_p->mutex);
+            _p->threadCount = std::max(value, static_cast<size_t>(1));
+        }
+
+        void CPUProcessor::setLUT3D(bool value)
+        {
+            std::lock_guard<std::mutex> lock(_p->mutex);
+            _p->lut3D = value;
+        }
+
+        void CPUProcessor::setLUT3DSize(size_t value)
+        {
+            std::lock_guard<std::mutex> lock(_p->mutex);
+            _p->lut3DSize = std::max(value, static_cast<size_t>(2));
+        }
+
+        void CPUProcessor::setCacheMax(size_t value)
+        {
+            std::lock_guard<std::mutex> lock(_p->mutex);
+            _p->cache.setMax(value);
+        }
+
+        void CPUProcessor::clearCache()
+        {
+            std::lock_guard<std::mutex> lock(_p->mutex);
+            for (const auto& i : _p->cache.getKeys())
+            {
+                _p->cache.remove(i);
+            }
+        }
+
+        std::shared_ptr<Image::Data> CPUProcessor::process(const std::shared_ptr<const Image::Data>& data, const Convert& convert)
+        {
+            DJV_PRIVATE_PTR();
+
+            const Image::Info& info = data->getInfo();
+            const uint8_t channelCount = Image::getChannelCount(info.type);
+            const uint8_t bitDepth = Image::getBitDepth(info.type);
+            const uint8_t outChannelCount = channelCount < 3 ? channelCount + 2 : channelCount;
+            const bool intType = Image::isIntType(info.type);
+            Image::Info outInfo = info;
+            outInfo.type = intType ?
+                Image::getIntType(outChannelCount, bitDepth) :
+                Image::getFloatType(outChannelCount, bitDepth);
+            outInfo.layout = Image::Layout(info.layout.mirror, info.layout.alignment);
+            auto out = Image::Data::create(outInfo);
+            out->setPluginName(data->getPluginName());
+            out->setTags(data->getTags());
+
+            // The 3D LUT is only used for integer images since floating point
+            // values may be outside of the range of the LUT.
+            std::shared_ptr<Private::Transform> transform;
+            const bool lut3D = intType && hasLUT3D();
+            size_t threadCount = 1;
+            {
+                std::lock_guard<std::mutex> lock(p.mutex);
+                transform = p.getTransform(convert, lut3D);
+                threadCount = p.threadCount;
+            }
+
+            // Process tiles of rows in parallel.
+            const uint16_t h = info.size.h;
+            const size_t tileCount = std::max(std::min(threadCount, static_cast<size_t>(h)), static_cast<size_t>(1));
+            const size_t tileSize = (h + tileCount - 1) / tileCount;
+            std::vector<std::future<void> > futures;
+            for (size_t y = 0; y < h; y += tileSize)
+            {
+                const uint16_t y0 = static_cast<uint16_t>(y);
+                const uint16_t y1 = static_cast<uint16_t>(std::min(y + tileSize, static_cast<size_t>(h)));
+                futures.push_back(std::async(
+                    std::launch::async,
+                    [&p, data, out, y0, y1, transform, lut3D]
+                    {
+                        p.process(data, out, y0, y1, transform, lut3D);
+                    }));
+            }
+            for (auto& i : futures)
+            {
+                i.get();
+            }
+            return out;
+        }
+
+        std::shared_ptr<CPUProcessor::Private::Transform> CPUProcessor::Private::getTransform(const Convert& convert, bool useLUT3D)
+        {
+            auto config = _OCIO::GetCurrentConfig();
+            const TransformKey key(config->getCacheID(), convert);
+            std::shared_ptr<Transform> out;
+            if (!cache.get(key, out))
+            {
+                out = std::shared_ptr<Transform>(new Transform);
+                out->processor = config->getProcessor(convert.input.c_str(), convert.output.c_str());
+                out->noOp = out->processor->isNoOp();
+                cache.add(key, out);
+            }
+            if (useLUT3D && !out->noOp && out->lut3DSize != lut3DSize)
+            {
+                // Transforms are shared between threads, so a new transform
+                // is created instead of modifying the cached one.
+                auto tmp = std::shared_ptr<Transform>(new Transform);
+                tmp->processor = out->processor;
+                tmp->lut3DSize = lut3DSize;
+                sampleLUT3D(tmp->processor, lut3DSize, tmp->lut3D);
+                cache.add(key, tmp);
+                out = tmp;
+            }
+            return out;
+        }
+
+        void CPUProcessor::Private::process(
+            const std::shared_ptr<const Image::Data>& in,
+            const std::shared_ptr<Image::Data>& out,
+            uint16_t y0,
+            uint16_t y1,
+            const std::shared_ptr<Transform>& transform,
+            bool lut3D)
+        {
+            const Image::Info& info = in->getInfo();
+            const Image::Type outType = out->getType();
+            const uint8_t channelCount = Image::getChannelCount(outType);
+            const Image::Type floatType = 4 == channelCount ? Image::Type::RGBA_F32 : Image::Type::RGB_F32;
+            const uint16_t w = info.size.w;
+            const uint16_t rows = y1 - y0;
+            const size_t pixelCount = static_cast<size_t>(w) * rows;
+
+            // Convert the rows to floating point.
+            std::vector<float> buf(pixelCount * channelCount);
+            std::vector<uint8_t> swap;
+            const bool endian = info.layout.endian != Memory::getEndian();
+            size_t wordSize = 0;
+            size_t wordCount = 0;
+            if (endian)
+            {
+                wordSize = Image::DataType::U10 == Image::getDataType(info.type) ?
+                    4 :
+                    Image::getByteCount(Image::getDataType(info.type));
+                wordCount = w * Image::getByteCount(info.type) / wordSize;
+                swap.resize(w * Image::getByteCount(info.type));
+            }
+            for (uint16_t y = y0; y < y1; ++y)
+            {
+                const uint8_t* p = in->getData(y);
+                if (endian)
+                {
+                    Memory::endian(p, swap.data(), wordCount, wordSize);
+                    p = swap.data();
+                }
+                Image::convert(p, info.type, buf.data() + static_cast<size_t>(y - y0) * w * channelCount, floatType, w);
+            }
+
+            // Apply the transform.
+            if (!transform->noOp)
+            {
+                if (lut3D && transform->lut3D.size())
+                {
+                    applyLUT3D(buf.data(), pixelCount, channelCount, transform->lut3D.data(), transform->lut3DSize);
+                }
+                else
+                {
+                    _OCIO::PackedImageDesc desc(buf.data(), w, rows, channelCount);
+                    transform->processor->apply(desc);
+                }
+            }
+
+            // Convert the rows to the output type.
+            for (uint16_t y = y0; y < y1; ++y)
+            {
+                Image::convert(buf.data() + static_cast<size_t>(y - y0) * w * channelCount, floatType, out->getData(y), outType, w);
+            }
+        }
+
+    } // namespace OCIO
+} // namespace djv
@@ -0,0 +1,87 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvOCIO/OCIO.h>
+
+#include <memory>
+
+namespace djv
+{
+    namespace Image
+    {
+        class Data;
+
+    } // namespace Image
+
+    namespace OCIO
+    {
+        //! This constant provides the default 3D LUT size for CPU processing.
+        const size_t cpuLUT3DSizeDefault = 33;
+
+        //! This constant provides the default maximum number of cached
+        //! CPU transforms.
+        const size_t cpuProcessorCacheMaxDefault = 16;
+
+        //! This class provides color space conversions of image data on the
+        //! CPU, using the current OpenColorIO configuration (as set by
+        //! OCIOSystem). This allows images to be converted without an OpenGL
+        //! context, for example when writing files.
+        //!
+        //! Images are processed in tiles of rows in parallel. Integer images
+        //! are converted with a 3D LUT sampled from the transform and
+        //! tetrahedral interpolation, floating point images are converted with
+        //! the full transform so that values outside of the 0-1 range are
+        //! preserved.
+        //!
+        //! Transforms are cached by the conversion and the configuration, so
+        //! changing the configuration does not require clearing the cache.
+        //!
+        //! This class is thread safe.
+        class CPUProcessor
+        {
+            DJV_NON_COPYABLE(CPUProcessor);
+            void _init();
+            CPUProcessor();
+
+        public:
+            ~CPUProcessor();
+
+            static std::shared_ptr<CPUProcessor> create();
+
+            //! \name Options
+            ///@{
+
+            size_t getThreadCount() const;
+            bool hasLUT3D() const;
+            size_t getLUT3DSize() const;
+            size_t getCacheMax() const;
+            size_t getCacheSize() const;
+
+            void setThreadCount(size_t);
+            void setLUT3D(bool);
+            void setLUT3DSize(size_t);
+            void setCacheMax(size_t);
+            void clearCache();
+
+            ///@}
+
+            //! \name Processing
+            ///@{
+
+            //! Convert the color space of an image. Luminance images are
+            //! converted to RGB images with the same data type.
+            //! Throws:
+            //! - std::exception
+            std::shared_ptr<Image::Data> process(const std::shared_ptr<const Image::Data>&, const Convert&);
+
+            ///@}
+
+        private:
+            DJV_PRIVATE();
+        };
+
+    } // namespace OCIO
+} // namespace djv
@@ -0,0 +1,93 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+#include <djvOCIO/CPUProcessorFunc.h>
+
+#include <djvMath/MathFunc.h>
+
+#include <algorithm>
+
+namespace djv
+{
+    namespace OCIO
+    {
+        void applyLUT3D(float* data, size_t pixelCount, size_t channelCount, const float* lut, size_t size)
+        {
+            const float max = static_cast<float>(size - 1);
+            const size_t strideG = size * 3;
+            const size_t strideB = size * size * 3;
+            for (size_t i = 0; i < pixelCount; ++i, data += channelCount)
+            {
+                const float r = Math::clamp(data[0], 0.F, 1.F) * max;
+                const float g = Math::clamp(data[1], 0.F, 1.F) * max;
+                const float b = Math::clamp(data[2], 0.F, 1.F) * max;
+                const size_t ri = std::min(static_cast<size_t>(r), size - 2);
+                const size_t gi = std::min(static_cast<size_t>(g), size - 2);
+                const size_t bi = std::min(static_cast<size_t>(b), size - 2);
+                const float dr = r - ri;
+                const float dg = g - gi;
+                const float db = b - bi;
+
+                const float* c000 = lut + bi * strideB + gi * strideG + ri * 3;
+                const float* c111 = c000 + strideB + strideG + 3;
+
+                // Find the tetrahedron that contains the point and the
+                // weights for its two inner vertices.
+                const float* c1 = nullptr;
+                const float* c2 = nullptr;
+                float w0 = 0.F;
+                float w1 = 0.F;
+                float w2 = 0.F;
+                float w3 = 0.F;
+                if (dr > dg)
+                {
+                    if (dg > db)
+                    {
+                        c1 = c000 + 3;
+                        c2 = c000 + strideG + 3;
+                        w0 = 1.F - dr; w1 = dr - dg; w2 = dg - db; w3 = db;
+                    }
+                    else if (dr > db)
+                    {
+                        c1 = c000 + 3;
+                        c2 = c000 + strideB + 3;
+                        w0 = 1.F - dr; w1 = dr - db; w2 = db - dg; w3 = dg;
+                    }
+                    else
+                    {
+                        c1 = c000 + strideB;
+                        c2 = c000 + strideB + 3;
+                        w0 = 1.F - db; w1 = db - dr; w2 = dr - dg; w3 = dg;
+                    }
+                }
+                else
+                {
+                    if (db > dg)
+                    {
+                        c1 = c000 + strideB;
+                        c2 = c000 + strideB + strideG;
+                        w0 = 1.F - db; w1 = db - dg; w2 = dg - dr; w3 = dr;
+                    }
+                    else if (db > dr)
+                    {
+                        c1 = c000 + strideG;
+                        c2 = c000 + strideB + strideG;
+                        w0 = 1.F - dg; w1 = dg - db; w2 = db - dr; w3 = dr;
+                    }
+                    else
+                    {
+                        c1 = c000 + strideG;
+                        c2 = c000 + strideG + 3;
+                        w0 = 1.F - dg; w1 = dg - dr; w2 = dr - db; w3 = db;
+                    }
+                }
+                for (size_t c = 0; c < 3; ++c)
+                {
+                    data[c] = w0 * c000[c] + w1 * c1[c] + w2 * c2[c] + w3 * c111[c];
+                }
+            }
+        }
+
+    } // namespace OCIO
+} // namespace djv
@@ -0,0 +1,20 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+
+namespace djv
+{
+    namespace OCIO
+    {
+        //! Apply a 3D LUT to RGB or RGBA pixels with tetrahedral interpolation.
+        //! The LUT has size * size * size RGB entries with the red index
+        //! changing fastest. The input values are clamped to the 0-1 range and
+        //! alpha is left unchanged.
+        void applyLUT3D(float* data, size_t pixelCount, size_t channelCount, const float* lut, size_t size);
+
+    } // namespace OCIO
+} // namespace djv
@@ -37,6 +37,8 @@ namespace djv
         {
             Atlas,
             Dynamic,
+            Tiled,      //!< Split the image into texture tiles and only upload
+                        //!< the tiles that are visible
 
             Count,
             First = Atlas
@@ -7,6 +7,7 @@
 #include <djvSystem/Context.h>
 #include <djvSystem/CoreSystem.h>
 #include <djvSystem/FileInfoFunc.h>
+#include <djvSystem/MemorySystem.h>
 #include <djvSystem/ResourceSystem.h>
 #include <djvSystem/TimerFunc.h>
 
@@ -19,6 +20,8 @@
 #include FT_FREETYPE_H
 #include FT_GLYPH_H
 
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <codecvt>
 #include <condition_variable>
@@ -26,6 +29,7 @@
 #include <locale>
 #include <mutex>
 #include <thread>
+#include <tuple>
 
 using namespace djv::Core;
 
@@ -77,6 +81,8 @@ namespace djv
             {
                 //! \todo Should this be configurable?
                 const size_t glyphCacheMax = 10000;
+                const size_t textCacheMax = 10000;
+                const size_t textCacheShards = 16;
 
                 class MetricsRequest
                 {
@@ -139,6 +145,103 @@ namespace djv
                     std::promise<std::vector<TextLine> > promise;
                 };
 
+                //! This class provides a key for cached text results.
+                class TextKey
+                {
+                public:
+                    TextKey() {}
+                    TextKey(const std::string& text, const FontInfo& fontInfo, uint16_t value) :
+                        text(text),
+                        fontInfo(fontInfo),
+                        value(value)
+                    {
+                        hash = std::hash<std::string>()(text);
+                        Memory::hashCombine(hash, fontInfo.getFamily());
+                        Memory::hashCombine(hash, fontInfo.getFace());
+                        Memory::hashCombine(hash, fontInfo.getSize());
+                        Memory::hashCombine(hash, fontInfo.getDPI());
+                        Memory::hashCombine(hash, value);
+                    }
+
+                    std::string text;
+                    FontInfo fontInfo;
+                    uint16_t value = 0;
+                    size_t hash = 0;
+
+                    bool operator < (const TextKey& other) const
+                    {
+                        return
+                            std::tie(hash, value, fontInfo, text) <
+                            std::tie(other.hash, other.value, other.fontInfo, other.text);
+                    }
+                };
+
+                //! This class provides a thread-safe cache of text results. The
+                //! cache is split into shards so the UI thread and the font
+                //! thread rarely wait on the same lock.
+                template<typename T>
+                class TextCache
+                {
+                public:
+                    TextCache()
+                    {
+                        for (auto& i : _shards)
+                        {
+                            i.cache.setMax(textCacheMax / textCacheShards);
+                        }
+                    }
+
+                    bool get(const TextKey& key, T& value)
+                    {
+                        auto& shard = _shards[key.hash % textCacheShards];
+                        std::unique_lock<std::mutex> lock(shard.mutex);
+                        return shard.cache.get(key, value);
+                    }
+
+                    void add(const TextKey& key, const T& value)
+                    {
+                        auto& shard = _shards[key.hash % textCacheShards];
+                        std::unique_lock<std::mutex> lock(shard.mutex);
+                        shard.cache.add(key, value);
+                    }
+
+                    void clear()
+                    {
+                        for (auto& i : _shards)
+                        {
+                            std::unique_lock<std::mutex> lock(i.mutex);
+                            i.cache.clear();
+                        }
+                    }
+
+                    size_t getSize() const
+                    {
+                        size_t out = 0;
+                        for (const auto& i : _shards)
+                        {
+                            std::unique_lock<std::mutex> lock(i.mutex);
+                            out += i.cache.getSize();
+                        }
+                        return out;
+                    }
+
+                private:
+                    struct Shard
+                    {
+                        mutable std::mutex mutex;
+                        Memory::Cache<TextKey, T> cache;
+                    };
+                    std::array<Shard, textCacheShards> _shards;
+                };
+
+                template<typename T>
+                std::future<T> getReadyFuture(const T& value)
+                {
+                    std::promise<T> promise;
+                    promise.set_value(value);
+                    return promise.get_future();
+                }
+
                 constexpr bool isSpace(djv_char_t c)
                 {
                     return ' ' == c || '\t' == c;
@@ -218,6 +321,7 @@ namespace djv
 
                 FT_Library ftLibrary = nullptr;
                 System::File::Path fontPath;
+                std::shared_ptr<System::File::ResourcePack> resourcePack;
                 std::map<FamilyID, std::string> fontFileNames;
                 std::map<FamilyID, std::string> fontNames;
                 std::shared_ptr<Observer::MapSubject<FamilyID, std::string> > fontNamesSubject;
@@ -247,6 +351,18 @@ namespace djv
                 Memory::Cache<GlyphInfo, std::shared_ptr<Glyph> > glyphCache;
                 std::atomic<size_t> glyphCacheSize;
                 std::atomic<float> glyphCachePercentageUsed;
+                size_t glyphByteCountTotal = 0;
+                size_t glyphCountTotal = 0;
+                std::atomic<size_t> glyphCacheByteCount;
+                std::atomic<float> glyphCacheScale;
+                std::shared_ptr<System::MemorySystem> memorySystem;
+                UID memoryCacheUID = 0;
+                TextCache<Metrics> metricsCache;
+                TextCache<glm::vec2> measureCache;
+                TextCache<std::vector<std::shared_ptr<Glyph> > > glyphsCache;
+                TextCache<std::vector<TextLine> > textLinesCache;
+
+                void clearTextCaches();
 
                 std::shared_ptr<System::Timer> statsTimer;
                 std::thread thread;
@@ -275,11 +391,14 @@ namespace djv
                 addDependency(context->getSystemT<System::CoreSystem>());
 
                 p.fontPath = _getResourceSystem()->getPath(System::File::ResourcePath::Fonts);
+                p.resourcePack = _getResourceSystem()->getResourcePack();
                 p.fontNamesSubject = Observer::MapSubject<FamilyID, std::string>::create();
                 p.fontFaceNamesSubject = Observer::MapSubject<FamilyID, std::map<FaceID, std::string> >::create();
                 p.glyphCache.setMax(glyphCacheMax);
                 p.glyphCacheSize = 0;
                 p.glyphCachePercentageUsed = 0.F;
+                p.glyphCacheByteCount = 0;
+                p.glyphCacheScale = 1.F;
 
                 p.fontNamesTimer = System::Timer::create(context);
                 p.fontNamesTimer->setRepeating(true);
@@ -309,6 +428,9 @@ namespace djv
                     std::stringstream ss;
                     ss << "Glyph cache: " << p.glyphCacheSize << ", " << p.glyphCachePercentageUsed << "%";
                     _log(ss.str());
+                    std::stringstream ss2;
+                    ss2 << "Text cache: " << getTextCacheSize();
+                    _log(ss2.str());
                 });
 
                 p.running = true;
@@ -333,6 +455,7 @@ namespace djv
                                     p.lcdRendering != p.lcdRenderingThread ||
                                     p.metricsQueue.size() ||
                                     p.measureQueue.size() ||
+                                    p.measureGlyphsQueue.size() ||
                                     p.glyphsQueue.size() ||
                                     p.textLinesQueue.size();
                             });
@@ -349,9 +472,24 @@ namespace djv
                         }
                         if (lcdRenderingChanged)
                         {
+                            lcdRenderingChanged = false;
+                            p.clearTextCaches();
                             p.glyphCache.clear();
                             p.glyphCacheSize = 0;
                             p.glyphCachePercentageUsed = 0.F;
+                            p.glyphCacheByteCount = 0;
+                        }
+                        const size_t glyphCacheScaledMax = std::max(
+                            static_cast<size_t>(glyphCacheMax * p.glyphCacheScale),
+                            static_cast<size_t>(1));
+                        if (glyphCacheScaledMax != p.glyphCache.getMax())
+                        {
+                            p.glyphCache.setMax(glyphCacheScaledMax);
+                            p.glyphCacheSize = p.glyphCache.getSize();
+                            p.glyphCachePercentageUsed = p.glyphCache.getPercentageUsed();
+                            p.glyphCacheByteCount = p.glyphCountTotal > 0 ?
+                                (p.glyphCacheSize * p.glyphByteCountTotal / p.glyphCountTotal) :
+                                0;
                         }
                         if (p.metricsRequests.size())
                         {
@@ -377,6 +515,32 @@ namespace djv
                     _delFreeType();
                 });
 
+                p.memorySystem = context->getSystemT<System::MemorySystem>();
+                if (p.memorySystem)
+                {
+                    auto weak = std::weak_ptr<FontSystem>(std::dynamic_pointer_cast<FontSystem>(shared_from_this()));
+                    System::MemoryCacheData memoryCacheData;
+                    memoryCacheData.name = DJV_TEXT("render2d_memory_cache_glyphs");
+                    memoryCacheData.priority = System::MemoryCachePriority::High;
+                    memoryCacheData.byteCount = [weak]
+                    {
+                        size_t out = 0;
+                        if (auto system = weak.lock())
+                        {
+                            out = system->_p->glyphCacheByteCount;
+                        }
+                        return out;
+                    };
+                    memoryCacheData.scale = [weak](float value)
+                    {
+                        if (auto system = weak.lock())
+                        {
+                            system->_p->glyphCacheScale = value;
+                        }
+                    };
+                    p.memoryCacheUID = p.memorySystem->addCache(memoryCacheData);
+                }
+
                 _logInitTime();
             }
 
@@ -387,6 +551,10 @@ namespace djv
             FontSystem::~FontSystem()
             {
                 DJV_PRIVATE_PTR();
+                if (p.memorySystem)
+                {
+                    p.memorySystem->removeCache(p.memoryCacheUID);
+                }
                 p.running = false;
                 if (p.thread.joinable())
                 {
@@ -425,18 +593,36 @@ namespace djv
                 return _p->glyphCachePercentageUsed;
             }
 
+            size_t FontSystem::getTextCacheSize() const
+            {
+                DJV_PRIVATE_PTR();
+                return
+                    p.metricsCache.getSize() +
+                    p.measureCache.getSize() +
+                    p.glyphsCache.getSize() +
+                    p.textLinesCache.getSize();
+            }
+
             void FontSystem::setLCDRendering(bool value)
             {
                 DJV_PRIVATE_PTR();
                 if (value == p.lcdRendering)
                     return;
-                std::unique_lock<std::mutex> lock(p.requestMutex);
-                p.lcdRendering = value;
+                {
+                    std::unique_lock<std::mutex> lock(p.requestMutex);
+                    p.lcdRendering = value;
+                }
+                p.clearTextCaches();
             }
 
             std::future<Metrics> FontSystem::getMetrics(const FontInfo& fontInfo)
             {
                 DJV_PRIVATE_PTR();
+                Metrics metrics;
+                if (getCachedMetrics(fontInfo, metrics))
+                {
+                    return getReadyFuture(metrics);
+                }
                 MetricsRequest request;
                 request.fontInfo = fontInfo;
                 auto future = request.promise.get_future();
@@ -454,6 +640,11 @@ namespace djv
                 uint16_t elide)
             {
                 DJV_PRIVATE_PTR();
+                glm::vec2 size = glm::vec2(0.F, 0.F);
+                if (getCachedSize(text, fontInfo, elide, size))
+                {
+                    return getReadyFuture(size);
+                }
                 MeasureRequest request;
                 request.text = text;
                 request.fontInfo = fontInfo;
@@ -492,6 +683,11 @@ namespace djv
                 uint16_t elide)
             {
                 DJV_PRIVATE_PTR();
+                std::vector<std::shared_ptr<Glyph> > glyphs;
+                if (getCachedGlyphs(text, fontInfo, elide, glyphs))
+                {
+                    return getReadyFuture(glyphs);
+                }
                 GlyphsRequest request;
                 request.text = text;
                 request.fontInfo = fontInfo;
@@ -511,6 +707,11 @@ namespace djv
                 const FontInfo& fontInfo)
             {
                 DJV_PRIVATE_PTR();
+                std::vector<TextLine> lines;
+                if (getCachedTextLines(text, maxLineWidth, fontInfo, lines))
+                {
+                    return getReadyFuture(lines);
+                }
                 TextLinesRequest request;
                 request.text = text;
                 request.fontInfo = fontInfo;
@@ -524,6 +725,38 @@ namespace djv
                 return future;
             }
 
+            bool FontSystem::getCachedMetrics(const FontInfo& fontInfo, Metrics& metrics)
+            {
+                return _p->metricsCache.get(TextKey(std::string(), fontInfo, 0), metrics);
+            }
+
+            bool FontSystem::getCachedSize(
+                const std::string& text,
+                const FontInfo& fontInfo,
+                uint16_t elide,
+                glm::vec2& size)
+            {
+                return _p->measureCache.get(TextKey(text, fontInfo, elide), size);
+            }
+
+            bool FontSystem::getCachedGlyphs(
+                const std::string& text,
+                const FontInfo& fontInfo,
+                uint16_t elide,
+                std::vector<std::shared_ptr<Glyph> >& glyphs)
+            {
+                return _p->glyphsCache.get(TextKey(text, fontInfo, elide), glyphs);
+            }
+
+            bool FontSystem::getCachedTextLines(
+                const std::string& text,
+                uint16_t maxLineWidth,
+                const FontInfo& fontInfo,
+                std::vector<TextLine>& textLines)
+            {
+                return _p->textLinesCache.get(TextKey(text, fontInfo, maxLineWidth), textLines);
+            }
+
             void FontSystem::cacheGlyphs(const std::string& text, const FontInfo& fontInfo)
             {
                 DJV_PRIVATE_PTR();
@@ -557,9 +790,37 @@ namespace djv
                         ss << "FreeType version: " << versionMajor << "." << versionMinor << "." << versionPatch;
                         _log(ss.str());
                     }
-                    for (const auto& i : System::File::directoryList(p.fontPath))
+
+                    // Get the font files, the resource pack is used if available
+                    // so the fonts can be loaded directly from memory.
+                    std::vector<std::string> fileNames;
+                    std::vector<System::File::ResourcePackEntry> resourcePackEntries;
+                    if (p.resourcePack)
+                    {
+                        const std::string prefix = System::ResourceSystem::getResourceName(System::File::ResourcePath::Fonts, std::string());
+                        for (const auto& i : p.resourcePack->getNames())
+                        {
+                            System::File::ResourcePackEntry entry;
+                            if (0 == i.compare(0, prefix.size(), prefix) && p.resourcePack->getEntry(i, entry))
+                            {
+                                fileNames.push_back(i);
+                                resourcePackEntries.push_back(entry);
+                            }
+                        }
+                    }
+                    if (fileNames.empty())
                     {
-                        const std::string& fileName = i.getFileName();
+                        for (const auto& i : System::File::directoryList(p.fontPath))
+                        {
+                            fileNames.push_back(i.getFileName());
+                            resourcePackEntries.push_back(System::File::ResourcePackEntry());
+                        }
+                    }
+
+                    for (size_t i = 0; i < fileNames.size(); ++i)
+                    {
+                        const std::string& fileName = fileNames[i];
+                        const auto& resourcePackEntry = resourcePackEntries[i];
                         {
                             std::stringstream ss;
                             ss << "Loading font: " << fileName;
@@ -567,7 +828,14 @@ namespace djv
                         }
 
                         FT_Face ftFace;
-                        ftError = FT_New_Face(p.ftLibrary, fileName.c_str(), 0, &ftFace);
+                        ftError = resourcePackEntry.data ?
+                            FT_New_Memory_Face(
+                                p.ftLibrary,
+                                resourcePackEntry.data,
+                                static_cast<FT_Long>(resourcePackEntry.size),
+                                0,
+                                &ftFace) :
+                            FT_New_Face(p.ftLibrary, fileName.c_str(), 0, &ftFace);
                         if (ftError)
                         {
                             std::stringstream ss;
@@ -683,6 +951,7 @@ namespace djv
                             metrics.lineHeight = static_cast<float>(ftFace->size->metrics.height) / 64.F;
                         }
                     }
+                    p.metricsCache.add(TextKey(std::string(), request.fontInfo, 0), metrics);
                     request.promise.set_value(std::move(metrics));
                 }
                 p.metricsRequests.clear();
@@ -717,6 +986,7 @@ namespace djv
                         ss << "Error converting string" << " '" << request.text << "': " << e.what();
                         _log(ss.str(), System::LogLevel::Error);
                     }
+                    p.measureCache.add(TextKey(request.text, request.fontInfo, request.elide), size);
                     request.promise.set_value(size);
                 }
                 p.measureRequests.clear();
@@ -798,6 +1068,7 @@ namespace djv
                             glyphs[i + 1] = p.getGlyph('.', fontInfoList);
                             glyphs[i + 2] = p.getGlyph('.', fontInfoList);
                         }
+                        p.glyphsCache.add(TextKey(request.text, request.fontInfo, request.elide), glyphs);
                         request.promise.set_value(std::move(glyphs));
                     }
                 }
@@ -1006,11 +1277,20 @@ namespace djv
                             }
                         }
                     }
+                    p.textLinesCache.add(TextKey(request.text, request.fontInfo, request.maxLineWidth), lines);
                     request.promise.set_value(lines);
                 }
                 p.textLinesRequests.clear();
             }
 
+            void FontSystem::Private::clearTextCaches()
+            {
+                metricsCache.clear();
+                measureCache.clear();
+                glyphsCache.clear();
+                textLinesCache.clear();
+            }
+
             std::vector<FontInfo> FontSystem::Private::getFontInfoList(const FontInfo& fontInfo) const
             {
                 std::vector<FontInfo> out;
@@ -1110,6 +1390,16 @@ namespace djv
                             glyphCacheSize = glyphCache.getSize();
                             glyphCachePercentageUsed = glyphCache.getPercentageUsed();
 
+                            // Estimate the size of the cache from the average
+                            // glyph size, since summing the glyphs on every add
+                            // would be too slow.
+                            if (out->imageData)
+                            {
+                                glyphByteCountTotal += out->imageData->getDataByteCount();
+                            }
+                            ++glyphCountTotal;
+                            glyphCacheByteCount = glyphCacheSize * glyphByteCountTotal / glyphCountTotal;
+
                             break;
                         }
                     }
@@ -131,6 +131,10 @@ namespace djv
 
             //! This class provides a font system.
             //!
+            //! Text results are cached by text, font, and elide or line width
+            //! so that repeated requests can be answered without waiting on the
+            //! font thread.
+            //!
             //! \todo Add support for gamma correction?
             //! - https://www.freetype.org/freetype2/docs/text-rendering-general.html
             class FontSystem : public System::ISystem
@@ -165,6 +169,10 @@ namespace djv
                 //! Get the glyph cache percentage used.
                 float getGlyphCachePercentage() const;
 
+                //! Get the number of cached text results (sizes, glyphs, and
+                //! text lines).
+                size_t getTextCacheSize() const;
+
                 ///@}
 
                 //! \name Options
@@ -181,12 +189,24 @@ namespace djv
                 //! Get font metrics.
                 std::future<Metrics> getMetrics(const FontInfo&);
 
+                //! Get font metrics if they have already been cached. This
+                //! does not wait on the font thread.
+                bool getCachedMetrics(const FontInfo&, Metrics&);
+
                 //! Measure the size of text.
                 std::future<glm::vec2> measure(
                     const std::string& text,
                     const FontInfo&    fontInfo,
                     uint16_t           elide    = 0);
 
+                //! Get the size of text if it has already been measured. This
+                //! does not wait on the font thread.
+                bool getCachedSize(
+                    const std::string& text,
+                    const FontInfo&    fontInfo,
+                    uint16_t           elide,
+                    glm::vec2&         size);
+
                 //! Measure the size of glyphs.
                 std::future<std::vector<Math::BBox2f> > measureGlyphs(
                     const std::string& text,
@@ -204,12 +224,28 @@ namespace djv
                     const FontInfo&    fontInfo,
                     uint16_t           elide    = 0);
 
+                //! Get font glyphs if they have already been cached. This
+                //! does not wait on the font thread.
+                bool getCachedGlyphs(
+                    const std::string&                    text,
+                    const FontInfo&                       fontInfo,
+                    uint16_t                              elide,
+                    std::vector<std::shared_ptr<Glyph> >& glyphs);
+
                 //! Break text into lines for wrapping.
                 std::future<std::vector<TextLine> > textLines(
                     const std::string& text,
                     uint16_t           maxLineWidth,
                     const FontInfo&    fontInfo);
 
+                //! Get the text lines if they have already been cached. This
+                //! does not wait on the font thread.
+                bool getCachedTextLines(
+                    const std::string&     text,
+                    uint16_t               maxLineWidth,
+                    const FontInfo&        fontInfo,
+                    std::vector<TextLine>& textLines);
+
                 //! Request font glyphs to be cached.
                 void cacheGlyphs(const std::string& text, const FontInfo&);
 
@@ -0,0 +1,333 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvRender2D/ImageSampler.h>
+
+#include <djvRender2D/RenderPrivate.h>
+
+#include <djvOCIO/CPUProcessor.h>
+
+#include <djvImage/Data.h>
+#include <djvImage/TypeFunc.h>
+
+#include <djvCore/MemoryFunc.h>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace Render2D
+    {
+        namespace
+        {
+            // Convert pixels to RGBA floating point values.
+            template<typename T>
+            void readPixels(const uint8_t* in, size_t count, uint8_t channelCount, float scale, float* out)
+            {
+                const T* p = reinterpret_cast<const T*>(in);
+                switch (channelCount)
+                {
+                case 1:
+                    for (size_t i = 0; i < count; ++i, p += 1, out += 4)
+                    {
+                        out[0] = out[1] = out[2] = static_cast<float>(p[0]) * scale;
+                        out[3] = 1.F;
+                    }
+                    break;
+                case 2:
+                    for (size_t i = 0; i < count; ++i, p += 2, out += 4)
+                    {
+                        out[0] = out[1] = out[2] = static_cast<float>(p[0]) * scale;
+                        out[3] = static_cast<float>(p[1]) * scale;
+                    }
+                    break;
+                case 3:
+                    for (size_t i = 0; i < count; ++i, p += 3, out += 4)
+                    {
+                        out[0] = static_cast<float>(p[0]) * scale;
+                        out[1] = static_cast<float>(p[1]) * scale;
+                        out[2] = static_cast<float>(p[2]) * scale;
+                        out[3] = 1.F;
+                    }
+                    break;
+                case 4:
+                    for (size_t i = 0; i < count; ++i, p += 4, out += 4)
+                    {
+                        out[0] = static_cast<float>(p[0]) * scale;
+                        out[1] = static_cast<float>(p[1]) * scale;
+                        out[2] = static_cast<float>(p[2]) * scale;
+                        out[3] = static_cast<float>(p[3]) * scale;
+                    }
+                    break;
+                default: break;
+                }
+            }
+
+            void readPixelsU10(const uint8_t* in, size_t count, float* out)
+            {
+                const Image::U10_S* p = reinterpret_cast<const Image::U10_S*>(in);
+                for (size_t i = 0; i < count; ++i, ++p, out += 4)
+                {
+                    out[0] = p->r / 1023.F;
+                    out[1] = p->g / 1023.F;
+                    out[2] = p->b / 1023.F;
+                    out[3] = 1.F;
+                }
+            }
+
+        } // namespace
+
+        struct ImageSampler::Private
+        {
+            std::shared_ptr<OCIO::CPUProcessor> cpuProcessor;
+        };
+
+        void ImageSampler::_init()
+        {
+            DJV_PRIVATE_PTR();
+            p.cpuProcessor = OCIO::CPUProcessor::create();
+            p.cpuProcessor->setThreadCount(1);
+        }
+
+        ImageSampler::ImageSampler() :
+            _p(new Private)
+        {}
+
+        ImageSampler::~ImageSampler()
+        {}
+
+        std::shared_ptr<ImageSampler> ImageSampler::create()
+        {
+            auto out = std::shared_ptr<ImageSampler>(new ImageSampler);
+            out->_init();
+            return out;
+        }
+
+        Image::Color ImageSampler::sample(
+            const std::shared_ptr<const Image::Data>& image,
+            const Math::BBox2i& area,
+            const ImageOptions& options,
+            Image::Type type)
+        {
+            DJV_PRIVATE_PTR();
+            if (!image || !image->isValid())
+            {
+                return Image::Color();
+            }
+            const auto& info = image->getInfo();
+            if (Image::Type::None == type)
+            {
+                type = info.type;
+            }
+
+            // Convert the area to image data coordinates and clamp it.
+            const int w = info.size.w;
+            const int h = info.size.h;
+            int x0 = area.min.x;
+            int x1 = area.max.x;
+            int y0 = area.min.y;
+            int y1 = area.max.y;
+            if (info.layout.mirror.x != options.mirror.x)
+            {
+                x0 = w - 1 - area.max.x;
+                x1 = w - 1 - area.min.x;
+            }
+            if (info.layout.mirror.y != options.mirror.y)
+            {
+                y0 = h - 1 - area.max.y;
+                y1 = h - 1 - area.min.y;
+            }
+            x0 = std::max(x0, 0);
+            x1 = std::min(x1, w - 1);
+            y0 = std::max(y0, 0);
+            y1 = std::min(y1, h - 1);
+            if (x1 < x0 || y1 < y0)
+            {
+                return Image::Color(type);
+            }
+            const size_t areaW = static_cast<size_t>(x1 - x0 + 1);
+            const size_t areaH = static_cast<size_t>(y1 - y0 + 1);
+            const size_t pixelCount = areaW * areaH;
+
+            // Convert the pixels to RGBA floating point values.
+            auto buf = std::make_shared<std::vector<float> >(pixelCount * 4);
+            const Image::DataType dataType = Image::getDataType(info.type);
+            const uint8_t channelCount = Image::getChannelCount(info.type);
+            const bool endian = info.layout.endian != Memory::getEndian();
+            const size_t wordSize = Image::DataType::U10 == dataType ? 4 : Image::getByteCount(dataType);
+            const size_t rowByteCount = areaW * image->getPixelByteCount();
+            std::vector<uint8_t> swap(endian ? rowByteCount : 0);
+            for (size_t y = 0; y < areaH; ++y)
+            {
+                const uint8_t* in = image->getData(static_cast<uint16_t>(x0), static_cast<uint16_t>(y0 + y));
+                if (endian)
+                {
+                    Memory::endian(in, swap.data(), rowByteCount / wordSize, wordSize);
+                    in = swap.data();
+                }
+                float* out = buf->data() + y * areaW * 4;
+                switch (dataType)
+                {
+                case Image::DataType::U8:  readPixels<Image::U8_T>(in, areaW, channelCount, 1.F / 255.F, out); break;
+                case Image::DataType::U10: readPixelsU10(in, areaW, out); break;
+                case Image::DataType::U16: readPixels<Image::U16_T>(in, areaW, channelCount, 1.F / 65535.F, out); break;
+                case Image::DataType::U32: readPixels<Image::U32_T>(in, areaW, channelCount, 1.F / 4294967295.F, out); break;
+                case Image::DataType::F16: readPixels<Image::F16_T>(in, areaW, channelCount, 1.F, out); break;
+                case Image::DataType::F32: readPixels<Image::F32_T>(in, areaW, channelCount, 1.F, out); break;
+                default: break;
+                }
+            }
+
+            // Apply the color operations, see djvRender2DFragment.glsl.
+            const bool colorMatrixEnabled = options.colorEnabled && options.color != ImageColor();
+            const glm::mat4x4 m = colorMatrixEnabled ? colorMatrix(options.color) : glm::mat4x4(1.F);
+            const bool colorInvert = options.colorEnabled && options.color.invert;
+            const bool levelsEnabled = options.levelsEnabled && options.levels != ImageLevels();
+            const float levelsGamma = 1.F / options.levels.gamma;
+            float exposureV = 0.F;
+            float exposureD = 0.F;
+            float exposureK = 0.F;
+            float exposureF = 0.F;
+            if (options.exposureEnabled)
+            {
+                exposureV = powf(2.F, options.exposure.exposure + 2.47393F);
+                exposureD = options.exposure.defog;
+                exposureK = powf(2.F, options.exposure.kneeLow);
+                exposureF = knee2(
+                    powf(2.F, options.exposure.kneeHigh) - exposureK,
+                    powf(2.F, 3.5F) - exposureK);
+            }
+            const float softClip = options.softClipEnabled ? options.softClip : 0.F;
+            if (colorMatrixEnabled || colorInvert || levelsEnabled || options.exposureEnabled || softClip > 0.F)
+            {
+                float* p = buf->data();
+                for (size_t i = 0; i < pixelCount; ++i, p += 4)
+                {
+                    if (colorMatrixEnabled)
+                    {
+                        const glm::vec4 v = glm::vec4(p[0], p[1], p[2], 1.F) * m;
+                        p[0] = v[0];
+                        p[1] = v[1];
+                        p[2] = v[2];
+                    }
+                    for (size_t c = 0; c < 3; ++c)
+                    {
+                        float v = p[c];
+                        if (colorInvert)
+                        {
+                            v = 1.F - v;
+                        }
+                        if (levelsEnabled)
+                        {
+                            v = (v - options.levels.inLow) / options.levels.inHigh;
+                            if (v >= 0.F)
+                            {
+                                v = powf(v, levelsGamma);
+                            }
+                            v = v * options.levels.outHigh + options.levels.outLow;
+                        }
+                        if (options.exposureEnabled)
+                        {
+                            v = std::max(0.F, v - exposureD) * exposureV;
+                            if (v > exposureK)
+                            {
+                                v = exposureK + knee(v - exposureK, exposureF);
+                            }
+                            v *= .332F;
+                        }
+                        if (softClip > 0.F)
+                        {
+                            const float tmp = 1.F - softClip;
+                            if (v > tmp)
+                            {
+                                v = tmp + (1.F - expf(-(v - tmp) / softClip)) * softClip;
+                            }
+                        }
+                        p[c] = v;
+                    }
+                }
+            }
+
+            // Apply the color space conversion.
+            const float* data = buf->data();
+            std::shared_ptr<Image::Data> converted;
+            if (options.colorSpace.isValid())
+            {
+                const Image::Info bufInfo(static_cast<uint16_t>(areaW), static_cast<uint16_t>(areaH), Image::Type::RGBA_F32);
+                converted = p.cpuProcessor->process(
+                    Image::Data::create(bufInfo, reinterpret_cast<const uint8_t*>(buf->data()), buf),
+                    options.colorSpace);
+                data = reinterpret_cast<const float*>(converted->getData());
+            }
+
+            // Average the pixels. The four channels are accumulated
+            // separately so the loop can be vectorized.
+            double sum[4] = { 0.0, 0.0, 0.0, 0.0 };
+            for (size_t y = 0; y < areaH; ++y)
+            {
+                float rowSum[4] = { 0.F, 0.F, 0.F, 0.F };
+                const float* p = data + y * areaW * 4;
+                for (size_t x = 0; x < areaW; ++x, p += 4)
+                {
+                    rowSum[0] += p[0];
+                    rowSum[1] += p[1];
+                    rowSum[2] += p[2];
+                    rowSum[3] += p[3];
+                }
+                for (size_t c = 0; c < 4; ++c)
+                {
+                    sum[c] += rowSum[c];
+                }
+            }
+            float average[4];
+            for (size_t c = 0; c < 4; ++c)
+            {
+                average[c] = static_cast<float>(sum[c] / pixelCount);
+            }
+
+            // Apply the channel display.
+            switch (options.channelsDisplay)
+            {
+            case ImageChannelsDisplay::Red:
+                average[1] = average[2] = average[0];
+                break;
+            case ImageChannelsDisplay::Green:
+                average[0] = average[2] = average[1];
+                break;
+            case ImageChannelsDisplay::Blue:
+                average[0] = average[1] = average[2];
+                break;
+            case ImageChannelsDisplay::Alpha:
+                average[0] = average[1] = average[2] = average[3];
+                break;
+            default: break;
+            }
+
+            // Convert to the output type.
+            const uint8_t outChannelCount = Image::getChannelCount(type);
+            Image::Color out(Image::getFloatType(outChannelCount, 32));
+            switch (outChannelCount)
+            {
+            case 1:
+                out.setF32(average[0], 0);
+                break;
+            case 2:
+                out.setF32(average[0], 0);
+                out.setF32(average[3], 1);
+                break;
+            default:
+                for (uint8_t c = 0; c < outChannelCount; ++c)
+                {
+                    out.setF32(average[c], c);
+                }
+                break;
+            }
+            return out.convert(type);
+        }
+
+    } // namespace Render2D
+} // namespace djv
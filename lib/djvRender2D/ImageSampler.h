@@ -0,0 +1,56 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvRender2D/Data.h>
+
+#include <djvImage/Color.h>
+
+#include <djvMath/BBox.h>
+
+namespace djv
+{
+    namespace Image
+    {
+        class Data;
+
+    } // namespace Image
+
+    namespace Render2D
+    {
+        //! This class provides sampling of image colors on the CPU.
+        //!
+        //! The color operations, color space conversion, and channel display
+        //! are the same as the image shader, so the sampled colors match what
+        //! is drawn without reading back from the GPU.
+        class ImageSampler
+        {
+            DJV_NON_COPYABLE(ImageSampler);
+            void _init();
+            ImageSampler();
+
+        public:
+            ~ImageSampler();
+
+            static std::shared_ptr<ImageSampler> create();
+
+            //! Get the average color of an area of an image. The area is in
+            //! displayed pixel coordinates, that is with the image layout and
+            //! option mirroring applied, and it is clamped to the image. The
+            //! color has the given type, or the image type if none is given.
+            //! Throws:
+            //! - std::exception
+            Image::Color sample(
+                const std::shared_ptr<const Image::Data>&,
+                const Math::BBox2i& area,
+                const ImageOptions& = ImageOptions(),
+                Image::Type = Image::Type::None);
+
+        private:
+            DJV_PRIVATE();
+        };
+
+    } // namespace Render2D
+} // namespace djv
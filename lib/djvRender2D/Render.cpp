@@ -8,6 +8,7 @@
 
 #include <djvGL/GLFWSystem.h>
 #include <djvGL/MeshFunc.h>
+#include <djvGL/PixelBufferRing.h>
 #include <djvGL/Shader.h>
 #include <djvGL/Texture.h>
 #include <djvGL/TextureAtlas.h>
@@ -21,14 +22,19 @@
 
 #include <djvSystem/Context.h>
 #include <djvSystem/FileIO.h>
-#include <djvSystem/FileIOFunc.h>
+#include <djvSystem/FileInfoFunc.h>
 #include <djvSystem/LogSystem.h>
+#include <djvSystem/MemorySystem.h>
+#include <djvSystem/PathFunc.h>
 #include <djvSystem/ResourceSystem.h>
 #include <djvSystem/TimerFunc.h>
 
+#include <djvMath/MathFunc.h>
 #include <djvMath/Range.h>
 
 #include <djvCore/Cache.h>
+#include <djvCore/MemoryFunc.h>
+#include <djvCore/StringFunc.h>
 
 #include <OpenColorIO/OpenColorIO.h>
 
@@ -36,6 +42,18 @@
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/gtx/perpendicular.hpp>
 
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <iomanip>
+#include <set>
+
+#if defined(DJV_PLATFORM_WINDOWS)
+#include <sys/utime.h>
+#else // DJV_PLATFORM_WINDOWS
+#include <utime.h>
+#endif // DJV_PLATFORM_WINDOWS
+
 using namespace djv::Core;
 namespace _OCIO = OCIO_NAMESPACE;
 
@@ -51,6 +69,7 @@ namespace djv
             bool                                         textLCDRendering    = true;
 
             Math::BBox2f                                 viewport;
+            Math::BBox2f                                 paintRect;
             std::vector<std::shared_ptr<Primitive> >     primitives;
             size_t                                       primitivesCount     = 0;
             PrimitiveData                                primitiveData;
@@ -59,9 +78,18 @@ namespace djv
             std::map<UID, uint64_t>                      glyphTextureIDs;
             std::vector<std::shared_ptr<GL::Texture> >   dynamicTextures;
             std::map<UID, std::shared_ptr<GL::Texture> > dynamicTextureCache;
+            std::shared_ptr<GL::PixelBufferRing>         pixelBufferRing;
+            GLint                                        maxTextureSize      = 0;
+            Memory::Cache<ImageTileKey, std::shared_ptr<GL::Texture> > imageTileCache;
+            float                                        imageTileCacheScale = 1.F;
+            size_t                                       imageTileCacheByteCount = 0;
+            std::vector<std::shared_ptr<GL::Texture> >   frameImageTiles;
 #if !defined(DJV_GL_ES2)
-            std::map<OCIO::Convert, ColorSpaceData>      colorSpaceCache;
+            Memory::Cache<OCIO::Convert, ColorSpaceData> colorSpaceCache;
             size_t                                       colorSpaceID        = 1;
+            std::set<size_t>                             frameColorSpaces;
+            System::File::Path                           programBinaryPath;
+            std::string                                  programBinaryKey;
 #endif // DJV_GL_ES2
             std::vector<uint8_t>                         vboData;
             size_t                                       vboDataSize         = 0;
@@ -71,10 +99,17 @@ namespace djv
             std::string                                  vertexSource;
             std::string                                  fragmentFileName;
             std::string                                  fragmentSource;
+            Memory::Cache<std::vector<size_t>, std::shared_ptr<ProgramData> > programCache;
             std::shared_ptr<GL::Shader>                  shader;
             GLint                                        mvpLoc              = 0;
 
+            std::shared_ptr<DrawList>                    drawListRecording;
+            size_t                                       drawListPrimitivesStart = 0;
+            size_t                                       drawListVBOStart    = 0;
+
             std::shared_ptr<System::Timer>               statsTimer;
+            std::shared_ptr<System::MemorySystem>        memorySystem;
+            UID                                          memoryCacheUID      = 0;
 
             void vboDataSizeUpdate(size_t);
 
@@ -86,8 +121,21 @@ namespace djv
                 const glm::mat3x3& currentTransform,
                 const Math::BBox2f& currentClipRect,
                 const float finalColor[4]);
+            void drawImageTiles(
+                const std::shared_ptr<Image::Data>&,
+                const glm::vec2& pos,
+                const ImageOptions&,
+                const std::shared_ptr<ImagePrimitive>&,
+                const glm::mat3x3& currentTransform,
+                const Math::BBox2f& currentClipRect);
 
-            std::string getFragmentSource() const;
+            std::shared_ptr<ProgramData> createProgram(const std::vector<size_t>& colorSpaces);
+#if !defined(DJV_GL_ES2)
+            std::shared_ptr<GL::Shader> readProgramBinary(const System::File::Path&);
+            void writeProgramBinary(const System::File::Path&, const std::shared_ptr<GL::Shader>&);
+            void programBinaryCleanup();
+#endif // DJV_GL_ES2
+            std::string getFragmentSource(const std::vector<size_t>& colorSpaces) const;
         };
 
         void Render::_init(const std::shared_ptr<System::Context>& context)
@@ -125,6 +173,9 @@ namespace djv
                 GL_NEAREST,
                 0));
             p.primitiveData.textureAtlasCount = _textureAtlasCount;
+            p.maxTextureSize = maxTextureSize;
+            p.imageTileCache.setMax(imageTileCacheMax);
+            p.pixelBufferRing = GL::PixelBufferRing::create(pixelBufferRingCount);
 
             _imageFilterUpdate();
 
@@ -133,12 +184,9 @@ namespace djv
             try
             {
                 p.vertexFileName = std::string(System::File::Path(shaderPath, "djvRender2DVertex.glsl"));
-                auto io = System::File::IO::create();
-                io->open(p.vertexFileName, System::File::Mode::Read);
-                p.vertexSource = System::File::readContents(io);
+                p.vertexSource = resourceSystem->readContents(System::File::ResourcePath::Shaders, "djvRender2DVertex.glsl");
                 p.fragmentFileName = std::string(System::File::Path(shaderPath, "djvRender2DFragment.glsl"));
-                io->open(p.fragmentFileName, System::File::Mode::Read);
-                p.fragmentSource = System::File::readContents(io);
+                p.fragmentSource = resourceSystem->readContents(System::File::ResourcePath::Shaders, "djvRender2DFragment.glsl");
             }
             catch (const std::exception& e)
             {
@@ -146,6 +194,82 @@ namespace djv
                 logSystem->log("djv::Render::Render2D", e.what(), System::LogLevel::Error);
             }
 
+#if !defined(DJV_GL_ES2)
+            p.colorSpaceCache.setMax(colorSpaceCacheMax);
+
+            // Program binaries are only valid for the driver that created
+            // them, so the driver information is included in the key.
+            {
+                std::stringstream ss;
+                ss << glGetString(GL_VENDOR) << glGetString(GL_RENDERER) << glGetString(GL_VERSION);
+                p.programBinaryKey = ss.str();
+            }
+            try
+            {
+                GLint binaryFormatCount = 0;
+                glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &binaryFormatCount);
+                if (binaryFormatCount > 0)
+                {
+                    // Binaries from other drivers can't be used, so they are
+                    // kept in a separate directory that is removed when the
+                    // driver changes.
+                    const System::File::Path path(
+                        resourceSystem->getPath(System::File::ResourcePath::Documents),
+                        programBinaryDirectory);
+                    std::string driverDirectory;
+                    {
+                        size_t hash = 0;
+                        Memory::hashCombine(hash, p.programBinaryKey);
+                        std::stringstream ss;
+                        ss << std::hex << std::setfill('0') << std::setw(16) << hash;
+                        driverDirectory = ss.str();
+                    }
+                    if (!System::File::Info(path).doesExist())
+                    {
+                        System::File::mkdir(path);
+                    }
+                    for (const auto& i : System::File::directoryList(path))
+                    {
+                        switch (i.getType())
+                        {
+                        case System::File::Type::File:
+                            std::remove(i.getFileName().c_str());
+                            break;
+                        case System::File::Type::Directory:
+                            if (i.getFileName(Math::Frame::invalid, false) != driverDirectory)
+                            {
+                                for (const auto& j : System::File::directoryList(i.getPath()))
+                                {
+                                    std::remove(j.getFileName().c_str());
+                                }
+                                try
+                                {
+                                    System::File::rmdir(i.getPath());
+                                }
+                                catch (const std::exception&)
+                                {
+                                    // Try again the next time.
+                                }
+                            }
+                            break;
+                        default: break;
+                        }
+                    }
+                    p.programBinaryPath = System::File::Path(path, driverDirectory);
+                    if (!System::File::Info(p.programBinaryPath).doesExist())
+                    {
+                        System::File::mkdir(p.programBinaryPath);
+                    }
+                    p.programBinaryCleanup();
+                }
+            }
+            catch (const std::exception& e)
+            {
+                _log(e.what(), System::LogLevel::Error);
+            }
+#endif // DJV_GL_ES2
+            p.programCache.setMax(programCacheMax);
+
             p.statsTimer = System::Timer::create(context);
             p.statsTimer->setRepeating(true);
             p.statsTimer->start(
@@ -160,13 +284,44 @@ namespace djv
                     ss << "Glyph texture IDs: " << p.glyphTextureIDs.size() << "\n";
                     ss << "Dynamic textures: " << p.dynamicTextures.size() << "\n";
                     ss << "Dynamic texture cache: " << p.dynamicTextureCache.size() << "\n";
+                    ss << "Image tile cache: " << p.imageTileCache.getSize() << "\n";
+                    ss << "Pixel buffers: " << p.pixelBufferRing->getByteCount() / Memory::megabyte << "MB\n";
 #if !defined(DJV_GL_ES2)
-                    ss << "Color space cache: " << p.colorSpaceCache.size() << "\n";
+                    ss << "Color space cache: " << p.colorSpaceCache.getSize() << "\n";
 #endif // DJV_GL_ES2
+                    ss << "Program cache: " << p.programCache.getSize() << "\n";
                     ss << "VBO size: " << (p.vbo ? p.vbo->getSize() : 0);
                     _log(ss.str());
                 });
 
+            // The image tile cache is resized at the end of the frame when
+            // the OpenGL context is current.
+            p.memorySystem = context->getSystemT<System::MemorySystem>();
+            if (p.memorySystem)
+            {
+                auto weak = std::weak_ptr<Render>(std::dynamic_pointer_cast<Render>(shared_from_this()));
+                System::MemoryCacheData memoryCacheData;
+                memoryCacheData.name = DJV_TEXT("render2d_memory_cache_image_tiles");
+                memoryCacheData.priority = System::MemoryCachePriority::Medium;
+                memoryCacheData.byteCount = [weak]
+                {
+                    size_t out = 0;
+                    if (auto system = weak.lock())
+                    {
+                        out = system->_p->imageTileCacheByteCount;
+                    }
+                    return out;
+                };
+                memoryCacheData.scale = [weak](float value)
+                {
+                    if (auto system = weak.lock())
+                    {
+                        system->_p->imageTileCacheScale = value;
+                    }
+                };
+                p.memoryCacheUID = p.memorySystem->addCache(memoryCacheData);
+            }
+
             _logInitTime();
         }
 
@@ -175,7 +330,13 @@ namespace djv
         {}
 
         Render::~Render()
-        {}
+        {
+            DJV_PRIVATE_PTR();
+            if (p.memorySystem)
+            {
+                p.memorySystem->removeCache(p.memoryCacheUID);
+            }
+        }
 
         std::shared_ptr<Render> Render::create(const std::shared_ptr<System::Context>& context)
         {
@@ -185,11 +346,17 @@ namespace djv
         }
 
         void Render::beginFrame(const Image::Size& size)
+        {
+            beginFrame(size, Math::BBox2f(0.F, 0.F, static_cast<float>(size.w), static_cast<float>(size.h)));
+        }
+
+        void Render::beginFrame(const Image::Size& size, const Math::BBox2f& paintRect)
         {
             DJV_PRIVATE_PTR();
             _size = size;
             _currentClipRect = Math::BBox2f(0.F, 0.F, static_cast<float>(size.w), static_cast<float>(size.h));
             p.viewport = Math::BBox2f(0.F, 0.F, static_cast<float>(size.w), static_cast<float>(size.h));
+            p.paintRect = paintRect.intersect(p.viewport);
         }
 
         void Render::endFrame()
@@ -198,38 +365,20 @@ namespace djv
             
             p.primitivesCount = p.primitives.size();
 
-            if (!p.shader)
-            {
-                p.shader = GL::Shader::create(p.vertexSource, p.getFragmentSource());
-                p.shader->setVertexName(p.vertexFileName);
-                p.shader->setFragmentName(p.fragmentFileName);
-                const auto program = p.shader->getProgram();
-                p.mvpLoc = glGetUniformLocation(program, "transform.mvp");
-                p.primitiveData.imageChannelsLoc = glGetUniformLocation(program, "imageChannels");
-                p.primitiveData.colorModeLoc = glGetUniformLocation(program, "colorMode");
-                p.primitiveData.colorLoc = glGetUniformLocation(program, "color");
+            std::vector<size_t> colorSpaces;
 #if !defined(DJV_GL_ES2)
-                p.primitiveData.colorSpaceLoc = glGetUniformLocation(program, "colorSpace");
-                p.primitiveData.colorSpaceSamplerLoc = glGetUniformLocation(program, "colorSpaceSampler");
+            colorSpaces = std::vector<size_t>(p.frameColorSpaces.begin(), p.frameColorSpaces.end());
+            p.frameColorSpaces.clear();
 #endif // DJV_GL_ES2
-                p.primitiveData.imageChannelsDisplayLoc = glGetUniformLocation(program, "imageChannelsDisplay");
-                p.primitiveData.colorMatrixLoc = glGetUniformLocation(program, "colorMatrix");
-                p.primitiveData.colorMatrixEnabledLoc = glGetUniformLocation(program, "colorMatrixEnabled");
-                p.primitiveData.colorInvertLoc = glGetUniformLocation(program, "colorInvert");
-                p.primitiveData.levelsInLowLoc = glGetUniformLocation(program, "levels.inLow");
-                p.primitiveData.levelsInHighLoc = glGetUniformLocation(program, "levels.inHigh");
-                p.primitiveData.levelsGammaLoc = glGetUniformLocation(program, "levels.gamma");
-                p.primitiveData.levelsOutLowLoc = glGetUniformLocation(program, "levels.outLow");
-                p.primitiveData.levelsOutHighLoc = glGetUniformLocation(program, "levels.outHigh");
-                p.primitiveData.levelsEnabledLoc = glGetUniformLocation(program, "levelsEnabled");
-                p.primitiveData.exposureVLoc = glGetUniformLocation(program, "exposure.v");
-                p.primitiveData.exposureDLoc = glGetUniformLocation(program, "exposure.d");
-                p.primitiveData.exposureKLoc = glGetUniformLocation(program, "exposure.k");
-                p.primitiveData.exposureFLoc = glGetUniformLocation(program, "exposure.f");
-                p.primitiveData.exposureEnabledLoc = glGetUniformLocation(program, "exposureEnabled");
-                p.primitiveData.softClipLoc = glGetUniformLocation(program, "softClip");
-                p.primitiveData.textureSamplerLoc = glGetUniformLocation(program, "textureSampler");
+            std::shared_ptr<ProgramData> program;
+            if (!p.programCache.get(colorSpaces, program))
+            {
+                program = p.createProgram(colorSpaces);
+                p.programCache.add(colorSpaces, program);
             }
+            p.shader = program->shader;
+            p.mvpLoc = program->mvpLoc;
+            p.primitiveData = program->primitiveData;
             p.shader->bind();
 
 #if !defined(DJV_GL_ES2)
@@ -244,11 +393,12 @@ namespace djv
                 static_cast<GLint>(p.viewport.min.y),
                 static_cast<GLsizei>(p.viewport.w()),
                 static_cast<GLsizei>(p.viewport.h()));
+            const Math::BBox2f paintRect = flip(p.paintRect, _size);
             glScissor(
-                static_cast<GLint>(p.viewport.min.x),
-                static_cast<GLint>(p.viewport.min.y),
-                static_cast<GLsizei>(p.viewport.w()),
-                static_cast<GLsizei>(p.viewport.h()));
+                static_cast<GLint>(paintRect.min.x),
+                static_cast<GLint>(paintRect.min.y),
+                static_cast<GLsizei>(paintRect.w()),
+                static_cast<GLsizei>(paintRect.h()));
             glClearColor(0.F, 0.F, 0.F, 0.F);
             glClear(GL_COLOR_BUFFER_BIT);
 
@@ -283,7 +433,13 @@ namespace djv
             glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
             for (const auto& primitive : p.primitives)
             {
-                const Math::BBox2f clipRect = flip(primitive->clipRect, _size);
+                // Primitives outside of the paint region are skipped.
+                const Math::BBox2f primitiveClipRect = primitive->clipRect.intersect(p.paintRect);
+                if (!primitiveClipRect.isValid())
+                {
+                    continue;
+                }
+                const Math::BBox2f clipRect = flip(primitiveClipRect, _size);
                 if (clipRect != currentClipRect)
                 {
                     currentClipRect = clipRect;
@@ -341,6 +497,8 @@ namespace djv
             _clipRects.clear();
             p.primitives.clear();
             p.vboDataSize = 0;
+            p.drawListRecording.reset();
+            p.frameImageTiles.clear();
             while (p.dynamicTextureCache.size() > dynamicTextureCacheMax)
             {
                 auto texture = p.dynamicTextureCache.begin();
@@ -351,13 +509,115 @@ namespace djv
             {
                 p.dynamicTextures.pop_back();
             }
+            const size_t imageTileCacheScaledMax = std::max(
+                static_cast<size_t>(imageTileCacheMax * p.imageTileCacheScale),
+                static_cast<size_t>(1));
+            if (imageTileCacheScaledMax != p.imageTileCache.getMax())
+            {
+                std::vector<std::shared_ptr<GL::Texture> > removed;
+                p.imageTileCache.setMax(imageTileCacheScaledMax, removed);
+                for (const auto& i : removed)
+                {
+                    p.imageTileCacheByteCount -= i->getInfo().getDataByteCount();
+                }
+            }
+        }
+
+        void Render::beginDrawList()
+        {
+            DJV_PRIVATE_PTR();
+            p.drawListRecording = std::shared_ptr<DrawList>(new DrawList);
+            p.drawListPrimitivesStart = p.primitives.size();
+            p.drawListVBOStart = p.vboDataSize;
+        }
+
+        std::shared_ptr<DrawList> Render::endDrawList()
+        {
+            DJV_PRIVATE_PTR();
+            auto out = p.drawListRecording;
+            if (out)
+            {
+                out->primitives = std::vector<std::shared_ptr<Primitive> >(
+                    p.primitives.begin() + p.drawListPrimitivesStart,
+                    p.primitives.end());
+                out->vboData = std::vector<uint8_t>(
+                    p.vboData.begin() + p.drawListVBOStart,
+                    p.vboData.begin() + p.vboDataSize);
+                out->vaoOffset = p.drawListVBOStart / GL::getVertexByteCount(GL::VBOType::Pos2_F32_UV_U16);
+                p.drawListRecording.reset();
+            }
+            return out;
+        }
+
+        bool Render::drawList(const std::shared_ptr<DrawList>& value)
+        {
+            DJV_PRIVATE_PTR();
+            if (!value)
+            {
+                return false;
+            }
+
+            // Check that the textures and color spaces are still available.
+            for (const auto& i : value->atlasIDs)
+            {
+                GL::TextureAtlasItem item;
+                if (!p.textureAtlas->getItem(i, item))
+                {
+                    return false;
+                }
+            }
+            for (const auto& i : value->dynamicTextures)
+            {
+                const auto j = p.dynamicTextureCache.find(i.first);
+                if (j == p.dynamicTextureCache.end() || j->second->getID() != i.second)
+                {
+                    return false;
+                }
+            }
+            for (const auto& i : value->imageTiles)
+            {
+                std::shared_ptr<GL::Texture> texture;
+                if (!p.imageTileCache.get(i.first, texture) || texture->getID() != i.second)
+                {
+                    return false;
+                }
+                p.frameImageTiles.push_back(texture);
+            }
 #if !defined(DJV_GL_ES2)
-            while (p.colorSpaceCache.size() > colorSpaceCacheMax)
+            for (const auto& i : value->colorSpaces)
+            {
+                ColorSpaceData colorSpaceData;
+                if (!p.colorSpaceCache.get(i.first, colorSpaceData) || colorSpaceData.id != i.second)
+                {
+                    return false;
+                }
+            }
+            for (const auto& i : value->colorSpaces)
             {
-                p.colorSpaceCache.erase(p.colorSpaceCache.begin());
-                p.shader.reset();
+                p.frameColorSpaces.insert(i.second);
             }
 #endif // DJV_GL_ES2
+
+            // Copy the vertex data and move the primitives to the new offset.
+            const size_t vboDataOffset = p.vboDataSize;
+            const size_t vaoOffset = vboDataOffset / GL::getVertexByteCount(GL::VBOType::Pos2_F32_UV_U16);
+            const size_t vboDataSize = value->vboData.size();
+            p.vboDataSize += vboDataSize;
+            if (p.vboDataSize > p.vboData.size())
+            {
+                p.vboData.resize(p.vboDataSize);
+            }
+            if (vboDataSize)
+            {
+                memcpy(&p.vboData[vboDataOffset], value->vboData.data(), vboDataSize);
+            }
+            for (const auto& i : value->primitives)
+            {
+                i->vaoOffset = i->vaoOffset - value->vaoOffset + vaoOffset;
+                p.primitives.push_back(i);
+            }
+            value->vaoOffset = vaoOffset;
+            return true;
         }
 
         void Render::setFillColor(const Image::Color& value)
@@ -713,6 +973,10 @@ namespace djv
                                 id = p.textureAtlas->addItem(glyph->imageData, item);
                                 p.glyphTextureIDs[uid] = id;
                             }
+                            if (p.drawListRecording)
+                            {
+                                p.drawListRecording->atlasIDs.push_back(id);
+                            }
 
                             if (!primitive || item.textureIndex != textureIndex)
                             {
@@ -1123,6 +1387,8 @@ namespace djv
             DJV_PRIVATE_PTR();
             p.dynamicTextures.clear();
             p.dynamicTextureCache.clear();
+            p.imageTileCache.clear();
+            p.imageTileCacheByteCount = 0;
             for (size_t i = 0; i < dynamicTextureCount; ++i)
             {
                 p.dynamicTextures.emplace_back(
@@ -1219,11 +1485,19 @@ namespace djv
                         powf(2.F, 3.5F) - primitive->exposureK);
                 }
                 primitive->softClip = options.softClipEnabled ? options.softClip : 0.F;
-                primitive->imageCache = options.cache;
+
+                // Images larger than the maximum texture size are tiled.
+                ImageCache cache = options.cache;
+                if (ImageCache::Dynamic == cache &&
+                    (info.size.w > maxTextureSize || info.size.h > maxTextureSize))
+                {
+                    cache = ImageCache::Tiled;
+                }
+                primitive->imageCache = cache;
                 float textureU[2] = { 0.F, 0.F };
                 float textureV[2] = { 0.F, 0.F };
                 const UID uid = image->getUID();
-                switch (options.cache)
+                switch (cache)
                 {
                 case ImageCache::Atlas:
                 {
@@ -1236,7 +1510,12 @@ namespace djv
                     }
                     if (!textureAtlas->getItem(id, item))
                     {
-                        textureIDs[uid] = textureAtlas->addItem(image, item);
+                        id = textureAtlas->addItem(image, item);
+                        textureIDs[uid] = id;
+                    }
+                    if (drawListRecording)
+                    {
+                        drawListRecording->atlasIDs.push_back(id);
                     }
                     primitive->atlasIndex = item.textureIndex;
                     if (info.layout.mirror.x)
@@ -1281,10 +1560,14 @@ namespace djv
                         {
                             texture = GL::Texture::create(image->getInfo(), GL_LINEAR, GL_NEAREST);
                         }
-                        texture->copy(*image);
+                        pixelBufferRing->copy(*image, *texture);
                         dynamicTextureCache[uid] = texture;
                         primitive->textureID = texture->getID();
                     }
+                    if (drawListRecording)
+                    {
+                        drawListRecording->dynamicTextures.push_back(std::make_pair(uid, primitive->textureID));
+                    }
                     if (info.layout.mirror.x)
                     {
                         textureU[0] = 1.F;
@@ -1323,12 +1606,7 @@ namespace djv
                 if (options.colorSpace.isValid())
                 {
                     ColorSpaceData colorSpaceData;
-                    const auto i = colorSpaceCache.find(options.colorSpace);
-                    if (i != colorSpaceCache.end())
-                    {
-                        colorSpaceData = i->second;
-                    }
-                    else
+                    if (!colorSpaceCache.get(options.colorSpace, colorSpaceData))
                     {
                         try
                         {
@@ -1351,18 +1629,32 @@ namespace djv
                             auto data = colorSpaceData.lut3D->getData();
                             processor->getGpuLut3D(data, shaderDesc);
                             colorSpaceData.lut3D->copy();
-                            colorSpaceCache[options.colorSpace] = colorSpaceData;
-                            shader.reset();
+                            colorSpaceCache.add(options.colorSpace, colorSpaceData);
                         }
                         catch (const std::exception& e)
                         {
+                            colorSpaceData = ColorSpaceData();
                             system->_log(e.what());
                         }
                     }
-                    primitive->colorSpace = colorSpaceData.id;
+                    if (colorSpaceData.id > 0)
+                    {
+                        frameColorSpaces.insert(colorSpaceData.id);
+                        if (drawListRecording)
+                        {
+                            drawListRecording->colorSpaces.push_back(std::make_pair(options.colorSpace, colorSpaceData.id));
+                        }
+                    }
+                    primitive->colorSpace = static_cast<int>(colorSpaceData.id);
                     primitive->colorSpaceTextureID = colorSpaceData.lut3D ? colorSpaceData.lut3D->getID() : 0;
                 }
 #endif // DJV_GL_ES2
+                if (ImageCache::Tiled == cache)
+                {
+                    drawImageTiles(image, pos, options, primitive, currentTransform, currentClipRect);
+                    return;
+                }
+
                 primitive->type = GL_TRIANGLE_STRIP;
                 primitive->vaoOffset = vboDataSize / GL::getVertexByteCount(GL::VBOType::Pos2_F32_UV_U16);
                 primitive->vaoSize = 4;
@@ -1394,29 +1686,343 @@ namespace djv
             }
         }
 
-        std::string Render::Private::getFragmentSource() const
+        void Render::Private::drawImageTiles(
+            const std::shared_ptr<Image::Data>& image,
+            const glm::vec2& pos,
+            const ImageOptions& options,
+            const std::shared_ptr<ImagePrimitive>& primitive,
+            const glm::mat3x3& currentTransform,
+            const Math::BBox2f& currentClipRect)
+        {
+            const auto& info = image->getInfo();
+            const uint16_t w = info.size.w;
+            const uint16_t h = info.size.h;
+            const bool flipX = info.layout.mirror.x != options.mirror.x;
+            const bool flipY = info.layout.mirror.y != options.mirror.y;
+            if (0 == w || 0 == h)
+            {
+                return;
+            }
+
+            // Find the visible area of the image by transforming the clipping
+            // rectangle back into image coordinates.
+            const Math::BBox2f clipRect = currentClipRect.intersect(paintRect);
+            const glm::mat3x3 inverse = glm::inverse(currentTransform);
+            const glm::vec3 clipPts[4] =
+            {
+                inverse * glm::vec3(clipRect.min.x, clipRect.min.y, 1.F),
+                inverse * glm::vec3(clipRect.max.x, clipRect.min.y, 1.F),
+                inverse * glm::vec3(clipRect.max.x, clipRect.max.y, 1.F),
+                inverse * glm::vec3(clipRect.min.x, clipRect.max.y, 1.F)
+            };
+            Math::BBox2f visible(clipPts[0].x - pos.x, clipPts[0].y - pos.y, 0.F, 0.F);
+            for (size_t i = 1; i < 4; ++i)
+            {
+                visible.expand(glm::vec2(clipPts[i].x - pos.x, clipPts[i].y - pos.y));
+            }
+            if (flipX)
+            {
+                visible = Math::BBox2f(w - visible.max.x, visible.min.y, visible.w(), visible.h());
+            }
+            if (flipY)
+            {
+                visible = Math::BBox2f(visible.min.x, h - visible.max.y, visible.w(), visible.h());
+            }
+
+            // Find the tiles that intersect the visible area.
+            const int tileCountX = (w + imageTileSize - 1) / imageTileSize;
+            const int tileCountY = (h + imageTileSize - 1) / imageTileSize;
+            const int tileMinX = Math::clamp(static_cast<int>(floorf(visible.min.x / imageTileSize)), 0, tileCountX - 1);
+            const int tileMaxX = Math::clamp(static_cast<int>(floorf(visible.max.x / imageTileSize)), 0, tileCountX - 1);
+            const int tileMinY = Math::clamp(static_cast<int>(floorf(visible.min.y / imageTileSize)), 0, tileCountY - 1);
+            const int tileMaxY = Math::clamp(static_cast<int>(floorf(visible.max.y / imageTileSize)), 0, tileCountY - 1);
+
+            const UID uid = image->getUID();
+            for (int tileY = tileMinY; tileY <= tileMaxY; ++tileY)
+            {
+                for (int tileX = tileMinX; tileX <= tileMaxX; ++tileX)
+                {
+                    // The tile area in image coordinates.
+                    const uint16_t x = tileX * imageTileSize;
+                    const uint16_t y = tileY * imageTileSize;
+                    const uint16_t tileW = std::min(imageTileSize, static_cast<uint16_t>(w - x));
+                    const uint16_t tileH = std::min(imageTileSize, static_cast<uint16_t>(h - y));
+
+                    // The tile position on screen.
+                    const float x0 = flipX ? (w - x - tileW) : x;
+                    const float y0 = flipY ? (h - y - tileH) : y;
+                    glm::vec3 pts[4];
+                    pts[0] = currentTransform * glm::vec3(pos.x + x0, pos.y + y0, 1.F);
+                    pts[1] = currentTransform * glm::vec3(pos.x + x0 + tileW, pos.y + y0, 1.F);
+                    pts[2] = currentTransform * glm::vec3(pos.x + x0 + tileW, pos.y + y0 + tileH, 1.F);
+                    pts[3] = currentTransform * glm::vec3(pos.x + x0, pos.y + y0 + tileH, 1.F);
+                    Math::BBox2f bbox(pts[0].x, pts[0].y, 0.F, 0.F);
+                    for (size_t i = 1; i < 4; ++i)
+                    {
+                        bbox.expand(glm::vec2(pts[i].x, pts[i].y));
+                    }
+                    if (!bbox.intersects(clipRect))
+                    {
+                        continue;
+                    }
+
+                    // The tile textures include a border of the neighboring
+                    // pixels so that there are no seams when filtering.
+                    const uint16_t textureX = x > 0 ? (x - 1) : 0;
+                    const uint16_t textureY = y > 0 ? (y - 1) : 0;
+                    const uint16_t textureW = std::min(static_cast<int>(x) + tileW + 1, static_cast<int>(w)) - textureX;
+                    const uint16_t textureH = std::min(static_cast<int>(y) + tileH + 1, static_cast<int>(h)) - textureY;
+                    const ImageTileKey key(uid, tileY * tileCountX + tileX);
+                    std::shared_ptr<GL::Texture> texture;
+                    if (!imageTileCache.get(key, texture))
+                    {
+                        texture = GL::Texture::create(
+                            Image::Info(textureW, textureH, info.type),
+                            toGL(imageFilterOptions.min),
+                            toGL(imageFilterOptions.mag));
+                        texture->copyRegion(*image, textureX, textureY, textureW, textureH);
+                        std::vector<std::shared_ptr<GL::Texture> > removed;
+                        imageTileCache.add(key, texture, removed);
+                        imageTileCacheByteCount += texture->getInfo().getDataByteCount();
+                        for (const auto& i : removed)
+                        {
+                            imageTileCacheByteCount -= i->getInfo().getDataByteCount();
+                        }
+                    }
+
+                    // Keep a reference to the texture until the end of the
+                    // frame in case it is removed from the cache.
+                    frameImageTiles.push_back(texture);
+                    if (drawListRecording)
+                    {
+                        drawListRecording->imageTiles.push_back(std::make_pair(key, texture->getID()));
+                    }
+
+                    float textureU[2] =
+                    {
+                        (x - textureX) / static_cast<float>(textureW),
+                        (x + tileW - textureX) / static_cast<float>(textureW)
+                    };
+                    float textureV[2] =
+                    {
+                        (y - textureY) / static_cast<float>(textureH),
+                        (y + tileH - textureY) / static_cast<float>(textureH)
+                    };
+                    if (flipX)
+                    {
+                        std::swap(textureU[0], textureU[1]);
+                    }
+                    if (flipY)
+                    {
+                        std::swap(textureV[0], textureV[1]);
+                    }
+
+                    auto tilePrimitive = std::make_shared<ImagePrimitive>(*primitive);
+                    tilePrimitive->textureID = texture->getID();
+                    tilePrimitive->type = GL_TRIANGLE_STRIP;
+                    tilePrimitive->vaoOffset = vboDataSize / GL::getVertexByteCount(GL::VBOType::Pos2_F32_UV_U16);
+                    tilePrimitive->vaoSize = 4;
+
+                    const size_t vboDataOffset = vboDataSize;
+                    vboDataSizeUpdate(4);
+                    VBOVertex* pData = reinterpret_cast<VBOVertex*>(&vboData[vboDataOffset]);
+                    pData->vx = pts[0].x;
+                    pData->vy = pts[0].y;
+                    pData->tx = static_cast<uint16_t>(textureU[0] * 65535.F);
+                    pData->ty = static_cast<uint16_t>(textureV[0] * 65535.F);
+                    ++pData;
+                    pData->vx = pts[1].x;
+                    pData->vy = pts[1].y;
+                    pData->tx = static_cast<uint16_t>(textureU[1] * 65535.F);
+                    pData->ty = static_cast<uint16_t>(textureV[0] * 65535.F);
+                    ++pData;
+                    pData->vx = pts[3].x;
+                    pData->vy = pts[3].y;
+                    pData->tx = static_cast<uint16_t>(textureU[0] * 65535.F);
+                    pData->ty = static_cast<uint16_t>(textureV[1] * 65535.F);
+                    ++pData;
+                    pData->vx = pts[2].x;
+                    pData->vy = pts[2].y;
+                    pData->tx = static_cast<uint16_t>(textureU[1] * 65535.F);
+                    pData->ty = static_cast<uint16_t>(textureV[1] * 65535.F);
+
+                    primitives.push_back(tilePrimitive);
+                }
+            }
+        }
+
+        std::shared_ptr<ProgramData> Render::Private::createProgram(const std::vector<size_t>& colorSpaces)
+        {
+            auto out = std::shared_ptr<ProgramData>(new ProgramData);
+            const std::string fragmentSource = getFragmentSource(colorSpaces);
+#if !defined(DJV_GL_ES2)
+            System::File::Path binaryPath;
+            if (!programBinaryPath.isEmpty())
+            {
+                size_t hash = 0;
+                Memory::hashCombine(hash, programBinaryKey);
+                Memory::hashCombine(hash, vertexSource);
+                Memory::hashCombine(hash, fragmentSource);
+                std::stringstream ss;
+                ss << std::hex << std::setfill('0') << std::setw(16) << hash << ".bin";
+                binaryPath = System::File::Path(programBinaryPath, ss.str());
+                out->shader = readProgramBinary(binaryPath);
+            }
+#endif // DJV_GL_ES2
+            if (!out->shader)
+            {
+                out->shader = GL::Shader::create(vertexSource, fragmentSource);
+                out->shader->setVertexName(vertexFileName);
+                out->shader->setFragmentName(fragmentFileName);
+#if !defined(DJV_GL_ES2)
+                if (!binaryPath.isEmpty())
+                {
+                    writeProgramBinary(binaryPath, out->shader);
+                }
+#endif // DJV_GL_ES2
+            }
+            const auto program = out->shader->getProgram();
+            out->primitiveData.textureAtlasCount = primitiveData.textureAtlasCount;
+            out->mvpLoc = glGetUniformLocation(program, "transform.mvp");
+            out->primitiveData.imageChannelsLoc = glGetUniformLocation(program, "imageChannels");
+            out->primitiveData.colorModeLoc = glGetUniformLocation(program, "colorMode");
+            out->primitiveData.colorLoc = glGetUniformLocation(program, "color");
+#if !defined(DJV_GL_ES2)
+            out->primitiveData.colorSpaceLoc = glGetUniformLocation(program, "colorSpace");
+            out->primitiveData.colorSpaceSamplerLoc = glGetUniformLocation(program, "colorSpaceSampler");
+#endif // DJV_GL_ES2
+            out->primitiveData.imageChannelsDisplayLoc = glGetUniformLocation(program, "imageChannelsDisplay");
+            out->primitiveData.colorMatrixLoc = glGetUniformLocation(program, "colorMatrix");
+            out->primitiveData.colorMatrixEnabledLoc = glGetUniformLocation(program, "colorMatrixEnabled");
+            out->primitiveData.colorInvertLoc = glGetUniformLocation(program, "colorInvert");
+            out->primitiveData.levelsInLowLoc = glGetUniformLocation(program, "levels.inLow");
+            out->primitiveData.levelsInHighLoc = glGetUniformLocation(program, "levels.inHigh");
+            out->primitiveData.levelsGammaLoc = glGetUniformLocation(program, "levels.gamma");
+            out->primitiveData.levelsOutLowLoc = glGetUniformLocation(program, "levels.outLow");
+            out->primitiveData.levelsOutHighLoc = glGetUniformLocation(program, "levels.outHigh");
+            out->primitiveData.levelsEnabledLoc = glGetUniformLocation(program, "levelsEnabled");
+            out->primitiveData.exposureVLoc = glGetUniformLocation(program, "exposure.v");
+            out->primitiveData.exposureDLoc = glGetUniformLocation(program, "exposure.d");
+            out->primitiveData.exposureKLoc = glGetUniformLocation(program, "exposure.k");
+            out->primitiveData.exposureFLoc = glGetUniformLocation(program, "exposure.f");
+            out->primitiveData.exposureEnabledLoc = glGetUniformLocation(program, "exposureEnabled");
+            out->primitiveData.softClipLoc = glGetUniformLocation(program, "softClip");
+            out->primitiveData.textureSamplerLoc = glGetUniformLocation(program, "textureSampler");
+            return out;
+        }
+
+#if !defined(DJV_GL_ES2)
+        std::shared_ptr<GL::Shader> Render::Private::readProgramBinary(const System::File::Path& path)
+        {
+            std::shared_ptr<GL::Shader> out;
+            if (System::File::Info(path).doesExist())
+            {
+                try
+                {
+                    auto io = System::File::IO::create();
+                    io->open(std::string(path), System::File::Mode::Read);
+                    uint32_t binaryFormat = 0;
+                    io->readU32(&binaryFormat);
+                    std::vector<uint8_t> binary(io->getSize() - io->getPos());
+                    io->read(binary.data(), binary.size());
+                    io->close();
+                    out = GL::Shader::create(binary, static_cast<GLenum>(binaryFormat));
+                    out->setVertexName(vertexFileName);
+                    out->setFragmentName(fragmentFileName);
+
+                    // Update the modification time so the least recently used
+                    // binaries are removed first.
+#if defined(DJV_PLATFORM_WINDOWS)
+                    _wutime(String::toWide(std::string(path)).c_str(), nullptr);
+#else // DJV_PLATFORM_WINDOWS
+                    utime(std::string(path).c_str(), nullptr);
+#endif // DJV_PLATFORM_WINDOWS
+                }
+                catch (const std::exception& e)
+                {
+                    // The binary is stale (for example the driver was updated),
+                    // the program will be compiled from source and re-written.
+                    std::stringstream ss;
+                    ss << path << ": " << e.what();
+                    system->_log(ss.str(), System::LogLevel::Warning);
+                }
+            }
+            return out;
+        }
+
+        void Render::Private::writeProgramBinary(const System::File::Path& path, const std::shared_ptr<GL::Shader>& shader)
+        {
+            try
+            {
+                std::vector<uint8_t> binary;
+                GLenum binaryFormat = 0;
+                shader->getBinary(binary, binaryFormat);
+                auto io = System::File::IO::create();
+                io->open(std::string(path), System::File::Mode::Write);
+                io->writeU32(static_cast<uint32_t>(binaryFormat));
+                io->write(binary.data(), binary.size());
+                io->close();
+                programBinaryCleanup();
+            }
+            catch (const std::exception& e)
+            {
+                std::stringstream ss;
+                ss << path << ": " << e.what();
+                system->_log(ss.str(), System::LogLevel::Warning);
+            }
+        }
+
+        void Render::Private::programBinaryCleanup()
+        {
+            System::File::DirectoryListOptions options;
+            options.sort = System::File::DirectoryListSort::Time;
+            std::vector<System::File::Info> files;
+            for (const auto& i : System::File::directoryList(programBinaryPath, options))
+            {
+                if (System::File::Type::File == i.getType())
+                {
+                    files.push_back(i);
+                }
+            }
+
+            // The files are sorted by time, so the least recently used files
+            // are first.
+            for (size_t i = 0; i + programBinaryMax < files.size(); ++i)
+            {
+                std::remove(files[i].getFileName().c_str());
+            }
+        }
+#endif // DJV_GL_ES2
+
+        std::string Render::Private::getFragmentSource(const std::vector<size_t>& colorSpaces) const
         {
             std::string out = fragmentSource;
 
             std::string functions;
             std::string body;
 #if !defined(DJV_GL_ES2)
+            // Only the color spaces used by the program are included so that
+            // the shader stays small and each combination can be cached.
             size_t i = 0;
-            for (const auto& j : colorSpaceCache)
+            for (const auto& j : colorSpaceCache.getValues())
             {
-                functions += j.second.shaderSource;
+                if (std::find(colorSpaces.begin(), colorSpaces.end(), j.id) == colorSpaces.end())
+                {
+                    continue;
+                }
+                functions += j.shaderSource;
                 {
                     std::stringstream ss;
                     if (0 == i)
                     {
-                        ss << "    if (" << j.second.id << " == colorSpace)\n";
+                        ss << "    if (" << j.id << " == colorSpace)\n";
                     }
                     else
                     {
-                        ss << "    else if (" << j.second.id << " == colorSpace)\n";
+                        ss << "    else if (" << j.id << " == colorSpace)\n";
                     }
                     ss << "    {\n";
-                    ss << "        t = colorSpace" << j.second.id << "(t, colorSpaceSampler);\n";
+                    ss << "        t = colorSpace" << j.id << "(t, colorSpaceSampler);\n";
                     ss << "    }\n";
                     body += ss.str();
                 }
@@ -31,6 +31,8 @@ namespace djv
 
     namespace Render2D
     {
+        class DrawList;
+
         //! This class provides a 2D render system.
         class Render : public System::ISystem
         {
@@ -49,10 +51,33 @@ namespace djv
             ///@{
 
             void beginFrame(const Image::Size&);
+
+            //! Begin a frame that only repaints the given region, the rest of
+            //! the framebuffer is left as-is.
+            void beginFrame(const Image::Size&, const Math::BBox2f& paintRect);
+
             void endFrame();
 
             ///@}
 
+            //! \name Draw Lists
+            ///@{
+
+            //! Start recording the primitives that are drawn into a draw list.
+            //! The primitives are also drawn in the current frame.
+            void beginDrawList();
+
+            //! Finish recording a draw list.
+            std::shared_ptr<DrawList> endDrawList();
+
+            //! Draw a previously recorded draw list. A draw list may only be
+            //! drawn once per frame. Returns false if the resources the draw
+            //! list refers to are no longer available, in which case the
+            //! primitives need to be drawn again.
+            bool drawList(const std::shared_ptr<DrawList>&);
+
+            ///@}
+
             //! \name Transform
             ///@{
 
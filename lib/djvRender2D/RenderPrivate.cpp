@@ -74,6 +74,7 @@ namespace djv
                 shader->setUniform(data.textureSamplerLoc, static_cast<int>(atlasIndex));
                 break;
             case ImageCache::Dynamic:
+            case ImageCache::Tiled:
                 glActiveTexture(static_cast<GLenum>(GL_TEXTURE0 + data.textureAtlasCount));
                 glBindTexture(GL_TEXTURE_2D, textureID);
                 shader->setUniform(data.textureSamplerLoc, static_cast<int>(data.textureAtlasCount));
@@ -13,6 +13,8 @@
 
 #include <djvMath/BBox.h>
 
+#include <djvCore/UID.h>
+
 namespace djv
 {
     namespace Render2D
@@ -22,9 +24,20 @@ namespace djv
         const uint16_t textureAtlasSize       = 8192;
         const size_t   dynamicTextureCount    = 16;
         const size_t   dynamicTextureCacheMax = 16;
+        const size_t   programCacheMax        = 16;
+        const uint16_t imageTileSize          = 1024;
+        const size_t   imageTileCacheMax      = 64;
+        const size_t   pixelBufferRingCount   = 3;
 #if !defined(DJV_GL_ES2)
         const size_t   lut3DSize              = 32;
         const size_t   colorSpaceCacheMax     = 32;
+
+        // The directory (relative to the documents path) where compiled
+        // program binaries are stored. Each driver gets a sub-directory.
+        const std::string programBinaryDirectory = "ShaderCache";
+
+        // The maximum number of program binaries kept for a driver.
+        const size_t   programBinaryMax       = 256;
 #endif // DJV_GL_ES2
 
         // This enumeration provides how the color is used to draw the render primitive.
@@ -74,6 +87,15 @@ namespace djv
             GLint textureSamplerLoc         = 0;
         };
 
+        //! This struct provides a compiled shader program. Programs are
+        //! cached by the set of color spaces they contain.
+        struct ProgramData
+        {
+            std::shared_ptr<GL::Shader> shader;
+            GLint                       mvpLoc        = 0;
+            PrimitiveData               primitiveData;
+        };
+
         //! This class provides the base functionality for render primitives.
         class Primitive
         {
@@ -107,7 +129,7 @@ namespace djv
             ColorMode            colorMode            = ColorMode::ColorAndTexture;
             Image::Channels      imageChannels        = Image::Channels::RGBA;
 #if !defined(DJV_GL_ES2)
-            uint8_t              colorSpace           = 0;
+            int                  colorSpace           = 0;
             GLuint               colorSpaceTextureID  = 0;
 #endif // DJV_GL_ES2
             glm::mat4x4          colorMatrix;
@@ -129,6 +151,10 @@ namespace djv
             void bind(const PrimitiveData&, const std::shared_ptr<GL::Shader>&) override;
         };
 
+        //! This typedef provides a key for image tiles, the image UID and the
+        //! tile index.
+        typedef std::pair<Core::UID, size_t> ImageTileKey;
+
         //! This class provides a shadow render primitive.
         class ShadowPrimitive : public Primitive
         {
@@ -155,6 +181,25 @@ namespace djv
             uint16_t ty;
         };
 
+        //! This class provides a recorded list of render primitives.
+        class DrawList
+        {
+        public:
+            std::vector<std::shared_ptr<Primitive> > primitives;
+
+            // The vertex data, and the VBO offset it was last drawn at.
+            std::vector<uint8_t> vboData;
+            size_t               vaoOffset = 0;
+
+            // The resources used by the primitives.
+            std::vector<Core::UID>                     atlasIDs;
+            std::vector<std::pair<Core::UID, GLuint> > dynamicTextures;
+            std::vector<std::pair<ImageTileKey, GLuint> > imageTiles;
+#if !defined(DJV_GL_ES2)
+            std::vector<std::pair<OCIO::Convert, size_t> > colorSpaces;
+#endif // DJV_GL_ES2
+        };
+
 #if !defined(DJV_GL_ES2)
 
         //! This class provides a 3D lookup table for color space conversions.
@@ -185,7 +230,7 @@ namespace djv
         //! This struct provides data for color space conversions.
         struct ColorSpaceData
         {
-            size_t                  id;
+            size_t                  id           = 0;
             std::string             shaderSource;
             std::shared_ptr<LUT3D>  lut3D;
         };
@@ -50,6 +50,7 @@ namespace djv
             _locations["transform.m"] = glGetUniformLocation(program, "transform.m");
             _locations["transform.mvp"] = glGetUniformLocation(program, "transform.mvp");
             _locations["color"] = glGetUniformLocation(program, "color");
+            _locations["instancing"] = glGetUniformLocation(program, "instancing");
         }
 
         SolidColorMaterial::SolidColorMaterial()
@@ -70,6 +71,7 @@ namespace djv
             _shader->setUniform(_locations["transform.m"], data.model);
             _shader->setUniform(_locations["transform.mvp"], data.camera * data.model);
             _shader->setUniform(_locations["color"], data.color);
+            _shader->setUniform(_locations["instancing"], data.instancing ? 1 : 0);
         }
 
         void DefaultMaterial::_init(const std::shared_ptr<System::Context>& context)
@@ -80,6 +82,7 @@ namespace djv
             _locations["transform.m"] = glGetUniformLocation(program, "transform.m");
             _locations["transform.mvp"] = glGetUniformLocation(program, "transform.mvp");
             _locations["transform.normals"] = glGetUniformLocation(program, "transform.normals");
+            _locations["instancing"] = glGetUniformLocation(program, "instancing");
 
             _locations["hemisphereLight.intensity"] = glGetUniformLocation(program, "hemisphereLight.intensity");
             _locations["hemisphereLight.up"] = glGetUniformLocation(program, "hemisphereLight.up");
@@ -214,6 +217,7 @@ namespace djv
             _shader->setUniform(_locations["transform.m"], data.model);
             _shader->setUniform(_locations["transform.mvp"], data.camera * data.model);
             _shader->setUniform(_locations["transform.normals"], glm::transpose(glm::inverse(glm::mat3x3(data.model))));
+            _shader->setUniform(_locations["instancing"], data.instancing ? 1 : 0);
         }
 
         DJV_ENUM_HELPERS_IMPLEMENTATION(DefaultMaterialMode);
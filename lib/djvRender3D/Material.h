@@ -41,6 +41,10 @@ namespace djv
             glm::mat4x4 model;
             glm::mat4x4 camera;
             Image::Color color;
+
+            //! Whether the per-instance transform and color vertex attributes
+            //! are used.
+            bool instancing = false;
         };
 
         //! This class provides the base functionality for materials.
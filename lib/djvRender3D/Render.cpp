@@ -16,9 +16,12 @@
 
 #include <djvSystem/Context.h>
 #include <djvSystem/LogSystem.h>
+#include <djvSystem/MemorySystem.h>
 #include <djvSystem/TimerFunc.h>
 
+#include <algorithm>
 #include <array>
+#include <cstddef>
 
 using namespace djv::Core;
 
@@ -29,10 +32,15 @@ namespace djv
         namespace
         {
             //! \todo Should this be configurable?
-            const uint8_t         textureAtlasCount       = 4;
-            const uint16_t        textureAtlasSize        = 8192;
-            const size_t          shadedMeshCacheSize     = 50000000;
-            const size_t          solidColorMeshCacheSize = 10000000;
+            const uint8_t         textureAtlasCount           = 4;
+            const uint16_t        textureAtlasSize            = 8192;
+            const size_t          shadedMeshCachePageSize     = 12500000;
+            const size_t          solidColorMeshCachePageSize = 2500000;
+            const size_t          meshCachePageCountMax       = 4;
+
+            //! The maximum number of vertices moved each frame to defragment
+            //! the mesh caches.
+            const size_t          meshCacheDefragmentSize     = 250000;
 #if defined(DJV_GL_ES2)
             const GL::VBOType shadedMeshType     = GL::VBOType::Pos3_F32_UV_F32_Normal_F32;
             const GL::VBOType solidColorMeshType = GL::VBOType::Pos3_F32;
@@ -41,15 +49,98 @@ namespace djv
             const GL::VBOType solidColorMeshType = GL::VBOType::Pos3_F32;
 #endif // DJV_GL_ES2
 
+            struct MeshRange
+            {
+                UID              uid  = 0;
+                size_t           page = 0;
+                Math::SizeTRange range;
+            };
+
             struct Primitive
             {
                 glm::mat4x4                   xform;
                 GLenum                        type     = GL_TRIANGLES;
-                std::vector<Math::SizeTRange> vaoRange;
+                std::vector<MeshRange>        meshRanges;
                 Image::Color                  color;
                 std::shared_ptr<IMaterial>    material;
+                std::vector<InstanceData>     instances;
+                size_t                        instanceOffset = 0;
             };
 
+            UID addMesh(GL::MeshCache& meshCache, const Geom::PointList& value, size_t& page, Math::SizeTRange& range)
+            {
+                return meshCache.add(GL::VBO::convert(value, meshCache.getVBOType()), page, range);
+            }
+
+            UID addMesh(GL::MeshCache& meshCache, const Geom::TriangleMesh& value, size_t& page, Math::SizeTRange& range)
+            {
+                return meshCache.add(GL::VBO::convert(value, meshCache.getVBOType()), page, range);
+            }
+
+            UID addMesh(GL::MeshCache& meshCache, const Geom::IndexedTriangleMesh& value, size_t& page, Math::SizeTRange& range)
+            {
+                return meshCache.add(value, page, range);
+            }
+
+#if !defined(DJV_GL_ES2)
+            //! These constants provide the instance vertex attribute locations,
+            //! they must match the shaders. The transform uses four locations.
+            const GLuint instanceTransformLocation = 4;
+            const GLuint instanceColorLocation     = 8;
+
+            struct InstanceVertex
+            {
+                GLfloat transform[16];
+                GLfloat color[4];
+            };
+
+            InstanceVertex getInstanceVertex(const InstanceData& value)
+            {
+                InstanceVertex out;
+                for (size_t c = 0; c < 4; ++c)
+                {
+                    for (size_t r = 0; r < 4; ++r)
+                    {
+                        out.transform[c * 4 + r] = value.transform[c][r];
+                    }
+                }
+                const Image::Color color = value.color.isValid() ?
+                    value.color.convert(Image::Type::RGBA_F32) :
+                    Image::Color(1.F, 1.F, 1.F, 1.F);
+                for (size_t i = 0; i < 4; ++i)
+                {
+                    out.color[i] = color.getF32(i);
+                }
+                return out;
+            }
+
+            void enableInstanceAttributes(GLuint vbo, size_t offset)
+            {
+                glBindBuffer(GL_ARRAY_BUFFER, vbo);
+                const GLsizei stride = static_cast<GLsizei>(sizeof(InstanceVertex));
+                const size_t byteOffset = offset * sizeof(InstanceVertex);
+                for (GLuint i = 0; i < 4; ++i)
+                {
+                    const GLuint location = instanceTransformLocation + i;
+                    glVertexAttribPointer(location, 4, GL_FLOAT, GL_FALSE, stride, (GLvoid*)(byteOffset + i * 4 * sizeof(GLfloat)));
+                    glVertexAttribDivisor(location, 1);
+                    glEnableVertexAttribArray(location);
+                }
+                glVertexAttribPointer(instanceColorLocation, 4, GL_FLOAT, GL_FALSE, stride, (GLvoid*)(byteOffset + offsetof(InstanceVertex, color)));
+                glVertexAttribDivisor(instanceColorLocation, 1);
+                glEnableVertexAttribArray(instanceColorLocation);
+            }
+
+            void disableInstanceAttributes()
+            {
+                for (GLuint i = 0; i < 4; ++i)
+                {
+                    glDisableVertexAttribArray(instanceTransformLocation + i);
+                }
+                glDisableVertexAttribArray(instanceColorLocation);
+            }
+#endif // DJV_GL_ES2
+
         } // namespace
 
         struct Render::Private
@@ -65,12 +156,54 @@ namespace djv
             std::shared_ptr<GL::TextureAtlas>       textureAtlas;
             std::map<GL::VBOType, std::shared_ptr<GL::MeshCache> > meshCache;
             std::map<GL::VBOType, std::map<UID, UID> > meshCacheUIDs;
+            std::map<GL::VBOType, size_t>           meshCacheEvictionCounts;
+            float                                   meshCacheScale    = 1.F;
 
             std::map<GL::VBOType, std::map<std::shared_ptr<IMaterial>, std::vector<std::shared_ptr<Primitive> > > > primitives;
+#if !defined(DJV_GL_ES2)
+            GLuint                                  instanceVBO       = 0;
+#endif // DJV_GL_ES2
 
             std::shared_ptr<System::Timer> statsTimer;
+            std::shared_ptr<System::MemorySystem> memorySystem;
+            UID memoryCacheUID = 0;
+
+            //! Get the mesh cache range for a mesh, adding it to the cache if
+            //! necessary. The range is acquired until the end of the frame.
+            template<typename T>
+            bool getMeshRange(GL::VBOType, const T&, MeshRange&);
         };
 
+        template<typename T>
+        bool Render::Private::getMeshRange(GL::VBOType type, const T& value, MeshRange& out)
+        {
+            auto& cache = meshCache[type];
+            auto& cacheUIDs = meshCacheUIDs[type];
+            const UID uid = value.getUID();
+            const auto i = cacheUIDs.find(uid);
+            if (i != cacheUIDs.end() && cache->get(i->second, out.page, out.range))
+            {
+                out.uid = i->second;
+            }
+            else
+            {
+                out.uid = addMesh(*cache, value, out.page, out.range);
+                if (out.uid)
+                {
+                    cacheUIDs[uid] = out.uid;
+                }
+                else if (i != cacheUIDs.end())
+                {
+                    cacheUIDs.erase(i);
+                }
+            }
+            if (out.uid)
+            {
+                cache->acquire(out.uid);
+            }
+            return out.uid != 0;
+        }
+
         void Render::_init(const std::shared_ptr<System::Context>& context)
         {
             ISystem::_init("djv::Render3D::Render", context);
@@ -106,11 +239,13 @@ namespace djv
                 0));
 
             p.meshCache[shadedMeshType].reset(new GL::MeshCache(
-                shadedMeshCacheSize,
-                shadedMeshType));
+                shadedMeshCachePageSize,
+                shadedMeshType,
+                meshCachePageCountMax));
             p.meshCache[solidColorMeshType].reset(new GL::MeshCache(
-                solidColorMeshCacheSize,
-                solidColorMeshType));
+                solidColorMeshCachePageSize,
+                solidColorMeshType,
+                meshCachePageCountMax));
 
             p.statsTimer = System::Timer::create(context);
             p.statsTimer->setRepeating(true);
@@ -123,11 +258,42 @@ namespace djv
                     ss << "Texture atlas: " << std::fixed << p.textureAtlas->getPercentageUsed() << "%\n";
                     for (const auto& i : p.meshCache)
                     {
-                        ss << "Mesh cache " << i.first << ": " << i.second->getPercentageUsed() << "%\n";
+                        ss << "Mesh cache " << i.first << ": " << i.second->getPercentageUsed() << "% of " <<
+                            i.second->getPageCount() << " pages, " <<
+                            i.second->getFragmentation() << "% fragmented, " <<
+                            i.second->getEvictionCount() << " evictions\n";
                     }
                     _log(ss.str());
                 });
 
+            // The mesh caches are resized at the end of the frame when the
+            // OpenGL context is current.
+            p.memorySystem = context->getSystemT<System::MemorySystem>();
+            if (p.memorySystem)
+            {
+                auto weak = std::weak_ptr<Render>(std::dynamic_pointer_cast<Render>(shared_from_this()));
+                System::MemoryCacheData memoryCacheData;
+                memoryCacheData.name = DJV_TEXT("render3d_memory_cache_meshes");
+                memoryCacheData.priority = System::MemoryCachePriority::Medium;
+                memoryCacheData.byteCount = [weak]
+                {
+                    size_t out = 0;
+                    if (auto system = weak.lock())
+                    {
+                        out = system->getMeshCacheByteCount();
+                    }
+                    return out;
+                };
+                memoryCacheData.scale = [weak](float value)
+                {
+                    if (auto system = weak.lock())
+                    {
+                        system->_p->meshCacheScale = value;
+                    }
+                };
+                p.memoryCacheUID = p.memorySystem->addCache(memoryCacheData);
+            }
+
             _logInitTime();
         }
 
@@ -136,7 +302,19 @@ namespace djv
         {}
 
         Render::~Render()
-        {}
+        {
+            DJV_PRIVATE_PTR();
+            if (p.memorySystem)
+            {
+                p.memorySystem->removeCache(p.memoryCacheUID);
+            }
+#if !defined(DJV_GL_ES2)
+            if (p.instanceVBO)
+            {
+                glDeleteBuffers(1, &p.instanceVBO);
+            }
+#endif // DJV_GL_ES2
+        }
 
         std::shared_ptr<Render> Render::create(const std::shared_ptr<System::Context>& context)
         {
@@ -199,14 +377,56 @@ namespace djv
                 glBindTexture(GL_TEXTURE_2D, atlasTextures[i]);
             }
 
+#if !defined(DJV_GL_ES2)
+            // Upload the instance data for all of the primitives.
+            std::vector<InstanceVertex> instanceVertices;
+            for (const auto& i : p.primitives)
+            {
+                for (const auto& j : i.second)
+                {
+                    for (const auto& k : j.second)
+                    {
+                        k->instanceOffset = instanceVertices.size();
+                        for (const auto& l : k->instances)
+                        {
+                            instanceVertices.push_back(getInstanceVertex(l));
+                        }
+                    }
+                }
+            }
+            if (instanceVertices.size())
+            {
+                if (!p.instanceVBO)
+                {
+                    glGenBuffers(1, &p.instanceVBO);
+                }
+                glBindBuffer(GL_ARRAY_BUFFER, p.instanceVBO);
+                glBufferData(
+                    GL_ARRAY_BUFFER,
+                    static_cast<GLsizeiptr>(instanceVertices.size() * sizeof(InstanceVertex)),
+                    instanceVertices.data(),
+                    GL_STREAM_DRAW);
+            }
+#endif // DJV_GL_ES2
+
             BindData bindData;
             bindData.lights = p.lights;
             PrimitiveBindData primitiveBindData;
             primitiveBindData.camera = p.options.camera->getP() * p.options.camera->getV();
             for (const auto& i : p.primitives)
             {
-                auto vao = p.meshCache[i.first]->getVAO();
-                vao->bind();
+                const auto& meshCache = p.meshCache[i.first];
+                size_t vaoPage = static_cast<size_t>(-1);
+                auto bindVAO = [&meshCache, &vaoPage](size_t page) -> std::shared_ptr<GL::VAO>
+                {
+                    const auto& vao = meshCache->getVAO(page);
+                    if (page != vaoPage)
+                    {
+                        vao->bind();
+                        vaoPage = page;
+                    }
+                    return vao;
+                };
                 for (const auto& j : i.second)
                 {
                     j.first->getShader()->bind();
@@ -215,10 +435,96 @@ namespace djv
                     {
                         primitiveBindData.model = k->xform;
                         primitiveBindData.color = k->color;
-                        j.first->primitiveBind(primitiveBindData);
-                        for (const auto& vaoIt : k->vaoRange)
+                        primitiveBindData.instancing = false;
+                        if (k->instances.empty())
+                        {
+                            j.first->primitiveBind(primitiveBindData);
+                            for (const auto& l : k->meshRanges)
+                            {
+                                bindVAO(l.page)->draw(k->type, l.range.getMin(), l.range.getMax() - l.range.getMin() + 1);
+                            }
+                        }
+                        else
+                        {
+#if defined(DJV_GL_ES2)
+                            // Instancing is not available so draw each instance
+                            // separately.
+                            for (const auto& l : k->instances)
+                            {
+                                primitiveBindData.model = k->xform * l.transform;
+                                primitiveBindData.color = l.color;
+                                j.first->primitiveBind(primitiveBindData);
+                                for (const auto& m : k->meshRanges)
+                                {
+                                    bindVAO(m.page)->draw(k->type, m.range.getMin(), m.range.getMax() - m.range.getMin() + 1);
+                                }
+                            }
+#else // DJV_GL_ES2
+                            primitiveBindData.instancing = true;
+                            j.first->primitiveBind(primitiveBindData);
+                            for (const auto& l : k->meshRanges)
+                            {
+                                // The instance attributes are part of the VAO
+                                // state, so they are set for each range.
+                                const auto vao = bindVAO(l.page);
+                                enableInstanceAttributes(p.instanceVBO, k->instanceOffset);
+                                vao->drawInstanced(
+                                    k->type,
+                                    l.range.getMin(),
+                                    l.range.getMax() - l.range.getMin() + 1,
+                                    k->instances.size());
+                                disableInstanceAttributes();
+                            }
+#endif // DJV_GL_ES2
+                        }
+                    }
+                }
+            }
+
+            // Release the mesh cache ranges now that they have been drawn,
+            // and then defragment the caches.
+            for (const auto& i : p.primitives)
+            {
+                const auto& meshCache = p.meshCache[i.first];
+                for (const auto& j : i.second)
+                {
+                    for (const auto& k : j.second)
+                    {
+                        for (const auto& l : k->meshRanges)
                         {
-                            vao->draw(k->type, vaoIt.getMin(), vaoIt.getMax() - vaoIt.getMin() + 1);
+                            meshCache->release(l.uid);
+                        }
+                    }
+                }
+            }
+            const size_t meshCachePageCountScaledMax = std::max(
+                static_cast<size_t>(meshCachePageCountMax * p.meshCacheScale),
+                static_cast<size_t>(1));
+            for (const auto& i : p.meshCache)
+            {
+                if (meshCachePageCountScaledMax != i.second->getPageCountMax())
+                {
+                    i.second->setPageCountMax(meshCachePageCountScaledMax);
+                }
+                i.second->defragment(meshCacheDefragmentSize);
+
+                // Remove the UIDs of meshes that have been evicted.
+                const size_t evictionCount = i.second->getEvictionCount();
+                auto& meshCacheEvictionCount = p.meshCacheEvictionCounts[i.first];
+                if (evictionCount != meshCacheEvictionCount)
+                {
+                    meshCacheEvictionCount = evictionCount;
+                    auto& cacheUIDs = p.meshCacheUIDs[i.first];
+                    auto j = cacheUIDs.begin();
+                    while (j != cacheUIDs.end())
+                    {
+                        if (!i.second->contains(j->second))
+                        {
+                            j = cacheUIDs.erase(j);
+                        }
+                        else
+                        {
+                            ++j;
                         }
                     }
                 }
@@ -294,24 +600,10 @@ namespace djv
 
                 for (const auto& i : value)
                 {
-                    if (i && i->v.size())
+                    MeshRange range;
+                    if (i && i->v.size() && p.getMeshRange(solidColorMeshType, *i, range))
                     {
-                        auto& meshCache = p.meshCache[solidColorMeshType];
-                        auto& meshCacheUIDs = p.meshCacheUIDs[solidColorMeshType];
-                        Math::SizeTRange range;
-                        bool cached = false;
-                        const UID uid = i->getUID();
-                        const auto j = meshCacheUIDs.find(uid);
-                        if (j != meshCacheUIDs.end())
-                        {
-                            cached = meshCache->get(j->second, range);
-                        }
-                        if (!cached)
-                        {
-                            const auto data = GL::VBO::convert(*i, solidColorMeshType);
-                            meshCacheUIDs[uid] = meshCache->add(data, range);
-                        }
-                        primitive->vaoRange.push_back(range);
+                        primitive->meshRanges.push_back(range);
                     }
                 }
 
@@ -330,21 +622,11 @@ namespace djv
                 primitive->color = p.currentColor;
                 primitive->material = p.currentMaterial;
 
-                auto& meshCache = p.meshCache[solidColorMeshType];
-                auto& meshCacheUIDs = p.meshCacheUIDs[solidColorMeshType];
-                Math::SizeTRange range;
-                const UID uid = value->getUID();
-                const auto i = meshCacheUIDs.find(uid);
-                if (i != meshCacheUIDs.end())
+                MeshRange range;
+                if (p.getMeshRange(solidColorMeshType, *value, range))
                 {
-                    meshCache->get(i->second, range);
+                    primitive->meshRanges.push_back(range);
                 }
-                if (range.getMin() == range.getMax())
-                {
-                    const auto data = GL::VBO::convert(*value, solidColorMeshType);
-                    meshCacheUIDs[uid] = meshCache->add(data, range);
-                }
-                primitive->vaoRange.push_back(range);
 
                 p.primitives[solidColorMeshType][primitive->material].push_back(primitive);
             }
@@ -363,23 +645,10 @@ namespace djv
 
                 for (const auto& i : value)
                 {
-                    if (i->v.size())
+                    MeshRange range;
+                    if (i->v.size() && p.getMeshRange(solidColorMeshType, *i, range))
                     {
-                        auto& meshCache = p.meshCache[solidColorMeshType];
-                        auto& meshCacheUIDs = p.meshCacheUIDs[solidColorMeshType];
-                        Math::SizeTRange range;
-                        const UID uid = i->getUID();
-                        const auto j = meshCacheUIDs.find(uid);
-                        if (j != meshCacheUIDs.end())
-                        {
-                            meshCache->get(j->second, range);
-                        }
-                        if (range.getMin() == range.getMax())
-                        {
-                            const auto data = GL::VBO::convert(*i, solidColorMeshType);
-                            meshCacheUIDs[uid] = meshCache->add(data, range);
-                        }
-                        primitive->vaoRange.push_back(range);
+                        primitive->meshRanges.push_back(range);
                     }
                 }
 
@@ -397,21 +666,11 @@ namespace djv
                 primitive->color = p.currentColor;
                 primitive->material = p.currentMaterial;
 
-                auto& meshCache = p.meshCache[shadedMeshType];
-                auto& meshCacheUIDs = p.meshCacheUIDs[shadedMeshType];
-                Math::SizeTRange range;
-                const UID uid = value.getUID();
-                const auto i = meshCacheUIDs.find(uid);
-                if (i != meshCacheUIDs.end())
-                {
-                    meshCache->get(i->second, range);
-                }
-                if (range.getMin() == range.getMax())
+                MeshRange range;
+                if (p.getMeshRange(shadedMeshType, value, range))
                 {
-                    const auto data = GL::VBO::convert(value, shadedMeshType);
-                    meshCacheUIDs[uid] = meshCache->add(data, range);
+                    primitive->meshRanges.push_back(range);
                 }
-                primitive->vaoRange.push_back(range);
 
                 p.primitives[shadedMeshType][primitive->material].push_back(primitive);
             }
@@ -427,25 +686,12 @@ namespace djv
                 primitive->color = p.currentColor;
                 primitive->material = p.currentMaterial;
 
-                auto& meshCache = p.meshCache[shadedMeshType];
-                auto& meshCacheUIDs = p.meshCacheUIDs[shadedMeshType];
                 for (const auto& i : value)
                 {
-                    if (i.triangles.size())
+                    MeshRange range;
+                    if (i.triangles.size() && p.getMeshRange(shadedMeshType, i, range))
                     {
-                        Math::SizeTRange range;
-                        const UID uid = i.getUID();
-                        const auto j = meshCacheUIDs.find(uid);
-                        if (j != meshCacheUIDs.end())
-                        {
-                            meshCache->get(j->second, range);
-                        }
-                        if (range.getMin() == range.getMax())
-                        {
-                            const auto data = GL::VBO::convert(i, shadedMeshType);
-                            meshCacheUIDs[uid] = meshCache->add(data, range);
-                        }
-                        primitive->vaoRange.push_back(range);
+                        primitive->meshRanges.push_back(range);
                     }
                 }
 
@@ -463,25 +709,35 @@ namespace djv
                 primitive->color = p.currentColor;
                 primitive->material = p.currentMaterial;
 
-                auto& meshCache = p.meshCache[shadedMeshType];
-                auto& meshCacheUIDs = p.meshCacheUIDs[shadedMeshType];
                 for (const auto& i : value)
                 {
-                    if (i->triangles.size())
+                    MeshRange range;
+                    if (i->triangles.size() && p.getMeshRange(shadedMeshType, *i, range))
                     {
-                        Math::SizeTRange range;
-                        const UID uid = i->getUID();
-                        const auto j = meshCacheUIDs.find(uid);
-                        if (j != meshCacheUIDs.end())
-                        {
-                            meshCache->get(j->second, range);
-                        }
-                        if (range.getMin() == range.getMax())
-                        {
-                            const auto data = GL::VBO::convert(*i, shadedMeshType);
-                            meshCacheUIDs[uid] = meshCache->add(data, range);
-                        }
-                        primitive->vaoRange.push_back(range);
+                        primitive->meshRanges.push_back(range);
+                    }
+                }
+
+                p.primitives[shadedMeshType][primitive->material].push_back(primitive);
+            }
+        }
+
+        void Render::drawTriangleMeshes(const std::vector<std::shared_ptr<Geom::IndexedTriangleMesh> >& value)
+        {
+            DJV_PRIVATE_PTR();
+            if (value.size())
+            {
+                auto primitive = std::shared_ptr<Primitive>(new Primitive);
+                primitive->xform = getCurrentTransform();
+                primitive->color = p.currentColor;
+                primitive->material = p.currentMaterial;
+
+                for (const auto& i : value)
+                {
+                    MeshRange range;
+                    if (i->indices.size() && p.getMeshRange(shadedMeshType, *i, range))
+                    {
+                        primitive->meshRanges.push_back(range);
                     }
                 }
 
@@ -489,6 +745,103 @@ namespace djv
             }
         }
 
+        void Render::drawPointsInstanced(
+            const std::vector<std::shared_ptr<Geom::PointList> >& value,
+            const std::vector<InstanceData>& instances)
+        {
+            DJV_PRIVATE_PTR();
+            if (instances.size())
+            {
+                auto& primitives = p.primitives[solidColorMeshType][p.currentMaterial];
+                const size_t size = primitives.size();
+                drawPoints(value);
+                if (primitives.size() > size)
+                {
+                    primitives.back()->instances = instances;
+                }
+            }
+        }
+
+        void Render::drawPolyLinesInstanced(
+            const std::vector<std::shared_ptr<Geom::PointList> >& value,
+            const std::vector<InstanceData>& instances)
+        {
+            DJV_PRIVATE_PTR();
+            if (instances.size())
+            {
+                auto& primitives = p.primitives[solidColorMeshType][p.currentMaterial];
+                const size_t size = primitives.size();
+                drawPolyLines(value);
+                if (primitives.size() > size)
+                {
+                    primitives.back()->instances = instances;
+                }
+            }
+        }
+
+        void Render::drawTriangleMeshesInstanced(
+            const std::vector<std::shared_ptr<Geom::IndexedTriangleMesh> >& value,
+            const std::vector<InstanceData>& instances)
+        {
+            DJV_PRIVATE_PTR();
+            if (instances.size())
+            {
+                auto& primitives = p.primitives[shadedMeshType][p.currentMaterial];
+                const size_t size = primitives.size();
+                drawTriangleMeshes(value);
+                if (primitives.size() > size)
+                {
+                    primitives.back()->instances = instances;
+                }
+            }
+        }
+
+        size_t Render::getMeshCacheByteCount() const
+        {
+            DJV_PRIVATE_PTR();
+            size_t out = 0;
+            for (const auto& i : p.meshCache)
+            {
+                out += i.second->getByteCount();
+            }
+            return out;
+        }
+
+        float Render::getMeshCachePercentage() const
+        {
+            DJV_PRIVATE_PTR();
+            float used = 0.F;
+            size_t byteCount = 0;
+            for (const auto& i : p.meshCache)
+            {
+                used += i.second->getPercentageUsed() / 100.F * i.second->getByteCount();
+                byteCount += i.second->getByteCount();
+            }
+            return byteCount > 0 ? (used / static_cast<float>(byteCount) * 100.F) : 0.F;
+        }
+
+        float Render::getMeshCacheFragmentation() const
+        {
+            DJV_PRIVATE_PTR();
+            float out = 0.F;
+            for (const auto& i : p.meshCache)
+            {
+                out = std::max(out, i.second->getFragmentation());
+            }
+            return out;
+        }
+
+        size_t Render::getMeshCacheEvictionCount() const
+        {
+            DJV_PRIVATE_PTR();
+            size_t out = 0;
+            for (const auto& i : p.meshCache)
+            {
+                out += i.second->getEvictionCount();
+            }
+            return out;
+        }
+
         DJV_ENUM_HELPERS_IMPLEMENTATION(DepthBufferMode);
 
     } // namespace Render3D
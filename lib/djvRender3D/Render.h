@@ -15,6 +15,7 @@ namespace djv
 {
     namespace Geom
     {
+        class IndexedTriangleMesh;
         class PointList;
         class TriangleMesh;
     
@@ -52,6 +53,13 @@ namespace djv
             DepthBufferMode             depthBufferMode = DepthBufferMode::Reverse;
         };
 
+        //! This struct provides the data for one instance of a primitive.
+        struct InstanceData
+        {
+            glm::mat4x4  transform = glm::mat4x4(1.F);
+            Image::Color color;
+        };
+
         //! This class provides a 3D render system.
         class Render : public System::ISystem
         {
@@ -111,6 +119,42 @@ namespace djv
             void drawTriangleMesh(const Geom::TriangleMesh&);
             void drawTriangleMeshes(const std::vector<Geom::TriangleMesh>&);
             void drawTriangleMeshes(const std::vector<std::shared_ptr<Geom::TriangleMesh> >&);
+            void drawTriangleMeshes(const std::vector<std::shared_ptr<Geom::IndexedTriangleMesh> >&);
+
+            ///@}
+
+            //! \name Instanced Primitives
+            //! The primitives are drawn once for each instance. The instance
+            //! transforms are relative to the current transform, and the
+            //! instance colors replace the current color.
+            ///@{
+
+            void drawPointsInstanced(
+                const std::vector<std::shared_ptr<Geom::PointList> >&,
+                const std::vector<InstanceData>&);
+            void drawPolyLinesInstanced(
+                const std::vector<std::shared_ptr<Geom::PointList> >&,
+                const std::vector<InstanceData>&);
+            void drawTriangleMeshesInstanced(
+                const std::vector<std::shared_ptr<Geom::IndexedTriangleMesh> >&,
+                const std::vector<InstanceData>&);
+
+            ///@}
+
+            //! \name Statistics
+            ///@{
+
+            //! Get the size of the mesh caches in bytes.
+            size_t getMeshCacheByteCount() const;
+
+            //! Get the percentage of the mesh caches that is used.
+            float getMeshCachePercentage() const;
+
+            //! Get the fragmentation of the mesh caches.
+            float getMeshCacheFragmentation() const;
+
+            //! Get the number of meshes evicted from the mesh caches.
+            size_t getMeshCacheEvictionCount() const;
 
             ///@}
 
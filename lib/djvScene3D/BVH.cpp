@@ -0,0 +1,458 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvScene3D/BVH.h>
+
+#include <algorithm>
+#include <array>
+#include <future>
+#include <limits>
+
+namespace djv
+{
+    namespace Scene3D
+    {
+        namespace
+        {
+            //! \todo Should this be configurable?
+            const size_t binCount = 12;
+            const uint32_t leafCountMin = 4;
+            const uint32_t leafCountMax = 16;
+            const uint32_t parallelCountMin = 4096;
+            const size_t parallelDepthMax = 3;
+
+            float getSurfaceArea(const Math::BBox3f& value)
+            {
+                const glm::vec3 size = value.getSize();
+                return 2.F * (size.x * size.y + size.y * size.z + size.z * size.x);
+            }
+
+            //! Intersect a ray with a bounding box, returning the distance
+            //! along the ray to the box.
+            bool intersectSlab(
+                const Math::BBox3f& bbox,
+                const glm::vec3&    start,
+                const glm::vec3&    invDir,
+                float               tMax,
+                float&              tNear)
+            {
+                float t0 = 0.F;
+                float t1 = tMax;
+                for (glm::vec3::length_type i = 0; i < 3; ++i)
+                {
+                    float a = (bbox.min[i] - start[i]) * invDir[i];
+                    float b = (bbox.max[i] - start[i]) * invDir[i];
+                    if (a > b)
+                    {
+                        std::swap(a, b);
+                    }
+                    t0 = std::max(t0, a);
+                    t1 = std::min(t1, b);
+                    if (t0 > t1)
+                        return false;
+                }
+                tNear = t0;
+                return true;
+            }
+
+        } // namespace
+
+        Frustum::Frustum()
+        {
+            _planes.fill(glm::vec4(0.F, 0.F, 0.F, 1.F));
+        }
+
+        Frustum::Frustum(const glm::mat4x4& value)
+        {
+            // Extract the planes from the rows of the matrix.
+            glm::vec4 rows[4];
+            for (glm::mat4x4::length_type i = 0; i < 4; ++i)
+            {
+                rows[i] = glm::vec4(value[0][i], value[1][i], value[2][i], value[3][i]);
+            }
+            _planes[0] = rows[3] + rows[0];
+            _planes[1] = rows[3] - rows[0];
+            _planes[2] = rows[3] + rows[1];
+            _planes[3] = rows[3] - rows[1];
+            _planes[4] = rows[3] + rows[2];
+            _planes[5] = rows[3] - rows[2];
+        }
+
+        const std::array<glm::vec4, 6>& Frustum::getPlanes() const
+        {
+            return _planes;
+        }
+
+        bool Frustum::intersects(const Math::BBox3f& value) const
+        {
+            // Test the corner of the box that is farthest along each plane
+            // normal.
+            for (const auto& i : _planes)
+            {
+                const glm::vec3 p(
+                    i.x >= 0.F ? value.max.x : value.min.x,
+                    i.y >= 0.F ? value.max.y : value.min.y,
+                    i.z >= 0.F ? value.max.z : value.min.z);
+                if (i.x * p.x + i.y * p.y + i.z * p.z + i.w < 0.F)
+                    return false;
+            }
+            return true;
+        }
+
+        BVH::BVH()
+        {}
+
+        void BVH::build(const std::vector<Math::BBox3f>& bboxes)
+        {
+            clear();
+            const uint32_t count = static_cast<uint32_t>(bboxes.size());
+            if (0 == count)
+                return;
+
+            std::vector<glm::vec3> centroids(count);
+            _indices.resize(count);
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                centroids[i] = bboxes[i].getCenter();
+                _indices[i] = i;
+            }
+            _nodes.reserve(count * 2);
+            _build(bboxes, centroids, 0, count, 0, _nodes);
+        }
+
+        void BVH::refit(const std::vector<Math::BBox3f>& bboxes)
+        {
+            // Parents are stored before their children so walking the nodes
+            // backwards updates the children first.
+            for (auto i = _nodes.rbegin(); i != _nodes.rend(); ++i)
+            {
+                if (i->count)
+                {
+                    i->bbox = bboxes[_indices[i->first]];
+                    for (uint32_t j = 1; j < i->count; ++j)
+                    {
+                        i->bbox.expand(bboxes[_indices[i->first + j]]);
+                    }
+                }
+                else
+                {
+                    i->bbox = _nodes[i->left].bbox;
+                    i->bbox.expand(_nodes[i->right].bbox);
+                }
+            }
+        }
+
+        void BVH::clear()
+        {
+            _nodes.clear();
+            _indices.clear();
+        }
+
+        size_t BVH::getItemCount() const
+        {
+            return _indices.size();
+        }
+
+        size_t BVH::getNodeCount() const
+        {
+            return _nodes.size();
+        }
+
+        const Math::BBox3f& BVH::getBBox() const
+        {
+            static const Math::BBox3f empty(0.F, 0.F, 0.F, 0.F, 0.F, 0.F);
+            return _nodes.size() ? _nodes[0].bbox : empty;
+        }
+
+        void BVH::cull(const Frustum& frustum, std::vector<size_t>& out) const
+        {
+            if (_nodes.empty())
+                return;
+            std::vector<uint32_t> stack;
+            stack.push_back(0);
+            while (stack.size())
+            {
+                const Node& node = _nodes[stack.back()];
+                stack.pop_back();
+                if (frustum.intersects(node.bbox))
+                {
+                    if (node.count)
+                    {
+                        for (uint32_t i = 0; i < node.count; ++i)
+                        {
+                            out.push_back(_indices[node.first + i]);
+                        }
+                    }
+                    else
+                    {
+                        stack.push_back(node.right);
+                        stack.push_back(node.left);
+                    }
+                }
+            }
+        }
+
+        void BVH::intersect(
+            const Math::Ray3f& ray,
+            const std::function<void(size_t item, float& tMax)>& callback,
+            float tMax) const
+        {
+            if (_nodes.empty())
+                return;
+            const glm::vec3 dir = ray.end - ray.start;
+            const float inf = std::numeric_limits<float>::max();
+            const glm::vec3 invDir(
+                dir.x != 0.F ? 1.F / dir.x : inf,
+                dir.y != 0.F ? 1.F / dir.y : inf,
+                dir.z != 0.F ? 1.F / dir.z : inf);
+            float tNear = 0.F;
+            if (!intersectSlab(_nodes[0].bbox, ray.start, invDir, tMax, tNear))
+                return;
+
+            // Visit the nearest child first so that the callback can shorten
+            // the ray as early as possible.
+            std::vector<std::pair<uint32_t, float> > stack;
+            stack.push_back(std::make_pair(0, tNear));
+            while (stack.size())
+            {
+                const auto item = stack.back();
+                stack.pop_back();
+                if (item.second > tMax)
+                    continue;
+                const Node& node = _nodes[item.first];
+                if (node.count)
+                {
+                    for (uint32_t i = 0; i < node.count; ++i)
+                    {
+                        callback(_indices[node.first + i], tMax);
+                    }
+                }
+                else
+                {
+                    float tLeft = 0.F;
+                    float tRight = 0.F;
+                    const bool left = intersectSlab(_nodes[node.left].bbox, ray.start, invDir, tMax, tLeft);
+                    const bool right = intersectSlab(_nodes[node.right].bbox, ray.start, invDir, tMax, tRight);
+                    if (left && right)
+                    {
+                        if (tLeft <= tRight)
+                        {
+                            stack.push_back(std::make_pair(node.right, tRight));
+                            stack.push_back(std::make_pair(node.left, tLeft));
+                        }
+                        else
+                        {
+                            stack.push_back(std::make_pair(node.left, tLeft));
+                            stack.push_back(std::make_pair(node.right, tRight));
+                        }
+                    }
+                    else if (left)
+                    {
+                        stack.push_back(std::make_pair(node.left, tLeft));
+                    }
+                    else if (right)
+                    {
+                        stack.push_back(std::make_pair(node.right, tRight));
+                    }
+                }
+            }
+        }
+
+        uint32_t BVH::_build(
+            const std::vector<Math::BBox3f>& bboxes,
+            const std::vector<glm::vec3>& centroids,
+            uint32_t first,
+            uint32_t count,
+            size_t depth,
+            std::vector<Node>& nodes)
+        {
+            const uint32_t out = static_cast<uint32_t>(nodes.size());
+            nodes.push_back(Node());
+
+            // Compute the bounds of the items and their centroids.
+            const auto begin = _indices.begin() + first;
+            const auto end = begin + count;
+            Math::BBox3f bbox = bboxes[*begin];
+            Math::BBox3f centroidBBox(centroids[*begin]);
+            for (auto i = begin + 1; i < end; ++i)
+            {
+                bbox.expand(bboxes[*i]);
+                centroidBBox.expand(centroids[*i]);
+            }
+            nodes[out].bbox = bbox;
+
+            // Find the axis with the largest spread.
+            const glm::vec3 centroidSize = centroidBBox.getSize();
+            glm::vec3::length_type axis = 0;
+            if (centroidSize.y > centroidSize[axis])
+            {
+                axis = 1;
+            }
+            if (centroidSize.z > centroidSize[axis])
+            {
+                axis = 2;
+            }
+            const float axisMin = centroidBBox.min[axis];
+            const float axisSize = centroidSize[axis];
+            if (count <= leafCountMin || axisSize <= 0.F)
+            {
+                nodes[out].first = first;
+                nodes[out].count = count;
+                return out;
+            }
+
+            // Sort the items into bins and find the split with the lowest
+            // cost using the surface area heuristic.
+            struct Bin
+            {
+                Math::BBox3f bbox;
+                uint32_t count = 0;
+            };
+            std::array<Bin, binCount> bins;
+            auto getBin = [&centroids, axis, axisMin, axisSize](uint32_t index)
+            {
+                const float v = (centroids[index][axis] - axisMin) / axisSize;
+                return std::min(static_cast<size_t>(v * binCount), binCount - 1);
+            };
+            for (auto i = begin; i < end; ++i)
+            {
+                Bin& bin = bins[getBin(*i)];
+                if (bin.count)
+                {
+                    bin.bbox.expand(bboxes[*i]);
+                }
+                else
+                {
+                    bin.bbox = bboxes[*i];
+                }
+                ++bin.count;
+            }
+            std::array<float, binCount> rightCost;
+            {
+                Math::BBox3f rightBBox;
+                uint32_t rightCount = 0;
+                for (size_t i = binCount - 1; i > 0; --i)
+                {
+                    if (bins[i].count)
+                    {
+                        if (rightCount)
+                        {
+                            rightBBox.expand(bins[i].bbox);
+                        }
+                        else
+                        {
+                            rightBBox = bins[i].bbox;
+                        }
+                        rightCount += bins[i].count;
+                    }
+                    rightCost[i] = rightCount ? rightCount * getSurfaceArea(rightBBox) : 0.F;
+                }
+            }
+            size_t split = 0;
+            float splitCost = std::numeric_limits<float>::max();
+            {
+                Math::BBox3f leftBBox;
+                uint32_t leftCount = 0;
+                for (size_t i = 1; i < binCount; ++i)
+                {
+                    const Bin& bin = bins[i - 1];
+                    if (bin.count)
+                    {
+                        if (leftCount)
+                        {
+                            leftBBox.expand(bin.bbox);
+                        }
+                        else
+                        {
+                            leftBBox = bin.bbox;
+                        }
+                        leftCount += bin.count;
+                    }
+                    if (leftCount > 0 && leftCount < count)
+                    {
+                        const float cost = leftCount * getSurfaceArea(leftBBox) + rightCost[i];
+                        if (cost < splitCost)
+                        {
+                            split = i;
+                            splitCost = cost;
+                        }
+                    }
+                }
+            }
+            if (count <= leafCountMax && splitCost >= count * getSurfaceArea(bbox))
+            {
+                nodes[out].first = first;
+                nodes[out].count = count;
+                return out;
+            }
+
+            // Partition the items, falling back to a median split.
+            auto middle = begin;
+            if (split > 0)
+            {
+                middle = std::partition(
+                    begin,
+                    end,
+                    [&getBin, split](uint32_t index)
+                    {
+                        return getBin(index) < split;
+                    });
+            }
+            if (middle == begin || middle == end)
+            {
+                middle = begin + count / 2;
+                std::nth_element(
+                    begin,
+                    middle,
+                    end,
+                    [&centroids, axis](uint32_t a, uint32_t b)
+                    {
+                        return centroids[a][axis] < centroids[b][axis];
+                    });
+            }
+            const uint32_t leftCount = static_cast<uint32_t>(middle - begin);
+            const uint32_t rightCount = count - leftCount;
+
+            // Build the children. Large subtrees are built in parallel into
+            // separate node lists and then appended.
+            if (count >= parallelCountMin && depth < parallelDepthMax)
+            {
+                std::vector<Node> leftNodes;
+                std::vector<Node> rightNodes;
+                auto future = std::async(
+                    std::launch::async,
+                    [this, &bboxes, &centroids, first, leftCount, depth, &leftNodes]
+                    {
+                        _build(bboxes, centroids, first, leftCount, depth + 1, leftNodes);
+                    });
+                _build(bboxes, centroids, first + leftCount, rightCount, depth + 1, rightNodes);
+                future.get();
+                for (auto* i : { &leftNodes, &rightNodes })
+                {
+                    const uint32_t offset = static_cast<uint32_t>(nodes.size());
+                    for (auto& j : *i)
+                    {
+                        if (!j.count)
+                        {
+                            j.left += offset;
+                            j.right += offset;
+                        }
+                    }
+                    nodes.insert(nodes.end(), i->begin(), i->end());
+                }
+                nodes[out].left = out + 1;
+                nodes[out].right = out + 1 + static_cast<uint32_t>(leftNodes.size());
+            }
+            else
+            {
+                const uint32_t left = _build(bboxes, centroids, first, leftCount, depth + 1, nodes);
+                const uint32_t right = _build(bboxes, centroids, first + leftCount, rightCount, depth + 1, nodes);
+                nodes[out].left = left;
+                nodes[out].right = right;
+            }
+            return out;
+        }
+
+    } // namespace Scene3D
+} // namespace djv
@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvMath/BBox.h>
+#include <djvMath/Ray.h>
+
+#include <glm/mat4x4.hpp>
+#include <glm/vec4.hpp>
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace djv
+{
+    namespace Scene3D
+    {
+        //! This class provides a view frustum.
+        class Frustum
+        {
+        public:
+            Frustum();
+            //! Create a frustum from a combined projection and view matrix.
+            explicit Frustum(const glm::mat4x4&);
+
+            const std::array<glm::vec4, 6>& getPlanes() const;
+
+            //! Get whether a bounding box is at least partially inside the
+            //! frustum.
+            bool intersects(const Math::BBox3f&) const;
+
+        private:
+            std::array<glm::vec4, 6> _planes;
+        };
+
+        //! This class provides a bounding volume hierarchy.
+        //!
+        //! The hierarchy is built from a list of item bounding boxes with the
+        //! surface area heuristic. Queries return indices into the list.
+        class BVH
+        {
+        public:
+            BVH();
+
+            //! \name Build
+            ///@{
+
+            //! Build the hierarchy. Large hierarchies are built in parallel.
+            void build(const std::vector<Math::BBox3f>&);
+
+            //! Update the node bounds for new item bounding boxes without
+            //! changing the structure. The number of items must not change.
+            void refit(const std::vector<Math::BBox3f>&);
+
+            void clear();
+
+            ///@}
+
+            //! \name Information
+            ///@{
+
+            size_t getItemCount() const;
+            size_t getNodeCount() const;
+            const Math::BBox3f& getBBox() const;
+
+            ///@}
+
+            //! \name Queries
+            ///@{
+
+            //! Get the items that are at least partially inside the frustum.
+            void cull(const Frustum&, std::vector<size_t>&) const;
+
+            //! Visit the items whose bounding boxes intersect the ray. The ray
+            //! is parameterized from zero at the start to one at the end. The
+            //! callback can shorten the ray by lowering the maximum to skip
+            //! items that are farther away.
+            void intersect(
+                const Math::Ray3f&,
+                const std::function<void(size_t item, float& tMax)>&,
+                float tMax = 1.F) const;
+
+            ///@}
+
+        private:
+            struct Node
+            {
+                Math::BBox3f bbox;
+                uint32_t     left  = 0;
+                uint32_t     right = 0;
+                uint32_t     first = 0;
+                uint32_t     count = 0;
+            };
+
+            uint32_t _build(
+                const std::vector<Math::BBox3f>&,
+                const std::vector<glm::vec3>& centroids,
+                uint32_t first,
+                uint32_t count,
+                size_t depth,
+                std::vector<Node>&);
+
+            std::vector<Node> _nodes;
+            std::vector<uint32_t> _indices;
+        };
+
+    } // namespace Scene3D
+} // namespace djv
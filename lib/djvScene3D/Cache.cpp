@@ -0,0 +1,1237 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvScene3D/Cache.h>
+
+#include <djvScene3D/Group.h>
+#include <djvScene3D/InstancePrimitive.h>
+#include <djvScene3D/LOD.h>
+#include <djvScene3D/Layer.h>
+#include <djvScene3D/Light.h>
+#include <djvScene3D/Material.h>
+#include <djvScene3D/MeshPrimitive.h>
+#include <djvScene3D/NullPrimitive.h>
+#include <djvScene3D/PointListPrimitive.h>
+#include <djvScene3D/PolyLinePrimitive.h>
+#include <djvScene3D/Scene.h>
+
+#include <djvSystem/File.h>
+#include <djvSystem/FileIO.h>
+#include <djvSystem/FileInfoFunc.h>
+#include <djvSystem/LogSystem.h>
+#include <djvSystem/PathFunc.h>
+#include <djvSystem/TextSystem.h>
+
+#include <djvGeom/IndexedTriangleMesh.h>
+#include <djvGeom/PointList.h>
+
+#include <djvImage/TypeFunc.h>
+
+#include <djvCore/MemoryFunc.h>
+#include <djvCore/StringFormat.h>
+#include <djvCore/StringFunc.h>
+
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <iomanip>
+#include <map>
+#include <set>
+#include <sstream>
+#include <thread>
+
+#if defined(DJV_PLATFORM_WINDOWS)
+#include <sys/utime.h>
+#else // DJV_PLATFORM_WINDOWS
+#include <utime.h>
+#endif // DJV_PLATFORM_WINDOWS
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace Scene3D
+    {
+        namespace IO
+        {
+            namespace Cache
+            {
+                namespace
+                {
+                    const char magic[4] = { 'D', 'J', 'V', 'S' };
+                    const size_t headerSize = 32;
+                    const size_t arrayAlignment = 8;
+                    const uint32_t invalidIndex = static_cast<uint32_t>(-1);
+
+                    //! Temporary files older than this (in seconds) are left
+                    //! over from interrupted writes.
+                    const time_t tempFileTimeout = 24 * 60 * 60;
+
+                    //! Set the modification time of a file to the current time.
+                    void touch(const std::string& fileName)
+                    {
+#if defined(DJV_PLATFORM_WINDOWS)
+                        _wutime(String::toWide(fileName).c_str(), nullptr);
+#else // DJV_PLATFORM_WINDOWS
+                        utime(fileName.c_str(), nullptr);
+#endif // DJV_PLATFORM_WINDOWS
+                    }
+
+                    enum class PrimitiveType : uint32_t
+                    {
+                        Null,
+                        Group,
+                        Mesh,
+                        PolyLine,
+                        PointList,
+                        Instance,
+                        HemisphereLight,
+                        DirectionalLight,
+                        PointLight,
+                        SpotLight
+                    };
+
+                    enum class LayerItemType : uint32_t
+                    {
+                        Layer,
+                        Primitive
+                    };
+
+                    //! This class provides a writer for binary cache data.
+                    class Writer
+                    {
+                    public:
+                        template<typename T>
+                        void pod(const T& value)
+                        {
+                            const uint8_t* p = reinterpret_cast<const uint8_t*>(&value);
+                            data.insert(data.end(), p, p + sizeof(T));
+                        }
+
+                        void string(const std::string& value)
+                        {
+                            pod(static_cast<uint64_t>(value.size()));
+                            data.insert(data.end(), value.begin(), value.end());
+                        }
+
+                        //! Arrays are aligned so that they can be copied
+                        //! directly from the memory map.
+                        template<typename T>
+                        void array(const std::vector<T>& value)
+                        {
+                            pod(static_cast<uint64_t>(value.size()));
+                            data.resize(((data.size() + arrayAlignment - 1) / arrayAlignment) * arrayAlignment, 0);
+                            const uint8_t* p = reinterpret_cast<const uint8_t*>(value.data());
+                            data.insert(data.end(), p, p + value.size() * sizeof(T));
+                        }
+
+                        void color(const Image::Color& value)
+                        {
+                            const Image::Type type = value.getType();
+                            pod(static_cast<uint32_t>(type));
+                            const uint8_t* p = value.getData();
+                            data.insert(data.end(), p, p + Image::getByteCount(type));
+                        }
+
+                        void bbox(const Math::BBox3f& value)
+                        {
+                            pod(value.min);
+                            pod(value.max);
+                        }
+
+                        std::vector<uint8_t> data;
+                    };
+
+                    //! This class provides a reader for binary cache data.
+                    class Reader
+                    {
+                    public:
+                        Reader(const uint8_t* start, const uint8_t* end) :
+                            _start(start),
+                            _p(start),
+                            _end(end)
+                        {}
+
+                        template<typename T>
+                        T pod()
+                        {
+                            _check(sizeof(T));
+                            T out;
+                            memcpy(&out, _p, sizeof(T));
+                            _p += sizeof(T);
+                            return out;
+                        }
+
+                        uint32_t index(size_t size)
+                        {
+                            const uint32_t out = pod<uint32_t>();
+                            if (out != invalidIndex && out >= size)
+                            {
+                                throw std::runtime_error(DJV_TEXT("error_scene_cache_invalid"));
+                            }
+                            return out;
+                        }
+
+                        std::string string()
+                        {
+                            const size_t size = _size(pod<uint64_t>(), 1);
+                            _check(size);
+                            std::string out(reinterpret_cast<const char*>(_p), size);
+                            _p += size;
+                            return out;
+                        }
+
+                        template<typename T>
+                        void array(std::vector<T>& out)
+                        {
+                            const uint64_t count = pod<uint64_t>();
+                            const size_t offset = _p - _start;
+                            _p = _start + ((offset + arrayAlignment - 1) / arrayAlignment) * arrayAlignment;
+                            const size_t size = _size(count, sizeof(T));
+                            _check(size);
+                            out.resize(count);
+                            if (size > 0)
+                            {
+                                memcpy(out.data(), _p, size);
+                            }
+                            _p += size;
+                        }
+
+                        Image::Color color()
+                        {
+                            const uint32_t type = pod<uint32_t>();
+                            if (type >= static_cast<uint32_t>(Image::Type::Count))
+                            {
+                                throw std::runtime_error(DJV_TEXT("error_scene_cache_invalid"));
+                            }
+                            Image::Color out(static_cast<Image::Type>(type));
+                            const size_t size = Image::getByteCount(out.getType());
+                            _check(size);
+                            if (size > 0)
+                            {
+                                memcpy(out.getData(), _p, size);
+                            }
+                            _p += size;
+                            return out;
+                        }
+
+                        Math::BBox3f bbox()
+                        {
+                            const glm::vec3 min = pod<glm::vec3>();
+                            const glm::vec3 max = pod<glm::vec3>();
+                            return Math::BBox3f(min, max);
+                        }
+
+                        bool isEnd() const
+                        {
+                            return _p == _end;
+                        }
+
+                    private:
+                        void _check(size_t size) const
+                        {
+                            if (size > static_cast<size_t>(_end - _p))
+                            {
+                                throw std::runtime_error(DJV_TEXT("error_scene_cache_invalid"));
+                            }
+                        }
+
+                        size_t _size(uint64_t count, size_t size) const
+                        {
+                            if (count > static_cast<uint64_t>(_end - _p) / size)
+                            {
+                                throw std::runtime_error(DJV_TEXT("error_scene_cache_invalid"));
+                            }
+                            return static_cast<size_t>(count) * size;
+                        }
+
+                        const uint8_t* _start = nullptr;
+                        const uint8_t* _p = nullptr;
+                        const uint8_t* _end = nullptr;
+                    };
+
+                    //! This struct provides the tables used to flatten the
+                    //! scene graph into indices.
+                    struct Tables
+                    {
+                        std::vector<std::shared_ptr<IMaterial> > materials;
+                        std::map<const IMaterial*, uint32_t> materialIndices;
+                        std::vector<std::shared_ptr<Layer> > layers;
+                        std::map<const Layer*, uint32_t> layerIndices;
+                        std::vector<std::shared_ptr<IPrimitive> > primitives;
+                        std::map<const IPrimitive*, uint32_t> primitiveIndices;
+
+                        void addMaterial(const std::shared_ptr<IMaterial>& value)
+                        {
+                            if (value && materialIndices.find(value.get()) == materialIndices.end())
+                            {
+                                materialIndices[value.get()] = static_cast<uint32_t>(materials.size());
+                                materials.push_back(value);
+                            }
+                        }
+
+                        void addLayer(const std::shared_ptr<Layer>& value)
+                        {
+                            if (value && layerIndices.find(value.get()) == layerIndices.end())
+                            {
+                                layerIndices[value.get()] = static_cast<uint32_t>(layers.size());
+                                layers.push_back(value);
+                                addMaterial(value->getMaterial());
+                                addLayer(value->getLayer().lock());
+                                for (const auto& i : value->getItems())
+                                {
+                                    addLayer(std::dynamic_pointer_cast<Layer>(i));
+                                }
+                            }
+                        }
+
+                        void addPrimitive(const std::shared_ptr<IPrimitive>& value)
+                        {
+                            if (value && primitiveIndices.find(value.get()) == primitiveIndices.end())
+                            {
+                                primitiveIndices[value.get()] = static_cast<uint32_t>(primitives.size());
+                                primitives.push_back(value);
+                                addMaterial(value->getMaterial());
+                                addLayer(value->getLayer().lock());
+                                for (const auto& i : value->getChildren())
+                                {
+                                    addPrimitive(i);
+                                }
+                                if (auto instance = std::dynamic_pointer_cast<InstancePrimitive>(value))
+                                {
+                                    for (const auto& i : instance->getInstances())
+                                    {
+                                        addPrimitive(i);
+                                    }
+                                }
+                            }
+                        }
+
+                        uint32_t getMaterialIndex(const std::shared_ptr<IMaterial>& value) const
+                        {
+                            const auto i = materialIndices.find(value.get());
+                            return i != materialIndices.end() ? i->second : invalidIndex;
+                        }
+
+                        uint32_t getLayerIndex(const std::shared_ptr<Layer>& value) const
+                        {
+                            const auto i = layerIndices.find(value.get());
+                            return i != layerIndices.end() ? i->second : invalidIndex;
+                        }
+
+                        uint32_t getPrimitiveIndex(const std::shared_ptr<IPrimitive>& value) const
+                        {
+                            const auto i = primitiveIndices.find(value.get());
+                            return i != primitiveIndices.end() ? i->second : invalidIndex;
+                        }
+                    };
+
+                    PrimitiveType getPrimitiveType(const std::shared_ptr<IPrimitive>& value)
+                    {
+                        PrimitiveType out = PrimitiveType::Null;
+                        if (std::dynamic_pointer_cast<NullPrimitive>(value))
+                        {
+                            out = PrimitiveType::Null;
+                        }
+                        else if (std::dynamic_pointer_cast<Group>(value))
+                        {
+                            out = PrimitiveType::Group;
+                        }
+                        else if (std::dynamic_pointer_cast<MeshPrimitive>(value))
+                        {
+                            out = PrimitiveType::Mesh;
+                        }
+                        else if (std::dynamic_pointer_cast<PolyLinePrimitive>(value))
+                        {
+                            out = PrimitiveType::PolyLine;
+                        }
+                        else if (std::dynamic_pointer_cast<PointListPrimitive>(value))
+                        {
+                            out = PrimitiveType::PointList;
+                        }
+                        else if (std::dynamic_pointer_cast<InstancePrimitive>(value))
+                        {
+                            out = PrimitiveType::Instance;
+                        }
+                        else if (std::dynamic_pointer_cast<HemisphereLight>(value))
+                        {
+                            out = PrimitiveType::HemisphereLight;
+                        }
+                        else if (std::dynamic_pointer_cast<DirectionalLight>(value))
+                        {
+                            out = PrimitiveType::DirectionalLight;
+                        }
+                        else if (std::dynamic_pointer_cast<PointLight>(value))
+                        {
+                            out = PrimitiveType::PointLight;
+                        }
+                        else if (std::dynamic_pointer_cast<SpotLight>(value))
+                        {
+                            out = PrimitiveType::SpotLight;
+                        }
+                        else
+                        {
+                            //! \todo Add support for cameras.
+                            throw std::runtime_error(DJV_TEXT("error_scene_cache_unsupported"));
+                        }
+                        return out;
+                    }
+
+                    void writeMesh(Writer& writer, const Geom::IndexedTriangleMesh& value)
+                    {
+                        writer.array(value.v);
+                        writer.array(value.c);
+                        writer.array(value.t);
+                        writer.array(value.n);
+                        writer.array(value.indices);
+                        writer.bbox(value.bbox);
+                    }
+
+                    std::shared_ptr<Geom::IndexedTriangleMesh> readMesh(Reader& reader)
+                    {
+                        auto out = std::shared_ptr<Geom::IndexedTriangleMesh>(new Geom::IndexedTriangleMesh);
+                        reader.array(out->v);
+                        reader.array(out->c);
+                        reader.array(out->t);
+                        reader.array(out->n);
+                        reader.array(out->indices);
+                        out->bbox = reader.bbox();
+                        for (const auto i : out->indices)
+                        {
+                            if (i >= out->v.size())
+                            {
+                                throw std::runtime_error(DJV_TEXT("error_scene_cache_invalid"));
+                            }
+                        }
+                        return out;
+                    }
+
+                    void writePointList(Writer& writer, const Geom::PointList& value)
+                    {
+                        writer.array(value.v);
+                        writer.array(value.c);
+                        writer.bbox(value.bbox);
+                    }
+
+                    std::shared_ptr<Geom::PointList> readPointList(Reader& reader)
+                    {
+                        auto out = std::shared_ptr<Geom::PointList>(new Geom::PointList);
+                        reader.array(out->v);
+                        reader.array(out->c);
+                        out->bbox = reader.bbox();
+                        return out;
+                    }
+
+                    void writeLight(Writer& writer, const ILight& value)
+                    {
+                        writer.pod(static_cast<uint8_t>(value.isEnabled()));
+                        writer.pod(value.getIntensity());
+                    }
+
+                    void readLight(Reader& reader, ILight& out)
+                    {
+                        out.setEnabled(reader.pod<uint8_t>() != 0);
+                        out.setIntensity(reader.pod<float>());
+                    }
+
+                    //! This struct provides the primitive connections that
+                    //! are resolved after all of the primitives are read.
+                    struct PrimitiveLinks
+                    {
+                        uint32_t layer = invalidIndex;
+                        std::vector<uint32_t> children;
+                        std::vector<uint32_t> instances;
+                    };
+
+                } // namespace
+
+                uint64_t getKey(const System::File::Info& fileInfo, const std::string& options)
+                {
+                    System::File::Info info(fileInfo);
+                    info.stat();
+                    std::string fileName = info.getFileName();
+                    try
+                    {
+                        fileName = System::File::getAbsolute(info.getPath()).get();
+                    }
+                    catch (const std::exception&)
+                    {}
+                    std::stringstream ss;
+                    ss << version << '\n';
+                    ss << fileName << '\n';
+                    ss << info.getSize() << '\n';
+                    ss << static_cast<int64_t>(info.getTime()) << '\n';
+                    ss << options;
+                    const std::string s = ss.str();
+                    return Memory::xxHash64(s.data(), s.size());
+                }
+
+                System::File::Path getPath(const System::File::Path& cachePath, uint64_t key)
+                {
+                    std::stringstream ss;
+                    ss << std::hex << std::setfill('0') << std::setw(16) << key << fileExtension;
+                    return System::File::Path(cachePath, ss.str());
+                }
+
+                void write(
+                    const std::string& fileName,
+                    uint64_t key,
+                    const std::shared_ptr<Scene>& scene,
+                    const LOD::PrimitiveLevels& primitiveLevels)
+                {
+                    std::map<const IPrimitive*, const LOD::Levels*> primitiveLevelsMap;
+                    for (const auto& i : primitiveLevels)
+                    {
+                        primitiveLevelsMap[i.first.get()] = &i.second;
+                    }
+
+                    // Flatten the scene graph.
+                    Tables tables;
+                    for (const auto& i : scene->getLayers())
+                    {
+                        tables.addLayer(i);
+                    }
+                    for (const auto& i : scene->getDefinitions())
+                    {
+                        tables.addPrimitive(i);
+                    }
+                    for (const auto& i : scene->getPrimitives())
+                    {
+                        tables.addPrimitive(i);
+                    }
+
+                    Writer writer;
+
+                    // Write the scene.
+                    writer.pod(static_cast<uint32_t>(scene->getSceneOrient()));
+                    writer.pod(scene->getSceneXForm());
+
+                    // Write the materials.
+                    writer.pod(static_cast<uint32_t>(tables.materials.size()));
+                    for (const auto& i : tables.materials)
+                    {
+                        auto material = std::dynamic_pointer_cast<DefaultMaterial>(i);
+                        if (!material)
+                        {
+                            throw std::runtime_error(DJV_TEXT("error_scene_cache_unsupported"));
+                        }
+                        writer.color(material->getAmbient());
+                        writer.color(material->getDiffuse());
+                        writer.color(material->getEmission());
+                        writer.color(material->getSpecular());
+                        writer.pod(material->getShine());
+                        writer.pod(material->getTransparency());
+                        writer.pod(material->getReflectivity());
+                        writer.pod(static_cast<uint8_t>(material->hasDisableLighting()));
+                    }
+
+                    // Write the layers.
+                    std::set<const Layer*> rootLayers;
+                    for (const auto& i : scene->getLayers())
+                    {
+                        rootLayers.insert(i.get());
+                    }
+                    writer.pod(static_cast<uint32_t>(tables.layers.size()));
+                    for (const auto& i : tables.layers)
+                    {
+                        writer.string(i->getName());
+                        writer.pod(static_cast<uint8_t>(i->isVisible()));
+                        writer.color(i->getColor());
+                        writer.pod(tables.getMaterialIndex(i->getMaterial()));
+                        writer.pod(static_cast<uint8_t>(rootLayers.find(i.get()) != rootLayers.end()));
+                    }
+
+                    // Write the primitives.
+                    writer.pod(static_cast<uint32_t>(tables.primitives.size()));
+                    for (const auto& i : tables.primitives)
+                    {
+                        const PrimitiveType type = getPrimitiveType(i);
+                        writer.pod(static_cast<uint32_t>(type));
+                        writer.string(i->getName());
+                        writer.pod(static_cast<uint8_t>(i->isVisible()));
+                        writer.bbox(i->getBBox());
+                        writer.pod(i->getXForm());
+                        writer.pod(static_cast<uint32_t>(i->getColorAssignment()));
+                        writer.color(i->getColor());
+                        writer.pod(static_cast<uint32_t>(i->getMaterialAssignment()));
+                        writer.pod(tables.getMaterialIndex(i->getMaterial()));
+                        writer.pod(tables.getLayerIndex(i->getLayer().lock()));
+                        const auto& children = i->getChildren();
+                        writer.pod(static_cast<uint32_t>(children.size()));
+                        for (const auto& j : children)
+                        {
+                            writer.pod(tables.getPrimitiveIndex(j));
+                        }
+                        switch (type)
+                        {
+                        case PrimitiveType::Mesh:
+                        {
+                            const auto& meshes = i->getMeshes();
+                            writer.pod(static_cast<uint32_t>(meshes.size()));
+                            for (const auto& j : meshes)
+                            {
+                                writeMesh(writer, *j);
+                            }
+                            const auto j = primitiveLevelsMap.find(i.get());
+                            const auto& lods = j != primitiveLevelsMap.end() ? *j->second : i->getLODs();
+                            size_t lodsSize = lods.size();
+                            for (const auto& j : lods)
+                            {
+                                if (j.size() != meshes.size())
+                                {
+                                    lodsSize = 0;
+                                }
+                            }
+                            writer.pod(static_cast<uint32_t>(lodsSize));
+                            for (size_t j = 0; j < lodsSize; ++j)
+                            {
+                                for (const auto& k : lods[j])
+                                {
+                                    writeMesh(writer, *k);
+                                }
+                            }
+                            break;
+                        }
+                        case PrimitiveType::PolyLine:
+                        {
+                            const auto& polyLines = i->getPolyLines();
+                            writer.pod(static_cast<uint32_t>(polyLines.size()));
+                            for (const auto& j : polyLines)
+                            {
+                                writePointList(writer, *j);
+                            }
+                            break;
+                        }
+                        case PrimitiveType::PointList:
+                        {
+                            const auto& pointList = i->getPointList();
+                            writer.pod(static_cast<uint8_t>(pointList ? 1 : 0));
+                            if (pointList)
+                            {
+                                writePointList(writer, *pointList);
+                            }
+                            break;
+                        }
+                        case PrimitiveType::Instance:
+                        {
+                            const auto& instances = std::dynamic_pointer_cast<InstancePrimitive>(i)->getInstances();
+                            writer.pod(static_cast<uint32_t>(instances.size()));
+                            for (const auto& j : instances)
+                            {
+                                writer.pod(tables.getPrimitiveIndex(j));
+                            }
+                            break;
+                        }
+                        case PrimitiveType::HemisphereLight:
+                        {
+                            auto light = std::dynamic_pointer_cast<HemisphereLight>(i);
+                            writeLight(writer, *light);
+                            writer.pod(light->getUp());
+                            writer.color(light->getTopColor());
+                            writer.color(light->getBottomColor());
+                            break;
+                        }
+                        case PrimitiveType::DirectionalLight:
+                        {
+                            auto light = std::dynamic_pointer_cast<DirectionalLight>(i);
+                            writeLight(writer, *light);
+                            writer.pod(light->getDirection());
+                            break;
+                        }
+                        case PrimitiveType::PointLight:
+                        {
+                            writeLight(writer, *std::dynamic_pointer_cast<PointLight>(i));
+                            break;
+                        }
+                        case PrimitiveType::SpotLight:
+                        {
+                            auto light = std::dynamic_pointer_cast<SpotLight>(i);
+                            writeLight(writer, *light);
+                            writer.pod(light->getConeAngle());
+                            writer.pod(light->getDirection());
+                            break;
+                        }
+                        default: break;
+                        }
+                    }
+
+                    // Write the layer items.
+                    for (const auto& i : tables.layers)
+                    {
+                        std::vector<std::pair<LayerItemType, uint32_t> > items;
+                        for (const auto& j : i->getItems())
+                        {
+                            if (auto layer = std::dynamic_pointer_cast<Layer>(j))
+                            {
+                                items.push_back(std::make_pair(LayerItemType::Layer, tables.getLayerIndex(layer)));
+                            }
+                            else if (auto primitive = std::dynamic_pointer_cast<IPrimitive>(j))
+                            {
+                                const uint32_t index = tables.getPrimitiveIndex(primitive);
+                                if (index != invalidIndex)
+                                {
+                                    items.push_back(std::make_pair(LayerItemType::Primitive, index));
+                                }
+                            }
+                        }
+                        writer.pod(static_cast<uint32_t>(items.size()));
+                        for (const auto& j : items)
+                        {
+                            writer.pod(static_cast<uint32_t>(j.first));
+                            writer.pod(j.second);
+                        }
+                    }
+
+                    // Write the scene primitives and definitions.
+                    for (const auto& i : { &scene->getPrimitives(), &scene->getDefinitions() })
+                    {
+                        writer.pod(static_cast<uint32_t>(i->size()));
+                        for (const auto& j : *i)
+                        {
+                            writer.pod(tables.getPrimitiveIndex(j));
+                        }
+                    }
+
+                    // Write the file.
+                    Writer header;
+                    header.data.insert(header.data.end(), magic, magic + sizeof(magic));
+                    header.pod(version);
+                    header.pod(key);
+                    header.pod(static_cast<uint64_t>(writer.data.size()));
+                    header.pod(Memory::xxHash64(writer.data.data(), writer.data.size()));
+                    auto io = System::File::IO::create();
+                    io->openTemp(System::File::Path(fileName).getDirectoryName());
+                    const std::string tmpFileName = io->getFileName();
+                    try
+                    {
+                        io->write(header.data.data(), header.data.size());
+                        io->write(writer.data.data(), writer.data.size());
+                        std::string error;
+                        if (!io->close(&error))
+                        {
+                            throw System::File::Error(error);
+                        }
+                    }
+                    catch (const std::exception&)
+                    {
+                        io->close();
+                        std::remove(tmpFileName.c_str());
+                        throw;
+                    }
+                    std::remove(fileName.c_str());
+                    if (std::rename(tmpFileName.c_str(), fileName.c_str()) != 0)
+                    {
+                        std::remove(tmpFileName.c_str());
+                        throw System::File::Error(DJV_TEXT("error_file_write"));
+                    }
+                }
+
+                std::shared_ptr<Scene> read(const std::string& fileName, uint64_t key)
+                {
+                    std::shared_ptr<Scene> out;
+                    if (!System::File::Info(fileName).doesExist())
+                        return out;
+
+                    // Map the file.
+                    auto io = System::File::IO::create();
+                    io->open(fileName, System::File::Mode::Read);
+#if defined(DJV_MMAP)
+                    const uint8_t* start = io->mmapP();
+                    const uint8_t* end = io->mmapEnd();
+#else // DJV_MMAP
+                    std::vector<uint8_t> buf(io->getSize());
+                    io->read(buf.data(), buf.size());
+                    const uint8_t* start = buf.data();
+                    const uint8_t* end = start + buf.size();
+#endif // DJV_MMAP
+
+                    // Validate the header.
+                    Reader header(start, end);
+                    char fileMagic[4] = { 0, 0, 0, 0 };
+                    for (size_t i = 0; i < sizeof(fileMagic); ++i)
+                    {
+                        fileMagic[i] = header.pod<char>();
+                    }
+                    if (memcmp(fileMagic, magic, sizeof(magic)) != 0 ||
+                        header.pod<uint32_t>() != version)
+                    {
+                        throw std::runtime_error(DJV_TEXT("error_scene_cache_invalid"));
+                    }
+                    if (header.pod<uint64_t>() != key)
+                        return out;
+                    const uint64_t size = header.pod<uint64_t>();
+                    const uint64_t hash = header.pod<uint64_t>();
+                    if (size != static_cast<uint64_t>(end - start) - headerSize ||
+                        hash != Memory::xxHash64(start + headerSize, static_cast<size_t>(size)))
+                    {
+                        throw std::runtime_error(DJV_TEXT("error_scene_cache_invalid"));
+                    }
+                    Reader reader(start + headerSize, end);
+
+                    // Read the scene.
+                    auto scene = Scene::create();
+                    scene->setSceneOrient(static_cast<SceneOrient>(reader.pod<uint32_t>()));
+                    scene->setSceneXForm(reader.pod<glm::mat4x4>());
+
+                    // Read the materials.
+                    std::vector<std::shared_ptr<IMaterial> > materials(reader.pod<uint32_t>());
+                    for (auto& i : materials)
+                    {
+                        auto material = DefaultMaterial::create();
+                        material->setAmbient(reader.color());
+                        material->setDiffuse(reader.color());
+                        material->setEmission(reader.color());
+                        material->setSpecular(reader.color());
+                        material->setShine(reader.pod<float>());
+                        material->setTransparency(reader.pod<float>());
+                        material->setReflectivity(reader.pod<float>());
+                        material->setDisableLighting(reader.pod<uint8_t>() != 0);
+                        i = material;
+                    }
+                    auto getMaterial = [&reader, &materials]
+                    {
+                        const uint32_t index = reader.index(materials.size());
+                        return index != invalidIndex ? materials[index] : nullptr;
+                    };
+
+                    // Read the layers.
+                    std::vector<std::shared_ptr<Layer> > layers(reader.pod<uint32_t>());
+                    for (auto& i : layers)
+                    {
+                        i = Layer::create();
+                        i->setName(reader.string());
+                        i->setVisible(reader.pod<uint8_t>() != 0);
+                        i->setColor(reader.color());
+                        i->setMaterial(getMaterial());
+                        if (reader.pod<uint8_t>())
+                        {
+                            scene->addLayer(i);
+                        }
+                    }
+
+                    // Read the primitives.
+                    const uint32_t primitivesSize = reader.pod<uint32_t>();
+                    std::vector<std::shared_ptr<IPrimitive> > primitives(primitivesSize);
+                    std::vector<PrimitiveLinks> links(primitivesSize);
+                    for (uint32_t i = 0; i < primitivesSize; ++i)
+                    {
+                        const PrimitiveType type = static_cast<PrimitiveType>(reader.pod<uint32_t>());
+                        std::shared_ptr<IPrimitive> primitive;
+                        switch (type)
+                        {
+                        case PrimitiveType::Null:             primitive = NullPrimitive::create(); break;
+                        case PrimitiveType::Group:            primitive = Group::create(); break;
+                        case PrimitiveType::Mesh:             primitive = MeshPrimitive::create(); break;
+                        case PrimitiveType::PolyLine:         primitive = PolyLinePrimitive::create(); break;
+                        case PrimitiveType::PointList:        primitive = PointListPrimitive::create(); break;
+                        case PrimitiveType::Instance:         primitive = InstancePrimitive::create(); break;
+                        case PrimitiveType::HemisphereLight:  primitive = HemisphereLight::create(); break;
+                        case PrimitiveType::DirectionalLight: primitive = DirectionalLight::create(); break;
+                        case PrimitiveType::PointLight:       primitive = PointLight::create(); break;
+                        case PrimitiveType::SpotLight:        primitive = SpotLight::create(); break;
+                        default:
+                            throw std::runtime_error(DJV_TEXT("error_scene_cache_invalid"));
+                        }
+                        primitive->setName(reader.string());
+                        primitive->setVisible(reader.pod<uint8_t>() != 0);
+                        primitive->setBBox(reader.bbox());
+                        primitive->setXForm(reader.pod<glm::mat4x4>());
+                        primitive->setColorAssignment(static_cast<ColorAssignment>(reader.pod<uint32_t>()));
+                        primitive->setColor(reader.color());
+                        primitive->setMaterialAssignment(static_cast<MaterialAssignment>(reader.pod<uint32_t>()));
+                        primitive->setMaterial(getMaterial());
+                        PrimitiveLinks& primitiveLinks = links[i];
+                        primitiveLinks.layer = reader.index(layers.size());
+                        primitiveLinks.children.resize(reader.pod<uint32_t>());
+                        for (auto& j : primitiveLinks.children)
+                        {
+                            j = reader.index(primitivesSize);
+                        }
+                        switch (type)
+                        {
+                        case PrimitiveType::Mesh:
+                        {
+                            auto meshPrimitive = std::dynamic_pointer_cast<MeshPrimitive>(primitive);
+                            const uint32_t meshesSize = reader.pod<uint32_t>();
+                            for (uint32_t j = 0; j < meshesSize; ++j)
+                            {
+                                meshPrimitive->addMesh(readMesh(reader));
+                            }
+
+                            // Each level of detail has the same number of
+                            // meshes as the primitive.
+                            std::vector<std::vector<std::shared_ptr<Geom::IndexedTriangleMesh> > > lods(reader.pod<uint32_t>());
+                            if (lods.size() > LOD::levelsMax)
+                            {
+                                throw std::runtime_error(DJV_TEXT("error_scene_cache_invalid"));
+                            }
+                            for (auto& j : lods)
+                            {
+                                for (uint32_t k = 0; k < meshesSize; ++k)
+                                {
+                                    j.push_back(readMesh(reader));
+                                }
+                            }
+                            meshPrimitive->setLODs(lods);
+                            break;
+                        }
+                        case PrimitiveType::PolyLine:
+                        {
+                            auto polyLinePrimitive = std::dynamic_pointer_cast<PolyLinePrimitive>(primitive);
+                            const uint32_t polyLinesSize = reader.pod<uint32_t>();
+                            for (uint32_t j = 0; j < polyLinesSize; ++j)
+                            {
+                                polyLinePrimitive->addPointList(readPointList(reader));
+                            }
+                            break;
+                        }
+                        case PrimitiveType::PointList:
+                            if (reader.pod<uint8_t>())
+                            {
+                                std::dynamic_pointer_cast<PointListPrimitive>(primitive)->setPointList(readPointList(reader));
+                            }
+                            break;
+                        case PrimitiveType::Instance:
+                            primitiveLinks.instances.resize(reader.pod<uint32_t>());
+                            for (auto& j : primitiveLinks.instances)
+                            {
+                                j = reader.index(primitivesSize);
+                            }
+                            break;
+                        case PrimitiveType::HemisphereLight:
+                        {
+                            auto light = std::dynamic_pointer_cast<HemisphereLight>(primitive);
+                            readLight(reader, *light);
+                            light->setUp(reader.pod<glm::vec3>());
+                            light->setTopColor(reader.color());
+                            light->setBottomColor(reader.color());
+                            break;
+                        }
+                        case PrimitiveType::DirectionalLight:
+                        {
+                            auto light = std::dynamic_pointer_cast<DirectionalLight>(primitive);
+                            readLight(reader, *light);
+                            light->setDirection(reader.pod<glm::vec3>());
+                            break;
+                        }
+                        case PrimitiveType::PointLight:
+                            readLight(reader, *std::dynamic_pointer_cast<PointLight>(primitive));
+                            break;
+                        case PrimitiveType::SpotLight:
+                        {
+                            auto light = std::dynamic_pointer_cast<SpotLight>(primitive);
+                            readLight(reader, *light);
+                            light->setConeAngle(reader.pod<float>());
+                            light->setDirection(reader.pod<glm::vec3>());
+                            break;
+                        }
+                        default: break;
+                        }
+                        primitives[i] = primitive;
+                    }
+
+                    // Read the layer items.
+                    for (const auto& i : layers)
+                    {
+                        const uint32_t itemsSize = reader.pod<uint32_t>();
+                        for (uint32_t j = 0; j < itemsSize; ++j)
+                        {
+                            const LayerItemType type = static_cast<LayerItemType>(reader.pod<uint32_t>());
+                            switch (type)
+                            {
+                            case LayerItemType::Layer:
+                            {
+                                const uint32_t index = reader.index(layers.size());
+                                if (index != invalidIndex)
+                                {
+                                    i->addItem(layers[index]);
+                                }
+                                break;
+                            }
+                            case LayerItemType::Primitive:
+                            {
+                                const uint32_t index = reader.index(primitivesSize);
+                                if (index != invalidIndex)
+                                {
+                                    i->addItem(primitives[index]);
+                                }
+                                break;
+                            }
+                            default:
+                                throw std::runtime_error(DJV_TEXT("error_scene_cache_invalid"));
+                            }
+                        }
+                    }
+
+                    // Connect the primitives.
+                    for (uint32_t i = 0; i < primitivesSize; ++i)
+                    {
+                        const auto& primitive = primitives[i];
+                        const PrimitiveLinks& primitiveLinks = links[i];
+                        if (primitiveLinks.layer != invalidIndex &&
+                            primitive->getLayer().lock() != layers[primitiveLinks.layer])
+                        {
+                            layers[primitiveLinks.layer]->addItem(primitive);
+                        }
+                        for (const auto j : primitiveLinks.children)
+                        {
+                            if (j != invalidIndex)
+                            {
+                                primitive->addChild(primitives[j]);
+                            }
+                        }
+                        if (primitiveLinks.instances.size())
+                        {
+                            auto instance = std::dynamic_pointer_cast<InstancePrimitive>(primitive);
+                            for (const auto j : primitiveLinks.instances)
+                            {
+                                if (j != invalidIndex)
+                                {
+                                    instance->addInstance(primitives[j]);
+                                }
+                            }
+                        }
+                    }
+
+                    // Read the scene primitives and definitions.
+                    for (int i = 0; i < 2; ++i)
+                    {
+                        const uint32_t size = reader.pod<uint32_t>();
+                        for (uint32_t j = 0; j < size; ++j)
+                        {
+                            const uint32_t index = reader.index(primitivesSize);
+                            if (index != invalidIndex)
+                            {
+                                if (0 == i)
+                                {
+                                    scene->addPrimitive(primitives[index]);
+                                }
+                                else
+                                {
+                                    scene->addDefinition(primitives[index]);
+                                }
+                            }
+                        }
+                    }
+                    if (!reader.isEnd())
+                    {
+                        throw std::runtime_error(DJV_TEXT("error_scene_cache_invalid"));
+                    }
+
+                    out = scene;
+                    return out;
+                }
+
+                void cleanup(const System::File::Path& cachePath, size_t maxByteCount)
+                {
+                    System::File::DirectoryListOptions options;
+                    options.sort = System::File::DirectoryListSort::Time;
+                    const time_t now = time(nullptr);
+                    std::vector<System::File::Info> files;
+                    uint64_t byteCount = 0;
+                    for (const auto& i : System::File::directoryList(cachePath, options))
+                    {
+                        if (System::File::Type::File == i.getType())
+                        {
+                            if (fileExtension == i.getPath().getExtension())
+                            {
+                                files.push_back(i);
+                                byteCount += i.getSize();
+                            }
+                            else if (now - i.getTime() > tempFileTimeout)
+                            {
+                                std::remove(i.getFileName().c_str());
+                            }
+                        }
+                    }
+
+                    // The files are sorted by time, so the least recently used
+                    // files are first.
+                    for (auto i = files.begin(); i != files.end() && byteCount > maxByteCount; ++i)
+                    {
+                        if (0 == std::remove(i->getFileName().c_str()))
+                        {
+                            byteCount -= i->getSize();
+                        }
+                    }
+                }
+
+                struct Read::Private
+                {
+                    std::shared_ptr<IRead> read;
+                    std::string cacheFileName;
+                    uint64_t key = 0;
+                    size_t cacheMaxByteCount = 0;
+                    size_t lodLevels = 0;
+                    std::promise<std::shared_ptr<Scene> > scenePromise;
+                    std::promise<LOD::PrimitiveLevels> lodsPromise;
+                    std::future<LOD::PrimitiveLevels> lodsFuture;
+                    std::atomic<bool> cancel;
+                    std::thread thread;
+                };
+
+                Read::Read() :
+                    _p(new Private)
+                {
+                    _p->cancel = false;
+                }
+
+                Read::~Read()
+                {
+                    DJV_PRIVATE_PTR();
+                    p.cancel = true;
+                    if (p.thread.joinable())
+                    {
+                        p.thread.join();
+                    }
+                }
+
+                std::shared_ptr<Read> Read::create(
+                    const std::shared_ptr<IRead>& read,
+                    const std::string& cacheFileName,
+                    uint64_t key,
+                    size_t cacheMaxByteCount,
+                    size_t lodLevels,
+                    const System::File::Info& fileInfo,
+                    const std::shared_ptr<System::TextSystem>& textSystem,
+                    const std::shared_ptr<System::ResourceSystem>& resourceSystem,
+                    const std::shared_ptr<System::LogSystem>& logSystem)
+                {
+                    auto out = std::shared_ptr<Read>(new Read);
+                    out->_init(fileInfo, textSystem, resourceSystem, logSystem);
+                    out->_p->read = read;
+                    out->_p->cacheFileName = cacheFileName;
+                    out->_p->key = key;
+                    out->_p->cacheMaxByteCount = cacheMaxByteCount;
+                    out->_p->lodLevels = lodLevels;
+                    return out;
+                }
+
+                std::future<Info> Read::getInfo()
+                {
+                    return _p->read->getInfo();
+                }
+
+                std::future<std::shared_ptr<Scene> > Read::getScene()
+                {
+                    DJV_PRIVATE_PTR();
+                    if (p.thread.joinable())
+                    {
+                        p.cancel = true;
+                        p.thread.join();
+                        p.cancel = false;
+                    }
+                    p.scenePromise = std::promise<std::shared_ptr<Scene> >();
+                    p.lodsPromise = std::promise<LOD::PrimitiveLevels>();
+                    auto out = p.scenePromise.get_future();
+                    p.lodsFuture = p.lodsPromise.get_future();
+                    p.thread = std::thread(
+                        [this]
+                        {
+                            DJV_PRIVATE_PTR();
+                            std::shared_ptr<Scene> scene;
+                            if (!p.cacheFileName.empty())
+                            {
+                                try
+                                {
+                                    scene = Cache::read(p.cacheFileName, p.key);
+                                    if (scene)
+                                    {
+                                        touch(p.cacheFileName);
+                                    }
+                                }
+                                catch (const std::exception& e)
+                                {
+                                    _logSystem->log(
+                                        "djv::Scene3D::IO::Cache",
+                                        String::Format("{0}: {1}").
+                                            arg(p.cacheFileName).
+                                            arg(_textSystem->getText(e.what())),
+                                        System::LogLevel::Warning);
+                                }
+                                if (scene)
+                                {
+                                    // The levels of detail were read from the cache.
+                                    p.scenePromise.set_value(scene);
+                                    p.lodsPromise.set_value(LOD::PrimitiveLevels());
+                                    return;
+                                }
+                            }
+                            try
+                            {
+                                scene = p.read->getScene().get();
+                            }
+                            catch (...)
+                            {
+                                p.scenePromise.set_exception(std::current_exception());
+                                p.lodsPromise.set_value(LOD::PrimitiveLevels());
+                                return;
+                            }
+
+                            // Return the scene before generating the levels of
+                            // detail so that it can be displayed right away. The
+                            // caller may change the scene transform and bounding
+                            // box, so the rest of the work uses a copy of the
+                            // scene that shares the primitives and layers. Those
+                            // are not modified until the caller applies the
+                            // levels of detail.
+                            std::shared_ptr<Scene> copy;
+                            if (scene)
+                            {
+                                copy = Scene::create();
+                                copy->setSceneOrient(scene->getSceneOrient());
+                                copy->setSceneXForm(scene->getSceneXForm());
+                                for (const auto& i : scene->getLayers())
+                                {
+                                    copy->addLayer(i);
+                                }
+                                for (const auto& i : scene->getDefinitions())
+                                {
+                                    copy->addDefinition(i);
+                                }
+                                for (const auto& i : scene->getPrimitives())
+                                {
+                                    copy->addPrimitive(i);
+                                }
+                            }
+                            p.scenePromise.set_value(scene);
+                            LOD::PrimitiveLevels lods;
+                            if (copy)
+                            {
+                                lods = LOD::compute(copy, p.lodLevels, &p.cancel);
+                                if (!p.cacheFileName.empty() && !p.cancel)
+                                {
+                                    try
+                                    {
+                                        Cache::write(p.cacheFileName, p.key, copy, lods);
+                                        cleanup(
+                                            System::File::Path(System::File::Path(p.cacheFileName).getDirectoryName()),
+                                            p.cacheMaxByteCount);
+                                    }
+                                    catch (const std::exception& e)
+                                    {
+                                        _logSystem->log(
+                                            "djv::Scene3D::IO::Cache",
+                                            String::Format("{0}: {1}").
+                                                arg(p.cacheFileName).
+                                                arg(_textSystem->getText(e.what())),
+                                            System::LogLevel::Warning);
+                                    }
+                                }
+                            }
+                            p.lodsPromise.set_value(lods);
+                        });
+                    return out;
+                }
+
+                std::future<LOD::PrimitiveLevels> Read::getLODs()
+                {
+                    return std::move(_p->lodsFuture);
+                }
+
+            } // namespace Cache
+        } // namespace IO
+    } // namespace Scene3D
+} // namespace djv
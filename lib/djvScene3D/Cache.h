@@ -0,0 +1,116 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvScene3D/IO.h>
+
+#include <djvCore/Memory.h>
+
+namespace djv
+{
+    namespace Scene3D
+    {
+        namespace IO
+        {
+            //! This namespace provides a binary cache for loaded scenes.
+            //!
+            //! The cache stores the scene after it has been loaded and
+            //! tessellated, so that it can be read back with a single memory
+            //! mapped copy instead of parsing the source file again. Cache
+            //! files are keyed on the source file path, size, modification
+            //! time, and the loader options.
+            namespace Cache
+            {
+                //! The cache file format version.
+                const uint32_t version = 2;
+
+                //! The cache file extension.
+                static const std::string fileExtension = ".djvscene";
+
+                //! The name of the cache directory in the user's documents
+                //! directory.
+                static const std::string directoryName = "SceneCache";
+
+                //! The default maximum size of the cache directory.
+                const size_t maxByteCountDefault = 2 * Core::Memory::gigabyte;
+
+                //! Get the key for a source file and loader options.
+                uint64_t getKey(const System::File::Info&, const std::string& options);
+
+                //! Get the cache file path for a key.
+                System::File::Path getPath(const System::File::Path& cachePath, uint64_t key);
+
+                //! Write a scene to a cache file. The file is written to a
+                //! uniquely named temporary file in the same directory and
+                //! then renamed, so that readers never see a partial file.
+                //! Levels of detail that have been computed but not yet
+                //! applied to the scene can be given to write them instead of
+                //! the ones in the primitives. Error messages are text IDs
+                //! for the text system.
+                //! Throws:
+                //! - System::File::Error
+                //! - std::exception
+                void write(
+                    const std::string& fileName,
+                    uint64_t key,
+                    const std::shared_ptr<Scene>&,
+                    const LOD::PrimitiveLevels& = LOD::PrimitiveLevels());
+
+                //! Read a scene from a cache file. A null pointer is
+                //! returned if the file does not exist or was written for a
+                //! different key. Error messages are text IDs for the text
+                //! system.
+                //! Throws:
+                //! - System::File::Error
+                //! - std::exception
+                std::shared_ptr<Scene> read(const std::string& fileName, uint64_t key);
+
+                //! Remove the least recently used cache files until the
+                //! cache directory is no larger than the given size. Cache
+                //! files are touched when they are read, so the modification
+                //! time is the time they were last used. Temporary files left
+                //! by interrupted writes are also removed.
+                void cleanup(const System::File::Path& cachePath, size_t maxByteCount);
+
+                //! This class provides a reader that uses the cache, falling
+                //! back to the source file reader if the cache is missing or
+                //! invalid. Scenes read from the source file are returned
+                //! first, and then levels of detail are generated for them in
+                //! the background and written to the cache, which is then
+                //! reduced to the maximum size. An empty cache file name
+                //! disables the cache.
+                class Read : public IRead
+                {
+                    DJV_NON_COPYABLE(Read);
+
+                protected:
+                    Read();
+
+                public:
+                    ~Read() override;
+
+                    static std::shared_ptr<Read> create(
+                        const std::shared_ptr<IRead>&,
+                        const std::string& cacheFileName,
+                        uint64_t key,
+                        size_t cacheMaxByteCount,
+                        size_t lodLevels,
+                        const System::File::Info&,
+                        const std::shared_ptr<System::TextSystem>&,
+                        const std::shared_ptr<System::ResourceSystem>&,
+                        const std::shared_ptr<System::LogSystem>&);
+
+                    std::future<Info> getInfo() override;
+                    std::future<std::shared_ptr<Scene> > getScene() override;
+                    std::future<LOD::PrimitiveLevels> getLODs() override;
+
+                private:
+                    DJV_PRIVATE();
+                };
+
+            } // namespace Cache
+        } // namespace IO
+    } // namespace Scene3D
+} // namespace djv
@@ -4,6 +4,8 @@
 
 #include <djvScene3D/IO.h>
 
+#include <djvScene3D/Cache.h>
+#include <djvScene3D/LOD.h>
 #include <djvScene3D/OBJ.h>
 #if defined(OpenNURBS_FOUND)
 #include <djvScene3D/OpenNURBS.h>
@@ -12,12 +14,16 @@
 #include <djvSystem/Context.h>
 #include <djvSystem/File.h>
 #include <djvSystem/LogSystem.h>
+#include <djvSystem/PathFunc.h>
 #include <djvSystem/ResourceSystem.h>
 #include <djvSystem/TextSystem.h>
 
 #include <djvCore/StringFormat.h>
 #include <djvCore/StringFunc.h>
 
+#include <rapidjson/writer.h>
+
+#include <algorithm>
 #include <map>
 #include <sstream>
 
@@ -59,6 +65,11 @@ namespace djv
             IRead::~IRead()
             {}
 
+            std::future<LOD::PrimitiveLevels> IRead::getLODs()
+            {
+                return std::future<LOD::PrimitiveLevels>();
+            }
+
             void IWrite::_init(
                 const System::File::Info & fileInfo,
                 const std::shared_ptr<System::TextSystem>& textSystem,
@@ -135,6 +146,10 @@ namespace djv
                 std::shared_ptr<Observer::ValueSubject<bool> > optionsChanged;
                 std::map<std::string, std::shared_ptr<IPlugin> > plugins;
                 std::set<std::string> sequenceExtensions;
+                bool cacheEnabled = true;
+                System::File::Path cachePath;
+                size_t cacheMaxByteCount = Cache::maxByteCountDefault;
+                size_t lodLevels = LOD::levelsDefault;
             };
 
             void IOSystem::_init(const std::shared_ptr<System::Context>& context)
@@ -145,6 +160,21 @@ namespace djv
 
                 p.optionsChanged = Observer::ValueSubject<bool>::create();
 
+                try
+                {
+                    // The cache is stored per user since the files are
+                    // read back without checking where they came from.
+                    auto resourceSystem = context->getSystemT<System::ResourceSystem>();
+                    p.cachePath = System::File::Path(
+                        resourceSystem->getPath(System::File::ResourcePath::Documents),
+                        Cache::directoryName);
+                }
+                catch (const std::exception& e)
+                {
+                    p.cacheEnabled = false;
+                    _log(e.what(), System::LogLevel::Error);
+                }
+
                 p.plugins[OBJ::pluginName] = OBJ::Plugin::create(context);
 #if defined(OpenNURBS_FOUND)
                 p.plugins[OpenNURBS::pluginName] = OpenNURBS::Plugin::create(context);
@@ -230,6 +260,46 @@ namespace djv
                 return _p->optionsChanged;
             }
 
+            bool IOSystem::isCacheEnabled() const
+            {
+                return _p->cacheEnabled;
+            }
+
+            const System::File::Path& IOSystem::getCachePath() const
+            {
+                return _p->cachePath;
+            }
+
+            void IOSystem::setCacheEnabled(bool value)
+            {
+                _p->cacheEnabled = value;
+            }
+
+            void IOSystem::setCachePath(const System::File::Path& value)
+            {
+                _p->cachePath = value;
+            }
+
+            size_t IOSystem::getCacheMaxByteCount() const
+            {
+                return _p->cacheMaxByteCount;
+            }
+
+            void IOSystem::setCacheMaxByteCount(size_t value)
+            {
+                _p->cacheMaxByteCount = value;
+            }
+
+            size_t IOSystem::getLODLevels() const
+            {
+                return _p->lodLevels;
+            }
+
+            void IOSystem::setLODLevels(size_t value)
+            {
+                _p->lodLevels = std::min(value, LOD::levelsMax);
+            }
+
             const std::set<std::string>& IOSystem::getSequenceExtensions() const
             {
                 return _p->sequenceExtensions;
@@ -270,6 +340,50 @@ namespace djv
                     if (i.second->canRead(fileInfo))
                     {
                         out = i.second->read(fileInfo);
+                        if (out)
+                        {
+                            if (auto context = getContext().lock())
+                            {
+                                std::string cacheFileName;
+                                uint64_t key = 0;
+                                if (p.cacheEnabled && !p.cachePath.isEmpty())
+                                {
+                                    try
+                                    {
+                                        if (!System::File::Info(p.cachePath).doesExist())
+                                        {
+                                            System::File::mkdir(p.cachePath);
+                                        }
+                                        rapidjson::Document document;
+                                        const rapidjson::Value options = i.second->getOptions(document.GetAllocator());
+                                        rapidjson::StringBuffer buffer;
+                                        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+                                        options.Accept(writer);
+                                        std::stringstream ss;
+                                        ss << i.first << buffer.GetString() << p.lodLevels;
+                                        key = Cache::getKey(fileInfo, ss.str());
+                                        cacheFileName = Cache::getPath(p.cachePath, key).get();
+                                    }
+                                    catch (const std::exception& e)
+                                    {
+                                        _log(e.what(), System::LogLevel::Error);
+                                    }
+                                }
+                                if (!cacheFileName.empty() || p.lodLevels > 0)
+                                {
+                                    out = Cache::Read::create(
+                                        out,
+                                        cacheFileName,
+                                        key,
+                                        p.cacheMaxByteCount,
+                                        p.lodLevels,
+                                        fileInfo,
+                                        context->getSystemT<System::TextSystem>(),
+                                        context->getSystemT<System::ResourceSystem>(),
+                                        context->getSystemT<System::LogSystem>());
+                                }
+                            }
+                        }
                         break;
                     }
                 }
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <djvScene3D/LOD.h>
+
 #include <djvSystem/FileInfo.h>
 #include <djvSystem/ISystem.h>
 
@@ -68,6 +70,13 @@ namespace djv
 
                 virtual std::future<Info> getInfo() = 0;
                 virtual std::future<std::shared_ptr<Scene> > getScene() = 0;
+
+                //! Get the levels of detail for the scene returned by
+                //! getScene(). They are generated in the background after the
+                //! scene has been returned, and should be applied with
+                //! LOD::apply() from the thread that uses the scene. The
+                //! future is invalid if the reader does not generate them.
+                virtual std::future<LOD::PrimitiveLevels> getLODs();
             };
 
             //! This class provides the interface for writing.
@@ -155,6 +164,35 @@ namespace djv
 
                 std::shared_ptr<Core::Observer::IValueSubject<bool> > observeOptionsChanged() const;
 
+                //! \name Cache
+                //! Loaded scenes are stored in a binary cache so that they
+                //! can be read again without parsing the source file. The
+                //! cache is in the user's documents directory by default, and
+                //! the least recently used files are removed when it is larger
+                //! than the maximum size.
+                ///@{
+
+                bool isCacheEnabled() const;
+                const System::File::Path& getCachePath() const;
+                size_t getCacheMaxByteCount() const;
+
+                void setCacheEnabled(bool);
+                void setCachePath(const System::File::Path&);
+                void setCacheMaxByteCount(size_t);
+
+                ///@}
+
+                //! \name Levels of Detail
+                //! Levels of detail are generated for the mesh primitives of
+                //! loaded scenes and stored in the cache. Zero disables them.
+                ///@{
+
+                size_t getLODLevels() const;
+
+                void setLODLevels(size_t);
+
+                ///@}
+
                 const std::set<std::string>& getSequenceExtensions() const;
                 bool canRead(const System::File::Info&) const;
                 bool canWrite(const System::File::Info&, const Info&) const;
@@ -12,7 +12,8 @@ namespace djv
 {
     namespace Scene3D
     {
-        std::vector<std::shared_ptr<Geom::TriangleMesh> > IPrimitive::_meshesDummy;
+        std::vector<std::shared_ptr<Geom::IndexedTriangleMesh> > IPrimitive::_meshesDummy;
+        std::vector<std::vector<std::shared_ptr<Geom::IndexedTriangleMesh> > > IPrimitive::_lodsDummy;
         std::vector<std::shared_ptr<Geom::PointList> > IPrimitive::_polyLinesDummy;
         std::shared_ptr<Geom::PointList> IPrimitive::_pointListDummy;
         
@@ -21,8 +21,8 @@ namespace djv
 {
     namespace Geom
     {
+        class IndexedTriangleMesh;
         class PointList;
-        class TriangleMesh;
 
     } // namespace Geom
 
@@ -90,7 +90,13 @@ namespace djv
 
             virtual const std::vector<std::shared_ptr<IPrimitive> >& getPrimitives() const;
 
-            virtual const std::vector<std::shared_ptr<Geom::TriangleMesh> >& getMeshes() const;
+            virtual const std::vector<std::shared_ptr<Geom::IndexedTriangleMesh> >& getMeshes() const;
+
+            //! Get the levels of detail. Each level contains a simplified
+            //! version of every mesh returned by getMeshes(), starting with
+            //! the least simplified level.
+            virtual const std::vector<std::vector<std::shared_ptr<Geom::IndexedTriangleMesh> > >& getLODs() const;
+
             virtual const std::vector<std::shared_ptr<Geom::PointList> >& getPolyLines() const;
             virtual const std::shared_ptr<Geom::PointList>& getPointList() const;
 
@@ -109,7 +115,8 @@ namespace djv
             std::shared_ptr<IMaterial> _material;
             std::weak_ptr<IPrimitive> _parent;
             std::vector<std::shared_ptr<IPrimitive> > _children;
-            static std::vector<std::shared_ptr<Geom::TriangleMesh> > _meshesDummy;
+            static std::vector<std::shared_ptr<Geom::IndexedTriangleMesh> > _meshesDummy;
+            static std::vector<std::vector<std::shared_ptr<Geom::IndexedTriangleMesh> > > _lodsDummy;
             static std::vector<std::shared_ptr<Geom::PointList> > _polyLinesDummy;
             static std::shared_ptr<Geom::PointList> _pointListDummy;
         };
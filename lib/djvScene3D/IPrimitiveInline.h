@@ -117,11 +117,16 @@ namespace djv
             return _children;
         }
 
-        inline const std::vector<std::shared_ptr<Geom::TriangleMesh> >& IPrimitive::getMeshes() const
+        inline const std::vector<std::shared_ptr<Geom::IndexedTriangleMesh> >& IPrimitive::getMeshes() const
         {
             return _meshesDummy;
         }
 
+        inline const std::vector<std::vector<std::shared_ptr<Geom::IndexedTriangleMesh> > >& IPrimitive::getLODs() const
+        {
+            return _lodsDummy;
+        }
+
         inline const std::vector<std::shared_ptr<Geom::PointList> >& IPrimitive::getPolyLines() const
         {
             return _polyLinesDummy;
@@ -0,0 +1,187 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvScene3D/LOD.h>
+
+#include <djvScene3D/MeshPrimitive.h>
+#include <djvScene3D/Scene.h>
+
+#include <djvGeom/IndexedTriangleMeshFunc.h>
+
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <set>
+#include <thread>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace Scene3D
+    {
+        namespace LOD
+        {
+            namespace
+            {
+                //! Levels must remove at least this fraction of the
+                //! triangles from the previous level.
+                const float levelReductionMin = .25F;
+
+                size_t getTriangleCount(const std::vector<std::shared_ptr<Geom::IndexedTriangleMesh> >& value)
+                {
+                    size_t out = 0;
+                    for (const auto& i : value)
+                    {
+                        out += i->getTriangleCount();
+                    }
+                    return out;
+                }
+
+                void getMeshPrimitives(
+                    const std::shared_ptr<IPrimitive>& value,
+                    std::set<const IPrimitive*>& visited,
+                    std::vector<std::shared_ptr<MeshPrimitive> >& out)
+                {
+                    if (value && visited.insert(value.get()).second)
+                    {
+                        if (auto meshPrimitive = std::dynamic_pointer_cast<MeshPrimitive>(value))
+                        {
+                            if (meshPrimitive->getLODs().empty())
+                            {
+                                out.push_back(meshPrimitive);
+                            }
+                        }
+                        for (const auto& i : value->getChildren())
+                        {
+                            getMeshPrimitives(i, visited, out);
+                        }
+                        for (const auto& i : value->getPrimitives())
+                        {
+                            getMeshPrimitives(i, visited, out);
+                        }
+                    }
+                }
+
+                Levels compute(const MeshPrimitive& primitive, size_t levels)
+                {
+                    Levels out;
+                    std::vector<std::shared_ptr<Geom::IndexedTriangleMesh> > previous = primitive.getMeshes();
+                    size_t previousTriangleCount = getTriangleCount(previous);
+                    while (out.size() < levels && previousTriangleCount >= triangleCountMin)
+                    {
+                        std::vector<std::shared_ptr<Geom::IndexedTriangleMesh> > level;
+                        for (const auto& i : previous)
+                        {
+                            auto mesh = std::shared_ptr<Geom::IndexedTriangleMesh>(new Geom::IndexedTriangleMesh);
+                            Geom::simplify(
+                                *i,
+                                static_cast<size_t>(i->getTriangleCount() * levelRatio),
+                                *mesh);
+                            level.push_back(mesh);
+                        }
+                        const size_t triangleCount = getTriangleCount(level);
+                        if (triangleCount > previousTriangleCount * (1.F - levelReductionMin))
+                            break;
+                        out.push_back(level);
+                        previous = std::move(level);
+                        previousTriangleCount = triangleCount;
+                    }
+                    return out;
+                }
+
+            } // namespace
+
+            PrimitiveLevels compute(const std::shared_ptr<Scene>& scene, size_t levels, const std::atomic<bool>* cancel)
+            {
+                PrimitiveLevels out;
+                levels = std::min(levels, levelsMax);
+                if (!scene || !levels)
+                    return out;
+
+                std::set<const IPrimitive*> visited;
+                std::vector<std::shared_ptr<MeshPrimitive> > primitives;
+                for (const auto& i : scene->getPrimitives())
+                {
+                    getMeshPrimitives(i, visited, primitives);
+                }
+                for (const auto& i : scene->getDefinitions())
+                {
+                    getMeshPrimitives(i, visited, primitives);
+                }
+
+                // Simplify the largest primitives first so that the threads
+                // finish at about the same time.
+                std::sort(
+                    primitives.begin(),
+                    primitives.end(),
+                    [](const std::shared_ptr<MeshPrimitive>& a, const std::shared_ptr<MeshPrimitive>& b)
+                    {
+                        return getTriangleCount(a->getMeshes()) > getTriangleCount(b->getMeshes());
+                    });
+                out.resize(primitives.size());
+                std::atomic<size_t> index(0);
+                const size_t threadCount = std::min(
+                    primitives.size(),
+                    static_cast<size_t>(std::max(std::thread::hardware_concurrency(), 1U)));
+                std::vector<std::future<void> > futures;
+                for (size_t i = 0; i < threadCount; ++i)
+                {
+                    futures.push_back(std::async(
+                        std::launch::async,
+                        [&primitives, &index, &out, levels, cancel]
+                        {
+                            for (size_t j = index++; j < primitives.size() && !(cancel && *cancel); j = index++)
+                            {
+                                out[j].first = primitives[j];
+                                out[j].second = compute(*primitives[j], levels);
+                            }
+                        }));
+                }
+                for (auto& future : futures)
+                {
+                    future.get();
+                }
+
+                // Remove the primitives that were skipped or not simplified.
+                out.erase(
+                    std::remove_if(
+                        out.begin(),
+                        out.end(),
+                        [](const std::pair<std::shared_ptr<MeshPrimitive>, Levels>& value)
+                        {
+                            return !value.first || value.second.empty();
+                        }),
+                    out.end());
+                return out;
+            }
+
+            void apply(const PrimitiveLevels& value)
+            {
+                for (const auto& i : value)
+                {
+                    i.first->setLODs(i.second);
+                }
+            }
+
+            void generate(const std::shared_ptr<Scene>& scene, size_t levels)
+            {
+                apply(compute(scene, levels));
+            }
+
+            size_t getLevel(float screenSize, float lodScreenSize, size_t levels)
+            {
+                size_t out = 0;
+                float size = lodScreenSize;
+                while (out < levels && screenSize < size)
+                {
+                    ++out;
+                    size *= .5F;
+                }
+                return out;
+            }
+
+        } // namespace LOD
+    } // namespace Scene3D
+} // namespace djv
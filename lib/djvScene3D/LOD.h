@@ -0,0 +1,78 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvCore/Core.h>
+
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace djv
+{
+    namespace Geom
+    {
+        class IndexedTriangleMesh;
+
+    } // namespace Geom
+
+    namespace Scene3D
+    {
+        class MeshPrimitive;
+        class Scene;
+
+        //! This namespace provides levels of detail for mesh primitives.
+        //!
+        //! Each level is simplified from the previous one with the quadric
+        //! error metric, so that distant or small primitives can be drawn
+        //! with fewer triangles.
+        namespace LOD
+        {
+            //! The default number of levels of detail.
+            const size_t levelsDefault = 3;
+
+            //! The maximum number of levels of detail.
+            const size_t levelsMax = 4;
+
+            //! The ratio of triangles between each level.
+            const float levelRatio = .25F;
+
+            //! Primitives with fewer triangles than this are not simplified.
+            const size_t triangleCountMin = 512;
+
+            //! The levels of detail for a mesh primitive.
+            typedef std::vector<std::vector<std::shared_ptr<Geom::IndexedTriangleMesh> > > Levels;
+
+            //! The levels of detail for the mesh primitives in a scene.
+            typedef std::vector<std::pair<std::shared_ptr<MeshPrimitive>, Levels> > PrimitiveLevels;
+
+            //! Compute the levels of detail for the mesh primitives in a
+            //! scene without modifying it, so that they can be computed in
+            //! the background while the scene is in use. Primitives that
+            //! already have levels of detail are skipped. Levels that do not
+            //! remove enough triangles to be worthwhile are not generated.
+            //! The computation stops early if the cancel flag is set.
+            PrimitiveLevels compute(
+                const std::shared_ptr<Scene>&,
+                size_t levels = levelsDefault,
+                const std::atomic<bool>* cancel = nullptr);
+
+            //! Set computed levels of detail on their primitives. This
+            //! should be called from the thread that uses the scene.
+            void apply(const PrimitiveLevels&);
+
+            //! Compute and set the levels of detail for the mesh primitives
+            //! in a scene.
+            void generate(const std::shared_ptr<Scene>&, size_t levels = levelsDefault);
+
+            //! Get the level of detail for the projected size of a primitive
+            //! in pixels. Level zero is used at or above the given size, and
+            //! each halving of the size uses the next level.
+            size_t getLevel(float screenSize, float lodScreenSize, size_t levels);
+
+        } // namespace LOD
+    } // namespace Scene3D
+} // namespace djv
@@ -20,7 +20,7 @@ namespace djv
             return std::shared_ptr<MeshPrimitive>(new MeshPrimitive);
         }
 
-        void MeshPrimitive::addMesh(const std::shared_ptr<Geom::TriangleMesh>& value)
+        void MeshPrimitive::addMesh(const std::shared_ptr<Geom::IndexedTriangleMesh>& value)
         {
             _meshes.push_back(value);
             Math::BBox3f bbox = getBBox();
@@ -36,6 +36,11 @@ namespace djv
             _pointCount += value->v.size();
         }
 
+        void MeshPrimitive::setLODs(const std::vector<std::vector<std::shared_ptr<Geom::IndexedTriangleMesh> > >& value)
+        {
+            _lods = value;
+        }
+
     } // namespace Scene3D
 } // namespace djv
 
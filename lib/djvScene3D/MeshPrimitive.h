@@ -6,7 +6,7 @@
 
 #include <djvScene3D/IPrimitive.h>
 
-#include <djvGeom/TriangleMesh.h>
+#include <djvGeom/IndexedTriangleMesh.h>
 
 namespace djv
 {
@@ -23,14 +23,20 @@ namespace djv
         public:
             static std::shared_ptr<MeshPrimitive> create();
 
-            void addMesh(const std::shared_ptr<Geom::TriangleMesh>&);
+            void addMesh(const std::shared_ptr<Geom::IndexedTriangleMesh>&);
+
+            //! Set the levels of detail. Each level must contain the same
+            //! number of meshes as the primitive.
+            void setLODs(const std::vector<std::vector<std::shared_ptr<Geom::IndexedTriangleMesh> > >&);
 
             std::string getClassName() const override;
-            const std::vector<std::shared_ptr<Geom::TriangleMesh> >& getMeshes() const override;
+            const std::vector<std::shared_ptr<Geom::IndexedTriangleMesh> >& getMeshes() const override;
+            const std::vector<std::vector<std::shared_ptr<Geom::IndexedTriangleMesh> > >& getLODs() const override;
             size_t getPointCount() const override;
 
         private:
-            std::vector<std::shared_ptr<Geom::TriangleMesh> > _meshes;
+            std::vector<std::shared_ptr<Geom::IndexedTriangleMesh> > _meshes;
+            std::vector<std::vector<std::shared_ptr<Geom::IndexedTriangleMesh> > > _lods;
             size_t _pointCount = 0;
         };
 
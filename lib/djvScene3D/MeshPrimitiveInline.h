@@ -11,11 +11,16 @@ namespace djv
             return "MeshPrimitive";
         }
 
-        inline const std::vector<std::shared_ptr<Geom::TriangleMesh> >& MeshPrimitive::getMeshes() const
+        inline const std::vector<std::shared_ptr<Geom::IndexedTriangleMesh> >& MeshPrimitive::getMeshes() const
         {
             return _meshes;
         }
 
+        inline const std::vector<std::vector<std::shared_ptr<Geom::IndexedTriangleMesh> > >& MeshPrimitive::getLODs() const
+        {
+            return _lods;
+        }
+
         inline size_t MeshPrimitive::getPointCount() const
         {
             return _pointCount;
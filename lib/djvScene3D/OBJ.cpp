@@ -17,6 +17,8 @@
 #include <djvCore/StringFormat.h>
 #include <djvCore/StringFunc.h>
 
+#include <cstring>
+
 using namespace djv::Core;
 
 namespace djv
@@ -32,38 +34,59 @@ namespace djv
                     //! Should this be configurable?
                     const size_t threadCount = 4;
 
-                    inline const char* findLineEnd(const char* start, const char* end)
+                    //! Get the line delimiter from the first line ending in the
+                    //! file, so that the lines can be found with memchr().
+                    char getLineDelimiter(const char* start, const char* end)
+                    {
+                        for (const char* p = start; p < end; ++p)
+                        {
+                            if ('\n' == p[0])
+                                return '\n';
+                            if ('\r' == p[0])
+                                return p < end - 1 && '\n' == p[1] ? '\n' : '\r';
+                        }
+                        return '\n';
+                    }
+
+                    //! Find the end of a line, skipping lines that are continued
+                    //! with a backslash.
+                    inline const char* findLineEnd(const char* start, const char* end, char delimiter)
                     {
                         const char* out = start;
-                        for (; out < end; ++out)
+                        while (out < end)
                         {
-                            if (out < end - 2 && '\\' == out[0] && '\r' == out[1] && '\n' == out[2])
+                            out = static_cast<const char*>(memchr(out, delimiter, end - out));
+                            if (!out)
                             {
-                                out += 2;
-                                continue;
+                                out = end;
+                                break;
                             }
-                            if (out < end - 1 && '\\' == out[0] && '\n' == out[1])
+                            const char* prev = out - 1;
+                            if (prev >= start && '\r' == *prev)
                             {
-                                out += 1;
-                                continue;
+                                --prev;
                             }
-                            if (out < end - 1 && '\\' == out[0] && '\r' == out[1])
+                            if (prev >= start && '\\' == *prev)
                             {
-                                out += 1;
+                                ++out;
                                 continue;
                             }
-                            if ('\n' == out[0])
-                                break;
-                            if ('\r' == out[0])
-                                break;
+                            break;
                         }
                         return out;
                     }
 
+                    //! Spaces, tabs, line endings, and line continuations are
+                    //! all treated as white space.
+                    inline bool isWhitespace(char value)
+                    {
+                        return static_cast<unsigned char>(value) <= ' ' || '\\' == value;
+                    }
+
                     inline const char* findWhitespaceEnd(const char* start, const char* end)
                     {
                         const char* out = start;
-                        for (; out < end && (*out == ' ' || *out == '\\' || *out == '\n' || *out == '\r'); ++out)
+                        for (; out < end && isWhitespace(*out); ++out)
                             ;
                         return out;
                     }
@@ -71,193 +94,315 @@ namespace djv
                     inline const char* findWordEnd(const char* start, const char* end)
                     {
                         const char* out = start;
-                        for (; out < end && *out != ' ' && *out != '\\' && *out != '\n' && *out != '\r'; ++out)
+                        for (; out < end && !isWhitespace(*out); ++out)
                             ;
                         return out;
                     }
 
-                    void parseFaceIndex(const char* s, size_t size, size_t& v, size_t& t, size_t& n)
+                    enum class LineType
+                    {
+                        None,
+                        Vertex,
+                        TextureCoordinate,
+                        Normal,
+                        Face
+                    };
+
+                    //! Get the line type, and move the line past the keyword.
+                    LineType getLineType(const char*& line, const char* lineEnd)
+                    {
+                        LineType out = LineType::None;
+                        const size_t lineSize = lineEnd - line;
+                        if (lineSize >= 2 && 'v' == line[0] && isWhitespace(line[1]))
+                        {
+                            out = LineType::Vertex;
+                            line += 1;
+                        }
+                        else if (lineSize >= 3 && 'v' == line[0] && 't' == line[1] && isWhitespace(line[2]))
+                        {
+                            out = LineType::TextureCoordinate;
+                            line += 2;
+                        }
+                        else if (lineSize >= 3 && 'v' == line[0] && 'n' == line[1] && isWhitespace(line[2]))
+                        {
+                            out = LineType::Normal;
+                            line += 2;
+                        }
+                        else if (lineSize >= 2 && 'f' == line[0] && isWhitespace(line[1]))
+                        {
+                            out = LineType::Face;
+                            line += 1;
+                        }
+                        return out;
+                    }
+
+                    //! Count the words in a line.
+                    size_t countWords(const char* line, const char* lineEnd)
+                    {
+                        size_t out = 0;
+                        bool whitespace = true;
+                        for (; line < lineEnd; ++line)
+                        {
+                            const bool value = isWhitespace(*line);
+                            out += whitespace && !value;
+                            whitespace = value;
+                        }
+                        return out;
+                    }
+
+                    //! Parse the floating point numbers in a line.
+                    size_t parseFloats(const char*& line, const char* lineEnd, float* out, size_t size)
                     {
-                        // Find the slashes.
-                        int slashPos[2] = { 0, 0 };
-                        int slashIndex = 0;
                         size_t i = 0;
-                        for (; i < size && slashIndex < 2; ++i)
+                        while (i < size && line < lineEnd)
                         {
-                            if ('/' == s[i])
+                            line = findWhitespaceEnd(line, lineEnd);
+                            const char* word = line;
+                            out[i] = 0.F;
+                            line = findWordEnd(String::fromChars(word, lineEnd, out[i]), lineEnd);
+                            if (line > word)
                             {
-                                slashPos[slashIndex++] = static_cast<int>(i);
+                                ++i;
                             }
                         }
+                        return i;
+                    }
 
-                        // Convert the strings to ints.
-                        if (!slashPos[0])
-                        {
-                            String::fromString(s, i, v);
-                        }
-                        else if (!slashPos[1])
+                    //! Resolve an OBJ index. Positive indices start at one,
+                    //! negative indices are relative to the number of
+                    //! elements read so far, and zero means no index.
+                    inline uint32_t resolveIndex(int64_t value, size_t count)
+                    {
+                        if (value < 0)
                         {
-                            String::fromString(s, slashPos[0], v);
-                            String::fromString(s + slashPos[0] + 1, i - slashPos[0] - 1, t);
+                            value += static_cast<int64_t>(count) + 1;
+                            if (value < 0)
+                            {
+                                value = 0;
+                            }
                         }
-                        else
+                        return static_cast<uint32_t>(value);
+                    }
+
+                    //! This struct provides a piece of the file that is read
+                    //! by a single thread.
+                    struct FilePiece
+                    {
+                        const char* start = nullptr;
+                        const char* end = nullptr;
+                        char lineDelimiter = '\n';
+
+                        //! The number of elements in this piece.
+                        size_t vSize = 0;
+                        size_t cSize = 0;
+                        size_t tSize = 0;
+                        size_t nSize = 0;
+                        size_t trianglesSize = 0;
+
+                        //! The number of elements in the previous pieces.
+                        size_t vOffset = 0;
+                        size_t cOffset = 0;
+                        size_t tOffset = 0;
+                        size_t nOffset = 0;
+                        size_t trianglesOffset = 0;
+                    };
+
+                    template<typename T>
+                    void forEachLine(const FilePiece& filePiece, const T& callback)
+                    {
+                        const char* line = filePiece.start;
+                        const char* lineEnd = filePiece.start;
+                        for (; line < filePiece.end; ++lineEnd, line = lineEnd)
                         {
-                            String::fromString(s, slashPos[0], v);
-                            String::fromString(s + slashPos[0] + 1, slashPos[1] - slashPos[0] - 1, t);
-                            String::fromString(s + slashPos[1] + 1, i - slashPos[1] - 1, n);
+                            // Find the end of the line.
+                            lineEnd = findLineEnd(lineEnd, filePiece.end, filePiece.lineDelimiter);
+
+                            // Skip white space and comments.
+                            line = findWhitespaceEnd(line, lineEnd);
+                            if (line < lineEnd && '#' != line[0])
+                            {
+                                const LineType lineType = getLineType(line, lineEnd);
+                                if (lineType != LineType::None)
+                                {
+                                    callback(lineType, line, lineEnd);
+                                }
+                            }
                         }
                     }
 
-                    void read(const std::string& fileName, Geom::TriangleMesh& mesh, size_t threads)
+                    //! Count the elements in a piece of the file.
+                    void count(FilePiece& filePiece)
+                    {
+                        forEachLine(
+                            filePiece,
+                            [&filePiece](LineType lineType, const char* line, const char* lineEnd)
+                            {
+                                switch (lineType)
+                                {
+                                case LineType::Vertex:
+                                    ++filePiece.vSize;
+                                    if (countWords(line, lineEnd) >= 6)
+                                    {
+                                        ++filePiece.cSize;
+                                    }
+                                    break;
+                                case LineType::TextureCoordinate: ++filePiece.tSize; break;
+                                case LineType::Normal: ++filePiece.nSize; break;
+                                case LineType::Face:
+                                {
+                                    const size_t words = countWords(line, lineEnd);
+                                    if (words >= 3)
+                                    {
+                                        filePiece.trianglesSize += words - 2;
+                                    }
+                                    break;
+                                }
+                                default: break;
+                                }
+                            });
+                    }
+
+                    //! Parse a piece of the file into the pre-allocated mesh.
+                    void parse(const FilePiece& filePiece, Geom::TriangleMesh& mesh)
+                    {
+                        size_t vIndex = filePiece.vOffset;
+                        size_t cIndex = filePiece.cOffset;
+                        size_t tIndex = filePiece.tOffset;
+                        size_t nIndex = filePiece.nOffset;
+                        size_t trianglesIndex = filePiece.trianglesOffset;
+                        forEachLine(
+                            filePiece,
+                            [&mesh, &vIndex, &cIndex, &tIndex, &nIndex, &trianglesIndex]
+                            (LineType lineType, const char* line, const char* lineEnd)
+                            {
+                                float values[3] = { 0.F, 0.F, 0.F };
+                                switch (lineType)
+                                {
+                                case LineType::Vertex:
+                                    parseFloats(line, lineEnd, values, 3);
+                                    mesh.v[vIndex++] = glm::vec3(values[0], values[1], values[2]);
+                                    if (3 == parseFloats(line, lineEnd, values, 3))
+                                    {
+                                        mesh.c[cIndex++] = glm::vec3(values[0], values[1], values[2]);
+                                    }
+                                    break;
+                                case LineType::TextureCoordinate:
+                                    parseFloats(line, lineEnd, values, 2);
+                                    mesh.t[tIndex++] = glm::vec2(values[0], values[1]);
+                                    break;
+                                case LineType::Normal:
+                                    parseFloats(line, lineEnd, values, 3);
+                                    mesh.n[nIndex++] = glm::vec3(values[0], values[1], values[2]);
+                                    break;
+                                case LineType::Face:
+                                {
+                                    // Convert the face to a triangle fan as
+                                    // it is read.
+                                    Geom::TriangleMesh::Vertex first;
+                                    Geom::TriangleMesh::Vertex prev;
+                                    size_t index = 0;
+                                    while (line < lineEnd)
+                                    {
+                                        line = findWhitespaceEnd(line, lineEnd);
+                                        const char* word = line;
+                                        int64_t v = 0;
+                                        int64_t t = 0;
+                                        int64_t n = 0;
+                                        line = String::fromChars(word, lineEnd, v);
+                                        if (line < lineEnd && '/' == *line)
+                                        {
+                                            line = String::fromChars(line + 1, lineEnd, t);
+                                            if (line < lineEnd && '/' == *line)
+                                            {
+                                                line = String::fromChars(line + 1, lineEnd, n);
+                                            }
+                                        }
+                                        line = findWordEnd(line, lineEnd);
+                                        if (line > word)
+                                        {
+                                            const Geom::TriangleMesh::Vertex vertex(
+                                                resolveIndex(v, vIndex),
+                                                resolveIndex(t, tIndex),
+                                                resolveIndex(n, nIndex));
+                                            if (0 == index)
+                                            {
+                                                first = vertex;
+                                            }
+                                            else if (index >= 2)
+                                            {
+                                                auto& triangle = mesh.triangles[trianglesIndex++];
+                                                triangle.v0 = first;
+                                                triangle.v1 = prev;
+                                                triangle.v2 = vertex;
+                                            }
+                                            prev = vertex;
+                                            ++index;
+                                        }
+                                    }
+                                    break;
+                                }
+                                default: break;
+                                }
+                            });
+                    }
+
+                    void read(const std::string& fileName, Geom::IndexedTriangleMesh& out, size_t threads)
                     {
-                        // Open the file.
+                        // Open the file. The file is parsed directly from the
+                        // memory map when it is available.
                         auto io = System::File::IO::create();
                         io->open(fileName, System::File::Mode::Read);
                         const size_t fileSize = io->getSize();
+                        if (!fileSize)
+                            return;
+#if defined(DJV_MMAP)
+                        const char* fileStart = reinterpret_cast<const char*>(io->mmapP());
+#else // DJV_MMAP
                         std::vector<char> data(fileSize);
-                        char* fileStart = data.data();
+                        io->read(data.data(), fileSize);
+                        const char* fileStart = data.data();
+#endif // DJV_MMAP
                         const char* fileEnd = fileStart + fileSize;
-                        io->read(fileStart, fileSize);
 
                         // Divide up the file for each thread.
+                        const char lineDelimiter = getLineDelimiter(fileStart, fileEnd);
                         threads = std::max(threads, size_t(1));
                         const size_t filePieceSize = fileSize / threads;
-                        typedef std::pair<const char*, const char*> FilePiece;
                         std::vector<FilePiece> filePieces;
                         const char* line = fileStart;
                         const char* lineEnd = nullptr;
-                        for (size_t i = 0; i < threads; ++i, line = lineEnd)
+                        for (size_t i = 0; i < threads && line < fileEnd; ++i, line = lineEnd)
                         {
                             // Find the end of the line for this piece of the file.
-                            lineEnd = findLineEnd(line + filePieceSize, fileEnd);
-                            if (lineEnd < fileEnd)
-                                ++lineEnd;
+                            if (i < threads - 1)
+                            {
+                                lineEnd = findLineEnd(std::min(line + filePieceSize, fileEnd), fileEnd, lineDelimiter);
+                                if (lineEnd < fileEnd)
+                                    ++lineEnd;
+                            }
+                            else
+                            {
+                                lineEnd = fileEnd;
+                            }
 
                             // Add this piece to the list.
-                            filePieces.push_back(FilePiece(line, lineEnd));
+                            FilePiece filePiece;
+                            filePiece.start = line;
+                            filePiece.end = lineEnd;
+                            filePiece.lineDelimiter = lineDelimiter;
+                            filePieces.push_back(filePiece);
                         }
 
-                        // Read the file pieces.
-                        std::vector<Geom::TriangleMesh*> meshPieces;
-                        meshPieces.push_back(&mesh);
-                        for (size_t i = 1; i < filePieces.size(); ++i)
-                        {
-                            meshPieces.push_back(new Geom::TriangleMesh);
-                        }
+                        // Count the elements in each piece.
                         std::vector<std::future<void> > futures;
-                        for (size_t i = 0; i < filePieces.size(); ++i)
+                        for (auto& filePiece : filePieces)
                         {
-                            auto filePiece = filePieces[i];
-                            auto mesh = meshPieces[i];
+                            auto p = &filePiece;
                             futures.push_back(std::async(
                                 std::launch::async,
-                                [filePiece, mesh]
+                                [p]
                                 {
-                                    const char* line = filePiece.first;
-                                    const char* lineEnd = filePiece.first;
-                                    const char* word = nullptr;
-                                    Geom::TriangleMesh::Face face;
-                                    glm::vec3 v;
-                                    glm::vec3 c;
-                                    for (; line < filePiece.second; ++lineEnd, line = lineEnd)
-                                    {
-                                        // Find the end of the line.
-                                        lineEnd = findLineEnd(lineEnd, filePiece.second);
-
-                                        // Skip white space.
-                                        line = findWhitespaceEnd(line, lineEnd);
-
-                                        const size_t lineSize = lineEnd - line;
-                                        if (lineSize >= 1 && '#' == line[0])
-                                        {
-                                            // Skip comments.
-                                        }
-                                        else if (lineSize >= 2 && 'v' == line[0] && 'n' == line[1])
-                                        {
-                                            // Read a normal.
-                                            ++line;
-                                            ++line;
-                                            for (int component = 0; component < 3 && line < lineEnd; ++component)
-                                            {
-                                                line = findWhitespaceEnd(line, lineEnd);
-                                                word = line;
-                                                line = findWordEnd(line, lineEnd);
-                                                String::fromString(word, line - word, v[component]);
-                                            }
-                                            mesh->n.push_back(v);
-                                        }
-                                        else if (lineSize >= 2 && 'v' == line[0] && 't' == line[1])
-                                        {
-                                            // Read a texture coordinate.
-                                            ++line;
-                                            ++line;
-                                            for (int component = 0; component < 3 && line < lineEnd; ++component)
-                                            {
-                                                line = findWhitespaceEnd(line, lineEnd);
-                                                word = line;
-                                                line = findWordEnd(line, lineEnd);
-                                                String::fromString(word, line - word, v[component]);
-                                            }
-                                            mesh->t.push_back(v);
-                                        }
-                                        else if (lineSize >= 1 && 'v' == line[0])
-                                        {
-                                            // Read a vertex.
-                                            ++line;
-                                            int component = 0;
-                                            for (; component < 3 && line < lineEnd; ++component)
-                                            {
-                                                line = findWhitespaceEnd(line, lineEnd);
-                                                word = line;
-                                                line = findWordEnd(line, lineEnd);
-                                                String::fromString(word, line - word, v[component]);
-                                            }
-                                            mesh->v.push_back(v);
-                                            component = 0;
-                                            for (; component < 3 && line < lineEnd; ++component)
-                                            {
-                                                line = findWhitespaceEnd(line, lineEnd);
-                                                word = line;
-                                                line = findWordEnd(line, lineEnd);
-                                                String::fromString(word, line - word, c[component]);
-                                            }
-                                            if (3 == component)
-                                            {
-                                                mesh->c.push_back(c);
-                                            }
-                                        }
-                                        else if (lineSize >= 1 && 'f' == line[0])
-                                        {
-                                            // Read a face.
-                                            ++line;
-                                            face.v.resize(3);
-                                            int index = 0;
-                                            while (line < lineEnd)
-                                            {
-                                                line = findWhitespaceEnd(line, lineEnd);
-                                                word = line;
-                                                line = findWordEnd(line, lineEnd);
-                                                if (line - word)
-                                                {
-                                                    size_t v = 0;
-                                                    size_t t = 0;
-                                                    size_t n = 0;
-                                                    parseFaceIndex(word, line - word, v, t, n);
-                                                    if (index < 3)
-                                                    {
-                                                        face.v[index].v = v;
-                                                        face.v[index].t = t;
-                                                        face.v[index++].n = n;
-                                                    }
-                                                    else
-                                                    {
-                                                        face.v.emplace_back(v, t, n);
-                                                    }
-                                                }
-                                            }
-                                            Geom::faceToTriangles(face, mesh->triangles);
-                                        }
-                                    }
+                                    count(*p);
                                 }));
                         }
                         for (auto& future : futures)
@@ -265,16 +410,50 @@ namespace djv
                             future.get();
                         }
 
-                        // Combine the mesh pieces.
-                        for (size_t i = 1; i < meshPieces.size(); ++i)
+                        // Allocate the mesh once. The offsets of each piece
+                        // are used to resolve negative indices and to write
+                        // the elements directly to their final location.
+                        Geom::TriangleMesh mesh;
+                        size_t vSize = 0;
+                        size_t cSize = 0;
+                        size_t tSize = 0;
+                        size_t nSize = 0;
+                        size_t trianglesSize = 0;
+                        for (auto& filePiece : filePieces)
+                        {
+                            filePiece.vOffset = vSize;
+                            filePiece.cOffset = cSize;
+                            filePiece.tOffset = tSize;
+                            filePiece.nOffset = nSize;
+                            filePiece.trianglesOffset = trianglesSize;
+                            vSize += filePiece.vSize;
+                            cSize += filePiece.cSize;
+                            tSize += filePiece.tSize;
+                            nSize += filePiece.nSize;
+                            trianglesSize += filePiece.trianglesSize;
+                        }
+                        mesh.v.resize(vSize);
+                        mesh.c.resize(cSize);
+                        mesh.t.resize(tSize);
+                        mesh.n.resize(nSize);
+                        mesh.triangles.resize(trianglesSize);
+
+                        // Parse the pieces.
+                        futures.clear();
+                        for (const auto& filePiece : filePieces)
                         {
-                            auto meshPiece = meshPieces[i];
-                            mesh.v.insert(mesh.v.end(), meshPiece->v.begin(), meshPiece->v.end());
-                            mesh.c.insert(mesh.c.end(), meshPiece->c.begin(), meshPiece->c.end());
-                            mesh.t.insert(mesh.t.end(), meshPiece->t.begin(), meshPiece->t.end());
-                            mesh.n.insert(mesh.n.end(), meshPiece->n.begin(), meshPiece->n.end());
-                            mesh.triangles.insert(mesh.triangles.end(), meshPiece->triangles.begin(), meshPiece->triangles.end());
-                            delete meshPieces[i];
+                            auto p = &filePiece;
+                            auto meshP = &mesh;
+                            futures.push_back(std::async(
+                                std::launch::async,
+                                [p, meshP]
+                                {
+                                    parse(*p, *meshP);
+                                }));
+                        }
+                        for (auto& future : futures)
+                        {
+                            future.get();
                         }
 
                         // Implied texture/normal indices.
@@ -311,7 +490,8 @@ namespace djv
                             }
                         }
 
-                        mesh.bboxUpdate();
+                        // Convert to an indexed mesh, merging duplicate vertices.
+                        Geom::toIndexedMesh(mesh, out);
                     }
 
                 } // namespace
@@ -360,7 +540,7 @@ namespace djv
                             {
                                 out = Scene::create();
                                 auto primitive = MeshPrimitive::create();
-                                auto mesh = std::shared_ptr<Geom::TriangleMesh>(new Geom::TriangleMesh);
+                                auto mesh = std::shared_ptr<Geom::IndexedTriangleMesh>(new Geom::IndexedTriangleMesh);
                                 read(_fileInfo.getFileName(), *mesh, threadCount);
                                 primitive->addMesh(mesh);
                                 auto material = DefaultMaterial::create();
@@ -18,7 +18,7 @@
 
 #include <djvSystem/TextSystem.h>
 
-#include <djvGeom/TriangleMesh.h>
+#include <djvGeom/IndexedTriangleMesh.h>
 
 #include <djvCore/StringFormat.h>
 #include <djvCore/StringFunc.h>
@@ -82,80 +82,80 @@ namespace djv
                             value.m_xform[0][3], value.m_xform[1][3], value.m_xform[2][3], value.m_xform[3][3]);
                     }
 
-                    std::shared_ptr<Geom::TriangleMesh> readMesh(const ON_Mesh* onMesh)
+                    std::shared_ptr<Geom::IndexedTriangleMesh> readMesh(const ON_Mesh* onMesh)
                     {
-                        auto out = std::make_shared<Geom::TriangleMesh>();
+                        auto out = std::make_shared<Geom::IndexedTriangleMesh>();
 
+                        // The OpenNURBS vertices are already unique so they
+                        // can be copied directly.
+                        const int vertexCount = onMesh->VertexCount();
                         const int faceCount = onMesh->FaceCount();
                         const bool hasTexCoord = onMesh->HasTextureCoordinates();
                         const bool hasNormals = onMesh->HasVertexNormals();
+                        out->v.reserve(vertexCount);
+                        for (int i = 0; i < vertexCount; ++i)
+                        {
+                            out->v.push_back(fromON(onMesh->m_V[i]));
+                        }
+                        if (hasTexCoord)
+                        {
+                            out->t.reserve(vertexCount);
+                            for (int i = 0; i < vertexCount; ++i)
+                            {
+                                out->t.push_back(fromON(onMesh->m_T[i]));
+                            }
+                        }
+                        if (hasNormals)
+                        {
+                            out->n.reserve(vertexCount);
+                            for (int i = 0; i < vertexCount; ++i)
+                            {
+                                out->n.push_back(fromON(onMesh->m_N[i]));
+                            }
+                        }
 
+                        out->indices.reserve(static_cast<size_t>(faceCount) * 6);
                         for (int i = 0; i < faceCount; ++i)
                         {
                             const ON_MeshFace& f = onMesh->m_F[i];
-                            const size_t v = 1 + out->v.size();
-                            const size_t n = 1 + out->n.size();
-                            const size_t t = 1 + out->t.size();
-                            for (int j = 0; j < 3; ++j)
+                            const uint32_t vi[] =
                             {
-                                out->v.push_back(fromON(onMesh->m_V[f.vi[j]]));
-                                if (hasTexCoord)
-                                {
-                                    out->t.push_back(fromON(onMesh->m_T[f.vi[j]]));
-                                }
-                                if (hasNormals)
-                                {
-                                    out->n.push_back(fromON(onMesh->m_N[f.vi[j]]));
-                                }
-                            }
+                                static_cast<uint32_t>(f.vi[0]),
+                                static_cast<uint32_t>(f.vi[1]),
+                                static_cast<uint32_t>(f.vi[2]),
+                                static_cast<uint32_t>(f.vi[3])
+                            };
                             if (f.IsQuad())
                             {
-                                out->v.push_back(fromON(onMesh->m_V[f.vi[3]]));
-                                if (hasTexCoord)
-                                {
-                                    out->t.push_back(fromON(onMesh->m_T[f.vi[3]]));
-                                }
-                                if (hasNormals)
-                                {
-                                    out->n.push_back(fromON(onMesh->m_N[f.vi[3]]));
-                                }
+                                // Split the quad along the shortest diagonal.
                                 if (onMesh->m_V[f.vi[0]].DistanceTo(onMesh->m_V[f.vi[2]]) <=
                                     onMesh->m_V[f.vi[1]].DistanceTo(onMesh->m_V[f.vi[3]]))
                                 {
-                                    Geom::TriangleMesh::Triangle a;
-                                    a.v0 = Geom::TriangleMesh::Vertex(v + 0, hasTexCoord ? t + 0 : 0, hasNormals ? n + 0 : 0);
-                                    a.v1 = Geom::TriangleMesh::Vertex(v + 1, hasTexCoord ? t + 1 : 0, hasNormals ? n + 1 : 0);
-                                    a.v2 = Geom::TriangleMesh::Vertex(v + 2, hasTexCoord ? t + 2 : 0, hasNormals ? n + 2 : 0);
-                                    out->triangles.push_back(a);
-                                    Geom::TriangleMesh::Triangle b;
-                                    a.v0 = Geom::TriangleMesh::Vertex(v + 0, hasTexCoord ? t + 0 : 0, hasNormals ? n + 0 : 0);
-                                    a.v1 = Geom::TriangleMesh::Vertex(v + 2, hasTexCoord ? t + 2 : 0, hasNormals ? n + 2 : 0);
-                                    a.v2 = Geom::TriangleMesh::Vertex(v + 3, hasTexCoord ? t + 3 : 0, hasNormals ? n + 3 : 0);
-                                    out->triangles.push_back(a);
+                                    out->indices.push_back(vi[0]);
+                                    out->indices.push_back(vi[1]);
+                                    out->indices.push_back(vi[2]);
+                                    out->indices.push_back(vi[0]);
+                                    out->indices.push_back(vi[2]);
+                                    out->indices.push_back(vi[3]);
                                 }
                                 else
                                 {
-                                    Geom::TriangleMesh::Triangle a;
-                                    a.v0 = Geom::TriangleMesh::Vertex(v + 1, hasTexCoord ? t + 1 : 0, hasNormals ? n + 1 : 0);
-                                    a.v1 = Geom::TriangleMesh::Vertex(v + 2, hasTexCoord ? t + 2 : 0, hasNormals ? n + 2 : 0);
-                                    a.v2 = Geom::TriangleMesh::Vertex(v + 3, hasTexCoord ? t + 3 : 0, hasNormals ? n + 3 : 0);
-                                    out->triangles.push_back(a);
-                                    Geom::TriangleMesh::Triangle b;
-                                    a.v0 = Geom::TriangleMesh::Vertex(v + 1, hasTexCoord ? t + 1 : 0, hasNormals ? n + 1 : 0);
-                                    a.v1 = Geom::TriangleMesh::Vertex(v + 3, hasTexCoord ? t + 3 : 0, hasNormals ? n + 3 : 0);
-                                    a.v2 = Geom::TriangleMesh::Vertex(v + 0, hasTexCoord ? t + 0 : 0, hasNormals ? n + 0 : 0);
-                                    out->triangles.push_back(a);
+                                    out->indices.push_back(vi[1]);
+                                    out->indices.push_back(vi[2]);
+                                    out->indices.push_back(vi[3]);
+                                    out->indices.push_back(vi[1]);
+                                    out->indices.push_back(vi[3]);
+                                    out->indices.push_back(vi[0]);
                                 }
                             }
                             else
                             {
-                                Geom::TriangleMesh::Triangle a;
-                                a.v0 = Geom::TriangleMesh::Vertex(v + 0, hasTexCoord ? t + 0 : 0, hasNormals ? n + 0 : 0);
-                                a.v1 = Geom::TriangleMesh::Vertex(v + 1, hasTexCoord ? t + 1 : 0, hasNormals ? n + 1 : 0);
-                                a.v2 = Geom::TriangleMesh::Vertex(v + 2, hasTexCoord ? t + 2 : 0, hasNormals ? n + 2 : 0);
-                                out->triangles.push_back(a);
+                                out->indices.push_back(vi[0]);
+                                out->indices.push_back(vi[1]);
+                                out->indices.push_back(vi[2]);
                             }
                         }
+                        out->shrink();
                         out->bboxUpdate();
                         return out;
                     }
@@ -167,7 +167,7 @@ namespace djv
                         std::map<const ON_Material*, std::shared_ptr<IMaterial> > onMaterialToMaterial;
                         std::map<const ON_InstanceDefinition*, std::shared_ptr<IPrimitive> > onInstanceDefToInstance;
                         std::map<std::shared_ptr<InstancePrimitive>, const ON_InstanceDefinition* > instanceToOnInstanceDef;
-                        std::map<const ON_Mesh*, std::shared_ptr<Geom::TriangleMesh> > onMeshToMesh;
+                        std::map<const ON_Mesh*, std::shared_ptr<Geom::IndexedTriangleMesh> > onMeshToMesh;
                     };
 
                     std::shared_ptr<IPrimitive> readGeometryComponent(
@@ -236,7 +236,7 @@ namespace djv
                             }
                             else if (auto onMesh = ON_Mesh::Cast(onModelGeometryComponent->Geometry(nullptr)))
                             {
-                                std::shared_ptr<Geom::TriangleMesh> mesh;
+                                std::shared_ptr<Geom::IndexedTriangleMesh> mesh;
                                 const auto i = data.onMeshToMesh.find(onMesh);
                                 if (i != data.onMeshToMesh.end())
                                 {
@@ -247,7 +247,7 @@ namespace djv
                                     mesh = readMesh(onMesh);
                                     data.onMeshToMesh[onMesh] = mesh;
                                 }
-                                if (mesh && mesh->triangles.size() > 0)
+                                if (mesh && mesh->indices.size() > 0)
                                 {
                                     auto newPrimitive = MeshPrimitive::create();
                                     newPrimitive->addMesh(mesh);
@@ -261,7 +261,7 @@ namespace djv
                                 const int onMeshCount = onBrep->GetMesh(ON::render_mesh, onMeshes);
                                 for (int i = 0; i < onMeshCount; ++i)
                                 {
-                                    std::shared_ptr<Geom::TriangleMesh> mesh;
+                                    std::shared_ptr<Geom::IndexedTriangleMesh> mesh;
                                     const auto j = data.onMeshToMesh.find(onMeshes[i]);
                                     if (j != data.onMeshToMesh.end())
                                     {
@@ -272,12 +272,12 @@ namespace djv
                                         mesh = readMesh(onMeshes[i]);
                                         data.onMeshToMesh[onMeshes[i]] = mesh;
                                     }
-                                    if (!newPrimitive && mesh && mesh->triangles.size() > 0)
+                                    if (!newPrimitive && mesh && mesh->indices.size() > 0)
                                     {
                                         newPrimitive = MeshPrimitive::create();
                                         out = newPrimitive;
                                     }
-                                    if (newPrimitive && mesh && mesh->triangles.size() > 0)
+                                    if (newPrimitive && mesh && mesh->indices.size() > 0)
                                     {
                                         newPrimitive->addMesh(mesh);
                                     }
@@ -287,7 +287,7 @@ namespace djv
                             {
                                 if (auto onMesh = onExtrusion->Mesh(ON::render_mesh))
                                 {
-                                    std::shared_ptr<Geom::TriangleMesh> mesh;
+                                    std::shared_ptr<Geom::IndexedTriangleMesh> mesh;
                                     const auto i = data.onMeshToMesh.find(onMesh);
                                     if (i != data.onMeshToMesh.end())
                                     {
@@ -298,7 +298,7 @@ namespace djv
                                         mesh = readMesh(onMesh);
                                         data.onMeshToMesh[onMesh] = mesh;
                                     }
-                                    if (mesh && mesh->triangles.size() > 0)
+                                    if (mesh && mesh->indices.size() > 0)
                                     {
                                         auto newPrimitive = MeshPrimitive::create();
                                         newPrimitive->addMesh(mesh);
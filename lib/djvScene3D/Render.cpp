@@ -4,8 +4,10 @@
 
 #include <djvScene3D/Render.h>
 
+#include <djvScene3D/BVH.h>
 #include <djvScene3D/Camera.h>
 #include <djvScene3D/IPrimitive.h>
+#include <djvScene3D/LOD.h>
 #include <djvScene3D/Light.h>
 #include <djvScene3D/Material.h>
 #include <djvScene3D/Scene.h>
@@ -14,10 +16,17 @@
 #include <djvRender3D/Light.h>
 #include <djvRender3D/Material.h>
 
+#include <djvGeom/IndexedTriangleMesh.h>
 #include <djvGeom/PointList.h>
+#include <djvGeom/TriangleMeshFunc.h>
+
+#include <djvMath/BBoxFunc.h>
+
+#include <djvCore/MemoryFunc.h>
 
 #include <glm/gtc/matrix_transform.hpp>
 
+#include <cmath>
 #include <unordered_map>
 
 using namespace djv::Core;
@@ -32,39 +41,279 @@ namespace djv
                 size == other.size &&
                 clip == other.clip &&
                 shaderMode == other.shaderMode &&
-                depthBufferMode == other.depthBufferMode;
+                depthBufferMode == other.depthBufferMode &&
+                lodScreenSize == other.lodScreenSize;
         }
 
-        struct Render::Private
+        bool PickResult::operator == (const PickResult& other) const
         {
-            std::weak_ptr<System::Context> context;
-            std::shared_ptr<Scene> scene;
-            std::map<std::shared_ptr<IMaterial>, std::shared_ptr<Render3D::IMaterial> > materials;
-            std::shared_ptr<Render3D::IMaterial> colorMaterial;
-            std::shared_ptr<Render3D::IMaterial> defaultMaterial;
-            std::list<glm::mat4x4> transforms;
-            const glm::mat4x4 identity = glm::mat4x4(1.F);
-            struct Key
+            return primitive == other.primitive &&
+                position == other.position &&
+                distance == other.distance;
+        }
+
+        namespace
+        {
+            //! This struct provides the key for batches of primitives that are
+            //! drawn together.
+            struct BatchKey
             {
                 glm::mat4x4 transform = glm::mat4x4(1.F);
                 Image::Color color;
                 std::shared_ptr<Render3D::IMaterial> material;
 
-                bool operator == (const Key& other) const
+                bool operator == (const BatchKey& other) const
                 {
                     return transform == other.transform &&
                         color == other.color &&
                         material == other.material;
                 }
             };
-            typedef std::pair<Key, std::vector<std::shared_ptr<Geom::TriangleMesh> > > TriangleMeshesKeyValue;
-            typedef std::pair<Key, std::vector<std::shared_ptr<Geom::PointList> > > PointListsKeyValue;
-            std::vector<TriangleMeshesKeyValue> triangleMeshes;
-            std::vector<PointListsKeyValue> polyLines;
-            std::vector<PointListsKeyValue> pointLists;
+
+            struct BatchKeyHash
+            {
+                size_t operator () (const BatchKey& value) const
+                {
+                    size_t out = 0;
+                    for (glm::mat4x4::length_type c = 0; c < 4; ++c)
+                    {
+                        for (glm::mat4x4::length_type r = 0; r < 4; ++r)
+                        {
+                            Memory::hashCombine(out, value.transform[c][r]);
+                        }
+                    }
+                    Memory::hashCombine(out, static_cast<int>(value.color.getType()));
+                    const size_t byteCount = Image::getByteCount(value.color.getType());
+                    const uint8_t* data = value.color.getData();
+                    for (size_t i = 0; i < byteCount; ++i)
+                    {
+                        Memory::hashCombine(out, data[i]);
+                    }
+                    Memory::hashCombine(out, value.material.get());
+                    return out;
+                }
+            };
+
+            //! This struct provides the key for primitives that are drawn
+            //! multiple times with different transforms and colors.
+            typedef std::pair<const IPrimitive*, const Render3D::IMaterial*> InstanceKey;
+
+            struct InstanceKeyHash
+            {
+                size_t operator () (const InstanceKey& value) const
+                {
+                    size_t out = 0;
+                    Memory::hashCombine(out, value.first);
+                    Memory::hashCombine(out, value.second);
+                    return out;
+                }
+            };
+
+            //! This struct provides a batch of primitives. Each value is
+            //! paired with the item it belongs to so that the batch can be
+            //! culled, and with its index in the primitive so that the
+            //! levels of detail can be looked up.
+            template<typename T>
+            struct Batch
+            {
+                BatchKey key;
+                std::vector<std::shared_ptr<T> > values;
+                std::vector<size_t> items;
+                std::vector<size_t> indices;
+            };
+
+            struct InstanceGroup
+            {
+                std::shared_ptr<IPrimitive> primitive;
+                std::shared_ptr<Render3D::IMaterial> material;
+                std::vector<Render3D::InstanceData> instances;
+                std::vector<size_t> items;
+            };
+
+            //! This struct provides an instance of a primitive in the scene.
+            struct Item
+            {
+                std::shared_ptr<IPrimitive> primitive;
+                glm::mat4x4 xform = glm::mat4x4(1.F);
+                glm::mat4x4 transform = glm::mat4x4(1.F);
+                Math::BBox3f bbox = Math::BBox3f(0.F, 0.F, 0.F, 0.F, 0.F, 0.F);
+            };
+
+            //! Compute the bounding box of a primitive's geometry. The
+            //! bounding boxes stored in the geometry are not used since they
+            //! may not have been updated.
+            Math::BBox3f getGeometryBBox(const IPrimitive& primitive)
+            {
+                Math::BBox3f out(0.F, 0.F, 0.F, 0.F, 0.F, 0.F);
+                bool first = true;
+                auto expand = [&out, &first](const std::vector<glm::vec3>& value)
+                {
+                    for (const auto& i : value)
+                    {
+                        if (first)
+                        {
+                            out = Math::BBox3f(i);
+                            first = false;
+                        }
+                        else
+                        {
+                            out.expand(i);
+                        }
+                    }
+                };
+                for (const auto& i : primitive.getMeshes())
+                {
+                    expand(i->v);
+                }
+                for (const auto& i : primitive.getPolyLines())
+                {
+                    expand(i->v);
+                }
+                if (const auto& pointList = primitive.getPointList())
+                {
+                    expand(pointList->v);
+                }
+                return out;
+            }
+
+            std::shared_ptr<BVH> createMeshBVH(const Geom::IndexedTriangleMesh& mesh)
+            {
+                const size_t triangleCount = mesh.indices.size() / 3;
+                std::vector<Math::BBox3f> bboxes(triangleCount);
+                for (size_t i = 0; i < triangleCount; ++i)
+                {
+                    const uint32_t* indices = &mesh.indices[i * 3];
+                    Math::BBox3f& bbox = bboxes[i];
+                    bbox = Math::BBox3f(mesh.v[indices[0]]);
+                    bbox.expand(mesh.v[indices[1]]);
+                    bbox.expand(mesh.v[indices[2]]);
+                }
+                auto out = std::shared_ptr<BVH>(new BVH);
+                out->build(bboxes);
+                return out;
+            }
+
+            template<typename T>
+            void getVisible(
+                const Batch<T>& batch,
+                const std::vector<bool>& visible,
+                std::vector<std::shared_ptr<T> >& out)
+            {
+                out.clear();
+                const size_t size = batch.values.size();
+                for (size_t i = 0; i < size; ++i)
+                {
+                    if (visible[batch.items[i]])
+                    {
+                        out.push_back(batch.values[i]);
+                    }
+                }
+            }
+
+            void getVisible(
+                const Batch<Geom::IndexedTriangleMesh>& batch,
+                const std::vector<bool>& visible,
+                const std::vector<Item>& items,
+                const std::vector<size_t>& itemLODs,
+                std::vector<std::shared_ptr<Geom::IndexedTriangleMesh> >& out)
+            {
+                out.clear();
+                const size_t size = batch.values.size();
+                for (size_t i = 0; i < size; ++i)
+                {
+                    const size_t item = batch.items[i];
+                    if (visible[item])
+                    {
+                        const size_t level = itemLODs[item];
+                        out.push_back(level > 0 ?
+                            items[item].primitive->getLODs()[level - 1][batch.indices[i]] :
+                            batch.values[i]);
+                    }
+                }
+            }
+
+            template<typename T>
+            Batch<T>& getBatch(
+                std::vector<Batch<T> >& batches,
+                std::unordered_map<BatchKey, size_t, BatchKeyHash>& indices,
+                const BatchKey& key)
+            {
+                size_t index = 0;
+                const auto i = indices.find(key);
+                if (i != indices.end())
+                {
+                    index = i->second;
+                }
+                else
+                {
+                    index = batches.size();
+                    indices[key] = index;
+                    batches.push_back(Batch<T>());
+                    batches.back().key = key;
+                }
+                return batches[index];
+            }
+
+            glm::mat4x4 getSceneTransform(const Scene& scene)
+            {
+                glm::mat4x4 out(1.F);
+                switch (scene.getSceneOrient())
+                {
+                case SceneOrient::ZUp:
+                {
+                    out = glm::rotate(out, Math::deg2rad(-90.F), glm::vec3(1.F, 0.F, 0.F));
+                    break;
+                }
+                default: break;
+                }
+                out *= scene.getSceneXForm();
+                return out;
+            }
+
+        } // namespace
+
+        struct Render::Private
+        {
+            std::weak_ptr<System::Context> context;
+            std::shared_ptr<Scene> scene;
+            std::map<std::shared_ptr<IMaterial>, std::shared_ptr<Render3D::IMaterial> > materials;
+            std::shared_ptr<Render3D::IMaterial> colorMaterial;
+            std::shared_ptr<Render3D::IMaterial> defaultMaterial;
+            std::list<glm::mat4x4> transforms;
+            const glm::mat4x4 identity = glm::mat4x4(1.F);
+
+            std::vector<InstanceGroup> instanceGroups;
+            std::unordered_map<InstanceKey, size_t, InstanceKeyHash> instanceGroupIndices;
+
+            std::vector<Batch<Geom::IndexedTriangleMesh> > triangleMeshes;
+            std::vector<Batch<Geom::PointList> > polyLines;
+            std::vector<Batch<Geom::PointList> > pointLists;
+            std::unordered_map<BatchKey, size_t, BatchKeyHash> triangleMeshesIndices;
+            std::unordered_map<BatchKey, size_t, BatchKeyHash> polyLinesIndices;
+            std::unordered_map<BatchKey, size_t, BatchKeyHash> pointListsIndices;
+
+            // The items are indexed by the bounding volume hierarchy, which
+            // is used for culling and picking.
+            std::vector<Item> items;
+            std::vector<Math::BBox3f> itemBBoxes;
+            std::unordered_map<const IPrimitive*, Math::BBox3f> primitiveBBoxes;
+            BVH bvh;
+            std::unordered_map<Core::UID, std::shared_ptr<BVH> > meshBVHs;
+
+            std::vector<size_t> visibleItems;
+            std::vector<bool> visible;
+            std::vector<size_t> itemLODs;
+            std::vector<std::shared_ptr<Geom::IndexedTriangleMesh> > visibleTriangleMeshes;
+            std::vector<std::shared_ptr<Geom::PointList> > visiblePointLists;
+            std::vector<Render3D::InstanceData> visibleInstances;
+
             size_t primitivesCount = 0;
             size_t pointCount = 0;
             size_t lightCount = 0;
+
+            void clearBatches();
+            void addBatches(const InstanceGroup&);
+            void transformsUpdate();
         };
 
         void Render::_init(const std::shared_ptr<System::Context>& context)
@@ -92,9 +341,15 @@ namespace djv
             
             p.materials.clear();
             p.transforms.clear();
-            p.triangleMeshes.clear();
-            p.polyLines.clear();
-            p.pointLists.clear();
+            p.clearBatches();
+            p.items.clear();
+            p.itemBBoxes.clear();
+            p.primitiveBBoxes.clear();
+            p.bvh.clear();
+            if (value != p.scene)
+            {
+                p.meshBVHs.clear();
+            }
             p.primitivesCount = 0;
             p.pointCount = 0;
             p.lightCount = 0;
@@ -105,27 +360,50 @@ namespace djv
             {
                 if (p.scene)
                 {
-                    glm::mat4x4 m(1.F);
-                    switch (p.scene->getSceneOrient())
-                    {
-                    case SceneOrient::ZUp:
-                    {
-                        m = glm::rotate(m, Math::deg2rad(-90.F), glm::vec3(1.F, 0.F, 0.F));
-                        break;
-                    }
-                    default: break;
-                    }
-                    m *= p.scene->getSceneXForm();
-                    _pushTransform(m);
+                    // The item transforms are relative to the scene transform
+                    // so that they can be updated when it changes.
                     for (const auto& i : p.scene->getPrimitives())
                     {
                         _prePass(i, context);
                     }
-                    _popTransform();
+
+                    // Primitives that are only drawn once are combined into
+                    // batches, the rest are drawn with instancing.
+                    std::vector<InstanceGroup> instanceGroups;
+                    for (auto& i : p.instanceGroups)
+                    {
+                        if (1 == i.instances.size())
+                        {
+                            p.addBatches(i);
+                        }
+                        else
+                        {
+                            instanceGroups.push_back(std::move(i));
+                        }
+                    }
+                    p.instanceGroups = std::move(instanceGroups);
+                    p.instanceGroupIndices.clear();
+                    p.triangleMeshesIndices.clear();
+                    p.polyLinesIndices.clear();
+                    p.pointListsIndices.clear();
+                    p.primitiveBBoxes.clear();
+
+                    p.transformsUpdate();
+                    p.bvh.build(p.itemBBoxes);
                 }
             }
         }
 
+        void Render::xformUpdate()
+        {
+            DJV_PRIVATE_PTR();
+            if (p.scene)
+            {
+                p.transformsUpdate();
+                p.bvh.refit(p.itemBBoxes);
+            }
+        }
+
         void Render::render(
             const std::shared_ptr<Render3D::Render>& render,
             const RenderOptions& renderOptions)
@@ -163,36 +441,201 @@ namespace djv
                 render3DOptions.clip = renderOptions.clip;
                 render3DOptions.depthBufferMode = renderOptions.depthBufferMode;
 
+                // Cull the primitives that are outside of the camera view.
+                const Frustum frustum(renderOptions.camera->getP() * renderOptions.camera->getV());
+                p.visibleItems.clear();
+                p.bvh.cull(frustum, p.visibleItems);
+                p.visible.assign(p.items.size(), false);
+                for (const auto i : p.visibleItems)
+                {
+                    p.visible[i] = true;
+                }
+
+                // Choose the level of detail for the visible items from the
+                // projected size of their bounding spheres. The W component
+                // of the projected center is the view depth for perspective
+                // projections and one for orthographic projections.
+                p.itemLODs.assign(p.items.size(), 0);
+                if (renderOptions.lodScreenSize > 0.F)
+                {
+                    const glm::mat4x4& projection = renderOptions.camera->getP();
+                    const glm::mat4x4 pv = projection * renderOptions.camera->getV();
+                    const float scale = std::abs(projection[1][1]) * renderOptions.size.h * .5F;
+                    for (const auto i : p.visibleItems)
+                    {
+                        const size_t levels = p.items[i].primitive->getLODs().size();
+                        if (levels > 0)
+                        {
+                            const Math::BBox3f& bbox = p.itemBBoxes[i];
+                            const glm::vec4 center = pv * glm::vec4(bbox.getCenter(), 1.F);
+                            if (center.w > 0.F)
+                            {
+                                const float screenSize = glm::length(bbox.getSize()) * scale / center.w;
+                                p.itemLODs[i] = LOD::getLevel(screenSize, renderOptions.lodScreenSize, levels);
+                            }
+                        }
+                    }
+                }
+
                 // Render the primitives.
                 render->beginFrame(render3DOptions);
                 for (const auto& i : p.triangleMeshes)
                 {
-                    render->setColor(i.first.color);
-                    render->setMaterial(i.first.material);
-                    render->pushTransform(i.first.transform);
-                    render->drawTriangleMeshes(i.second);
-                    render->popTransform();
+                    getVisible(i, p.visible, p.items, p.itemLODs, p.visibleTriangleMeshes);
+                    if (p.visibleTriangleMeshes.size())
+                    {
+                        render->setColor(i.key.color);
+                        render->setMaterial(i.key.material);
+                        render->pushTransform(i.key.transform);
+                        render->drawTriangleMeshes(p.visibleTriangleMeshes);
+                        render->popTransform();
+                    }
                 }
                 for (const auto& i : p.polyLines)
                 {
-                    render->setColor(i.first.color);
-                    render->setMaterial(i.first.material);
-                    render->pushTransform(i.first.transform);
-                    render->drawPolyLines(i.second);
-                    render->popTransform();
+                    getVisible(i, p.visible, p.visiblePointLists);
+                    if (p.visiblePointLists.size())
+                    {
+                        render->setColor(i.key.color);
+                        render->setMaterial(i.key.material);
+                        render->pushTransform(i.key.transform);
+                        render->drawPolyLines(p.visiblePointLists);
+                        render->popTransform();
+                    }
                 }
                 for (const auto& i : p.pointLists)
                 {
-                    render->setColor(i.first.color);
-                    render->setMaterial(i.first.material);
-                    render->pushTransform(i.first.transform);
-                    render->drawPoints(i.second);
-                    render->popTransform();
+                    getVisible(i, p.visible, p.visiblePointLists);
+                    if (p.visiblePointLists.size())
+                    {
+                        render->setColor(i.key.color);
+                        render->setMaterial(i.key.material);
+                        render->pushTransform(i.key.transform);
+                        render->drawPoints(p.visiblePointLists);
+                        render->popTransform();
+                    }
+                }
+                for (const auto& i : p.instanceGroups)
+                {
+                    // Draw the triangle meshes for each level of detail.
+                    const auto& lods = i.primitive->getLODs();
+                    const size_t size = i.instances.size();
+                    for (size_t level = 0; level <= lods.size(); ++level)
+                    {
+                        p.visibleInstances.clear();
+                        for (size_t j = 0; j < size; ++j)
+                        {
+                            const size_t item = i.items[j];
+                            if (p.visible[item] && p.itemLODs[item] == level)
+                            {
+                                p.visibleInstances.push_back(i.instances[j]);
+                            }
+                        }
+                        if (p.visibleInstances.size())
+                        {
+                            render->setMaterial(i.material);
+                            render->drawTriangleMeshesInstanced(
+                                level > 0 ? lods[level - 1] : i.primitive->getMeshes(),
+                                p.visibleInstances);
+                        }
+                    }
+
+                    p.visibleInstances.clear();
+                    for (size_t j = 0; j < size; ++j)
+                    {
+                        if (p.visible[i.items[j]])
+                        {
+                            p.visibleInstances.push_back(i.instances[j]);
+                        }
+                    }
+                    if (p.visibleInstances.size())
+                    {
+                        render->setMaterial(i.material);
+                        render->drawPolyLinesInstanced(i.primitive->getPolyLines(), p.visibleInstances);
+                        if (const auto& pointList = i.primitive->getPointList())
+                        {
+                            render->drawPointsInstanced({ pointList }, p.visibleInstances);
+                        }
+                    }
                 }
                 render->endFrame();
             }
         }
 
+        bool Render::pick(const Math::Ray3f& ray, PickResult& out)
+        {
+            DJV_PRIVATE_PTR();
+            size_t hitItem = p.items.size();
+            float hitT = 1.F;
+            p.bvh.intersect(
+                ray,
+                [this, &ray, &hitItem, &hitT](size_t index, float& tMax)
+                {
+                    DJV_PRIVATE_PTR();
+
+                    // Intersect the ray with the meshes in local space. The
+                    // ray parameter is the same in both spaces since the
+                    // transform is affine.
+                    const Item& item = p.items[index];
+                    const glm::mat4x4 inverse = glm::inverse(item.transform);
+                    const glm::vec3 start(inverse * glm::vec4(ray.start, 1.F));
+                    const glm::vec3 end(inverse * glm::vec4(ray.end, 1.F));
+                    const glm::vec3 dir = end - start;
+                    const float dirLengthSquared = glm::dot(dir, dir);
+                    if (dirLengthSquared <= 0.F)
+                        return;
+                    for (const auto& mesh : item.primitive->getMeshes())
+                    {
+                        std::shared_ptr<BVH> meshBVH;
+                        const auto i = p.meshBVHs.find(mesh->getUID());
+                        if (i != p.meshBVHs.end())
+                        {
+                            meshBVH = i->second;
+                        }
+                        else
+                        {
+                            meshBVH = createMeshBVH(*mesh);
+                            p.meshBVHs[mesh->getUID()] = meshBVH;
+                        }
+                        meshBVH->intersect(
+                            Math::Ray3f(start, end),
+                            [index, &mesh, &start, &dir, dirLengthSquared, &tMax, &hitItem, &hitT](size_t triangle, float& meshTMax)
+                            {
+                                const uint32_t* indices = &mesh->indices[triangle * 3];
+                                glm::vec3 position;
+                                glm::vec3 barycentric;
+                                if (Geom::intersectTriangle(
+                                    start,
+                                    dir,
+                                    mesh->v[indices[0]],
+                                    mesh->v[indices[1]],
+                                    mesh->v[indices[2]],
+                                    position,
+                                    barycentric))
+                                {
+                                    const float t = glm::dot(position - start, dir) / dirLengthSquared;
+                                    if (t <= meshTMax)
+                                    {
+                                        meshTMax = t;
+                                        tMax = t;
+                                        hitItem = index;
+                                        hitT = t;
+                                    }
+                                }
+                            },
+                            tMax);
+                    }
+                });
+            const bool hit = hitItem < p.items.size();
+            if (hit)
+            {
+                out.primitive = p.items[hitItem].primitive;
+                out.position = ray.start + (ray.end - ray.start) * hitT;
+                out.distance = glm::distance(ray.start, out.position);
+            }
+            return hit;
+        }
+
         size_t Render::getPrimitivesCount() const
         {
             return _p->primitivesCount;
@@ -203,6 +646,90 @@ namespace djv
             return _p->pointCount;
         }
 
+        void Render::Private::clearBatches()
+        {
+            instanceGroups.clear();
+            instanceGroupIndices.clear();
+            triangleMeshes.clear();
+            polyLines.clear();
+            pointLists.clear();
+            triangleMeshesIndices.clear();
+            polyLinesIndices.clear();
+            pointListsIndices.clear();
+        }
+
+        void Render::Private::addBatches(const InstanceGroup& value)
+        {
+            BatchKey key;
+            key.transform = value.instances[0].transform;
+            key.color = value.instances[0].color;
+            key.material = value.material;
+            const size_t item = value.items[0];
+
+            // Add the triangle meshes.
+            const auto& meshes = value.primitive->getMeshes();
+            if (meshes.size())
+            {
+                auto& batch = getBatch(triangleMeshes, triangleMeshesIndices, key);
+                batch.values.insert(batch.values.end(), meshes.begin(), meshes.end());
+                batch.items.insert(batch.items.end(), meshes.size(), item);
+                for (size_t i = 0; i < meshes.size(); ++i)
+                {
+                    batch.indices.push_back(i);
+                }
+            }
+
+            // Add the poly-lines.
+            const auto& lines = value.primitive->getPolyLines();
+            if (lines.size())
+            {
+                auto& batch = getBatch(polyLines, polyLinesIndices, key);
+                batch.values.insert(batch.values.end(), lines.begin(), lines.end());
+                batch.items.insert(batch.items.end(), lines.size(), item);
+            }
+
+            // Add the points.
+            if (const auto& pointList = value.primitive->getPointList())
+            {
+                auto& batch = getBatch(pointLists, pointListsIndices, key);
+                batch.values.push_back(pointList);
+                batch.items.push_back(item);
+            }
+        }
+
+        void Render::Private::transformsUpdate()
+        {
+            const glm::mat4x4 sceneTransform = getSceneTransform(*scene);
+            const size_t size = items.size();
+            itemBBoxes.resize(size);
+            for (size_t i = 0; i < size; ++i)
+            {
+                Item& item = items[i];
+                item.transform = sceneTransform * item.xform;
+                itemBBoxes[i] = item.bbox * item.transform;
+            }
+            for (auto& i : triangleMeshes)
+            {
+                i.key.transform = items[i.items[0]].transform;
+            }
+            for (auto& i : polyLines)
+            {
+                i.key.transform = items[i.items[0]].transform;
+            }
+            for (auto& i : pointLists)
+            {
+                i.key.transform = items[i.items[0]].transform;
+            }
+            for (auto& i : instanceGroups)
+            {
+                const size_t instancesSize = i.instances.size();
+                for (size_t j = 0; j < instancesSize; ++j)
+                {
+                    i.instances[j].transform = items[i.items[j]].transform;
+                }
+            }
+        }
+
         Image::Color Render::_getColor(const std::shared_ptr<IPrimitive>& primitive) const
         {
             Image::Color out(0.F, 0.F, 0.F);
@@ -320,69 +847,55 @@ namespace djv
                     {
                         _pushTransform(primitive->getXForm());
                     }
-                    const auto& currentTransform = _getCurrentTransform();
 
-                    // Get the primitive's triangle meshes.
-                    Private::Key key;
-                    key.color = _getColor(primitive);
-                    key.material = renderMaterial ? renderMaterial : (primitive->isShaded() ? p.defaultMaterial : p.colorMaterial);
-                    key.transform = currentTransform;
+                    // Add an instance of the primitive. Primitives that are
+                    // referenced from multiple places in the scene (for
+                    // example by InstancePrimitive) share a group.
+                    if (primitive->getMeshes().size() ||
+                        primitive->getPolyLines().size() ||
+                        primitive->getPointList())
                     {
-                        const auto j = std::find_if(
-                            p.triangleMeshes.begin(),
-                            p.triangleMeshes.end(),
-                            [key](const Private::TriangleMeshesKeyValue& value)
-                            {
-                                return key == value.first;
-                            });
-                        if (j != p.triangleMeshes.end())
+                        if (!renderMaterial)
                         {
-                            const auto& meshes = primitive->getMeshes();
-                            j->second.insert(j->second.end(), meshes.begin(), meshes.end());
+                            renderMaterial = primitive->isShaded() ? p.defaultMaterial : p.colorMaterial;
                         }
-                        else
+                        const InstanceKey key(primitive.get(), renderMaterial.get());
+                        const auto j = p.instanceGroupIndices.find(key);
+                        size_t index = 0;
+                        if (j != p.instanceGroupIndices.end())
                         {
-                            p.triangleMeshes.push_back(std::make_pair(key, primitive->getMeshes()));
-                        }
-                    }
-
-                    // Get the primitive's poly-lines.
-                    {
-                        const auto j = std::find_if(
-                            p.polyLines.begin(),
-                            p.polyLines.end(),
-                            [key](const Private::PointListsKeyValue& value)
-                            {
-                                return key == value.first;
-                            });
-                        if (j != p.polyLines.end())
-                        {
-                            const auto& pointLists = primitive->getPolyLines();
-                            j->second.insert(j->second.end(), pointLists.begin(), pointLists.end());
+                            index = j->second;
                         }
                         else
                         {
-                            p.polyLines.push_back(std::make_pair(key, primitive->getPolyLines()));
+                            index = p.instanceGroups.size();
+                            p.instanceGroupIndices[key] = index;
+                            InstanceGroup group;
+                            group.primitive = primitive;
+                            group.material = renderMaterial;
+                            p.instanceGroups.push_back(std::move(group));
                         }
-                    }
-
-                    // Get the primitive's points.
-                    {
-                        const auto j = std::find_if(
-                            p.pointLists.begin(),
-                            p.pointLists.end(),
-                            [key](const Private::PointListsKeyValue& value)
-                            {
-                                return key == value.first;
-                            });
-                        if (j != p.pointLists.end())
+                        Render3D::InstanceData instance;
+                        instance.transform = _getCurrentTransform();
+                        instance.color = _getColor(primitive);
+                        p.instanceGroups[index].instances.push_back(instance);
+
+                        // Add an item for culling and picking.
+                        Item item;
+                        item.primitive = primitive;
+                        item.xform = instance.transform;
+                        const auto k = p.primitiveBBoxes.find(primitive.get());
+                        if (k != p.primitiveBBoxes.end())
                         {
-                            j->second.push_back(primitive->getPointList());
+                            item.bbox = k->second;
                         }
                         else
                         {
-                            p.pointLists.push_back(Private::PointListsKeyValue(key, { primitive->getPointList() }));
+                            item.bbox = getGeometryBBox(*primitive);
+                            p.primitiveBBoxes[primitive.get()] = item.bbox;
                         }
+                        p.instanceGroups[index].items.push_back(p.items.size());
+                        p.items.push_back(item);
                     }
 
                     // Recurse.
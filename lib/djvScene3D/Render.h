@@ -9,6 +9,8 @@
 
 #include <djvImage/Info.h>
 
+#include <djvMath/Ray.h>
+
 #include <glm/mat4x4.hpp>
 
 namespace djv
@@ -41,9 +43,23 @@ namespace djv
             Render3D::DefaultMaterialMode shaderMode      = Render3D::DefaultMaterialMode::Default;
             Render3D::DepthBufferMode     depthBufferMode = Render3D::DepthBufferMode::Reverse;
 
+            //! The projected size in pixels below which primitives are drawn
+            //! with simplified levels of detail. Zero disables them.
+            float                         lodScreenSize   = 256.F;
+
             bool operator == (const RenderOptions&) const;
         };
 
+        //! This struct provides the result of picking a primitive.
+        struct PickResult
+        {
+            std::shared_ptr<IPrimitive> primitive;
+            glm::vec3                   position = glm::vec3(0.F, 0.F, 0.F);
+            float                       distance = 0.F;
+
+            bool operator == (const PickResult&) const;
+        };
+
         //! This class provides a renderer.
         class Render : public std::enable_shared_from_this<Render>
         {
@@ -56,10 +72,22 @@ namespace djv
 
             void setScene(const std::shared_ptr<Scene>&);
 
+            //! Update the render data after the scene transform has changed.
+            //! This is faster than setting the scene again since the
+            //! bounding volume hierarchy is refit instead of rebuilt.
+            void xformUpdate();
+
+            //! Render the scene. Primitives outside of the camera view are
+            //! culled, and the level of detail for each primitive is chosen
+            //! from its projected size.
             void render(
                 const std::shared_ptr<Render3D::Render>&,
                 const RenderOptions&);
 
+            //! Find the closest triangle mesh intersected by the ray. The ray
+            //! is in world space.
+            bool pick(const Math::Ray3f&, PickResult&);
+
             size_t getPrimitivesCount() const;
             size_t getPointCount() const;
 
@@ -6,6 +6,7 @@
 
 #include <djvSystem/Animation.h>
 #include <djvSystem/Context.h>
+#include <djvSystem/MemorySystem.h>
 #include <djvSystem/Timer.h>
 
 namespace djv
@@ -23,6 +24,9 @@ namespace djv
             auto animationSystem = Animation::AnimationSystem::create(context);
             addDependency(animationSystem);
 
+            auto memorySystem = MemorySystem::create(context);
+            addDependency(memorySystem);
+
             _logInitTime();
         }
 
@@ -63,10 +63,12 @@ namespace djv
                 //! - Error
                 void open(const std::string& fileName, Mode);
 
-                //! Open a temporary file.
+                //! Open a temporary file with a unique name. The file is
+                //! created in the given directory, or the system temporary
+                //! directory if it is empty.
                 //! Throws:
                 //! - Error
-                void openTemp();
+                void openTemp(const std::string& directory = std::string());
 
                 //! Close the file.
                 bool close(std::string* error = nullptr);
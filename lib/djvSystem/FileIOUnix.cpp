@@ -177,12 +177,12 @@ namespace djv
 #endif // DJV_MMAP
             }
             
-            void IO::openTemp()
+            void IO::openTemp(const std::string& directory)
             {
                 close();
 
                 // Open the file.
-                const Path path(getTemp(), "XXXXXX");
+                const Path path(directory.empty() ? getTemp() : Path(directory), "XXXXXX");
                 const std::string fileName = path.get();
                 const size_t size = fileName.size();
                 std::vector<char> buf(size + 1);
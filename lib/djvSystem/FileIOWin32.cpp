@@ -212,13 +212,25 @@ namespace djv
 #endif // DJV_MMAP
             }
 
-            void IO::openTemp()
+            void IO::openTemp(const std::string& directory)
             {
                 WCHAR path[MAX_PATH];
-                DWORD r = GetTempPathW(MAX_PATH, path);
-                if (!r)
+                if (directory.empty())
                 {
-                    throw Error(getErrorMessage(ErrorType::OpenTemp, std::string()));
+                    DWORD r = GetTempPathW(MAX_PATH, path);
+                    if (!r)
+                    {
+                        throw Error(getErrorMessage(ErrorType::OpenTemp, std::string()));
+                    }
+                }
+                else
+                {
+                    const std::wstring directoryW = String::toWide(directory);
+                    if (directoryW.size() >= MAX_PATH)
+                    {
+                        throw Error(getErrorMessage(ErrorType::OpenTemp, directory));
+                    }
+                    wcscpy_s(path, MAX_PATH, directoryW.c_str());
                 }
                 WCHAR buf[MAX_PATH];
                 if (GetTempFileNameW(path, L"", 0, buf))
@@ -43,22 +43,25 @@ namespace djv
                     uid_t    user        = 0;
                     int      permissions = 0;
                     time_t   time        = 0;
-                    for (auto i : Math::Frame::toFrames(_sequence))
+                    for (const auto& range : _sequence.getRanges())
                     {
-                        _STAT info;
-                        memset(&info, 0, sizeof(_STAT));
-                        const std::string fileName = getFileName(i);
-                        if (_STAT_FNC(fileName.c_str(), &info) != 0)
+                        for (auto i = range.getMin(); i <= range.getMax(); ++i)
                         {
-                            return false;
+                            _STAT info;
+                            memset(&info, 0, sizeof(_STAT));
+                            const std::string fileName = getFileName(i);
+                            if (_STAT_FNC(fileName.c_str(), &info) != 0)
+                            {
+                                return false;
+                            }
+                            exists       = true;
+                            size        += info.st_size;
+                            user         = std::min(_user, static_cast<uid_t>(info.st_uid));
+                            permissions |= (info.st_mode & S_IRUSR) ? static_cast<int>(Permissions::Read)  : 0;
+                            permissions |= (info.st_mode & S_IWUSR) ? static_cast<int>(Permissions::Write) : 0;
+                            permissions |= (info.st_mode & S_IXUSR) ? static_cast<int>(Permissions::Exec)  : 0;
+                            time         = std::max(_time, info.st_mtime);
                         }
-                        exists       = true;
-                        size        += info.st_size;
-                        user         = std::min(_user, static_cast<uid_t>(info.st_uid));
-                        permissions |= (info.st_mode & S_IRUSR) ? static_cast<int>(Permissions::Read)  : 0;
-                        permissions |= (info.st_mode & S_IWUSR) ? static_cast<int>(Permissions::Write) : 0;
-                        permissions |= (info.st_mode & S_IXUSR) ? static_cast<int>(Permissions::Exec)  : 0;
-                        time         = std::max(_time, info.st_mtime);
                     }
                     _exists      = exists;
                     _size        = size;
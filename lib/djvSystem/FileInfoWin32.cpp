@@ -49,27 +49,30 @@ namespace djv
                     uid_t    user        = 0;
                     int      permissions = 0;
                     time_t   time        = 0;
-                    for (auto i : Math::Frame::toFrames(_sequence))
+                    for (const auto& range : _sequence.getRanges())
                     {
-                        _STAT info;
-                        memset(&info, 0, sizeof(_STAT));
-                        if (_STAT_FNC(String::toWide(getFileName(i)).c_str(), &info) != 0)
+                        for (auto i = range.getMin(); i <= range.getMax(); ++i)
                         {
-                            if (error)
+                            _STAT info;
+                            memset(&info, 0, sizeof(_STAT));
+                            if (_STAT_FNC(String::toWide(getFileName(i)).c_str(), &info) != 0)
                             {
-                                char tmp[String::cStringLength] = "";
-                                strerror_s(tmp, String::cStringLength, errno);
-                                *error = tmp;
+                                if (error)
+                                {
+                                    char tmp[String::cStringLength] = "";
+                                    strerror_s(tmp, String::cStringLength, errno);
+                                    *error = tmp;
+                                }
+                                return false;
                             }
-                            return false;
+                            exists       = true;
+                            size        += info.st_size;
+                            user         = std::min(_user, static_cast<uid_t>(info.st_uid));
+                            permissions |= (info.st_mode & _S_IREAD)  ? static_cast<int>(Permissions::Read)  : 0;
+                            permissions |= (info.st_mode & _S_IWRITE) ? static_cast<int>(Permissions::Write) : 0;
+                            permissions |= (info.st_mode & _S_IEXEC)  ? static_cast<int>(Permissions::Exec)  : 0;
+                            time         = std::max(_time, info.st_mtime);
                         }
-                        exists       = true;
-                        size        += info.st_size;
-                        user         = std::min(_user, static_cast<uid_t>(info.st_uid));
-                        permissions |= (info.st_mode & _S_IREAD)  ? static_cast<int>(Permissions::Read)  : 0;
-                        permissions |= (info.st_mode & _S_IWRITE) ? static_cast<int>(Permissions::Write) : 0;
-                        permissions |= (info.st_mode & _S_IEXEC)  ? static_cast<int>(Permissions::Exec)  : 0;
-                        time         = std::max(_time, info.st_mtime);
                     }
                     _exists      = exists;
                     _size        = size;
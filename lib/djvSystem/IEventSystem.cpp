@@ -26,6 +26,8 @@ namespace djv
                 std::weak_ptr<TextSystem> textSystem;
                 std::chrono::steady_clock::time_point t;
                 PointerInfo pointerInfo;
+                PointerInfo hoverPointerInfo;
+                bool hoverRequest = true;
                 std::shared_ptr<Observer::ValueSubject<PointerInfo> > pointerSubject;
                 std::shared_ptr<Observer::ValueSubject<std::shared_ptr<IObject> > > hover;
                 std::shared_ptr<Observer::ValueSubject<std::shared_ptr<IObject> > > grab;
@@ -33,6 +35,7 @@ namespace djv
                 std::shared_ptr<Observer::ValueSubject<std::shared_ptr<IObject> > > keyGrab;
                 std::weak_ptr<IObject> textFocus;
                 std::shared_ptr<Observer::ValueSubject<bool> > textFocusActive;
+                std::vector<std::weak_ptr<IObject> > updateObjects;
                 bool textInit = false;
                 std::shared_ptr<Observer::Value<std::string> > localeObserver;
                 std::shared_ptr<Observer::Value<bool> > textChangedObserver;
@@ -84,7 +87,8 @@ namespace djv
                     if (auto system = weak.lock())
                     {
                         std::stringstream ss;
-                        ss << "Global object count: " << IObject::getGlobalObjectCount();
+                        ss << "Global object count: " << IObject::getGlobalObjectCount() << ", ";
+                        ss << "update objects: " << system->_p->updateObjects.size();
                         system->_log(ss.str());
                     }
                 });
@@ -198,6 +202,10 @@ namespace djv
                         _log(ss.str());
                     }*/
                     grab->event(moveEvent);
+
+                    // Find the hovered object again once the grab is released.
+                    p.hoverRequest = true;
+
                     if (!moveEvent.isAccepted())
                     {
                         // Release the grabbed object if it did not accept the move event.
@@ -240,8 +248,12 @@ namespace djv
                         }
                     }
                 }
-                else
+                else if (p.hoverRequest || !(p.pointerInfo == p.hoverPointerInfo))
                 {
+                    // The hovered object is only found again when the pointer
+                    // moves or a hover update has been requested.
+                    p.hoverRequest = false;
+                    p.hoverPointerInfo = p.pointerInfo;
                     std::shared_ptr<IObject> hover;
                     _hover(moveEvent, hover);
                     /*if (hover)
@@ -271,17 +283,54 @@ namespace djv
                 }
             }
 
+            void IEventSystem::_update(Update& event)
+            {
+                DJV_PRIVATE_PTR();
+                // Objects may enable or disable updates while handling the
+                // event so iterate over a copy of the list. Objects that have
+                // disabled updates are removed from the list.
+                std::vector<std::weak_ptr<IObject> > objects;
+                std::swap(objects, p.updateObjects);
+                for (const auto& i : objects)
+                {
+                    if (auto object = i.lock())
+                    {
+                        if (object->_updateEnabled)
+                        {
+                            object->event(event);
+                        }
+                        if (object->_updateEnabled)
+                        {
+                            p.updateObjects.push_back(object);
+                        }
+                        else
+                        {
+                            object->_updateRegistered = false;
+                        }
+                    }
+                }
+            }
+
             void IEventSystem::_updateRecursive(const std::shared_ptr<IObject>& object, Update& event)
             {
                 object->event(event);
                 const auto children = object->_children;
                 for (const auto& child : children)
                 {
-                    child->_parentsEnabled = object->_enabled && object->_parentsEnabled;
                     _updateRecursive(child, event);
                 }
             }
 
+            void IEventSystem::_addUpdateObject(const std::shared_ptr<IObject>& value)
+            {
+                _p->updateObjects.push_back(value);
+            }
+
+            void IEventSystem::_hoverRequest()
+            {
+                _p->hoverRequest = true;
+            }
+
             void IEventSystem::_pointerMove(const PointerInfo& info)
             {
                 DJV_PRIVATE_PTR();
@@ -64,9 +64,16 @@ namespace djv
             protected:
                 virtual void _init(Init&) = 0;
                 void _initRecursive(const std::shared_ptr<IObject>&, Init&);
-                virtual void _update(Update&) = 0;
+
+                //! The default implementation sends update events to the
+                //! objects that have enabled them.
+                virtual void _update(Update&);
                 void _updateRecursive(const std::shared_ptr<IObject>&, Update&);
 
+                //! Request that the hovered object is found again on the
+                //! next tick, for example after the layout has changed.
+                void _hoverRequest();
+
                 void _pointerMove(const PointerInfo&);
                 void _buttonPress(int);
                 void _buttonRelease(int);
@@ -81,8 +88,11 @@ namespace djv
             private:
                 void _setHover(const std::shared_ptr<IObject>&);
                 void _keyPress(std::shared_ptr<IObject>, KeyPress&);
+                void _addUpdateObject(const std::shared_ptr<IObject>&);
 
                 DJV_PRIVATE();
+
+                friend class System::IObject;
             };
 
         } // namespace Event
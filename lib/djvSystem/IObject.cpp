@@ -85,6 +85,8 @@ namespace djv
 
             value->_parent = shared_from_this();
             _children.push_back(value);
+            value->_parentsEnabled = _enabled && _parentsEnabled;
+            value->_parentsEnabledUpdate();
             
             Event::ChildAdded childAddedEvent(value);
             event(childAddedEvent);
@@ -102,6 +104,8 @@ namespace djv
                 _children.erase(i);
 
                 child->_parent.reset();
+                child->_parentsEnabled = true;
+                child->_parentsEnabledUpdate();
 
                 Event::ChildRemoved childRemovedEvent(child);
                 event(childRemovedEvent);
@@ -153,6 +157,14 @@ namespace djv
             }
         }
 
+        void IObject::setEnabled(bool value)
+        {
+            if (value == _enabled)
+                return;
+            _enabled = value;
+            _parentsEnabledUpdate();
+        }
+
         bool IObject::event(System::Event::Event& event)
         {
             bool out = false;
@@ -258,6 +270,22 @@ namespace djv
             return false;
         }
 
+        void IObject::_setUpdateEnabled(bool value)
+        {
+            _updateEnabled = value;
+            if (_updateEnabled && !_updateRegistered)
+            {
+                if (auto context = _context.lock())
+                {
+                    if (auto eventSystem = context->getSystemT<Event::IEventSystem>())
+                    {
+                        _updateRegistered = true;
+                        eventSystem->_addUpdateObject(shared_from_this());
+                    }
+                }
+            }
+        }
+
         const std::string& IObject::_getText(const std::string& id) const
         {
             return _textSystem->getText(id);
@@ -277,6 +305,19 @@ namespace djv
             object->event(event);
         }
         
+        void IObject::_parentsEnabledUpdate()
+        {
+            const bool enabled = _enabled && _parentsEnabled;
+            for (const auto& i : _children)
+            {
+                if (i->_parentsEnabled != enabled)
+                {
+                    i->_parentsEnabled = enabled;
+                    i->_parentsEnabledUpdate();
+                }
+            }
+        }
+
         bool IObject::_eventFilter(System::Event::Event& event)
         {
             bool filtered = false;
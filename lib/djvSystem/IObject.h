@@ -148,6 +148,11 @@ namespace djv
             //! Over-ride this function to filter events for other objects.
             virtual bool _eventFilter(const std::shared_ptr<IObject>&, Event::Event&);
 
+            //! Set whether the object receives update events. Objects only
+            //! receive update events while they are enabled, for example
+            //! while waiting on futures or running animations.
+            void _setUpdateEnabled(bool);
+
             ///@}
 
             //! \name Convenience Functions
@@ -165,6 +170,7 @@ namespace djv
 
         private:
             void _eventInitRecursive(const std::shared_ptr<IObject>&, Event::Init&);
+            void _parentsEnabledUpdate();
             bool _eventFilter(System::Event::Event&);
 
             template<typename T>
@@ -183,6 +189,9 @@ namespace djv
             bool _enabled = true;
             bool _parentsEnabled = true;
 
+            bool _updateEnabled = false;
+            bool _updateRegistered = false;
+
             std::vector<std::weak_ptr<IObject> > _filters;
 
             std::shared_ptr<ResourceSystem> _resourceSystem;
@@ -112,11 +112,6 @@ namespace djv
             return parents ? (_parentsEnabled && _enabled) : _enabled;
         }
 
-        inline void IObject::setEnabled(bool value)
-        {
-            _enabled = value;
-        }
-
         inline const std::shared_ptr<ResourceSystem>& IObject::_getResourceSystem() const
         {
             return _resourceSystem;
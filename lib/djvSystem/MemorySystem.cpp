@@ -0,0 +1,259 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvSystem/MemorySystem.h>
+
+#include <djvSystem/Context.h>
+#include <djvSystem/MemorySystemFunc.h>
+#include <djvSystem/Timer.h>
+#include <djvSystem/TimerFunc.h>
+
+#include <djvCore/MemoryFunc.h>
+#include <djvCore/OSFunc.h>
+#include <djvCore/UIDFunc.h>
+
+#include <algorithm>
+#include <map>
+#include <sstream>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace System
+    {
+        namespace
+        {
+            //! The smallest scale that a cache is reduced to.
+            const float scaleMin = .125F;
+
+        } // namespace
+
+        bool MemoryCacheInfo::operator == (const MemoryCacheInfo& other) const
+        {
+            return
+                uid == other.uid &&
+                name == other.name &&
+                priority == other.priority &&
+                byteCount == other.byteCount &&
+                scale == other.scale &&
+                resizable == other.resizable;
+        }
+
+        struct MemorySystem::Private
+        {
+            struct Cache
+            {
+                MemoryCacheData data;
+                float scale = 1.F;
+            };
+            std::map<UID, Cache> caches;
+
+            std::shared_ptr<Observer::ValueSubject<OS::MemoryStatus> > status;
+            std::shared_ptr<Observer::ValueSubject<MemoryPressure> > pressure;
+            std::shared_ptr<Observer::ListSubject<MemoryCacheInfo> > cacheInfo;
+            std::shared_ptr<Timer> timer;
+        };
+
+        void MemorySystem::_init(const std::shared_ptr<Context>& context)
+        {
+            ISystem::_init("djv::System::MemorySystem", context);
+            DJV_PRIVATE_PTR();
+
+            p.status = Observer::ValueSubject<OS::MemoryStatus>::create(OS::getMemoryStatus());
+            p.pressure = Observer::ValueSubject<MemoryPressure>::create(getMemoryPressure(p.status->get()));
+            p.cacheInfo = Observer::ListSubject<MemoryCacheInfo>::create();
+
+            {
+                std::stringstream ss;
+                ss << "Total memory: " << Memory::getSizeLabel(p.status->get().total);
+                _log(ss.str());
+            }
+
+            auto weak = std::weak_ptr<MemorySystem>(std::dynamic_pointer_cast<MemorySystem>(shared_from_this()));
+            p.timer = Timer::create(context);
+            p.timer->setRepeating(true);
+            p.timer->start(
+                getTimerDuration(TimerValue::Slow),
+                [weak](const std::chrono::steady_clock::time_point&, const Time::Duration&)
+                {
+                    if (auto system = weak.lock())
+                    {
+                        system->update(OS::getMemoryStatus());
+                    }
+                });
+
+            _logInitTime();
+        }
+
+        MemorySystem::MemorySystem() :
+            _p(new Private)
+        {}
+
+        MemorySystem::~MemorySystem()
+        {}
+
+        std::shared_ptr<MemorySystem> MemorySystem::create(const std::shared_ptr<Context>& context)
+        {
+            auto out = context->getSystemT<MemorySystem>();
+            if (!out)
+            {
+                out = std::shared_ptr<MemorySystem>(new MemorySystem);
+                out->_init(context);
+            }
+            return out;
+        }
+
+        std::shared_ptr<Observer::IValueSubject<OS::MemoryStatus> > MemorySystem::observeStatus() const
+        {
+            return _p->status;
+        }
+
+        std::shared_ptr<Observer::IValueSubject<MemoryPressure> > MemorySystem::observePressure() const
+        {
+            return _p->pressure;
+        }
+
+        std::shared_ptr<Observer::IListSubject<MemoryCacheInfo> > MemorySystem::observeCaches() const
+        {
+            return _p->cacheInfo;
+        }
+
+        UID MemorySystem::addCache(const MemoryCacheData& value)
+        {
+            DJV_PRIVATE_PTR();
+            const UID out = createUID();
+            Private::Cache cache;
+            cache.data = value;
+            p.caches[out] = cache;
+
+            // New caches start at the scale of the other caches with the same
+            // priority so that they do not immediately add to the pressure.
+            for (const auto& i : p.caches)
+            {
+                if (i.first != out &&
+                    i.second.data.priority == value.priority &&
+                    i.second.data.scale)
+                {
+                    p.caches[out].scale = i.second.scale;
+                    break;
+                }
+            }
+            if (value.scale && p.caches[out].scale < 1.F)
+            {
+                value.scale(p.caches[out].scale);
+            }
+
+            std::stringstream ss;
+            ss << "Add cache: " << value.name;
+            _log(ss.str());
+            _cachesUpdate();
+            return out;
+        }
+
+        void MemorySystem::removeCache(UID value)
+        {
+            DJV_PRIVATE_PTR();
+            const auto i = p.caches.find(value);
+            if (i != p.caches.end())
+            {
+                std::stringstream ss;
+                ss << "Remove cache: " << i->second.data.name;
+                _log(ss.str());
+                p.caches.erase(i);
+                _cachesUpdate();
+            }
+        }
+
+        void MemorySystem::update(const OS::MemoryStatus& value)
+        {
+            DJV_PRIVATE_PTR();
+            const MemoryPressure pressure = getMemoryPressure(value);
+            if (pressure != p.pressure->get())
+            {
+                std::stringstream ss;
+                ss << "Memory pressure: " << pressure << ", available: " <<
+                    Memory::getSizeLabel(value.available) << "/" << Memory::getSizeLabel(value.total);
+                _log(ss.str());
+            }
+
+            // Find the priority of the caches to resize. Under high pressure
+            // the lowest priority caches that can still be reduced are
+            // halved, and when there is no pressure the highest priority
+            // caches that have been reduced are doubled. Moderate pressure
+            // leaves the caches alone so that they do not oscillate.
+            bool found = false;
+            MemoryCachePriority priority = MemoryCachePriority::First;
+            switch (pressure)
+            {
+            case MemoryPressure::High:
+                for (const auto& i : p.caches)
+                {
+                    if (i.second.data.scale && i.second.scale > scaleMin &&
+                        (!found || i.second.data.priority < priority))
+                    {
+                        found = true;
+                        priority = i.second.data.priority;
+                    }
+                }
+                break;
+            case MemoryPressure::None:
+                for (const auto& i : p.caches)
+                {
+                    if (i.second.data.scale && i.second.scale < 1.F &&
+                        (!found || i.second.data.priority > priority))
+                    {
+                        found = true;
+                        priority = i.second.data.priority;
+                    }
+                }
+                break;
+            default: break;
+            }
+            if (found)
+            {
+                for (auto& i : p.caches)
+                {
+                    if (i.second.data.scale && i.second.data.priority == priority)
+                    {
+                        const float scale = MemoryPressure::High == pressure ?
+                            std::max(i.second.scale * .5F, scaleMin) :
+                            std::min(i.second.scale * 2.F, 1.F);
+                        if (scale != i.second.scale)
+                        {
+                            i.second.scale = scale;
+                            i.second.data.scale(scale);
+                            std::stringstream ss;
+                            ss << "Cache scale: " << i.second.data.name << ", " << scale;
+                            _log(ss.str());
+                        }
+                    }
+                }
+            }
+
+            p.status->setIfChanged(value);
+            p.pressure->setIfChanged(pressure);
+            _cachesUpdate();
+        }
+
+        void MemorySystem::_cachesUpdate()
+        {
+            DJV_PRIVATE_PTR();
+            std::vector<MemoryCacheInfo> info;
+            for (const auto& i : p.caches)
+            {
+                MemoryCacheInfo item;
+                item.uid = i.first;
+                item.name = i.second.data.name;
+                item.priority = i.second.data.priority;
+                item.byteCount = i.second.data.byteCount ? i.second.data.byteCount() : 0;
+                item.scale = i.second.scale;
+                item.resizable = i.second.data.scale ? true : false;
+                info.push_back(item);
+            }
+            p.cacheInfo->setIfChanged(info);
+        }
+
+    } // namespace System
+} // namespace djv
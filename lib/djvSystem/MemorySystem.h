@@ -0,0 +1,130 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvSystem/ISystem.h>
+
+#include <djvCore/ListObserver.h>
+#include <djvCore/OS.h>
+#include <djvCore/UID.h>
+#include <djvCore/ValueObserver.h>
+
+#include <functional>
+
+namespace djv
+{
+    namespace System
+    {
+        //! This enumeration provides the memory cache priorities. Caches with
+        //! a lower priority are reduced first when memory is low.
+        enum class MemoryCachePriority
+        {
+            Low,
+            Medium,
+            High,
+
+            Count,
+            First = Low
+        };
+
+        //! This enumeration provides the memory pressure levels.
+        enum class MemoryPressure
+        {
+            None,
+            Moderate,
+            High,
+
+            Count,
+            First = None
+        };
+
+        //! This struct provides the data used to register a memory cache.
+        //!
+        //! The callbacks are called from the main thread, so caches that are
+        //! owned by other threads should use atomics to share the values.
+        struct MemoryCacheData
+        {
+            //! The text ID of the cache name.
+            std::string                  name;
+            MemoryCachePriority          priority  = MemoryCachePriority::Medium;
+
+            //! Get the size of the cache in bytes.
+            std::function<size_t(void)>  byteCount;
+
+            //! Set the size of the cache as a fraction of its default maximum.
+            //! Caches that cannot be resized may leave this empty, in which
+            //! case they are only reported.
+            std::function<void(float)>   scale;
+        };
+
+        //! This struct provides information about a memory cache.
+        struct MemoryCacheInfo
+        {
+            Core::UID           uid       = 0;
+            std::string         name;
+            MemoryCachePriority priority  = MemoryCachePriority::Medium;
+            size_t              byteCount = 0;
+            float               scale     = 1.F;
+            bool                resizable = false;
+
+            bool operator == (const MemoryCacheInfo&) const;
+        };
+
+        //! This class provides a system that watches the available memory
+        //! and reduces the size of the registered caches when it is low.
+        //!
+        //! When the memory pressure is high the lowest priority caches are
+        //! halved first, down to a minimum scale. When the pressure goes away
+        //! the highest priority caches are grown back first.
+        class MemorySystem : public ISystem
+        {
+            DJV_NON_COPYABLE(MemorySystem);
+            void _init(const std::shared_ptr<Context>&);
+            MemorySystem();
+
+        public:
+            ~MemorySystem() override;
+
+            //! Create a new memory system.
+            static std::shared_ptr<MemorySystem> create(const std::shared_ptr<Context>&);
+
+            //! \name Status
+            ///@{
+
+            std::shared_ptr<Core::Observer::IValueSubject<Core::OS::MemoryStatus> > observeStatus() const;
+            std::shared_ptr<Core::Observer::IValueSubject<MemoryPressure> > observePressure() const;
+
+            ///@}
+
+            //! \name Caches
+            ///@{
+
+            std::shared_ptr<Core::Observer::IListSubject<MemoryCacheInfo> > observeCaches() const;
+
+            //! Register a cache.
+            Core::UID addCache(const MemoryCacheData&);
+
+            //! Remove a cache.
+            void removeCache(Core::UID);
+
+            ///@}
+
+            //! \name Update
+            ///@{
+
+            //! Update the caches for the given memory status. This is called
+            //! periodically with the current status.
+            void update(const Core::OS::MemoryStatus&);
+
+            ///@}
+
+        private:
+            void _cachesUpdate();
+
+            DJV_PRIVATE();
+        };
+
+    } // namespace System
+} // namespace djv
@@ -0,0 +1,76 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvSystem/MemorySystemFunc.h>
+
+#include <algorithm>
+#include <array>
+#include <sstream>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace System
+    {
+        namespace
+        {
+            //! The fraction of the total memory that is available below
+            //! which the pressure is moderate or high.
+            const float availableModerate = .2F;
+            const float availableHigh     = .1F;
+
+            //! The pressure stall percentage above which the pressure is
+            //! moderate or high.
+            const float stallModerate = 10.F;
+            const float stallHigh     = 25.F;
+
+            //! The fraction of the total memory used by this process above
+            //! which the pressure is moderate or high. This catches our own
+            //! caches growing too large before the rest of the system runs
+            //! short of memory.
+            const float processModerate = .5F;
+            const float processHigh     = .75F;
+
+        } // namespace
+
+        MemoryPressure getMemoryPressure(const OS::MemoryStatus& value)
+        {
+            MemoryPressure out = MemoryPressure::None;
+            if (value.total > 0)
+            {
+                const float available = value.available / static_cast<float>(value.total);
+                const float process = value.process / static_cast<float>(value.total);
+                if (available < availableHigh || value.pressure >= stallHigh || process >= processHigh)
+                {
+                    out = MemoryPressure::High;
+                }
+                else if (available < availableModerate || value.pressure >= stallModerate || process >= processModerate)
+                {
+                    out = MemoryPressure::Moderate;
+                }
+            }
+            return out;
+        }
+
+        DJV_ENUM_HELPERS_IMPLEMENTATION(MemoryCachePriority);
+        DJV_ENUM_HELPERS_IMPLEMENTATION(MemoryPressure);
+
+    } // namespace System
+
+    DJV_ENUM_SERIALIZE_HELPERS_IMPLEMENTATION(
+        System,
+        MemoryCachePriority,
+        DJV_TEXT("memory_cache_priority_low"),
+        DJV_TEXT("memory_cache_priority_medium"),
+        DJV_TEXT("memory_cache_priority_high"));
+
+    DJV_ENUM_SERIALIZE_HELPERS_IMPLEMENTATION(
+        System,
+        MemoryPressure,
+        DJV_TEXT("memory_pressure_none"),
+        DJV_TEXT("memory_pressure_moderate"),
+        DJV_TEXT("memory_pressure_high"));
+
+} // namespace djv
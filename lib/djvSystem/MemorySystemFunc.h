@@ -0,0 +1,34 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvSystem/MemorySystem.h>
+
+#include <djvCore/Enum.h>
+
+namespace djv
+{
+    namespace System
+    {
+        //! \name Information
+        ///@{
+
+        //! Get the memory pressure for the given memory status. The
+        //! pressure increases when there is little memory available, when
+        //! tasks are stalled waiting for memory, or when this process uses a
+        //! large fraction of the total memory.
+        MemoryPressure getMemoryPressure(const Core::OS::MemoryStatus&);
+
+        ///@}
+
+        DJV_ENUM_HELPERS(MemoryCachePriority);
+        DJV_ENUM_HELPERS(MemoryPressure);
+
+    } // namespace System
+
+    DJV_ENUM_SERIALIZE_HELPERS(System::MemoryCachePriority);
+    DJV_ENUM_SERIALIZE_HELPERS(System::MemoryPressure);
+
+} // namespace djv
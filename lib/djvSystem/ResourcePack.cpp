@@ -0,0 +1,233 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+#include <djvSystem/ResourcePack.h>
+
+#include <djvSystem/File.h>
+#include <djvSystem/FileIO.h>
+
+#include <djvCore/StringFormat.h>
+
+#include <algorithm>
+#include <cstring>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace System
+    {
+        namespace File
+        {
+            namespace
+            {
+                const char resourcePackMagic[] = { 'D', 'J', 'V', 'P' };
+                const size_t headerSize = 16;
+
+                size_t getAlignedOffset(size_t value)
+                {
+                    return (value + resourcePackAlignment - 1) / resourcePackAlignment * resourcePackAlignment;
+                }
+
+            } // namespace
+
+            void ResourcePack::_init(const std::string& fileName)
+            {
+                _fileName = fileName;
+                _open(fileName);
+
+                // Validate the header and the index.
+                uint32_t header[4] = { 0, 0, 0, 0 };
+                if (_size < headerSize ||
+                    memcmp(_data, resourcePackMagic, sizeof(resourcePackMagic)) != 0)
+                {
+                    _close();
+                    throw Error(String::Format("{0}: {1}").arg(fileName).arg(DJV_TEXT("error_invalid_resource_pack")));
+                }
+                memcpy(header, _data, headerSize);
+                if (header[1] != resourcePackVersion)
+                {
+                    _close();
+                    throw Error(String::Format("{0}: {1}").arg(fileName).arg(DJV_TEXT("error_unsupported_resource_pack_version")));
+                }
+                _entryCount = header[2];
+                if (_entryCount > (_size - headerSize) / sizeof(IndexEntry))
+                {
+                    _close();
+                    throw Error(String::Format("{0}: {1}").arg(fileName).arg(DJV_TEXT("error_invalid_resource_pack_index")));
+                }
+                _index = reinterpret_cast<const IndexEntry*>(_data + headerSize);
+                for (uint32_t i = 0; i < _entryCount; ++i)
+                {
+                    const auto& entry = _index[i];
+                    // Compare against the remaining size so that the sums
+                    // cannot wrap around for corrupt offsets and sizes.
+                    if (entry.nameOffset > _size ||
+                        entry.nameSize > _size - entry.nameOffset ||
+                        entry.dataOffset > _size ||
+                        entry.dataSize > _size - entry.dataOffset)
+                    {
+                        _close();
+                        throw Error(String::Format("{0}: {1}").arg(fileName).arg(DJV_TEXT("error_invalid_resource_pack_index")));
+                    }
+                }
+            }
+
+            ResourcePack::ResourcePack()
+            {}
+
+            ResourcePack::~ResourcePack()
+            {
+                _close();
+            }
+
+            std::shared_ptr<ResourcePack> ResourcePack::create(const std::string& fileName)
+            {
+                auto out = std::shared_ptr<ResourcePack>(new ResourcePack);
+                out->_init(fileName);
+                return out;
+            }
+
+            const std::string& ResourcePack::getFileName() const
+            {
+                return _fileName;
+            }
+
+            size_t ResourcePack::getSize() const
+            {
+                return _size;
+            }
+
+            size_t ResourcePack::getEntryCount() const
+            {
+                return _entryCount;
+            }
+
+            std::vector<std::string> ResourcePack::getNames() const
+            {
+                std::vector<std::string> out;
+                out.reserve(_entryCount);
+                for (uint32_t i = 0; i < _entryCount; ++i)
+                {
+                    out.push_back(_getName(_index[i]));
+                }
+                return out;
+            }
+
+            bool ResourcePack::hasEntry(const std::string& name) const
+            {
+                return _find(name) != nullptr;
+            }
+
+            bool ResourcePack::getEntry(const std::string& name, ResourcePackEntry& out) const
+            {
+                bool found = false;
+                if (const IndexEntry* entry = _find(name))
+                {
+                    out.data = _data + entry->dataOffset;
+                    out.size = static_cast<size_t>(entry->dataSize);
+                    found = true;
+                }
+                return found;
+            }
+
+            const ResourcePack::IndexEntry* ResourcePack::_find(const std::string& name) const
+            {
+                // The index is sorted by name so we can use a binary search
+                // directly on the mapped memory.
+                const IndexEntry* out = nullptr;
+                const char* names = reinterpret_cast<const char*>(_data);
+                const IndexEntry* begin = _index;
+                const IndexEntry* end = _index + _entryCount;
+                const IndexEntry* i = std::lower_bound(
+                    begin,
+                    end,
+                    name,
+                    [names](const IndexEntry& entry, const std::string& value)
+                    {
+                        return value.compare(0, std::string::npos, names + entry.nameOffset, entry.nameSize) > 0;
+                    });
+                if (i != end &&
+                    0 == name.compare(0, std::string::npos, names + i->nameOffset, i->nameSize))
+                {
+                    out = i;
+                }
+                return out;
+            }
+
+            std::string ResourcePack::_getName(const IndexEntry& entry) const
+            {
+                return std::string(reinterpret_cast<const char*>(_data) + entry.nameOffset, entry.nameSize);
+            }
+
+            void writeResourcePack(
+                const std::string& fileName,
+                std::vector<std::pair<std::string, std::vector<uint8_t> > > entries)
+            {
+                std::sort(
+                    entries.begin(),
+                    entries.end(),
+                    [](const std::pair<std::string, std::vector<uint8_t> >& a,
+                       const std::pair<std::string, std::vector<uint8_t> >& b)
+                    {
+                        return a.first < b.first;
+                    });
+
+                // Compute the layout.
+                const uint32_t entryCount = static_cast<uint32_t>(entries.size());
+                struct IndexEntry
+                {
+                    uint32_t nameOffset;
+                    uint32_t nameSize;
+                    uint64_t dataOffset;
+                    uint64_t dataSize;
+                };
+                std::vector<IndexEntry> index(entryCount);
+                size_t offset = headerSize + entryCount * sizeof(IndexEntry);
+                for (uint32_t i = 0; i < entryCount; ++i)
+                {
+                    index[i].nameOffset = static_cast<uint32_t>(offset);
+                    index[i].nameSize = static_cast<uint32_t>(entries[i].first.size());
+                    offset += entries[i].first.size();
+                }
+                for (uint32_t i = 0; i < entryCount; ++i)
+                {
+                    offset = getAlignedOffset(offset);
+                    index[i].dataOffset = offset;
+                    index[i].dataSize = entries[i].second.size();
+                    offset += entries[i].second.size();
+                }
+
+                // Write the file.
+                auto io = IO::create();
+                io->open(fileName, Mode::Write);
+                const uint32_t header[4] = { 0, resourcePackVersion, entryCount, 0 };
+                io->write(resourcePackMagic, sizeof(resourcePackMagic));
+                io->write(header + 1, sizeof(uint32_t) * 3);
+                if (entryCount)
+                {
+                    io->write(index.data(), index.size() * sizeof(IndexEntry));
+                }
+                for (const auto& i : entries)
+                {
+                    io->write(i.first);
+                }
+                const uint8_t padding[resourcePackAlignment] = {};
+                for (uint32_t i = 0; i < entryCount; ++i)
+                {
+                    const size_t pos = io->getPos();
+                    if (pos < index[i].dataOffset)
+                    {
+                        io->write(padding, index[i].dataOffset - pos);
+                    }
+                    if (entries[i].second.size())
+                    {
+                        io->write(entries[i].second.data(), entries[i].second.size());
+                    }
+                }
+            }
+
+        } // namespace File
+    } // namespace System
+} // namespace djv
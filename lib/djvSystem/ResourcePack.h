@@ -0,0 +1,120 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvCore/Core.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace djv
+{
+    namespace System
+    {
+        namespace File
+        {
+            //! This constant provides the resource pack file name.
+            const std::string resourcePackFileName = "djvResources.pack";
+
+            //! This constant provides the resource pack format version.
+            const uint32_t resourcePackVersion = 1;
+
+            //! This constant provides the alignment of resource pack data.
+            const size_t resourcePackAlignment = 16;
+
+            //! This class provides a view of a resource pack entry. The data
+            //! is only valid for the lifetime of the resource pack.
+            class ResourcePackEntry
+            {
+            public:
+                const uint8_t* data = nullptr;
+                size_t         size = 0;
+            };
+
+            //! This class provides read-only access to a resource pack.
+            //!
+            //! A resource pack is a single memory-mapped file that contains
+            //! bundled resources (icons, fonts, shaders, text) and a sorted
+            //! index so that they can be found without touching the file system.
+            //!
+            //! File layout:
+            //! - Header: magic "DJVP", version, entry count, reserved (4 x uint32_t)
+            //! - Index: entry count x (name offset, name size, data offset, data size) (uint32_t, uint32_t, uint64_t, uint64_t)
+            //! - Names
+            //! - Data, each entry aligned to resourcePackAlignment
+            class ResourcePack
+            {
+                DJV_NON_COPYABLE(ResourcePack);
+
+            protected:
+                void _init(const std::string& fileName);
+                ResourcePack();
+
+            public:
+                ~ResourcePack();
+
+                //! Open a resource pack.
+                //! Throws:
+                //! - Error
+                static std::shared_ptr<ResourcePack> create(const std::string& fileName);
+
+                //! Get the file name.
+                const std::string& getFileName() const;
+
+                //! Get the file size.
+                size_t getSize() const;
+
+                //! Get the number of entries.
+                size_t getEntryCount() const;
+
+                //! Get the entry names.
+                std::vector<std::string> getNames() const;
+
+                //! Get whether the pack contains the given entry.
+                bool hasEntry(const std::string&) const;
+
+                //! Get an entry.
+                bool getEntry(const std::string&, ResourcePackEntry&) const;
+
+            private:
+                struct IndexEntry
+                {
+                    uint32_t nameOffset;
+                    uint32_t nameSize;
+                    uint64_t dataOffset;
+                    uint64_t dataSize;
+                };
+
+                void _open(const std::string&);
+                void _close();
+                const IndexEntry* _find(const std::string&) const;
+                std::string _getName(const IndexEntry&) const;
+
+                std::string       _fileName;
+                size_t            _size       = 0;
+                const uint8_t*    _data       = nullptr;
+                const IndexEntry* _index      = nullptr;
+                uint32_t          _entryCount = 0;
+#if defined(DJV_PLATFORM_WINDOWS)
+                void*             _f          = nullptr;
+                void*             _mmap       = nullptr;
+#else // DJV_PLATFORM_WINDOWS
+                int               _f          = -1;
+                void*             _mmap       = reinterpret_cast<void*>(-1);
+#endif // DJV_PLATFORM_WINDOWS
+            };
+
+            //! Write a resource pack. The entries are sorted by name.
+            //! Throws:
+            //! - Error
+            void writeResourcePack(
+                const std::string& fileName,
+                std::vector<std::pair<std::string, std::vector<uint8_t> > >);
+
+        } // namespace File
+    } // namespace System
+} // namespace djv
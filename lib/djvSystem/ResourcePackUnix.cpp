@@ -0,0 +1,72 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+#include <djvSystem/ResourcePack.h>
+
+#include <djvSystem/File.h>
+
+#include <djvCore/StringFormat.h>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace System
+    {
+        namespace File
+        {
+            void ResourcePack::_open(const std::string& fileName)
+            {
+                _f = ::open(fileName.c_str(), O_RDONLY);
+                if (-1 == _f)
+                {
+                    throw Error(String::Format("{0}: {1}").arg(fileName).arg(DJV_TEXT("error_cannot_open_file")));
+                }
+                struct stat info;
+                if (fstat(_f, &info) != 0)
+                {
+                    _close();
+                    throw Error(String::Format("{0}: {1}").arg(fileName).arg(DJV_TEXT("error_cannot_stat_file")));
+                }
+                _size = static_cast<size_t>(info.st_size);
+                if (_size > 0)
+                {
+                    _mmap = mmap(0, _size, PROT_READ, MAP_SHARED, _f, 0);
+                    if (_mmap == reinterpret_cast<void*>(-1))
+                    {
+                        _close();
+                        throw Error(String::Format("{0}: {1}").arg(fileName).arg(DJV_TEXT("error_cannot_memory_map")));
+                    }
+                    madvise(_mmap, _size, MADV_RANDOM);
+                    _data = reinterpret_cast<const uint8_t*>(_mmap);
+                }
+            }
+
+            void ResourcePack::_close()
+            {
+                if (_mmap != reinterpret_cast<void*>(-1))
+                {
+                    munmap(_mmap, _size);
+                    _mmap = reinterpret_cast<void*>(-1);
+                }
+                if (_f != -1)
+                {
+                    ::close(_f);
+                    _f = -1;
+                }
+                _size = 0;
+                _data = nullptr;
+                _index = nullptr;
+                _entryCount = 0;
+            }
+
+        } // namespace File
+    } // namespace System
+} // namespace djv
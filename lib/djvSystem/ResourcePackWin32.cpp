@@ -0,0 +1,102 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+#include <djvSystem/ResourcePack.h>
+
+#include <djvSystem/File.h>
+
+#include <djvCore/StringFormat.h>
+
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif // WIN32_LEAN_AND_MEAN
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif // NOMINMAX
+#include <windows.h>
+
+#include <codecvt>
+#include <locale>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace System
+    {
+        namespace File
+        {
+            void ResourcePack::_open(const std::string& fileName)
+            {
+                HANDLE f = INVALID_HANDLE_VALUE;
+                try
+                {
+                    std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>, wchar_t> utf16;
+                    f = CreateFileW(
+                        utf16.from_bytes(fileName).c_str(),
+                        GENERIC_READ,
+                        FILE_SHARE_READ,
+                        0,
+                        OPEN_EXISTING,
+                        FILE_ATTRIBUTE_NORMAL,
+                        0);
+                }
+                catch (const std::exception&)
+                {
+                    f = INVALID_HANDLE_VALUE;
+                }
+                if (INVALID_HANDLE_VALUE == f)
+                {
+                    throw Error(String::Format("{0}: {1}").arg(fileName).arg(DJV_TEXT("error_cannot_open_file")));
+                }
+                _f = f;
+                LARGE_INTEGER size;
+                if (!GetFileSizeEx(f, &size))
+                {
+                    _close();
+                    throw Error(String::Format("{0}: {1}").arg(fileName).arg(DJV_TEXT("error_cannot_stat_file")));
+                }
+                _size = static_cast<size_t>(size.QuadPart);
+                if (_size > 0)
+                {
+                    _mmap = CreateFileMapping(f, 0, PAGE_READONLY, 0, 0, 0);
+                    if (!_mmap)
+                    {
+                        _close();
+                        throw Error(String::Format("{0}: {1}").arg(fileName).arg(DJV_TEXT("error_cannot_memory_map")));
+                    }
+                    _data = reinterpret_cast<const uint8_t*>(MapViewOfFile(_mmap, FILE_MAP_READ, 0, 0, 0));
+                    if (!_data)
+                    {
+                        _close();
+                        throw Error(String::Format("{0}: {1}").arg(fileName).arg(DJV_TEXT("error_cannot_memory_map")));
+                    }
+                }
+            }
+
+            void ResourcePack::_close()
+            {
+                if (_data)
+                {
+                    UnmapViewOfFile(_data);
+                }
+                if (_mmap)
+                {
+                    CloseHandle(_mmap);
+                    _mmap = nullptr;
+                }
+                if (_f)
+                {
+                    CloseHandle(_f);
+                    _f = nullptr;
+                }
+                _size = 0;
+                _data = nullptr;
+                _index = nullptr;
+                _entryCount = 0;
+            }
+
+        } // namespace File
+    } // namespace System
+} // namespace djv
@@ -5,6 +5,8 @@
 #include <djvSystem/ResourceSystem.h>
 
 #include <djvSystem/Context.h>
+#include <djvSystem/FileIO.h>
+#include <djvSystem/FileIOFunc.h>
 #include <djvSystem/FileInfo.h>
 #include <djvSystem/PathFunc.h>
 
@@ -23,6 +25,7 @@ namespace djv
         {
             File::Path applicationPath;
             std::map<File::ResourcePath, File::Path> paths;
+            std::shared_ptr<File::ResourcePack> resourcePack;
         };
 
         namespace
@@ -154,6 +157,7 @@ namespace djv
             File::Path settingsFile(documents, applicationName + ".json");
             p.paths[File::ResourcePath::SettingsFile] = settingsFile;
 
+            File::Path resourcePackPath;
             File::Path testPath = p.paths[File::ResourcePath::Application];
             testPath.append("djvSystem.en.text");
             if (File::Info(testPath).doesExist())
@@ -168,6 +172,7 @@ namespace djv
                 p.paths[File::ResourcePath::Text]          = p.paths[File::ResourcePath::Application];
                 p.paths[File::ResourcePath::Color]         = p.paths[File::ResourcePath::Application];
                 p.paths[File::ResourcePath::Documentation] = p.paths[File::ResourcePath::Application];
+                resourcePackPath = File::Path(p.paths[File::ResourcePath::Application], File::resourcePackFileName);
             }
             else
             {
@@ -182,6 +187,20 @@ namespace djv
                 p.paths[File::ResourcePath::Color]         = File::Path(etc, "Color");
                 File::Path docs = File::Path(p.paths[File::ResourcePath::Application], "docs");
                 p.paths[File::ResourcePath::Documentation] = File::Path(docs, "documentation.html");
+                resourcePackPath = File::Path(etc, File::resourcePackFileName);
+            }
+
+            // Open the resource pack.
+            if (File::Info(resourcePackPath).doesExist())
+            {
+                try
+                {
+                    p.resourcePack = File::ResourcePack::create(resourcePackPath.get());
+                }
+                catch (const std::exception& e)
+                {
+                    std::cerr << "[ERROR] Cannot open the resource pack: " << e.what() << std::endl;
+                }
             }
         }
 
@@ -210,6 +229,61 @@ namespace djv
             return i != p.paths.end() ? i->second : File::Path();
         }
 
+        const std::shared_ptr<File::ResourcePack>& ResourceSystem::getResourcePack() const
+        {
+            return _p->resourcePack;
+        }
+
+        std::string ResourceSystem::getResourceName(File::ResourcePath path, const std::string& name)
+        {
+            std::string out;
+            switch (path)
+            {
+            case File::ResourcePath::Fonts:   out = "Fonts/"; break;
+            case File::ResourcePath::Icons:   out = "Icons/"; break;
+            case File::ResourcePath::Shaders: out = "Shaders/"; break;
+            case File::ResourcePath::Text:    out = "Text/"; break;
+            default: break;
+            }
+            if (!out.empty())
+            {
+                out += name;
+            }
+            return out;
+        }
+
+        bool ResourceSystem::getResource(File::ResourcePath path, const std::string& name, File::ResourcePackEntry& out) const
+        {
+            DJV_PRIVATE_PTR();
+            bool found = false;
+            if (p.resourcePack)
+            {
+                const std::string resourceName = getResourceName(path, name);
+                if (!resourceName.empty())
+                {
+                    found = p.resourcePack->getEntry(resourceName, out);
+                }
+            }
+            return found;
+        }
+
+        std::string ResourceSystem::readContents(File::ResourcePath path, const std::string& name) const
+        {
+            std::string out;
+            File::ResourcePackEntry entry;
+            if (getResource(path, name, entry))
+            {
+                out = std::string(reinterpret_cast<const char*>(entry.data), entry.size);
+            }
+            else
+            {
+                auto io = File::IO::create();
+                io->open(std::string(File::Path(getPath(path), name)), File::Mode::Read);
+                out = File::readContents(io);
+            }
+            return out;
+        }
+
     } // namespace System
 } // namespace djv
 
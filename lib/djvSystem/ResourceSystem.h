@@ -6,6 +6,7 @@
 
 #include <djvSystem/ISystem.h>
 #include <djvSystem/Path.h>
+#include <djvSystem/ResourcePack.h>
 
 namespace djv
 {
@@ -18,6 +19,10 @@ namespace djv
         //!
         //! By default log files and settings are written to "$HOME/Documents/DJV".
         //! This may be overridden with the DJV_DOCUMENTS_PATH environment variable.
+        //!
+        //! If a resource pack (File::resourcePackFileName) is found next to the
+        //! bundled resources it is memory-mapped and the icons, fonts, shaders,
+        //! and text are served from it instead of the individual files.
         class ResourceSystem : public ISystemBase
         {
             DJV_NON_COPYABLE(ResourceSystem);
@@ -33,6 +38,22 @@ namespace djv
             //! Get a resource path.
             File::Path getPath(File::ResourcePath) const;
 
+            //! Get the resource pack. Returns nullptr if there is no resource pack.
+            const std::shared_ptr<File::ResourcePack>& getResourcePack() const;
+
+            //! Get the name of a resource in the resource pack.
+            static std::string getResourceName(File::ResourcePath, const std::string&);
+
+            //! Get a resource from the resource pack. The name is relative to
+            //! the resource path.
+            bool getResource(File::ResourcePath, const std::string&, File::ResourcePackEntry&) const;
+
+            //! Read the contents of a resource, from the resource pack if
+            //! available otherwise from the file system.
+            //! Throws:
+            //! - File::Error
+            std::string readContents(File::ResourcePath, const std::string&) const;
+
         private:
             DJV_PRIVATE();
         };
@@ -34,6 +34,13 @@ namespace djv
 {
     namespace System
     {
+        namespace
+        {
+            //! The locale used for text that is missing from the current locale.
+            const std::string fallbackLocale = "en";
+
+        } // namespace
+
         struct TextSystem::Private
         {
             Private(TextSystem& p) :
@@ -62,9 +69,9 @@ namespace djv
 
             std::vector<File::Info> getTextFiles() const;
 
-            void reload(const File::Info&);
+            void reload(const File::Info&, bool useResourcePack = false);
 
-            TextMap readText(const File::Info&);
+            TextMap readText(const File::Info&, bool useResourcePack);
             void readAllFutures();
 
             void startTimer();
@@ -242,10 +249,11 @@ namespace djv
                 p.logSystem->log(getSystemName(), ss.str());
             }
 
-            // Load the text.
+            // Load the text, the bundled text files are read from the
+            // resource pack if available.
             for (const auto& j : p.textFiles)
             {
-                p.reload(j);
+                p.reload(j, true);
             }
 
             // Start a directory watcher to check for changes to the text files.
@@ -322,13 +330,16 @@ namespace djv
             p.readAllFutures();
             {
                 std::unique_lock<std::mutex> lock(p.mutex);
-                const auto i = p.text.find(p.currentLocale->get());
-                if (i != p.text.end())
+                for (const auto& locale : { p.currentLocale->get(), fallbackLocale })
                 {
-                    const auto j = i->second.find(id);
-                    if (j != i->second.end())
+                    const auto i = p.text.find(locale);
+                    if (i != p.text.end())
                     {
-                        return j->second;
+                        const auto j = i->second.find(id);
+                        if (j != i->second.end())
+                        {
+                            return j->second;
+                        }
                     }
                 }
             }
@@ -341,14 +352,17 @@ namespace djv
             p.readAllFutures();
             {
                 std::unique_lock<std::mutex> lock(p.mutex);
-                const auto i = p.text.find(p.currentLocale->get());
-                if (i != p.text.end())
+                for (const auto& locale : { p.currentLocale->get(), fallbackLocale })
                 {
-                    for (const auto& j : i->second)
+                    const auto i = p.text.find(locale);
+                    if (i != p.text.end())
                     {
-                        if (text == j.second)
+                        for (const auto& j : i->second)
                         {
-                            return j.first;
+                            if (text == j.second)
+                            {
+                                return j.first;
+                            }
                         }
                     }
                 }
@@ -397,18 +411,18 @@ namespace djv
             return out;
         }
         
-        void TextSystem::Private::reload(const File::Info& value)
+        void TextSystem::Private::reload(const File::Info& value, bool useResourcePack)
         {
             auto info = value;
             readFutures.push_back(std::async(
                 std::launch::async,
-                [this, info]
+                [this, info, useResourcePack]
                 {
-                    return readText(info);
+                    return readText(info, useResourcePack);
                 }));
         }
 
-        TextSystem::Private::TextMap TextSystem::Private::readText(const File::Info& textFile)
+        TextSystem::Private::TextMap TextSystem::Private::readText(const File::Info& textFile, bool useResourcePack)
         {
             TextMap out;
             try
@@ -421,20 +435,38 @@ namespace djv
                     locale.insert(locale.begin(), *j);
                 }
                 
+                const std::string fileName = path.getFileName();
+                File::ResourcePackEntry resourcePackEntry;
+                if (useResourcePack &&
+                    File::Path(resourceSystem->getPath(File::ResourcePath::Text), fileName) == path)
+                {
+                    resourceSystem->getResource(File::ResourcePath::Text, fileName, resourcePackEntry);
+                }
                 auto fileIO = File::IO::create();
-                fileIO->open(path.get(), File::Mode::Read);
                 size_t bufSize = 0;
+                const char* bufP = nullptr;
+#if !defined(DJV_MMAP)
+                std::vector<char> buf;
+#endif // DJV_MMAP
+                if (resourcePackEntry.data)
+                {
+                    bufP = reinterpret_cast<const char*>(resourcePackEntry.data);
+                    bufSize = resourcePackEntry.size;
+                }
+                else
+                {
+                    fileIO->open(path.get(), File::Mode::Read);
 #if defined(DJV_MMAP)
-                const char* bufP = reinterpret_cast<const char*>(fileIO->mmapP());
-                const char* bufEnd = reinterpret_cast<const char*>(fileIO->mmapEnd());
-                bufSize = bufEnd - bufP;
+                    bufP = reinterpret_cast<const char*>(fileIO->mmapP());
+                    const char* bufEnd = reinterpret_cast<const char*>(fileIO->mmapEnd());
+                    bufSize = bufEnd - bufP;
 #else // DJV_MMAP
-                std::vector<char> buf;
-                bufSize = fileIO->getSize();
-                buf.resize(bufSize);
-                fileIO->read(buf.data(), bufSize);
-                const char* bufP = buf.data();
+                    bufSize = fileIO->getSize();
+                    buf.resize(bufSize);
+                    fileIO->read(buf.data(), bufSize);
+                    bufP = buf.data();
 #endif // DJV_MMAP
+                }
 
                 // Parse the JSON.
                 rapidjson::Document document;
@@ -58,7 +58,8 @@ namespace djv
             //! \name Text
             ///@{
 
-            //! Get the text for the given ID.
+            //! Get the text for the given ID. If the ID is missing from the
+            //! current locale the English text is used.
             const std::string& getText(const std::string&);
 
             //! Get the ID for the given text.
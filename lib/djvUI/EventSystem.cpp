@@ -5,6 +5,7 @@
 #include <djvUI/EventSystem.h>
 
 #include <djvUI/SettingsSystem.h>
+#include <djvUI/SpatialIndex.h>
 #include <djvUI/Style.h>
 #include <djvUI/UISettings.h>
 #include <djvUI/UISystem.h>
@@ -30,8 +31,16 @@ namespace djv
             std::vector<std::weak_ptr<Window> > newWindows;
             bool resizeRequest = false;
             bool redrawRequest = false;
+            bool fullRedrawRequest = false;
             bool textLCDRenderingDirty = false;
             bool tooltips = false;
+            struct SpatialIndexData
+            {
+                std::weak_ptr<Window> window;
+                std::shared_ptr<SpatialIndex> index;
+            };
+            std::vector<SpatialIndexData> spatialIndices;
+            bool spatialIndicesValid = false;
             std::shared_ptr<Observer::Value<bool> > textLCDRenderingObserver;
             std::shared_ptr<Observer::Value<bool> > tooltipsObserver;
             std::shared_ptr<System::Timer> statsTimer;
@@ -39,6 +48,21 @@ namespace djv
 
         namespace
         {
+            void expandPaintRect(Math::BBox2f& out, const Math::BBox2f& value)
+            {
+                if (value.isValid())
+                {
+                    if (out.isValid())
+                    {
+                        out.expand(value);
+                    }
+                    else
+                    {
+                        out = value;
+                    }
+                }
+            }
+
             /*void getClassNames(const std::shared_ptr<IObject>& object, std::map<std::string, size_t>& out)
             {
                 const std::string& className = object->getClassName();
@@ -122,6 +146,7 @@ namespace djv
         void EventSystem::resizeRequest()
         {
             _p->resizeRequest = true;
+            _p->spatialIndicesValid = false;
         }
 
         void EventSystem::redrawRequest()
@@ -160,6 +185,7 @@ namespace djv
                         }
                     }
                     style->setClean();
+                    p.fullRedrawRequest = true;
                 }
 
                 if (!p.newWindows.empty())
@@ -179,6 +205,7 @@ namespace djv
                             p.windows.push_back(window);
                         }
                     }
+                    p.fullRedrawRequest = true;
                 }
 
                 auto i = p.windows.begin();
@@ -198,7 +225,10 @@ namespace djv
                     }
                     if (erase)
                     {
+                        p.spatialIndicesValid = false;
                         i = p.windows.erase(i);
+                        p.redrawRequest = true;
+                        p.fullRedrawRequest = true;
                     }
                     else
                     {
@@ -218,6 +248,7 @@ namespace djv
             setTextFocus(nullptr);
             _p->newWindows.push_back(value);
             _p->resizeRequest = true;
+            _p->spatialIndicesValid = false;
             _p->redrawRequest = true;
         }
 
@@ -235,6 +266,13 @@ namespace djv
             return out;
         }
 
+        bool EventSystem::_fullRedrawRequestReset()
+        {
+            const bool out = _p->fullRedrawRequest;
+            _p->fullRedrawRequest = false;
+            return out;
+        }
+
         void EventSystem::_pushClipRect(const Math::BBox2f&)
         {
             // Default implementation does nothing.
@@ -311,24 +349,152 @@ namespace djv
             }
         }
 
-        void EventSystem::_init(System::Event::Init& event)
+        void EventSystem::_paintRectRecursive(
+            const std::shared_ptr<Widget>& widget,
+            const Math::BBox2f& clipRect,
+            float parentsOpacity,
+            bool invalidate,
+            Math::BBox2f& out)
         {
-            for (const auto& i : _p->windows)
+            const bool painted = clipRect.isValid() && widget->isVisible() && !widget->isClipped();
+            const float opacity = parentsOpacity * widget->getOpacity();
+            const float alphaMult = opacity * (widget->isEnabled(true) ? 1.F : widget->_style->getPalette().getDisabledMult());
+            if (invalidate ||
+                !widget->_drawListsValid ||
+                painted != widget->_drawListsPainted ||
+                (painted && (
+                    clipRect != widget->_drawListsClipRect ||
+                    widget->getGeometry() != widget->_drawListsGeometry ||
+                    alphaMult != widget->_drawListsOpacity)))
+            {
+                if (widget->_drawListsPainted)
+                {
+                    expandPaintRect(out, widget->_drawListsClipRect);
+                }
+                if (painted)
+                {
+                    expandPaintRect(out, clipRect);
+                }
+                widget->_drawListsValid = false;
+            }
+            widget->_drawListsPainted = painted;
+            widget->_drawListsClipRect = clipRect;
+            widget->_drawListsGeometry = widget->getGeometry();
+            widget->_drawListsOpacity = alphaMult;
+            for (const auto& child : widget->getChildWidgets())
+            {
+                _paintRectRecursive(
+                    child,
+                    painted ? clipRect.intersect(child->getGeometry()) : Math::BBox2f(0.F, 0.F, 0.F, 0.F),
+                    opacity,
+                    invalidate,
+                    out);
+            }
+        }
+
+        void EventSystem::_paintRecursive(
+            const std::shared_ptr<Widget>& widget,
+            System::Event::Paint& event,
+            System::Event::PaintOverlay& overlayEvent,
+            const Math::BBox2f& paintRect)
+        {
+            if (widget->isVisible() && !widget->isClipped())
+            {
+                const Math::BBox2f clipRect = event.getClipRect();
+                if (clipRect.intersect(paintRect).isValid())
+                {
+                    const auto& render = widget->_render;
+                    const bool valid = widget->_drawListsValid;
+                    _pushClipRect(clipRect);
+                    if (!valid || !render->drawList(widget->_paintDrawList))
+                    {
+                        render->beginDrawList();
+                        widget->event(event);
+                        widget->_paintDrawList = render->endDrawList();
+                    }
+                    for (const auto& child : widget->getChildWidgets())
+                    {
+                        const Math::BBox2f childClipRect = clipRect.intersect(child->getGeometry());
+                        event.setClipRect(childClipRect);
+                        overlayEvent.setClipRect(childClipRect);
+                        _paintRecursive(child, event, overlayEvent, paintRect);
+                    }
+                    event.setClipRect(clipRect);
+                    overlayEvent.setClipRect(clipRect);
+                    if (!valid || !render->drawList(widget->_paintOverlayDrawList))
+                    {
+                        render->beginDrawList();
+                        widget->event(overlayEvent);
+                        widget->_paintOverlayDrawList = render->endDrawList();
+                    }
+                    _popClipRect();
+
+                    // Widgets are not drawn until they have been laid out, so
+                    // their draw lists are not kept until then.
+                    widget->_drawListsValid = !widget->_visibleInit;
+                }
+            }
+        }
+
+        void EventSystem::_spatialIndexUpdate()
+        {
+            DJV_PRIVATE_PTR();
+            std::vector<Private::SpatialIndexData> spatialIndices;
+            for (const auto& i : p.windows)
             {
                 if (auto window = i.lock())
                 {
-                    _initRecursive(window, event);
+                    // Re-use the existing index for the window.
+                    Private::SpatialIndexData data;
+                    data.window = window;
+                    for (const auto& j : p.spatialIndices)
+                    {
+                        if (j.window.lock() == window)
+                        {
+                            data.index = j.index;
+                            break;
+                        }
+                    }
+                    if (!data.index)
+                    {
+                        data.index = SpatialIndex::create();
+                    }
+                    data.index->build(window);
+                    spatialIndices.push_back(data);
                 }
             }
+            p.spatialIndices = std::move(spatialIndices);
+            p.spatialIndicesValid = true;
+
+            // The widget under the pointer may have changed.
+            _hoverRequest();
         }
 
-        void EventSystem::_update(System::Event::Update& event)
+        std::shared_ptr<SpatialIndex> EventSystem::_getSpatialIndex(const std::shared_ptr<Window>& window) const
+        {
+            DJV_PRIVATE_PTR();
+            std::shared_ptr<SpatialIndex> out;
+            if (p.spatialIndicesValid)
+            {
+                for (const auto& i : p.spatialIndices)
+                {
+                    if (i.window.lock() == window)
+                    {
+                        out = i.index;
+                        break;
+                    }
+                }
+            }
+            return out;
+        }
+
+        void EventSystem::_init(System::Event::Init& event)
         {
             for (const auto& i : _p->windows)
             {
                 if (auto window = i.lock())
                 {
-                    _updateRecursive(window, event);
+                    _initRecursive(window, event);
                 }
             }
         }
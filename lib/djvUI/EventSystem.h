@@ -10,6 +10,7 @@ namespace djv
 {
     namespace UI
     {
+        class SpatialIndex;
         class Widget;
         class Window;
 
@@ -50,6 +51,10 @@ namespace djv
             bool _resizeRequestReset();
             bool _redrawRequestReset();
 
+            //! A full redraw is requested when the style changes or windows
+            //! are added or removed.
+            bool _fullRedrawRequestReset();
+
             virtual void _pushClipRect(const Math::BBox2f&);
             virtual void _popClipRect();
 
@@ -62,8 +67,35 @@ namespace djv
                 System::Event::Paint&,
                 System::Event::PaintOverlay&);
 
+            //! Find the region that needs to be repainted. Widgets that have
+            //! changed since they were last painted are invalidated and the
+            //! areas they cover, before and after the change, are added to
+            //! the region. If "invalidate" is true all of the widgets are
+            //! invalidated.
+            void _paintRectRecursive(
+                const std::shared_ptr<Widget>&,
+                const Math::BBox2f& clipRect,
+                float parentsOpacity,
+                bool invalidate,
+                Math::BBox2f&);
+
+            //! Paint the widgets that intersect the given region. Widgets that
+            //! have not changed re-use the primitives from the last paint.
+            void _paintRecursive(
+                const std::shared_ptr<Widget>&,
+                System::Event::Paint&,
+                System::Event::PaintOverlay&,
+                const Math::BBox2f& paintRect);
+
+            //! Rebuild the spatial indices used for hit-testing. This should
+            //! be called after the layout and clip events.
+            void _spatialIndexUpdate();
+
+            //! Get the spatial index for a window. A null pointer is returned
+            //! if the index is out of date.
+            std::shared_ptr<SpatialIndex> _getSpatialIndex(const std::shared_ptr<Window>&) const;
+
             void _init(System::Event::Init&) override;
-            void _update(System::Event::Update&) override;
 
         private:
             DJV_PRIVATE();
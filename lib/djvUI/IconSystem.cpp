@@ -8,17 +8,21 @@
 #include <djvAV/IOSystem.h>
 
 #include <djvImage/Data.h>
+#include <djvImage/DataFunc.h>
 
 #include <djvSystem/Context.h>
 #include <djvSystem/File.h>
 #include <djvSystem/FileInfoFunc.h>
 #include <djvSystem/LogSystem.h>
+#include <djvSystem/MemorySystem.h>
 #include <djvSystem/ResourceSystem.h>
 #include <djvSystem/TimerFunc.h>
 
 #include <djvCore/Cache.h>
 
+#include <algorithm>
 #include <atomic>
+#include <set>
 #include <thread>
 
 using namespace djv::Core;
@@ -32,6 +36,16 @@ namespace djv
             //! \todo Should this be configurable?
             const size_t imageCacheMax = 1000;
 
+            size_t getByteCount(const std::vector<std::shared_ptr<Image::Data> >& value)
+            {
+                size_t out = 0;
+                for (const auto& i : value)
+                {
+                    out += i->getDataByteCount();
+                }
+                return out;
+            }
+
             struct ImageRequest
             {
                 ImageRequest(const std::string& name, uint16_t size) :
@@ -82,6 +96,7 @@ namespace djv
         struct IconSystem::Private
         {
             System::File::Path iconPath;
+            std::shared_ptr<System::File::ResourcePack> resourcePack;
             std::vector<uint16_t> dpiList;
             std::shared_ptr<AV::IO::IOSystem> io;
             std::list<ImageRequest> imageQueue;
@@ -92,12 +107,17 @@ namespace djv
 
             Memory::Cache<size_t, std::shared_ptr<Image::Data> > imageCache;
             std::atomic<float> imageCachePercentage;
+            std::atomic<size_t> imageCacheByteCount;
+            std::atomic<float> imageCacheScale;
+            std::shared_ptr<System::MemorySystem> memorySystem;
+            UID memoryCacheUID = 0;
 
             std::shared_ptr<System::Timer> statsTimer;
             std::thread thread;
             std::atomic<bool> running;
 
             System::File::Path getPath(const std::string& name, uint16_t dpi) const;
+            std::string getResourceName(const std::string& name, uint16_t dpi) const;
             uint16_t findClosestDPI(uint16_t) const;
         };
 
@@ -109,12 +129,38 @@ namespace djv
 
             addDependency(AV::AVSystem::create(context));
 
-            p.iconPath = context->getSystemT<System::ResourceSystem>()->getPath(System::File::ResourcePath::Icons);
-                        
+            auto resourceSystem = context->getSystemT<System::ResourceSystem>();
+            p.iconPath = resourceSystem->getPath(System::File::ResourcePath::Icons);
+
+            // Find the DPI values in the resource pack.
+            if (auto resourcePack = resourceSystem->getResourcePack())
+            {
+                const std::string prefix = System::ResourceSystem::getResourceName(System::File::ResourcePath::Icons, std::string());
+                std::set<uint16_t> dpiSet;
+                for (const auto& i : resourcePack->getNames())
+                {
+                    if (0 == i.compare(0, prefix.size(), prefix))
+                    {
+                        const size_t j = i.find("DPI/", prefix.size());
+                        if (j != std::string::npos && j > prefix.size())
+                        {
+                            dpiSet.insert(static_cast<uint16_t>(std::stoi(i.substr(prefix.size(), j - prefix.size()))));
+                        }
+                    }
+                }
+                if (dpiSet.size())
+                {
+                    p.resourcePack = resourcePack;
+                    p.dpiList = std::vector<uint16_t>(dpiSet.begin(), dpiSet.end());
+                }
+            }
+
             p.io = context->getSystemT<AV::IO::IOSystem>();
 
             p.imageCache.setMax(imageCacheMax);
             p.imageCachePercentage = 0.F;
+            p.imageCacheByteCount = 0;
+            p.imageCacheScale = 1.F;
 
             p.statsTimer = System::Timer::create(context);
             p.statsTimer->setRepeating(true);
@@ -138,19 +184,22 @@ namespace djv
                 try
                 {
                     // Find the DPI values.
-                    for (const auto& i : System::File::directoryList(p.iconPath))
+                    if (!p.resourcePack)
                     {
-                        const std::string fileName = i.getFileName(Math::Frame::invalid, false);
-                        const size_t size = fileName.size();
-                        if (size > 3 &&
-                            fileName[size - 3] == 'D' &&
-                            fileName[size - 2] == 'P' &&
-                            fileName[size - 1] == 'I')
+                        for (const auto& i : System::File::directoryList(p.iconPath))
                         {
-                            p.dpiList.push_back(std::stoi(fileName.substr(0, size - 3)));
+                            const std::string fileName = i.getFileName(Math::Frame::invalid, false);
+                            const size_t size = fileName.size();
+                            if (size > 3 &&
+                                fileName[size - 3] == 'D' &&
+                                fileName[size - 2] == 'P' &&
+                                fileName[size - 1] == 'I')
+                            {
+                                p.dpiList.push_back(std::stoi(fileName.substr(0, size - 3)));
+                            }
                         }
+                        std::sort(p.dpiList.begin(), p.dpiList.end());
                     }
-                    std::sort(p.dpiList.begin(), p.dpiList.end());
                     for (const auto& i : p.dpiList)
                     {
                         std::stringstream ss;
@@ -161,6 +210,17 @@ namespace djv
                     const auto timeout = System::getTimerValue(System::TimerValue::Medium);
                     while (p.running)
                     {
+                        const size_t imageCacheScaledMax = std::max(
+                            static_cast<size_t>(imageCacheMax * p.imageCacheScale),
+                            static_cast<size_t>(1));
+                        if (imageCacheScaledMax != p.imageCache.getMax())
+                        {
+                            std::vector<std::shared_ptr<Image::Data> > removed;
+                            p.imageCache.setMax(imageCacheScaledMax, removed);
+                            p.imageCachePercentage = p.imageCache.getPercentageUsed();
+                            p.imageCacheByteCount -= getByteCount(removed);
+                        }
+
                         {
                             std::unique_lock<std::mutex> lock(p.requestMutex);
                             if (p.requestCV.wait_for(
@@ -187,6 +247,32 @@ namespace djv
                 }
             });
 
+            p.memorySystem = context->getSystemT<System::MemorySystem>();
+            if (p.memorySystem)
+            {
+                auto weak = std::weak_ptr<IconSystem>(std::dynamic_pointer_cast<IconSystem>(shared_from_this()));
+                System::MemoryCacheData memoryCacheData;
+                memoryCacheData.name = DJV_TEXT("ui_memory_cache_icons");
+                memoryCacheData.priority = System::MemoryCachePriority::High;
+                memoryCacheData.byteCount = [weak]
+                {
+                    size_t out = 0;
+                    if (auto system = weak.lock())
+                    {
+                        out = system->_p->imageCacheByteCount;
+                    }
+                    return out;
+                };
+                memoryCacheData.scale = [weak](float value)
+                {
+                    if (auto system = weak.lock())
+                    {
+                        system->_p->imageCacheScale = value;
+                    }
+                };
+                p.memoryCacheUID = p.memorySystem->addCache(memoryCacheData);
+            }
+
             _logInitTime();
         }
 
@@ -197,6 +283,10 @@ namespace djv
         IconSystem::~IconSystem()
         {
             DJV_PRIVATE_PTR();
+            if (p.memorySystem)
+            {
+                p.memorySystem->removeCache(p.memoryCacheUID);
+            }
             p.running = false;
             if (p.thread.joinable())
             {
@@ -220,6 +310,20 @@ namespace djv
             DJV_PRIVATE_PTR();
             ImageRequest request(name, static_cast<uint16_t>(Math::clamp(size, 0.F, 65535.F)));
             auto future = request.promise.get_future();
+            if (p.resourcePack)
+            {
+                // Icons in the resource pack are pre-decoded so they can be
+                // returned immediately without copying.
+                System::File::ResourcePackEntry entry;
+                if (p.resourcePack->getEntry(p.getResourceName(request.name, p.findClosestDPI(request.size)), entry))
+                {
+                    if (auto image = Image::unpack(entry.data, entry.size, p.resourcePack))
+                    {
+                        request.promise.set_value(image);
+                        return future;
+                    }
+                }
+            }
             {
                 std::unique_lock<std::mutex> lock(p.requestMutex);
                 p.imageQueue.push_back(std::move(request));
@@ -290,8 +394,11 @@ namespace djv
                 }
                 if (image)
                 {
-                    p.imageCache.add(i->key, image);
+                    std::vector<std::shared_ptr<Image::Data> > removed;
+                    p.imageCache.add(i->key, image, removed);
                     p.imageCachePercentage = p.imageCache.getPercentageUsed();
+                    p.imageCacheByteCount += image->getDataByteCount();
+                    p.imageCacheByteCount -= getByteCount(removed);
                     i->promise.set_value(image);
                     i = p.pendingImageRequests.erase(i);
                 }
@@ -340,6 +447,13 @@ namespace djv
             return out;
         }
 
+        std::string IconSystem::Private::getResourceName(const std::string& name, uint16_t dpi) const
+        {
+            std::stringstream ss;
+            ss << dpi << "DPI/" << name;
+            return System::ResourceSystem::getResourceName(System::File::ResourcePath::Icons, ss.str());
+        }
+
         uint16_t IconSystem::Private::findClosestDPI(uint16_t value) const
         {
             const uint16_t dpi = static_cast<uint16_t>(value / static_cast<float>(Style::iconSizeDefault) * static_cast<float>(Render2D::dpiDefault));
@@ -207,6 +207,7 @@ namespace djv
                         auto iconSystem = context->getSystemT<IconSystem>();
                         const auto& style = _getStyle();
                         p.imageFuture = iconSystem->getIcon(p.name, style->getMetric(p.iconSizeRole));
+                        _setUpdateEnabled(true);
                     }
                 }
             }
@@ -229,6 +230,7 @@ namespace djv
                 }
                 _resize();
             }
+            _setUpdateEnabled(p.imageFuture.valid());
         }
 
         void IconWidget::_iconUpdate()
@@ -241,6 +243,7 @@ namespace djv
                     auto iconSystem = context->getSystemT<IconSystem>();
                     const auto& style = _getStyle();
                     p.imageFuture = iconSystem->getIcon(p.name, style->getMetric(p.iconSizeRole));
+                    _setUpdateEnabled(true);
                 }
                 else
                 {
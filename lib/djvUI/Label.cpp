@@ -382,17 +382,35 @@ namespace djv
                         _log(e.what(), System::LogLevel::Error);
                     }
                 }
+                _setUpdateEnabled(
+                    p.fontMetricsFuture.valid() ||
+                    p.textSizeFuture.valid() ||
+                    p.sizeStringFuture.valid() ||
+                    p.glyphsFuture.valid());
             }
 
             void Label::_textUpdate()
             {
                 DJV_PRIVATE_PTR();
-                p.textSizeFuture = p.fontSystem->measure(p.text, p.fontInfo, p.textElide);
-                if (!p.text.size())
+                if (p.fontSystem->getCachedSize(p.text, p.fontInfo, p.textElide, p.textSize) &&
+                    p.fontSystem->getCachedGlyphs(p.text, p.fontInfo, p.textElide, p.glyphs))
                 {
-                    p.glyphs.clear();
+                    p.textSizeFuture = std::future<glm::vec2>();
+                    p.glyphsFuture = std::future<std::vector<std::shared_ptr<Render2D::Font::Glyph> > >();
+                    p.labelMinimumSizeInit = true;
+                    _resize();
+                    _redraw();
+                }
+                else
+                {
+                    p.textSizeFuture = p.fontSystem->measure(p.text, p.fontInfo, p.textElide);
+                    if (!p.text.size())
+                    {
+                        p.glyphs.clear();
+                    }
+                    p.glyphsFuture = p.fontSystem->getGlyphs(p.text, p.fontInfo, p.textElide);
+                    _setUpdateEnabled(true);
                 }
-                p.glyphsFuture = p.fontSystem->getGlyphs(p.text, p.fontInfo, p.textElide);
             }
 
             void Label::_sizeStringUpdate()
@@ -400,7 +418,17 @@ namespace djv
                 DJV_PRIVATE_PTR();
                 if (!p.sizeString.empty())
                 {
-                    p.sizeStringFuture = p.fontSystem->measure(p.sizeString, p.fontInfo);
+                    if (p.fontSystem->getCachedSize(p.sizeString, p.fontInfo, 0, p.sizeStringSize))
+                    {
+                        p.sizeStringFuture = std::future<glm::vec2>();
+                        p.labelMinimumSizeInit = true;
+                        _resize();
+                    }
+                    else
+                    {
+                        p.sizeStringFuture = p.fontSystem->measure(p.sizeString, p.fontInfo);
+                        _setUpdateEnabled(true);
+                    }
                 }
             }
 
@@ -411,7 +439,17 @@ namespace djv
                 p.fontInfo = p.fontFamily.empty() ?
                     style->getFontInfo(p.fontFace, p.fontSizeRole) :
                     style->getFontInfo(p.fontFamily, p.fontFace, p.fontSizeRole);
-                p.fontMetricsFuture = p.fontSystem->getMetrics(p.fontInfo);
+                if (p.fontSystem->getCachedMetrics(p.fontInfo, p.fontMetrics))
+                {
+                    p.fontMetricsFuture = std::future<Render2D::Font::Metrics>();
+                    p.labelMinimumSizeInit = true;
+                    _resize();
+                }
+                else
+                {
+                    p.fontMetricsFuture = p.fontSystem->getMetrics(p.fontInfo);
+                    _setUpdateEnabled(true);
+                }
                 _textUpdate();
                 _sizeStringUpdate();
             }
@@ -35,6 +35,17 @@ namespace djv
     {
         namespace
         {
+            template<typename T>
+            bool hasValidFutures(const T& value)
+            {
+                bool out = false;
+                for (const auto& i : value)
+                {
+                    out |= i.second.valid();
+                }
+                return out;
+            }
+
             class MenuWidget : public Widget
             {
                 DJV_NON_COPYABLE(MenuWidget);
@@ -565,6 +576,13 @@ namespace djv
                         }
                     }
                 }
+                _setUpdateEnabled(
+                    hasValidFutures(_iconFutures) ||
+                    hasValidFutures(_fontMetricsFutures) ||
+                    hasValidFutures(_textSizeFutures) ||
+                    hasValidFutures(_textGlyphsFutures) ||
+                    hasValidFutures(_shortcutSizeFutures) ||
+                    hasValidFutures(_shortcutGlyphsFutures));
             }
 
             std::shared_ptr<MenuWidget::Item> MenuWidget::_getItem(const glm::vec2& pos) const
@@ -649,6 +667,7 @@ namespace djv
                                             auto iconSystem = context->getSystemT<IconSystem>();
                                             auto style = widget->_getStyle();
                                             widget->_iconFutures[item] = iconSystem->getIcon(value, style->getMetric(MetricsRole::Icon));
+                                            widget->_setUpdateEnabled(true);
                                             widget->_resize();
                                         }
                                     }
@@ -662,6 +681,7 @@ namespace djv
                                 {
                                     item->text = value;
                                     widget->_textUpdateRequest = true;
+                                    widget->_setUpdateEnabled(true);
                                 }
                             });
                         _fontObservers[item] = Observer::Value<std::string>::create(
@@ -672,6 +692,7 @@ namespace djv
                             {
                                 item->font = value;
                                 widget->_textUpdateRequest = true;
+                                widget->_setUpdateEnabled(true);
                             }
                         });
                         _shortcutsObservers[item] = Observer::List<std::shared_ptr<Shortcut> >::create(
@@ -694,6 +715,7 @@ namespace djv
                                     }
                                     item->shortcutLabel = String::join(labels, ", ");
                                     widget->_textUpdateRequest = true;
+                                    widget->_setUpdateEnabled(true);
                                 }
                             }
                         });
@@ -733,6 +755,7 @@ namespace djv
                     _shortcutGlyphsFutures[i.second] = _fontSystem->getGlyphs(i.second->shortcutLabel, i.second->fontInfo);
                     _hasShortcuts |= i.second->shortcutLabel.size() > 0;
                 }
+                _setUpdateEnabled(true);
             }
 
             class MenuPopupWidget : public Widget
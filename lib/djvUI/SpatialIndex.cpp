@@ -0,0 +1,151 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvUI/SpatialIndex.h>
+
+#include <djvUI/Widget.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace djv
+{
+    namespace UI
+    {
+        namespace
+        {
+            //! \todo Should this be configurable?
+            const float  cellSizeMin  = 64.F;
+            const size_t cellCountMax = 128;
+
+        } // namespace
+
+        struct SpatialIndex::Private
+        {
+            // The widgets are stored in the order they are painted so that
+            // walking the list backwards gives the hit-testing order.
+            std::vector<std::weak_ptr<Widget> > widgets;
+            std::vector<Math::BBox2f> rects;
+
+            Math::BBox2f bounds = Math::BBox2f(0.F, 0.F, 0.F, 0.F);
+            glm::vec2 cellSize = glm::vec2(cellSizeMin, cellSizeMin);
+            size_t cellsW = 0;
+            size_t cellsH = 0;
+            std::vector<std::vector<uint32_t> > cells;
+        };
+
+        SpatialIndex::SpatialIndex() :
+            _p(new Private)
+        {}
+
+        SpatialIndex::~SpatialIndex()
+        {}
+
+        std::shared_ptr<SpatialIndex> SpatialIndex::create()
+        {
+            return std::shared_ptr<SpatialIndex>(new SpatialIndex);
+        }
+
+        void SpatialIndex::build(const std::shared_ptr<Widget>& widget)
+        {
+            DJV_PRIVATE_PTR();
+            clear();
+
+            // Collect the widgets that can receive pointer events. Clipped
+            // widgets are skipped along with their children since the
+            // children are clipped as well.
+            for (const auto& child : widget->getChildWidgets())
+            {
+                _add(child);
+            }
+            if (p.widgets.empty())
+                return;
+
+            // Create the grid.
+            p.bounds = p.rects[0];
+            for (const auto& i : p.rects)
+            {
+                p.bounds.expand(i);
+            }
+            p.cellSize.x = std::max(cellSizeMin, p.bounds.w() / static_cast<float>(cellCountMax));
+            p.cellSize.y = std::max(cellSizeMin, p.bounds.h() / static_cast<float>(cellCountMax));
+            p.cellsW = std::max(static_cast<size_t>(ceilf(p.bounds.w() / p.cellSize.x)), static_cast<size_t>(1));
+            p.cellsH = std::max(static_cast<size_t>(ceilf(p.bounds.h() / p.cellSize.y)), static_cast<size_t>(1));
+            p.cells.resize(p.cellsW * p.cellsH);
+
+            // Add the widgets to the cells they overlap. The indices in each
+            // cell are in increasing order.
+            const size_t size = p.rects.size();
+            for (size_t i = 0; i < size; ++i)
+            {
+                const auto& rect = p.rects[i];
+                const size_t x0 = std::min(static_cast<size_t>((rect.min.x - p.bounds.min.x) / p.cellSize.x), p.cellsW - 1);
+                const size_t x1 = std::min(static_cast<size_t>((rect.max.x - p.bounds.min.x) / p.cellSize.x), p.cellsW - 1);
+                const size_t y0 = std::min(static_cast<size_t>((rect.min.y - p.bounds.min.y) / p.cellSize.y), p.cellsH - 1);
+                const size_t y1 = std::min(static_cast<size_t>((rect.max.y - p.bounds.min.y) / p.cellSize.y), p.cellsH - 1);
+                for (size_t y = y0; y <= y1; ++y)
+                {
+                    for (size_t x = x0; x <= x1; ++x)
+                    {
+                        p.cells[y * p.cellsW + x].push_back(static_cast<uint32_t>(i));
+                    }
+                }
+            }
+        }
+
+        void SpatialIndex::clear()
+        {
+            DJV_PRIVATE_PTR();
+            p.widgets.clear();
+            p.rects.clear();
+            p.bounds = Math::BBox2f(0.F, 0.F, 0.F, 0.F);
+            p.cellsW = 0;
+            p.cellsH = 0;
+            p.cells.clear();
+        }
+
+        size_t SpatialIndex::getWidgetCount() const
+        {
+            return _p->widgets.size();
+        }
+
+        std::vector<std::shared_ptr<Widget> > SpatialIndex::getWidgets(const glm::vec2& pos) const
+        {
+            DJV_PRIVATE_PTR();
+            std::vector<std::shared_ptr<Widget> > out;
+            if (!p.cells.empty() && p.bounds.contains(pos))
+            {
+                const size_t x = std::min(static_cast<size_t>((pos.x - p.bounds.min.x) / p.cellSize.x), p.cellsW - 1);
+                const size_t y = std::min(static_cast<size_t>((pos.y - p.bounds.min.y) / p.cellSize.y), p.cellsH - 1);
+                const auto& cell = p.cells[y * p.cellsW + x];
+                for (auto i = cell.rbegin(); i != cell.rend(); ++i)
+                {
+                    if (p.rects[*i].contains(pos))
+                    {
+                        if (auto widget = p.widgets[*i].lock())
+                        {
+                            out.push_back(widget);
+                        }
+                    }
+                }
+            }
+            return out;
+        }
+
+        void SpatialIndex::_add(const std::shared_ptr<Widget>& widget)
+        {
+            DJV_PRIVATE_PTR();
+            if (widget->isVisible() && !widget->isClipped() && widget->getClipRect().isValid())
+            {
+                p.widgets.push_back(widget);
+                p.rects.push_back(widget->getClipRect());
+                for (const auto& child : widget->getChildWidgets())
+                {
+                    _add(child);
+                }
+            }
+        }
+
+    } // namespace UI
+} // namespace djv
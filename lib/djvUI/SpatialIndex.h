@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvMath/BBox.h>
+
+#include <djvCore/Core.h>
+
+#include <memory>
+#include <vector>
+
+namespace djv
+{
+    namespace UI
+    {
+        class Widget;
+
+        //! This class provides a spatial index of widgets for hit-testing.
+        //!
+        //! The widgets are stored in a uniform grid over their clipping
+        //! rectangles so that the widgets under a position can be found
+        //! without walking the widget hierarchy.
+        class SpatialIndex
+        {
+            DJV_NON_COPYABLE(SpatialIndex);
+
+        protected:
+            SpatialIndex();
+
+        public:
+            ~SpatialIndex();
+
+            static std::shared_ptr<SpatialIndex> create();
+
+            //! Build the index from the children of the given widget. This
+            //! should be called after the layout and clip events. The widget
+            //! itself is not added to the index.
+            void build(const std::shared_ptr<Widget>&);
+
+            //! Clear the index.
+            void clear();
+
+            //! Get the number of widgets in the index.
+            size_t getWidgetCount() const;
+
+            //! Get the widgets under the given position. The widgets are
+            //! returned in hit-testing order, children before their parents
+            //! and widgets on top before the widgets below them.
+            std::vector<std::shared_ptr<Widget> > getWidgets(const glm::vec2&) const;
+
+        private:
+            void _add(const std::shared_ptr<Widget>&);
+
+            DJV_PRIVATE();
+        };
+
+    } // namespace UI
+} // namespace djv
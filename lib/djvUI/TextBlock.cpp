@@ -298,6 +298,7 @@ namespace djv
                         _log(e.what(), System::LogLevel::Error);
                     }
                 }
+                _setUpdateEnabled(p.fontMetricsFuture.valid());
             }
 
             void Block::_textUpdate()
@@ -307,7 +308,15 @@ namespace djv
                 p.fontInfo = p.fontFamily.empty() ?
                     style->getFontInfo(p.fontFace, p.fontSizeRole) :
                     style->getFontInfo(p.fontFamily, p.fontFace, p.fontSizeRole);
-                p.fontMetricsFuture = p.fontSystem->getMetrics(p.fontInfo);
+                if (p.fontSystem->getCachedMetrics(p.fontInfo, p.fontMetrics))
+                {
+                    p.fontMetricsFuture = std::future<Render2D::Font::Metrics>();
+                }
+                else
+                {
+                    p.fontMetricsFuture = p.fontSystem->getMetrics(p.fontInfo);
+                    _setUpdateEnabled(true);
+                }
                 p.fontSystem->cacheGlyphs(p.text, p.fontInfo);
                 p.textCache.clear();
                 _resize();
@@ -319,10 +328,16 @@ namespace djv
                 const auto key = std::make_pair(fontInfo, value);
                 if (!textCache.get(key, out))
                 {
-                    auto textLines = fontSystem->textLines(
-                        text,
-                        wordWrap ? static_cast<uint16_t>(std::min(value, static_cast<float>(std::numeric_limits<uint16_t>::max()))) : 0.F,
-                        fontInfo).get();
+                    // Only wait on the font system when the lines are not
+                    // already cached.
+                    const uint16_t maxLineWidth = wordWrap ?
+                        static_cast<uint16_t>(std::min(value, static_cast<float>(std::numeric_limits<uint16_t>::max()))) :
+                        0;
+                    std::vector<Render2D::Font::TextLine> textLines;
+                    if (!fontSystem->getCachedTextLines(text, maxLineWidth, fontInfo, textLines))
+                    {
+                        textLines = fontSystem->textLines(text, maxLineWidth, fontInfo).get();
+                    }
                     glm::vec2 textSize = glm::vec2(0.F, 0.F);
                     for (const auto& i : textLines)
                     {
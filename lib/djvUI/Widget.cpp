@@ -496,6 +496,7 @@ namespace djv
                         _childWidgets.push_back(widget);
                     }
                     _resize();
+                    _redraw();
                     break;
                 }
                 case System::Event::Type::ChildRemoved:
@@ -509,10 +510,15 @@ namespace djv
                             _childWidgets.erase(i);
                         }
                     }
+                    // Repaint the area that was covered by the child.
                     _resize();
+                    _redraw();
                     break;
                 }
                 case System::Event::Type::ChildOrder:
+                    _resize();
+                    _redraw();
+                    break;
                 case System::Event::Type::Init:
                     _resize();
                     break;
@@ -529,15 +535,19 @@ namespace djv
                             if (auto eventSystem = _eventSystem.lock())
                             {
                                 const bool tooltipsEnabled = eventSystem->areTooltipsEnabled();
-                                if (tooltipsEnabled)
+                                for (auto& i : _pointerToTooltips)
                                 {
-                                    for (auto& i : _pointerToTooltips)
+                                    const auto t = std::chrono::duration_cast<std::chrono::milliseconds>(_updateTime - i.second.timer);
+                                    if (!tooltipsEnabled)
+                                    {
+                                        i.second.timeout = true;
+                                    }
+                                    else if (t > tooltipTimeout && !i.second.timeout)
                                     {
+                                        i.second.timeout = true;
                                         const auto j = _pointerHover.find(i.first);
-                                        const auto t = std::chrono::duration_cast<std::chrono::milliseconds>(_updateTime - i.second.timer);
                                         const auto& g = getGeometry();
-                                        if (t > tooltipTimeout &&
-                                            !i.second.tooltip &&
+                                        if (!i.second.tooltip &&
                                             j != _pointerHover.end() &&
                                             g.contains(j->second))
                                         {
@@ -552,13 +562,13 @@ namespace djv
                                                     break;
                                                 }
                                             }
-
                                         }
                                     }
                                 }
                             }
                         }
                     }
+                    _tooltipsUpdate();
                     break;
                 }
                 case System::Event::Type::InitLayout:
@@ -597,8 +607,10 @@ namespace djv
                         {
                             _tooltipsToDelete.insert(i.second.tooltip);
                             i.second.tooltip.reset();
-                            i.second.timer = _updateTime;
+                            i.second.timer = std::chrono::steady_clock::now();
+                            i.second.timeout = false;
                         }
+                        _tooltipsUpdate();
                         releaseTextFocus();
                     }
                     _clipEvent(clipEvent);
@@ -639,7 +651,8 @@ namespace djv
                     const auto id = info.id;
                     _pointerHover[id] = info.projectedPos;
                     _pointerToTooltips[id] = TooltipData();
-                    _pointerToTooltips[id].timer = _updateTime;
+                    _pointerToTooltips[id].timer = std::chrono::steady_clock::now();
+                    _tooltipsUpdate();
                     _pointerEnterEvent(static_cast<System::Event::PointerEnter&>(event));
                     break;
                 }
@@ -674,7 +687,9 @@ namespace djv
                         {
                             _tooltipsToDelete.insert(i->second.tooltip);
                             i->second.tooltip.reset();
-                            i->second.timer = _updateTime;
+                            i->second.timer = std::chrono::steady_clock::now();
+                            i->second.timeout = false;
+                            _tooltipsUpdate();
                         }
                     }
                     _pointerHover[id] = info.projectedPos;
@@ -846,6 +861,7 @@ namespace djv
 
         void Widget::_resize()
         {
+            _drawListsValid = false;
             if (auto eventSystem = _eventSystem.lock())
             {
                 eventSystem->resizeRequest();
@@ -854,6 +870,7 @@ namespace djv
 
         void Widget::_redraw()
         {
+            _drawListsValid = false;
             if (auto eventSystem = _eventSystem.lock())
             {
                 eventSystem->redrawRequest();
@@ -868,6 +885,12 @@ namespace djv
             _resize();
         }
 
+        void Widget::_setUpdateEnabled(bool value)
+        {
+            _updateRequest = value;
+            _tooltipsUpdate();
+        }
+
         std::string Widget::_getTooltipText() const
         {
             std::stringstream out;
@@ -942,5 +965,17 @@ namespace djv
             return out;
         }
 
+        void Widget::_tooltipsUpdate()
+        {
+            // Tooltips are created and deleted in the update event so only
+            // request updates until the tooltip timers have finished.
+            bool tooltipsPending = !_tooltipsToDelete.empty();
+            for (const auto& i : _pointerToTooltips)
+            {
+                tooltipsPending |= !i.second.timeout;
+            }
+            IObject::_setUpdateEnabled(_updateRequest || tooltipsPending);
+        }
+
     } // namespace UI
 } // namespace djv
@@ -20,6 +20,7 @@ namespace djv
 {
     namespace Render2D
     {
+        class DrawList;
         class Render;
 
     } // namespace Render
@@ -196,15 +197,21 @@ namespace djv
 
             ///@}
 
-            //! Call this function when the widget needs resizing.
+            //! Call this function when the widget needs resizing. This also
+            //! redraws the widget.
             void _resize();
 
-            //! Call this function to redraw the widget.
+            //! Call this function to redraw the widget. This must be called
+            //! whenever the appearance of the widget changes.
             void _redraw();
 
             //! Set the minimum size. This is computed and set in the pre-layout event.
             void _setMinimumSize(const glm::vec2&);
 
+            //! Set whether the widget receives update events. Widgets also
+            //! receive update events while tooltips are pending.
+            void _setUpdateEnabled(bool);
+
             const std::chrono::steady_clock::time_point& _getUpdateTime();
             const std::map<System::Event::PointerID, glm::vec2> _getPointerHover() const;
 
@@ -213,8 +220,11 @@ namespace djv
             virtual std::shared_ptr<ITooltipWidget> _createTooltip(const glm::vec2& pos);
 
         private:
+            void _tooltipsUpdate();
+
             std::vector<std::shared_ptr<Widget> > _childWidgets;
 
+            bool _updateRequest = false;
             std::chrono::steady_clock::time_point _updateTime;
 
             bool                _visible             = true;
@@ -243,11 +253,22 @@ namespace djv
             struct TooltipData
             {
                 std::chrono::steady_clock::time_point timer;
+                bool timeout = false;
                 std::shared_ptr<Tooltip> tooltip;
             };
             std::map<System::Event::PointerID, TooltipData> _pointerToTooltips;
             std::set<std::shared_ptr<Tooltip> > _tooltipsToDelete;
 
+            // The primitives from the last paint are kept so that the widget
+            // does not need to be painted again until it changes.
+            std::shared_ptr<Render2D::DrawList> _paintDrawList;
+            std::shared_ptr<Render2D::DrawList> _paintOverlayDrawList;
+            bool                _drawListsValid      = false;
+            bool                _drawListsPainted    = false;
+            Math::BBox2f        _drawListsClipRect   = Math::BBox2f(0.F, 0.F, 0.F, 0.F);
+            Math::BBox2f        _drawListsGeometry   = Math::BBox2f(0.F, 0.F, 0.F, 0.F);
+            float               _drawListsOpacity    = 1.F;
+
             std::weak_ptr<EventSystem> _eventSystem;
             std::shared_ptr<Render2D::Render> _render;
             std::shared_ptr<Style::Style> _style;
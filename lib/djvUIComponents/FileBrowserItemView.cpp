@@ -105,8 +105,24 @@ namespace djv
                 std::function<void(const std::set<size_t>&)> selectedCallback2;
                 std::function<void(const std::vector<System::File::Info>&)> activatedCallback;
                 std::function<void(const std::set<size_t>&)> activatedCallback2;
+
+                bool isUpdatePending() const;
             };
 
+            bool ItemView::Private::isUpdatePending() const
+            {
+                return
+                    nameFontMetricsFuture.valid() ||
+                    nameLinesFutures.size() ||
+                    ioInfoFutures.size() ||
+                    thumbnailFutures.size() ||
+                    thumbnailTimers.size() ||
+                    iconsFutures.size() ||
+                    nameGlyphsFutures.size() ||
+                    sizeGlyphsFutures.size() ||
+                    timeGlyphsFutures.size();
+            }
+
             void ItemView::_init(UI::SelectionType selectionType, const std::shared_ptr<System::Context>& context)
             {
                 Widget::_init(context);
@@ -458,6 +474,7 @@ namespace djv
                         }
                     }
                 }
+                _setUpdateEnabled(p.isUpdatePending());
             }
 
             void ItemView::_paintEvent(System::Event::Paint& event)
@@ -1081,6 +1098,7 @@ namespace djv
                         }
                     }
                 }
+                _setUpdateEnabled(p.isUpdatePending());
             }
 
             std::vector<System::File::Info> ItemView::_getSelectedItems(const std::set<size_t>& value) const
@@ -1189,6 +1207,7 @@ namespace djv
                         p.iconsFutures[type] = iconSystem->getIcon(name, p.thumbnailSize.h);
                     }
                 }
+                _setUpdateEnabled(p.isUpdatePending());
             }
 
             void ItemView::_thumbnailsSizeUpdate()
@@ -1239,6 +1258,7 @@ namespace djv
                         }
                     }
                 }
+                _setUpdateEnabled(p.isUpdatePending());
             }
 
             void ItemView::_itemsUpdate()
@@ -1283,6 +1303,7 @@ namespace djv
                     p.sizeGlyphsFutures.clear();
                     p.timeGlyphsFutures.clear();
                 }
+                _setUpdateEnabled(p.isUpdatePending());
             }
 
         } // namespace FileBrowser
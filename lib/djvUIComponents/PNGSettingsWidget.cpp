@@ -0,0 +1,145 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvUIComponents/PNGSettingsWidget.h>
+
+#include <djvUI/FormLayout.h>
+#include <djvUI/IntSlider.h>
+
+#include <djvAV/IOSystem.h>
+#include <djvAV/PNGFunc.h>
+
+#include <djvSystem/Context.h>
+
+#include <djvMath/NumericValueModels.h>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace UIComponents
+    {
+        namespace Settings
+        {
+            struct PNGWidget::Private
+            {
+                std::shared_ptr<UI::Numeric::IntSlider> compressionLevelSlider;
+                std::shared_ptr<UI::Numeric::IntSlider> threadCountSlider;
+                std::shared_ptr<UI::FormLayout> layout;
+            };
+
+            void PNGWidget::_init(const std::shared_ptr<System::Context>& context)
+            {
+                IWidget::_init(context);
+
+                DJV_PRIVATE_PTR();
+                setClassName("djv::UIComponents::Settings::PNGWidget");
+
+                p.compressionLevelSlider = UI::Numeric::IntSlider::create(context);
+                p.compressionLevelSlider->setRange(Math::IntRange(0, 9));
+
+                p.threadCountSlider = UI::Numeric::IntSlider::create(context);
+                p.threadCountSlider->setRange(Math::IntRange(1, 16));
+
+                p.layout = UI::FormLayout::create(context);
+                p.layout->addChild(p.compressionLevelSlider);
+                p.layout->addChild(p.threadCountSlider);
+                addChild(p.layout);
+
+                _widgetUpdate();
+
+                auto weak = std::weak_ptr<PNGWidget>(std::dynamic_pointer_cast<PNGWidget>(shared_from_this()));
+                auto contextWeak = std::weak_ptr<System::Context>(context);
+                p.compressionLevelSlider->setValueCallback(
+                    [weak, contextWeak](int value)
+                    {
+                        if (auto context = contextWeak.lock())
+                        {
+                            if (auto widget = weak.lock())
+                            {
+                                auto io = context->getSystemT<AV::IO::IOSystem>();
+                                AV::IO::PNG::Options options;
+                                rapidjson::Document document;
+                                auto& allocator = document.GetAllocator();
+                                fromJSON(io->getOptions(AV::IO::PNG::pluginName, allocator), options);
+                                options.compressionLevel = value;
+                                io->setOptions(AV::IO::PNG::pluginName, toJSON(options, allocator));
+                            }
+                        }
+                    });
+
+                p.threadCountSlider->setValueCallback(
+                    [weak, contextWeak](int value)
+                    {
+                        if (auto context = contextWeak.lock())
+                        {
+                            if (auto widget = weak.lock())
+                            {
+                                auto io = context->getSystemT<AV::IO::IOSystem>();
+                                AV::IO::PNG::Options options;
+                                rapidjson::Document document;
+                                auto& allocator = document.GetAllocator();
+                                fromJSON(io->getOptions(AV::IO::PNG::pluginName, allocator), options);
+                                options.threadCount = value;
+                                io->setOptions(AV::IO::PNG::pluginName, toJSON(options, allocator));
+                            }
+                        }
+                    });
+            }
+
+            PNGWidget::PNGWidget() :
+                _p(new Private)
+            {}
+
+            std::shared_ptr<PNGWidget> PNGWidget::create(const std::shared_ptr<System::Context>& context)
+            {
+                auto out = std::shared_ptr<PNGWidget>(new PNGWidget);
+                out->_init(context);
+                return out;
+            }
+
+            std::string PNGWidget::getSettingsName() const
+            {
+                return DJV_TEXT("settings_io_section_png");
+            }
+
+            std::string PNGWidget::getSettingsGroup() const
+            {
+                return DJV_TEXT("settings_title_io");
+            }
+
+            std::string PNGWidget::getSettingsSortKey() const
+            {
+                return "d";
+            }
+
+            void PNGWidget::_initEvent(System::Event::Init& event)
+            {
+                IWidget::_initEvent(event);
+                DJV_PRIVATE_PTR();
+                if (event.getData().text)
+                {
+                    p.layout->setText(p.compressionLevelSlider, _getText(DJV_TEXT("settings_io_png_compression_level")) + ":");
+                    p.layout->setText(p.threadCountSlider, _getText(DJV_TEXT("settings_io_png_thread_count")) + ":");
+                }
+            }
+
+            void PNGWidget::_widgetUpdate()
+            {
+                DJV_PRIVATE_PTR();
+                if (auto context = getContext().lock())
+                {
+                    auto io = context->getSystemT<AV::IO::IOSystem>();
+                    AV::IO::PNG::Options options;
+                    rapidjson::Document document;
+                    auto& allocator = document.GetAllocator();
+                    fromJSON(io->getOptions(AV::IO::PNG::pluginName, allocator), options);
+                    p.compressionLevelSlider->setValue(options.compressionLevel);
+                    p.threadCountSlider->setValue(options.threadCount);
+                }
+            }
+
+        } // namespace Settings
+    } // namespace UIComponents
+} // namespace djv
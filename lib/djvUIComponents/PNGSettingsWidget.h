@@ -0,0 +1,43 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvUIComponents/SettingsIWidget.h>
+
+namespace djv
+{
+    namespace UIComponents
+    {
+        namespace Settings
+        {
+            //! This class provides a PNG settings widget.
+            class PNGWidget : public IWidget
+            {
+                DJV_NON_COPYABLE(PNGWidget);
+
+            protected:
+                void _init(const std::shared_ptr<System::Context>&);
+                PNGWidget();
+
+            public:
+                static std::shared_ptr<PNGWidget> create(const std::shared_ptr<System::Context>&);
+
+                std::string getSettingsName() const override;
+                std::string getSettingsGroup() const override;
+                std::string getSettingsSortKey() const override;
+
+            protected:
+                void _initEvent(System::Event::Init&) override;
+
+            private:
+                void _widgetUpdate();
+
+                DJV_PRIVATE();
+            };
+
+        } // namespace Settings
+    } // namespace UIComponents
+} // namespace djv
+
@@ -40,6 +40,7 @@ namespace djv
             const float zoomSensitivity     = .1F;
             const float nearMult            = .001F;
             const float farMult             = 10.F;
+            const float pickDragMax         = 2.F;
         
         } // namespace
 
@@ -70,9 +71,12 @@ namespace djv
             System::Event::PointerID pressedID = System::Event::invalidID;
             std::map<int, bool> buttons;
             glm::vec2 pointerPos = glm::vec2(0.F, 0.F);
+            glm::vec2 pressPos = glm::vec2(0.F, 0.F);
             std::shared_ptr<Observer::ValueSubject<Math::BBox3f> > bbox;
             std::shared_ptr<Observer::ValueSubject<size_t> > primitivesCount;
             std::shared_ptr<Observer::ValueSubject<size_t> > pointCount;
+            std::shared_ptr<Observer::ValueSubject<Scene3D::PickResult> > pick;
+            std::shared_ptr<Observer::ValueSubject<float> > measurement;
             std::shared_ptr<System::Timer> statsTimer;
         };
 
@@ -83,6 +87,8 @@ namespace djv
 
             setClassName("djv::UIComponents::SceneWidget");
             setPointerEnabled(true);
+            // The scene is rendered in the update event.
+            _setUpdateEnabled(true);
 
             p.sceneRotate = Observer::ValueSubject<SceneRotate>::create(SceneRotate::None);
             p.render3D = context->getSystemT<Render3D::Render>();
@@ -100,6 +106,8 @@ namespace djv
             p.bbox = Observer::ValueSubject<Math::BBox3f>::create(Math::BBox3f(0.F, 0.F, 0.F, 0.F, 0.F, 0.F));
             p.primitivesCount = Observer::ValueSubject<size_t>::create(0);
             p.pointCount = Observer::ValueSubject<size_t>::create(0);
+            p.pick = Observer::ValueSubject<Scene3D::PickResult>::create();
+            p.measurement = Observer::ValueSubject<float>::create(0.F);
 
             p.statsTimer = System::Timer::create(context);
             p.statsTimer->setRepeating(true);
@@ -146,6 +154,8 @@ namespace djv
             DJV_PRIVATE_PTR();
             p.scene = value;
             p.render->setScene(p.scene);
+            p.pick->setIfChanged(Scene3D::PickResult());
+            p.measurement->setIfChanged(0.F);
             _sceneUpdate();
         }
 
@@ -234,6 +244,41 @@ namespace djv
             return _p->pointCount;
         }
 
+        bool SceneWidget::pick(const glm::vec2& pos, Scene3D::PickResult& out) const
+        {
+            DJV_PRIVATE_PTR();
+            bool hit = false;
+            const Math::BBox2f& g = getGeometry();
+            if (p.scene && g.w() > 0.F && g.h() > 0.F)
+            {
+                // Un-project the position to a ray from the near to the far
+                // clipping planes.
+                const glm::vec2 ndc(
+                    (pos.x - g.min.x) / g.w() * 2.F - 1.F,
+                    1.F - (pos.y - g.min.y) / g.h() * 2.F);
+                const glm::mat4x4 inverse = glm::inverse(p.camera->getP() * p.camera->getV());
+                glm::vec4 start = inverse * glm::vec4(ndc.x, ndc.y, -1.F, 1.F);
+                glm::vec4 end = inverse * glm::vec4(ndc.x, ndc.y, 1.F, 1.F);
+                if (start.w != 0.F && end.w != 0.F)
+                {
+                    start /= start.w;
+                    end /= end.w;
+                    hit = p.render->pick(Math::Ray3f(glm::vec3(start), glm::vec3(end)), out);
+                }
+            }
+            return hit;
+        }
+
+        std::shared_ptr<Observer::IValueSubject<Scene3D::PickResult> > SceneWidget::observePick() const
+        {
+            return _p->pick;
+        }
+
+        std::shared_ptr<Observer::IValueSubject<float> > SceneWidget::observeMeasurement() const
+        {
+            return _p->measurement;
+        }
+
         void SceneWidget::_layoutEvent(System::Event::Layout&)
         {
             DJV_PRIVATE_PTR();
@@ -307,6 +352,7 @@ namespace djv
             p.pressedID = pointerInfo.id;
             p.buttons = pointerInfo.buttons;
             p.pointerPos = pointerInfo.projectedPos;
+            p.pressPos = pointerInfo.projectedPos;
         }
 
         void SceneWidget::_buttonReleaseEvent(System::Event::ButtonRelease & event)
@@ -316,6 +362,26 @@ namespace djv
             if (pointerInfo.id == p.pressedID)
             {
                 event.accept();
+
+                // Clicking without dragging picks a primitive and measures
+                // the distance from the previous pick.
+                if (p.buttons.find(1) != p.buttons.end() &&
+                    glm::length(pointerInfo.projectedPos - p.pressPos) <= pickDragMax)
+                {
+                    Scene3D::PickResult result;
+                    if (pick(pointerInfo.projectedPos, result))
+                    {
+                        const auto& prev = p.pick->get();
+                        p.measurement->setIfChanged(
+                            prev.primitive ? glm::distance(prev.position, result.position) : 0.F);
+                    }
+                    else
+                    {
+                        p.measurement->setIfChanged(0.F);
+                    }
+                    p.pick->setIfChanged(result);
+                }
+
                 p.pressedID = System::Event::invalidID;
                 p.buttons.clear();
             }
@@ -481,7 +547,7 @@ namespace djv
                 }
                 p.scene->setSceneXForm(m);
                 p.scene->bboxUpdate();
-                p.render->setScene(p.scene);
+                p.render->xformUpdate();
                 const float max = p.scene->getBBoxMax();
                 auto cameraData = p.cameraData->get();
                 cameraData.clip = Math::FloatRange(max * nearMult, max * farMult);
@@ -110,6 +110,21 @@ namespace djv
 
             ///@}
 
+            //! \name Picking
+            ///@{
+
+            //! Pick the closest primitive under the given position. The
+            //! position is in window coordinates.
+            bool pick(const glm::vec2&, Scene3D::PickResult&) const;
+
+            //! Observe the last primitive picked by clicking in the view.
+            std::shared_ptr<Core::Observer::IValueSubject<Scene3D::PickResult> > observePick() const;
+
+            //! Observe the distance between the last two picked positions.
+            std::shared_ptr<Core::Observer::IValueSubject<float> > observeMeasurement() const;
+
+            ///@}
+
         protected:
             void _layoutEvent(System::Event::Layout&) override;
             void _paintEvent(System::Event::Paint&) override;
@@ -7,6 +7,7 @@
 #include <djvUI/ComboBox.h>
 #include <djvUI/Label.h>
 #include <djvUI/FormLayout.h>
+#include <djvUI/IntSlider.h>
 
 #include <djvAV/IOSystem.h>
 #include <djvAV/TIFFFunc.h>
@@ -24,6 +25,8 @@ namespace djv
             struct TIFFWidget::Private
             {
                 std::shared_ptr<UI::ComboBox> compressionComboBox;
+                std::shared_ptr<UI::Numeric::IntSlider> compressionLevelSlider;
+                std::shared_ptr<UI::Numeric::IntSlider> threadCountSlider;
                 std::shared_ptr<UI::FormLayout> layout;
             };
 
@@ -36,8 +39,16 @@ namespace djv
 
                 p.compressionComboBox = UI::ComboBox::create(context);
 
+                p.compressionLevelSlider = UI::Numeric::IntSlider::create(context);
+                p.compressionLevelSlider->setRange(Math::IntRange(1, 9));
+
+                p.threadCountSlider = UI::Numeric::IntSlider::create(context);
+                p.threadCountSlider->setRange(Math::IntRange(1, 16));
+
                 p.layout = UI::FormLayout::create(context);
                 p.layout->addChild(p.compressionComboBox);
+                p.layout->addChild(p.compressionLevelSlider);
+                p.layout->addChild(p.threadCountSlider);
                 addChild(p.layout);
 
                 _widgetUpdate();
@@ -58,6 +69,36 @@ namespace djv
                             io->setOptions(AV::IO::TIFF::pluginName, toJSON(options, allocator));
                         }
                     });
+
+                p.compressionLevelSlider->setValueCallback(
+                    [contextWeak](int value)
+                    {
+                        if (auto context = contextWeak.lock())
+                        {
+                            auto io = context->getSystemT<AV::IO::IOSystem>();
+                            AV::IO::TIFF::Options options;
+                            rapidjson::Document document;
+                            auto& allocator = document.GetAllocator();
+                            fromJSON(io->getOptions(AV::IO::TIFF::pluginName, allocator), options);
+                            options.compressionLevel = value;
+                            io->setOptions(AV::IO::TIFF::pluginName, toJSON(options, allocator));
+                        }
+                    });
+
+                p.threadCountSlider->setValueCallback(
+                    [contextWeak](int value)
+                    {
+                        if (auto context = contextWeak.lock())
+                        {
+                            auto io = context->getSystemT<AV::IO::IOSystem>();
+                            AV::IO::TIFF::Options options;
+                            rapidjson::Document document;
+                            auto& allocator = document.GetAllocator();
+                            fromJSON(io->getOptions(AV::IO::TIFF::pluginName, allocator), options);
+                            options.threadCount = value;
+                            io->setOptions(AV::IO::TIFF::pluginName, toJSON(options, allocator));
+                        }
+                    });
             }
 
             TIFFWidget::TIFFWidget() :
@@ -93,6 +134,8 @@ namespace djv
                 if (event.getData().text)
                 {
                     p.layout->setText(p.compressionComboBox, _getText(DJV_TEXT("settings_io_tiff_compression")) + ":");
+                    p.layout->setText(p.compressionLevelSlider, _getText(DJV_TEXT("settings_io_tiff_compression_level")) + ":");
+                    p.layout->setText(p.threadCountSlider, _getText(DJV_TEXT("settings_io_tiff_thread_count")) + ":");
                     _widgetUpdate();
                 }
             }
@@ -116,6 +159,8 @@ namespace djv
                     }
                     p.compressionComboBox->setItems(items);
                     p.compressionComboBox->setCurrentItem(static_cast<int>(options.compression));
+                    p.compressionLevelSlider->setValue(options.compressionLevel);
+                    p.threadCountSlider->setValue(options.threadCount);
                 }
             }
 
@@ -28,23 +28,14 @@
 #include <djvUI/SettingsSystem.h>
 #include <djvUI/ToolButton.h>
 
-#include <djvRender2D/Render.h>
+#include <djvRender2D/ImageSampler.h>
 
 #include <djvOCIO/OCIOSystem.h>
 
-#include <djvGL/OffscreenBuffer.h>
-#if defined(DJV_GL_ES2)
-#include <djvGL/Mesh.h>
-#include <djvGL/Shader.h>
-#endif // DJV_GL_ES2
-
 #include <djvImage/ColorFunc.h>
-#include <djvImage/DataFunc.h>
+#include <djvImage/Data.h>
 
 #include <djvSystem/Context.h>
-#if defined(DJV_GL_ES2)
-#include <djvSystem/ResourceSystem.h>
-#endif // DJV_GL_ES2
 
 #include <djvCore/StringFunc.h>
 
@@ -64,9 +55,6 @@ namespace djv
             //! \todo Should this be configurable?
             const size_t sampleSizeMax = 100;
 
-            //! \todo What is this really?
-            const size_t bufferSizeMin = 100;
-        
         } // namespace
 
         struct ColorPickerWidget::Private
@@ -94,10 +82,7 @@ namespace djv
             std::shared_ptr<UI::FormLayout> formLayout;
             std::shared_ptr<UI::VerticalLayout> layout;
 
-            std::shared_ptr<GL::OffscreenBuffer> offscreenBuffer;
-#if defined(DJV_GL_ES2)
-            std::shared_ptr<GL::Shader> shader;
-#endif // DJV_GL_ES2
+            std::shared_ptr<Render2D::ImageSampler> imageSampler;
 
             std::shared_ptr<Observer::Value<ColorPickerData> > dataObserver;
             std::shared_ptr<Observer::Value<ImageData> > imageDataObserver;
@@ -174,13 +159,7 @@ namespace djv
             p.layout->addChild(hLayout);
             addChild(p.layout);
 
-#if defined(DJV_GL_ES2)
-            auto resourceSystem = context->getSystemT<System::ResourceSystem>();
-            const System::File::Path shaderPath = resourceSystem->getPath(System::File::ResourcePath::Shaders);
-            p.shader = GL::Shader::create(
-                System::File::Path(shaderPath, "djvRender2DVertex.glsl"),
-                System::File::Path(shaderPath, "djvRender2DFragment.glsl"));
-#endif // DJV_GL_ES2
+            p.imageSampler = Render2D::ImageSampler::create();
 
             _sampleUpdate();
             _widgetUpdate();
@@ -484,45 +463,27 @@ namespace djv
             {
                 try
                 {
+                    // Transform the sample area from the view into the image.
                     glm::mat3x3 m(1.F);
-                    m = glm::translate(m, -(p.pickerPos / p.imageZoom));
-                    const float z = p.data.sampleSize / 2.F;
-                    m = glm::translate(m, glm::vec2(z, z));
                     m = glm::translate(m, p.imagePos / p.imageZoom);
                     m *= UI::ImageWidget::getXForm(
                         p.image,
                         p.imageData.rotate,
                         glm::vec2(1.F, 1.F),
                         p.imageData.aspectRatio);
-                    pixelPos = glm::inverse(glm::translate(m, glm::vec2(-.5F, -.5F))) * pixelPos;
-
-                    const size_t sampleSize = std::max(p.data.sampleSize, bufferSizeMin);
-                    const Image::Size size(sampleSize, sampleSize);
-                    const Image::Type type = p.data.lockType != Image::Type::None ? p.data.lockType : p.image->getType();
-                    
-                    bool create = !p.offscreenBuffer;
-                    create |= p.offscreenBuffer && size != p.offscreenBuffer->getSize();
-                    create |= p.offscreenBuffer && type != p.offscreenBuffer->getColorType();
-                    if (create)
-                    {
-                        p.offscreenBuffer = GL::OffscreenBuffer::create(
-                            size,
-                            type,
-                            _getTextSystem());
-                    }
+                    const glm::mat3x3 inverse = glm::inverse(m);
+                    const glm::vec2 pos = p.pickerPos / p.imageZoom;
+                    const float z = p.data.sampleSize / 2.F;
+                    pixelPos = inverse * glm::vec3(pos.x, pos.y, 1.F);
+                    const glm::vec3 a = inverse * glm::vec3(pos.x - z, pos.y - z, 1.F);
+                    const glm::vec3 b = inverse * glm::vec3(pos.x + z, pos.y + z, 1.F);
+                    const int x = static_cast<int>(floorf(std::min(a.x, b.x) + .5F));
+                    const int y = static_cast<int>(floorf(std::min(a.y, b.y) + .5F));
+                    const int w = std::max(static_cast<int>(roundf(fabsf(b.x - a.x))), 1);
+                    const int h = std::max(static_cast<int>(roundf(fabsf(b.y - a.y))), 1);
 
-                    p.offscreenBuffer->bind();
-                    const auto& render = _getRender();
-                    const auto imageFilterOptions = render->getImageFilterOptions();
-                    render->setImageFilterOptions(Render2D::ImageFilterOptions(Render2D::ImageFilter::Nearest));
-                    render->beginFrame(size);
-                    render->setFillColor(Image::Color(0.F, 0.F, 0.F));
-                    render->drawRect(Math::BBox2f(0.F, 0.F, sampleSize, sampleSize));
-                    render->setFillColor(Image::Color(1.F, 1.F, 1.F));
-                    render->pushTransform(m);
                     Render2D::ImageOptions options;
                     options.channelsDisplay = p.imageData.channelsDisplay;
-                    options.alphaBlend = p.imageData.alphaBlend;
                     options.mirror = p.imageData.mirror;
                     if (p.data.applyColorSpace)
                     {
@@ -541,42 +502,22 @@ namespace djv
                         }
                         options.colorSpace.output = p.outputColorSpace;
                     }
-                    options.colorEnabled = p.imageData.colorEnabled;
-                    options.color = p.imageData.color;
-                    options.levelsEnabled = p.imageData.levelsEnabled;
-                    options.levels = p.imageData.levels;
-                    options.exposureEnabled = p.imageData.exposureEnabled;
-                    options.exposure = p.imageData.exposure;
-                    options.softClipEnabled = p.imageData.softClipEnabled;
-                    options.softClip = p.imageData.softClip;
-                    if (!p.data.applyColorOperations)
+                    if (p.data.applyColorOperations)
                     {
-                        options.colorEnabled    = false;
-                        options.levelsEnabled   = false;
-                        options.exposureEnabled = false;
-                        options.softClipEnabled = false;
+                        options.colorEnabled = p.imageData.colorEnabled;
+                        options.color = p.imageData.color;
+                        options.levelsEnabled = p.imageData.levelsEnabled;
+                        options.levels = p.imageData.levels;
+                        options.exposureEnabled = p.imageData.exposureEnabled;
+                        options.exposure = p.imageData.exposure;
+                        options.softClipEnabled = p.imageData.softClipEnabled;
+                        options.softClip = p.imageData.softClip;
                     }
-                    options.cache = Render2D::ImageCache::Dynamic;
-                    render->drawImage(p.image, glm::vec2(0.F, 0.F), options);
-                    render->popTransform();
-                    render->endFrame();
-                    render->setImageFilterOptions(imageFilterOptions);
-                    auto data = Image::Data::create(Image::Info(p.data.sampleSize, p.data.sampleSize, type));
-                    glBindFramebuffer(GL_FRAMEBUFFER, 0);
-#if !defined(DJV_GL_ES2)  // \todo GL_READ_FRAMEBUFFER, glClampColor not in OpenGL ES 2
-                    glBindFramebuffer(GL_READ_FRAMEBUFFER, p.offscreenBuffer->getID());
-                    glClampColor(GL_CLAMP_READ_COLOR, GL_FALSE);
-#endif // DJV_GL_ES2
-                    glPixelStorei(GL_PACK_ALIGNMENT, 1);
-                    glReadPixels(
-                        0,
-                        static_cast<int>(sampleSize) - static_cast<int>(data->getHeight()),
-                        data->getWidth(),
-                        data->getHeight(),
-                        Image::getGLFormat(type),
-                        Image::getGLType(type),
-                        data->getData());
-                    p.color = Image::getAverageColor(data);
+                    p.color = p.imageSampler->sample(
+                        p.image,
+                        Math::BBox2i(x, y, w, h),
+                        options,
+                        p.data.lockType);
                 }
                 catch (const std::exception& e)
                 {
@@ -586,10 +527,6 @@ namespace djv
                     _log(String::join(messages, ' '), System::LogLevel::Error);
                 }
             }
-            else if (p.offscreenBuffer)
-            {
-                p.offscreenBuffer.reset();
-            }
             switch (p.imageData.rotate)
             {
             /*case UI::ImageRotate::_90:
@@ -16,6 +16,8 @@
 #include <djvUI/RowLayout.h>
 #include <djvUI/TextBlock.h>
 
+#include <djvRender3D/Render.h>
+
 #include <djvRender2D/FontSystem.h>
 #include <djvRender2D/Render.h>
 
@@ -25,6 +27,8 @@
 #include <djvSystem/Context.h>
 #include <djvSystem/TimerFunc.h>
 
+#include <djvCore/MemoryFunc.h>
+
 using namespace djv::Core;
 
 namespace djv
@@ -364,6 +368,16 @@ namespace djv
                 _lineGraphs["VBOSize"] = UIComponents::LineGraphWidget::create(context);
                 _lineGraphs["VBOSize"]->setPrecision(0);
 
+                _textBlocks["MeshCache"] = UI::Text::Block::create(context);
+                _thermometerWidgets["MeshCache"] = UIComponents::ThermometerWidget::create(context);
+
+                _textBlocks["MeshCacheFragmentation"] = UI::Text::Block::create(context);
+                _thermometerWidgets["MeshCacheFragmentation"] = UIComponents::ThermometerWidget::create(context);
+
+                _textBlocks["MeshCacheEvictions"] = UI::Text::Block::create(context);
+                _lineGraphs["MeshCacheEvictions"] = UIComponents::LineGraphWidget::create(context);
+                _lineGraphs["MeshCacheEvictions"]->setPrecision(0);
+
                 for (auto& i : _textBlocks)
                 {
                     i.second->setFontFamily(Render2D::Font::familyMono);
@@ -379,6 +393,12 @@ namespace djv
                 _layout->addChild(_lineGraphs["DynamicTextureCount"]);
                 _layout->addChild(_textBlocks["VBOSize"]);
                 _layout->addChild(_lineGraphs["VBOSize"]);
+                _layout->addChild(_textBlocks["MeshCache"]);
+                _layout->addChild(_thermometerWidgets["MeshCache"]);
+                _layout->addChild(_textBlocks["MeshCacheFragmentation"]);
+                _layout->addChild(_thermometerWidgets["MeshCacheFragmentation"]);
+                _layout->addChild(_textBlocks["MeshCacheEvictions"]);
+                _layout->addChild(_lineGraphs["MeshCacheEvictions"]);
                 addChild(_layout);
 
                 _timer = System::Timer::create(context);
@@ -443,6 +463,42 @@ namespace djv
                     ss << vboSize;
                     _textBlocks["VBOSize"]->setText(ss.str());
                 }
+
+                if (auto context = getContext().lock())
+                {
+                    if (auto render3D = context->getSystemT<Render3D::Render>())
+                    {
+                        const size_t meshCacheByteCount = render3D->getMeshCacheByteCount();
+                        const float meshCachePercentage = render3D->getMeshCachePercentage();
+                        const float meshCacheFragmentation = render3D->getMeshCacheFragmentation();
+                        const size_t meshCacheEvictionCount = render3D->getMeshCacheEvictionCount();
+
+                        _thermometerWidgets["MeshCache"]->setPercentage(meshCachePercentage);
+                        _thermometerWidgets["MeshCacheFragmentation"]->setPercentage(meshCacheFragmentation);
+                        _lineGraphs["MeshCacheEvictions"]->addSample(meshCacheEvictionCount);
+
+                        {
+                            std::stringstream ss;
+                            ss << _getText(DJV_TEXT("debug_render_mesh_cache")) << ": ";
+                            ss.precision(2);
+                            ss << std::fixed << meshCachePercentage << "% / " << Memory::getSizeLabel(meshCacheByteCount);
+                            _textBlocks["MeshCache"]->setText(ss.str());
+                        }
+                        {
+                            std::stringstream ss;
+                            ss << _getText(DJV_TEXT("debug_render_mesh_cache_fragmentation")) << ": ";
+                            ss.precision(2);
+                            ss << std::fixed << meshCacheFragmentation << "%";
+                            _textBlocks["MeshCacheFragmentation"]->setText(ss.str());
+                        }
+                        {
+                            std::stringstream ss;
+                            ss << _getText(DJV_TEXT("debug_render_mesh_cache_evictions")) << ": ";
+                            ss << meshCacheEvictionCount;
+                            _textBlocks["MeshCacheEvictions"]->setText(ss.str());
+                        }
+                    }
+                }
             }
 
             class MediaDebugWidget : public UI::Widget
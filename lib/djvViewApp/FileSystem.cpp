@@ -29,6 +29,7 @@
 #include <djvSystem/Context.h>
 #include <djvSystem/FileInfoFunc.h>
 #include <djvSystem/LogSystem.h>
+#include <djvSystem/MemorySystem.h>
 #include <djvSystem/PathFunc.h>
 #include <djvSystem/RecentFilesModel.h>
 #include <djvSystem/TextSystem.h>
@@ -73,6 +74,9 @@ namespace djv
             std::shared_ptr<Observer::Value<bool> > cacheEnabledObserver;
             std::shared_ptr<Observer::Value<int> > cacheSizeObserver;
             std::shared_ptr<System::Timer> cacheTimer;
+            float cacheScale = 1.F;
+            std::shared_ptr<System::MemorySystem> memorySystem;
+            UID memoryCacheUID = 0;
 
             typedef std::pair<System::File::Info, std::string> FileInfoAndNumber;
 
@@ -372,6 +376,38 @@ namespace djv
                     }
                 });
 
+            p.memorySystem = context->getSystemT<System::MemorySystem>();
+            if (p.memorySystem)
+            {
+                System::MemoryCacheData memoryCacheData;
+                memoryCacheData.name = DJV_TEXT("settings_memory_cache_media");
+                memoryCacheData.priority = System::MemoryCachePriority::Medium;
+                memoryCacheData.byteCount = [weak]
+                {
+                    size_t out = 0;
+                    if (auto system = weak.lock())
+                    {
+                        for (const auto& i : system->_p->media->get())
+                        {
+                            if (i->hasCache())
+                            {
+                                out += i->getCacheByteCount();
+                            }
+                        }
+                    }
+                    return out;
+                };
+                memoryCacheData.scale = [weak](float value)
+                {
+                    if (auto system = weak.lock())
+                    {
+                        system->_p->cacheScale = value;
+                        system->_cacheUpdate();
+                    }
+                };
+                p.memoryCacheUID = p.memorySystem->addCache(memoryCacheData);
+            }
+
             _logInitTime();
         }
 
@@ -382,6 +418,10 @@ namespace djv
         FileSystem::~FileSystem()
         {
             DJV_PRIVATE_PTR();
+            if (p.memorySystem)
+            {
+                p.memorySystem->removeCache(p.memoryCacheUID);
+            }
             if (p.fileBrowserDialog)
             {
                 p.fileBrowserDialog->close();
@@ -665,7 +705,10 @@ namespace djv
                 }
             }
             const bool cacheEnabled = p.settings->observeCacheEnabled()->get();
-            const size_t cacheMaxByteCount = p.settings->observeCacheSize()->get() * Memory::gigabyte;
+            // The cache size is reduced by the memory system when memory is
+            // low.
+            const size_t cacheMaxByteCount = static_cast<size_t>(
+                p.settings->observeCacheSize()->get() * Memory::gigabyte * p.cacheScale);
             const size_t mediaCacheSizeByteCount = cacheCount > 0 ? (cacheMaxByteCount / cacheCount) : 0;
             for (const auto& i : media)
             {
@@ -300,7 +300,9 @@ namespace djv
                     options.exposure = _imageData.exposure;
                     options.softClipEnabled = _imageData.softClipEnabled;
                     options.softClip = _imageData.softClip;
-                    options.cache = Render2D::ImageCache::Dynamic;
+                    // Only the magnified area of the image is visible, so
+                    // tiling avoids uploading the whole image.
+                    options.cache = Render2D::ImageCache::Tiled;
                     render->drawImage(_image, glm::vec2(0.F, 0.F), options);
                     render->popTransform();
                 }
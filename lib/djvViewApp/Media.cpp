@@ -9,10 +9,12 @@
 
 #include <djvAV/AVSystem.h>
 #include <djvAV/IOSystem.h>
+#include <djvAV/SequenceVerify.h>
 #include <djvAV/TimeFunc.h>
 
 #include <djvAudio/AudioSystem.h>
 #include <djvAudio/DataFunc.h>
+#include <djvAudio/TimeStretch.h>
 
 #include <djvSystem/Context.h>
 #include <djvSystem/FileInfoFunc.h>
@@ -26,6 +28,9 @@
 #include <djvCore/StringFunc.h>
 #include <djvCore/UndoStack.h>
 
+#include <algorithm>
+#include <atomic>
+
 using namespace djv::Core;
 
 namespace djv
@@ -38,6 +43,8 @@ namespace djv
             const size_t audioBufferFrameCount = 256;
             const size_t videoQueueSize        = 10;
             const size_t realSpeedFrameCount   = 30;
+            const float  audioScrubDurationMin = .04F;
+            const float  audioScrubTimeout     = .25F;
             
         } // namespace
 
@@ -70,6 +77,9 @@ namespace djv
             std::shared_ptr<Observer::ValueSubject<size_t> > threadCount;
             std::shared_ptr<Observer::ValueSubject<Math::Frame::Sequence> > cacheSequence;
             std::shared_ptr<Observer::ValueSubject<Math::Frame::Sequence> > cachedFrames;
+            std::shared_ptr<Observer::ValueSubject<Math::Frame::Sequence> > problemFrames;
+            std::future<AV::IO::VerifyReport> verifyFuture;
+            std::shared_ptr<std::atomic<bool> > verifyCancel;
             bool cacheEnabled = false;
             size_t cacheMaxByteCount = 0;
             std::shared_ptr<Observer::ListSubject<std::shared_ptr<AnnotatePrimitive> > > annotations;
@@ -83,9 +93,12 @@ namespace djv
 
             AV::IO::Direction ioDirection = AV::IO::Direction::Forward;
             std::unique_ptr<RtAudio> rtAudio;
-            std::shared_ptr<Audio::Data> audioData;
-            size_t audioDataSamplesOffset = 0;
+            std::shared_ptr<Audio::TimeStretch> timeStretch;
             size_t audioDataSamplesCount = 0;
+            std::atomic<bool> audioScrub;
+            size_t audioScrubSampleCount = 0;
+            size_t audioScrubSampleOffset = 0;
+            size_t audioScrubSampleWait = 0;
             Math::Frame::Index frameOffset = 0;
             Time::Duration currentTime = Time::Duration::zero();
             std::chrono::steady_clock::time_point playbackTime;
@@ -96,6 +109,7 @@ namespace djv
             std::shared_ptr<System::Timer> queueTimer;
             std::shared_ptr<System::Timer> realSpeedTimer;
             std::shared_ptr<System::Timer> cacheTimer;
+            std::shared_ptr<System::Timer> verifyTimer;
             std::shared_ptr<System::Timer> debugTimer;
         };
 
@@ -126,9 +140,11 @@ namespace djv
             p.volume = Observer::ValueSubject<float>::create(1.F);
             p.audioEnabled = Observer::ValueSubject<bool>::create(false);
             p.mute = Observer::ValueSubject<bool>::create(false);
+            p.audioScrub = false;
             p.threadCount = Observer::ValueSubject<size_t>::create(4);
             p.cacheSequence = Observer::ValueSubject<Math::Frame::Sequence>::create();
             p.cachedFrames = Observer::ValueSubject<Math::Frame::Sequence>::create();
+            p.problemFrames = Observer::ValueSubject<Math::Frame::Sequence>::create();
             p.annotations = Observer::ListSubject<std::shared_ptr<AnnotatePrimitive> >::create();
             p.undoStack = Command::UndoStack::create();
             
@@ -155,6 +171,8 @@ namespace djv
             });
             p.cacheTimer = System::Timer::create(context);
             p.cacheTimer->setRepeating(true);
+            p.verifyTimer = System::Timer::create(context);
+            p.verifyTimer->setRepeating(true);
             p.debugTimer = System::Timer::create(context);
             p.debugTimer->setRepeating(true);
 
@@ -175,6 +193,7 @@ namespace djv
             }
 
             _open();
+            _verify();
 
             p.queueTimer->start(
                 System::getTimerDuration(System::TimerValue::VeryFast),
@@ -195,6 +214,13 @@ namespace djv
         {
             DJV_PRIVATE_PTR();
             p.rtAudio.reset();
+
+            // Stop the verification so that the future does not block until
+            // every frame has been checked.
+            if (p.verifyCancel)
+            {
+                *p.verifyCancel = true;
+            }
         }
 
         std::shared_ptr<Media> Media::create(
@@ -406,6 +432,14 @@ namespace djv
             {
                 setPlayback(Playback::Stop);
                 _seek(p.currentFrame->get());
+                if (_isAudioEnabled())
+                {
+                    // Play a short grain of audio while scrubbing.
+                    p.audioScrubSampleOffset = 0;
+                    p.audioScrubSampleWait = 0;
+                    p.audioScrub = true;
+                    _startAudioStream();
+                }
             }
         }
 
@@ -658,6 +692,11 @@ namespace djv
             return _p->cachedFrames;
         }
 
+        std::shared_ptr<Core::Observer::IValueSubject<Math::Frame::Sequence> > Media::observeProblemFrames() const
+        {
+            return _p->problemFrames;
+        }
+
         void Media::setCacheEnabled(bool value)
         {
             DJV_PRIVATE_PTR();
@@ -750,15 +789,13 @@ namespace djv
         bool Media::_hasAudio() const
         {
             DJV_PRIVATE_PTR();
-            return p.audioInfo.isValid() && p.rtAudio;
+            return p.audioInfo.isValid() && p.rtAudio && p.timeStretch;
         }
 
         bool Media::_isAudioEnabled() const
         {
             DJV_PRIVATE_PTR();
-            return _hasAudio() &&
-                p.speed->get() == p.defaultSpeed->get() &&
-                !p.playEveryFrame->get();
+            return _hasAudio() && !p.playEveryFrame->get();
         }
 
         bool Media::_hasAudioSyncPlayback() const
@@ -768,6 +805,87 @@ namespace djv
                 Playback::Forward == p.playback->get();
         }
 
+        void Media::_verify()
+        {
+            DJV_PRIVATE_PTR();
+            if (auto context = p.context.lock())
+            {
+                if (System::File::Type::Sequence == p.fileInfo.getType())
+                {
+                    // Check the frames in the background so that missing and
+                    // truncated frames are shown before playback reaches them.
+                    // Only the file sizes are checked, decoding every frame
+                    // would compete with playback.
+                    const auto fileInfo = p.fileInfo;
+                    auto io = context->getSystemT<AV::IO::IOSystem>();
+                    AV::IO::VerifyOptions options;
+                    p.verifyCancel.reset(new std::atomic<bool>(false));
+                    options.cancel = p.verifyCancel;
+                    p.verifyFuture = std::async(
+                        std::launch::async,
+                        [fileInfo, options, io]
+                        {
+                            return AV::IO::verify(fileInfo, options, io);
+                        });
+                    auto weak = std::weak_ptr<Media>(std::dynamic_pointer_cast<Media>(shared_from_this()));
+                    p.verifyTimer->start(
+                        System::getTimerDuration(System::TimerValue::Slow),
+                        [weak](const std::chrono::steady_clock::time_point&, const Time::Duration&)
+                        {
+                            if (auto media = weak.lock())
+                            {
+                                media->_verifyUpdate();
+                            }
+                        });
+                }
+            }
+        }
+
+        void Media::_verifyUpdate()
+        {
+            DJV_PRIVATE_PTR();
+            if (p.verifyFuture.valid() &&
+                p.verifyFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+            {
+                p.verifyTimer->stop();
+                try
+                {
+                    const auto report = p.verifyFuture.get();
+                    p.problemFrames->setIfChanged(report.getProblemIndices(p.sequence->get()));
+                    if (report.hasProblems())
+                    {
+                        if (auto context = p.context.lock())
+                        {
+                            std::stringstream ss;
+                            ss << p.fileInfo << ":";
+                            if (report.missing.isValid())
+                            {
+                                ss << " missing frames " << report.missing << ";";
+                            }
+                            if (report.truncated.isValid())
+                            {
+                                ss << " truncated frames " << report.truncated << ";";
+                            }
+                            if (report.errors.isValid())
+                            {
+                                ss << " unreadable frames " << report.errors << ";";
+                            }
+                            auto logSystem = context->getSystemT<System::LogSystem>();
+                            logSystem->log("djv::ViewApp::Media", ss.str(), System::LogLevel::Warning);
+                        }
+                    }
+                }
+                catch (const std::exception& e)
+                {
+                    if (auto context = p.context.lock())
+                    {
+                        auto logSystem = context->getSystemT<System::LogSystem>();
+                        logSystem->log("djv::ViewApp::Media", e.what(), System::LogLevel::Error);
+                    }
+                }
+            }
+        }
+
         void Media::_open()
         {
             DJV_PRIVATE_PTR();
@@ -816,12 +934,16 @@ namespace djv
                         frame = Math::clamp(currentFrame, static_cast<Math::Frame::Index>(0), end);
                     }
                     p.currentFrame->setIfChanged(frame);
-                    if (_hasAudio())
+                    if (p.rtAudio)
                     {
                         if (p.rtAudio->isStreamOpen())
                         {
                             p.rtAudio->closeStream();
                         }
+                        p.timeStretch.reset();
+                    }
+                    if (p.audioInfo.isValid() && p.rtAudio)
+                    {
                         RtAudio::StreamParameters rtParameters;
                         auto audioSystem = context->getSystemT<Audio::AudioSystem>();
                         rtParameters.deviceId = audioSystem->getDefaultOutputDevice();
@@ -829,16 +951,39 @@ namespace djv
                         unsigned int rtBufferFrames = audioBufferFrameCount;
                         try
                         {
+                            // Use the sample rate of the file if the device
+                            // supports it, otherwise convert it to the
+                            // preferred sample rate of the device.
+                            unsigned int sampleRate = static_cast<unsigned int>(p.audioInfo.sampleRate);
+                            const RtAudio::DeviceInfo rtInfo = p.rtAudio->getDeviceInfo(rtParameters.deviceId);
+                            if (rtInfo.preferredSampleRate > 0 &&
+                                std::find(rtInfo.sampleRates.begin(), rtInfo.sampleRates.end(), sampleRate) == rtInfo.sampleRates.end())
+                            {
+                                sampleRate = rtInfo.preferredSampleRate;
+                            }
                             p.rtAudio->openStream(
                                 &rtParameters,
                                 nullptr,
-                                Audio::toRtAudio(p.audioInfo.type),
-                                p.audioInfo.sampleRate,
+                                RTAUDIO_FLOAT32,
+                                sampleRate,
                                 &rtBufferFrames,
                                 _rtAudioCallback,
                                 this,
                                 nullptr,
                                 _rtAudioErrorCallback);
+                            p.timeStretch = Audio::TimeStretch::create(
+                                p.audioInfo.channelCount,
+                                p.audioInfo.sampleRate,
+                                sampleRate);
+                            p.audioScrubSampleCount = static_cast<size_t>(
+                                sampleRate * std::max(speed.swap().toFloat(), audioScrubDurationMin));
+                            if (sampleRate != p.audioInfo.sampleRate)
+                            {
+                                std::stringstream ss;
+                                ss << "Audio sample rate conversion: " << p.audioInfo.sampleRate << " to " << sampleRate;
+                                auto logSystem = context->getSystemT<System::LogSystem>();
+                                logSystem->log("djv::ViewApp::Media", ss.str());
+                            }
                         }
                         catch (const std::exception& e)
                         {
@@ -1011,15 +1156,19 @@ namespace djv
                 {
                     p.read->seek(value, p.ioDirection);
                 }
-                p.audioData.reset();
-                p.audioDataSamplesOffset = 0;
+                _stopAudioStream();
+                p.audioScrub = false;
+                if (p.timeStretch)
+                {
+                    p.timeStretch->reset();
+                    p.timeStretch->setSpeed(p.speed->get().toFloat() / p.defaultSpeed->get().toFloat());
+                }
                 p.audioDataSamplesCount = 0;
                 p.frameOffset = p.currentFrame->get();
                 p.currentTime = Time::Duration::zero();
                 p.realSpeedTime = std::chrono::steady_clock::now();
                 p.realSpeedFrameCount = 0;
                 p.playEveryFrameTime = Time::Duration::zero();
-                _stopAudioStream();
             }
         }
 
@@ -1050,8 +1199,6 @@ namespace djv
                     }
                     p.ioDirection = forward ? AV::IO::Direction::Forward : AV::IO::Direction::Reverse;
                     _seek(p.currentFrame->get());
-                    p.audioData.reset();
-                    p.audioDataSamplesOffset = 0;
                     p.audioDataSamplesCount = 0;
                     p.frameOffset = p.currentFrame->get();
                     p.currentTime = Time::Duration::zero();
@@ -1099,11 +1246,13 @@ namespace djv
                 {
                     if (p.audioDataSamplesCount)
                     {
+                        // The audio position is in samples of the file, so
+                        // it is scaled by the default speed.
                         Math::Frame::Index frame = p.frameOffset +
                             AV::Time::scale(
                                 p.audioDataSamplesCount,
                                 Math::IntRational(1, static_cast<int>(p.audioInfo.sampleRate)),
-                                speed.swap());
+                                p.defaultSpeed->get().swap());
                         _setCurrentFrame(frame);
                     }
                 }
@@ -1262,91 +1411,91 @@ namespace djv
             void* userData)
         {
             Media* media = reinterpret_cast<Media*>(userData);
-            const auto& info = media->_p->audioInfo;
-
-            size_t outputSampleCount = static_cast<size_t>(nFrames);
-            size_t sampleCount = 0;
-            const size_t sampleByteCount = info.channelCount * Audio::getByteCount(info.type);
-            const float volume = !media->_p->mute->get() ? media->_p->volume->get() : 0.F;
-
-            if (media->_p->audioData)
+            Private& p = *media->_p;
+            const size_t channelCount = static_cast<size_t>(p.audioInfo.channelCount);
+            const float volume = !p.mute->get() ? p.volume->get() : 0.F;
+            const bool scrub = p.audioScrub;
+            Audio::F32_T* out = reinterpret_cast<Audio::F32_T*>(outputBuffer);
+
+            // Render the audio, getting more frames from the read queue as
+            // they are needed.
+            size_t sampleCount = static_cast<size_t>(nFrames);
+            if (scrub)
             {
-                sampleCount += media->_p->audioData->getSampleCount() - media->_p->audioDataSamplesOffset;
+                sampleCount = std::min(sampleCount, p.audioScrubSampleCount - std::min(p.audioScrubSampleOffset, p.audioScrubSampleCount));
             }
-
-            // Get audio frames from the read queue.
-            std::vector<AV::IO::AudioFrame> frames;
+            size_t outputSampleCount = 0;
+            while (outputSampleCount < sampleCount)
             {
-                std::lock_guard<std::mutex> lock(media->_p->read->getMutex());
-                auto& queue = media->_p->read->getAudioQueue();
-                while (!queue.isEmpty() && sampleCount < outputSampleCount)
+                outputSampleCount += p.timeStretch->render(
+                    out + outputSampleCount * channelCount,
+                    sampleCount - outputSampleCount);
+                if (outputSampleCount < sampleCount)
                 {
-                    auto frame = queue.getFrame();
-                    frames.push_back(frame);
-                    queue.popFrame();
-                    sampleCount += frame.data->getSampleCount();
+                    AV::IO::AudioFrame frame;
+                    {
+                        std::lock_guard<std::mutex> lock(p.read->getMutex());
+                        auto& queue = p.read->getAudioQueue();
+                        if (!queue.isEmpty())
+                        {
+                            frame = queue.popFrame();
+                        }
+                    }
+                    if (!frame.data)
+                    {
+                        break;
+                    }
+                    p.timeStretch->addInput(
+                        frame.data->getData(),
+                        frame.data->getSampleCount(),
+                        frame.data->getType());
                 }
             }
+            p.audioDataSamplesCount = static_cast<size_t>(p.timeStretch->getPosition());
 
-            // Use the remaining data from the frame.
-            uint8_t* p = reinterpret_cast<uint8_t*>(outputBuffer);
-            if (media->_p->audioData)
+            if (scrub)
             {
-                const size_t size = std::min(
-                    media->_p->audioData->getSampleCount() - media->_p->audioDataSamplesOffset,
-                    outputSampleCount);
-                //memcpy(
-                //    p,
-                //    media->_p->audioData->getData() + media->_p->audioDataSamplesOffset * sampleByteCount,
-                //    size * sampleByteCount);
-                Audio::volume(
-                    media->_p->audioData->getData() + media->_p->audioDataSamplesOffset * sampleByteCount,
-                    p,
-                    volume,
-                    size,
-                    info.channelCount,
-                    info.type);
-                p += size * sampleByteCount;
-                media->_p->audioDataSamplesOffset += size;
-                media->_p->audioDataSamplesCount += size;
-                outputSampleCount -= size;
-                if (media->_p->audioDataSamplesOffset >= media->_p->audioData->getSampleCount())
+                // Fade the scrub grain in and out.
+                const size_t fade = std::max(p.audioScrubSampleCount / 4, static_cast<size_t>(1));
+                Audio::F32_T* outP = out;
+                for (size_t i = 0; i < outputSampleCount; ++i)
                 {
-                    media->_p->audioData.reset();
-                    media->_p->audioDataSamplesOffset = 0;
+                    const size_t j = p.audioScrubSampleOffset + i;
+                    const size_t k = std::min(j, p.audioScrubSampleCount - j);
+                    const float v = volume * std::min(k / static_cast<float>(fade), 1.F);
+                    for (size_t c = 0; c < channelCount; ++c, ++outP)
+                    {
+                        *outP *= v;
+                    }
                 }
             }
-
-            // Process the frames.
-            for (const auto& i : frames)
+            else
             {
-                media->_p->audioData = i.data;
-                size_t size = std::min(i.data->getSampleCount(), outputSampleCount);
-                //memcpy(
-                //    p,
-                //    i.audio->getData(),
-                //    size * sampleByteCount);
-                Audio::volume(
-                    i.data->getData(),
-                    p,
-                    volume,
-                    size,
-                    info.channelCount,
-                    info.type);
-                p += size * sampleByteCount;
-                media->_p->audioDataSamplesOffset = size;
-                media->_p->audioDataSamplesCount += size;
-                outputSampleCount -= size;
+                uint8_t* outP = reinterpret_cast<uint8_t*>(out);
+                Audio::volume(outP, outP, volume, outputSampleCount, channelCount, Audio::Type::F32);
             }
 
-            const size_t zero = (nFrames * sampleByteCount) - (p - reinterpret_cast<uint8_t*>(outputBuffer));
+            const size_t zero = static_cast<size_t>(nFrames) - outputSampleCount;
             if (zero)
             {
-                //! \todo Is this the correct way to clear the audio data?
-                memset(p, 0, zero);
+                memset(out + outputSampleCount * channelCount, 0, zero * channelCount * sizeof(Audio::F32_T));
             }
 
-            return 0;
+            int r = 0;
+            if (scrub)
+            {
+                // Stop the stream when the scrub grain is finished, or when
+                // the audio is not available.
+                p.audioScrubSampleOffset += outputSampleCount;
+                p.audioScrubSampleWait += zero;
+                if (p.audioScrubSampleOffset >= p.audioScrubSampleCount ||
+                    p.audioScrubSampleWait >= p.timeStretch->getOutputSampleRate() * audioScrubTimeout)
+                {
+                    p.audioScrub = false;
+                    r = 1;
+                }
+            }
+            return r;
         }
 
         void Media::_rtAudioErrorCallback(
@@ -167,6 +167,15 @@ namespace djv
 
             ///@}
 
+            //! \name Verification
+            ///@{
+
+            //! Observe the frame indices of missing, truncated, or unreadable
+            //! frames in a sequence.
+            std::shared_ptr<Core::Observer::IValueSubject<Math::Frame::Sequence> > observeProblemFrames() const;
+
+            ///@}
+
             //! \name Annotations
             ///@{
             
@@ -205,6 +214,8 @@ namespace djv
             bool _isAudioEnabled() const;
             bool _hasAudioSyncPlayback() const;
             void _open();
+            void _verify();
+            void _verifyUpdate();
             void _setSpeed(const Math::IntRational&);
             void _setCurrentFrame(Math::Frame::Index);
             void _seek(Math::Frame::Index);
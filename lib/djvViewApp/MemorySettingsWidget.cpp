@@ -15,9 +15,13 @@
 #include <djvUI/SettingsSystem.h>
 
 #include <djvSystem/Context.h>
+#include <djvSystem/MemorySystemFunc.h>
 
+#include <djvCore/MemoryFunc.h>
 #include <djvCore/OSFunc.h>
 
+#include <iomanip>
+
 using namespace djv::Core;
 
 namespace djv
@@ -202,11 +206,34 @@ namespace djv
 
         struct MemorySettingsWidget::Private
         {
+            OS::MemoryStatus status;
+            System::MemoryPressure pressure = System::MemoryPressure::None;
+            std::vector<System::MemoryCacheInfo> caches;
+
             std::shared_ptr<MemoryCacheEnabledWidget> enabledWidget;
             std::shared_ptr<MemoryCacheSizeWidget> sizeWidget;
+            std::shared_ptr<UI::Text::Label> availableLabel;
+            std::shared_ptr<UI::Text::Label> processLabel;
+            std::shared_ptr<UI::Text::Label> pressureLabel;
+            std::vector<std::shared_ptr<UI::Text::Label> > cacheLabels;
+            std::shared_ptr<UI::VerticalLayout> cacheLayout;
             std::shared_ptr<UI::FormLayout> layout;
+
+            std::shared_ptr<Observer::Value<OS::MemoryStatus> > statusObserver;
+            std::shared_ptr<Observer::Value<System::MemoryPressure> > pressureObserver;
+            std::shared_ptr<Observer::List<System::MemoryCacheInfo> > cachesObserver;
+
+            std::shared_ptr<UI::Text::Label> createLabel(const std::shared_ptr<System::Context>&);
         };
 
+        std::shared_ptr<UI::Text::Label> MemorySettingsWidget::Private::createLabel(const std::shared_ptr<System::Context>& context)
+        {
+            auto out = UI::Text::Label::create(context);
+            out->setTextHAlign(UI::TextHAlign::Left);
+            out->setMargin(UI::MetricsRole::MarginSmall);
+            return out;
+        }
+
         void MemorySettingsWidget::_init(const std::shared_ptr<System::Context>& context)
         {
             IWidget::_init(context);
@@ -222,6 +249,55 @@ namespace djv
             p.layout->addChild(p.enabledWidget);
             p.layout->addChild(p.sizeWidget);
             addChild(p.layout);
+
+            auto memorySystem = context->getSystemT<System::MemorySystem>();
+            if (memorySystem)
+            {
+                p.availableLabel = p.createLabel(context);
+                p.processLabel = p.createLabel(context);
+                p.pressureLabel = p.createLabel(context);
+                p.cacheLayout = UI::VerticalLayout::create(context);
+                p.cacheLayout->setSpacing(UI::MetricsRole::None);
+                p.layout->addChild(p.availableLabel);
+                p.layout->addChild(p.processLabel);
+                p.layout->addChild(p.pressureLabel);
+                p.layout->addChild(p.cacheLayout);
+
+                auto weak = std::weak_ptr<MemorySettingsWidget>(
+                    std::dynamic_pointer_cast<MemorySettingsWidget>(shared_from_this()));
+                p.statusObserver = Observer::Value<OS::MemoryStatus>::create(
+                    memorySystem->observeStatus(),
+                    [weak](const OS::MemoryStatus& value)
+                    {
+                        if (auto widget = weak.lock())
+                        {
+                            widget->_p->status = value;
+                            widget->_widgetUpdate();
+                        }
+                    });
+
+                p.pressureObserver = Observer::Value<System::MemoryPressure>::create(
+                    memorySystem->observePressure(),
+                    [weak](System::MemoryPressure value)
+                    {
+                        if (auto widget = weak.lock())
+                        {
+                            widget->_p->pressure = value;
+                            widget->_widgetUpdate();
+                        }
+                    });
+
+                p.cachesObserver = Observer::List<System::MemoryCacheInfo>::create(
+                    memorySystem->observeCaches(),
+                    [weak](const std::vector<System::MemoryCacheInfo>& value)
+                    {
+                        if (auto widget = weak.lock())
+                        {
+                            widget->_p->caches = value;
+                            widget->_widgetUpdate();
+                        }
+                    });
+            }
         }
 
         MemorySettingsWidget::MemorySettingsWidget() :
@@ -253,6 +329,67 @@ namespace djv
             {
                 p.layout->setText(p.enabledWidget, _getText(DJV_TEXT("settings_memory_cache_enabled")) + ":");
                 p.layout->setText(p.sizeWidget, _getText(DJV_TEXT("settings_memory_cache_size")) + ":");
+                if (p.cacheLayout)
+                {
+                    p.layout->setText(p.availableLabel, _getText(DJV_TEXT("settings_memory_available")) + ":");
+                    p.layout->setText(p.processLabel, _getText(DJV_TEXT("settings_memory_process")) + ":");
+                    p.layout->setText(p.pressureLabel, _getText(DJV_TEXT("settings_memory_pressure")) + ":");
+                    p.layout->setText(p.cacheLayout, _getText(DJV_TEXT("settings_memory_caches")) + ":");
+                }
+                _widgetUpdate();
+            }
+        }
+
+        void MemorySettingsWidget::_widgetUpdate()
+        {
+            DJV_PRIVATE_PTR();
+            if (auto context = getContext().lock())
+            {
+                if (p.cacheLayout)
+                {
+                    {
+                        std::stringstream ss;
+                        ss << Memory::getSizeLabel(p.status.available) << " / " << Memory::getSizeLabel(p.status.total);
+                        p.availableLabel->setText(ss.str());
+                    }
+                    p.processLabel->setText(Memory::getSizeLabel(p.status.process));
+                    {
+                        std::stringstream ss;
+                        ss << p.pressure;
+                        std::stringstream ss2;
+                        ss2 << _getText(ss.str());
+                        if (p.status.pressure > 0.F)
+                        {
+                            ss2 << " (" << std::fixed << std::setprecision(1) << p.status.pressure << "%)";
+                        }
+                        p.pressureLabel->setText(ss2.str());
+                    }
+
+                    if (p.cacheLabels.size() != p.caches.size())
+                    {
+                        p.cacheLabels.clear();
+                        p.cacheLayout->clearChildren();
+                        for (size_t i = 0; i < p.caches.size(); ++i)
+                        {
+                            auto label = p.createLabel(context);
+                            p.cacheLabels.push_back(label);
+                            p.cacheLayout->addChild(label);
+                        }
+                    }
+                    for (size_t i = 0; i < p.caches.size(); ++i)
+                    {
+                        const auto& cache = p.caches[i];
+                        std::stringstream ss;
+                        ss << cache.priority;
+                        std::stringstream ss2;
+                        ss2 << _getText(cache.name) << ": " << Memory::getSizeLabel(cache.byteCount) << ", " << _getText(ss.str());
+                        if (cache.resizable)
+                        {
+                            ss2 << ", " << static_cast<int>(cache.scale * 100.F) << "%";
+                        }
+                        p.cacheLabels[i]->setText(ss2.str());
+                    }
+                }
             }
         }
 
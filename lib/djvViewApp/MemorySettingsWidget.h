@@ -75,6 +75,8 @@ namespace djv
             void _initEvent(System::Event::Init&) override;
 
         private:
+            void _widgetUpdate();
+
             DJV_PRIVATE();
         };
 
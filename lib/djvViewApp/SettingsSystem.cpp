@@ -29,6 +29,9 @@
 #if defined(FFmpeg_FOUND)
 #include <djvUIComponents/FFmpegSettingsWidget.h>
 #endif
+#if defined(PNG_FOUND)
+#include <djvUIComponents/PNGSettingsWidget.h>
+#endif
 #if defined(OpenEXR_FOUND)
 #include <djvUIComponents/OpenEXRSettingsWidget.h>
 #endif
@@ -145,6 +148,9 @@ namespace djv
 #if defined(FFmpeg_FOUND)
                     UIComponents::Settings::FFmpegWidget::create(context),
 #endif
+#if defined(PNG_FOUND)
+                    UIComponents::Settings::PNGWidget::create(context),
+#endif
 #if defined(OpenEXR_FOUND)
                     UIComponents::Settings::OpenEXRWidget::create(context),
 #endif
@@ -47,6 +47,7 @@ namespace djv
             bool cacheEnabled = false;
             Math::Frame::Sequence cacheSequence;
             Math::Frame::Sequence cachedFrames;
+            Math::Frame::Sequence problemFrames;
             Render2D::Font::FontInfo fontInfo;
             Render2D::Font::Metrics fontMetrics;
             std::future<Render2D::Font::Metrics> fontMetricsFuture;
@@ -266,6 +267,14 @@ namespace djv
             _redraw();
         }
 
+        void TimelineSlider::setProblemFrames(const Math::Frame::Sequence& value)
+        {
+            if (value == _p->problemFrames)
+                return;
+            _p->problemFrames = value;
+            _redraw();
+        }
+
         void TimelineSlider::setCurrentFrameCallback(const std::function<void(Math::Frame::Index)>& value)
         {
             _p->currentFrameCallback = value;
@@ -340,6 +349,7 @@ namespace djv
                                     tick->size.y = p.fontMetrics.lineHeight;
                                     tick->text = AV::Time::toString(p.sequence.getFrame(i.second(unit, speedF)), p.speed, p.timeUnits);
                                     tick->glyphsFuture = p.fontSystem->getGlyphs(tick->text, p.fontInfo);
+                                    _setUpdateEnabled(true);
                                     tick->textPos = glm::vec2(x + tick->size.x + m - g.min.x, textY);
                                     x2 = x + p.maxFrameLength + m * 2.F;
                                     ++timeTicksCount;
@@ -436,6 +446,25 @@ namespace djv
                     render->drawRects(rects);
                 }
 
+                // Draw the problem frames.
+                if (p.problemFrames.isValid())
+                {
+                    color = style->getColor(UI::ColorRole::Error);
+                    render->setFillColor(color);
+                    rects.clear();
+                    for (const auto& i : p.problemFrames.getRanges())
+                    {
+                        const float x0 = _frameToPos(i.getMin());
+                        const float x1 = _frameToPos(i.getMax() + 1);
+                        rects.emplace_back(Math::BBox2f(
+                            x0,
+                            g.max.y - b * 4.F,
+                            std::max(x1 - x0, b),
+                            b * 4.F));
+                    }
+                    render->drawRects(rects);
+                }
+
                 // Draw the frame ticks.
                 const size_t sequenceFrameCount = p.sequence.getFrameCount();
                 if (_getFrameLength() > b * 2.F)
@@ -650,6 +679,16 @@ namespace djv
                     }
                 }
             }
+            bool pending =
+                p.fontMetricsFuture.valid() ||
+                p.currentFrameSizeFuture.valid() ||
+                p.currentFrameGlyphsFuture.valid() ||
+                p.maxFrameSizeFuture.valid();
+            for (const auto& i : p.timeTicks)
+            {
+                pending |= i->glyphsFuture.valid();
+            }
+            _setUpdateEnabled(pending);
         }
 
         bool TimelineSlider::_isPIPEnabled() const
@@ -755,6 +794,7 @@ namespace djv
                 default: break;
                 }
                 p.maxFrameSizeFuture = p.fontSystem->measure(maxFrameText, p.fontInfo);
+                _setUpdateEnabled(true);
                 p.sizePrev = glm::vec2(0.F, 0.F);
                 _resize();
             }
@@ -773,6 +813,7 @@ namespace djv
                 p.currentFrameText = text;
                 p.currentFrameSizeFuture = p.fontSystem->measure(p.currentFrameText, p.fontInfo);
                 p.currentFrameGlyphsFuture = p.fontSystem->getGlyphs(p.currentFrameText, p.fontInfo);
+                _setUpdateEnabled(true);
             }
         }
 
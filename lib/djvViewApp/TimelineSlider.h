@@ -57,6 +57,14 @@ namespace djv
 
             ///@}
 
+            //! \name Verification
+            ///@{
+
+            //! Set the frames that are missing, truncated, or unreadable.
+            void setProblemFrames(const Math::Frame::Sequence&);
+
+            ///@}
+
             //! \name Callbacks
             ///@{
             
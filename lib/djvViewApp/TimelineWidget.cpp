@@ -80,6 +80,7 @@ namespace djv
             std::shared_ptr<Observer::Value<bool> > cacheEnabledObserver;
             std::shared_ptr<Observer::Value<Math::Frame::Sequence> > cacheSequenceObserver;
             std::shared_ptr<Observer::Value<Math::Frame::Sequence> > cachedFramesObserver;
+            std::shared_ptr<Observer::Value<Math::Frame::Sequence> > problemFramesObserver;
         };
 
         void TimelineWidget::_init(const std::shared_ptr<System::Context>& context)
@@ -512,6 +513,16 @@ namespace djv
                                             widget->_p->timelineSlider->setCachedFrames(value);
                                         }
                                     });
+
+                                widget->_p->problemFramesObserver = Observer::Value<Math::Frame::Sequence>::create(
+                                    widget->_p->media->observeProblemFrames(),
+                                    [weak](const Math::Frame::Sequence& value)
+                                    {
+                                        if (auto widget = weak.lock())
+                                        {
+                                            widget->_p->timelineSlider->setProblemFrames(value);
+                                        }
+                                    });
                             }
                             else
                             {
@@ -541,6 +552,8 @@ namespace djv
                                 widget->_p->muteObserver.reset();
                                 widget->_p->cacheSequenceObserver.reset();
                                 widget->_p->cachedFramesObserver.reset();
+                                widget->_p->problemFramesObserver.reset();
+                                widget->_p->timelineSlider->setProblemFrames(Math::Frame::Sequence());
                                 widget->_widgetUpdate();
                                 widget->_speedUpdate();
                                 widget->_realSpeedUpdate();
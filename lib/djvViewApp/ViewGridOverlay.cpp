@@ -270,6 +270,7 @@ namespace djv
                 const auto& style = _getStyle();
                 const auto fontInfo = style->getFontInfo(Render2D::Font::familyMono, Render2D::Font::faceDefault, UI::MetricsRole::FontSmall);
                 p.fontMetricsFuture = p.fontSystem->getMetrics(fontInfo);
+                _setUpdateEnabled(true);
             }
         }
 
@@ -336,6 +337,10 @@ namespace djv
                     ++textGlyphsFuturesIt;
                 }
             }
+            _setUpdateEnabled(
+                p.fontMetricsFuture.valid() ||
+                p.textSizeFutures.size() ||
+                p.textGlyphsFutures.size());
         }
 
         std::string GridOverlay::_getLabel(const GridPos& value) const
@@ -402,6 +407,7 @@ namespace djv
             const auto fontInfo = style->getFontInfo(Render2D::Font::familyMono, Render2D::Font::faceDefault, UI::MetricsRole::FontSmall);
             p.textSizeFutures[pos] = p.fontSystem->measure(label, fontInfo);
             p.textGlyphsFutures[pos] = p.fontSystem->getGlyphs(label, fontInfo);
+            _setUpdateEnabled(true);
         }
 
         void GridOverlay::_textUpdate()
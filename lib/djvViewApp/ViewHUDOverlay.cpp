@@ -291,6 +291,10 @@ namespace djv
                     ++j;
                 }
             }
+            _setUpdateEnabled(
+                p.fontMetricsFuture.valid() ||
+                p.textSizeFutures.size() ||
+                p.glyphsFutures.size());
         }
 
         void HUDOverlay::_textUpdate()
@@ -362,6 +366,7 @@ namespace djv
                 p.textSizeFutures[i.first] = p.fontSystem->measure(i.second.text, fontInfo);
                 p.glyphsFutures[i.first] = p.fontSystem->getGlyphs(i.second.text, fontInfo);
             }
+            _setUpdateEnabled(true);
         }
 
     } // namespace ViewApp
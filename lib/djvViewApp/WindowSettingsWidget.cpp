@@ -556,6 +556,7 @@ namespace djv
                 }
                 p.imageWidget->setImage(p.image);
             }
+            _setUpdateEnabled(p.imageFuture.future.valid());
         }
 
         void BackgroundImageSettingsWidget::_widgetUpdate()
@@ -578,6 +579,7 @@ namespace djv
                     const float s = style->getMetric(UI::MetricsRole::TextColumn);
                     auto thumbnailSystem = context->getSystemT<AV::ThumbnailSystem>();
                     p.imageFuture = thumbnailSystem->getImage(p.fileName, Image::Size(s, s));
+                    _setUpdateEnabled(true);
                 }
             }
         }
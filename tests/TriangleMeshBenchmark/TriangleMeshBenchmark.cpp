@@ -0,0 +1,105 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvGL/Mesh.h>
+
+#include <djvGeom/IndexedTriangleMesh.h>
+#include <djvGeom/TriangleMesh.h>
+#include <djvGeom/TriangleMeshFunc.h>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+using namespace djv;
+
+// This program compares the memory usage and conversion times of the
+// triangle mesh representations for a grid of quads.
+//
+// Usage: TriangleMeshBenchmark [grid size]
+
+namespace
+{
+    void gridMesh(size_t size, Geom::TriangleMesh& out)
+    {
+        out.clear();
+        out.v.reserve((size + 1) * (size + 1));
+        out.t.reserve((size + 1) * (size + 1));
+        out.n.push_back(glm::vec3(0.F, 0.F, 1.F));
+        for (size_t y = 0; y <= size; ++y)
+        {
+            for (size_t x = 0; x <= size; ++x)
+            {
+                out.v.push_back(glm::vec3(x, y, 0.F));
+                out.t.push_back(glm::vec2(x / static_cast<float>(size), y / static_cast<float>(size)));
+            }
+        }
+        out.triangles.reserve(size * size * 2);
+        for (size_t y = 0; y < size; ++y)
+        {
+            for (size_t x = 0; x < size; ++x)
+            {
+                const uint32_t i = static_cast<uint32_t>(y * (size + 1) + x + 1);
+                const uint32_t j = static_cast<uint32_t>(i + size + 1);
+                Geom::TriangleMesh::Triangle triangle;
+                triangle.v0 = Geom::TriangleMesh::Vertex(i, i, 1);
+                triangle.v1 = Geom::TriangleMesh::Vertex(i + 1, i + 1, 1);
+                triangle.v2 = Geom::TriangleMesh::Vertex(j + 1, j + 1, 1);
+                out.triangles.push_back(triangle);
+                triangle.v0 = Geom::TriangleMesh::Vertex(i, i, 1);
+                triangle.v1 = Geom::TriangleMesh::Vertex(j + 1, j + 1, 1);
+                triangle.v2 = Geom::TriangleMesh::Vertex(j, j, 1);
+                out.triangles.push_back(triangle);
+            }
+        }
+        out.bboxUpdate();
+    }
+
+    float elapsed(const std::chrono::steady_clock::time_point& t)
+    {
+        const std::chrono::duration<float> delta = std::chrono::steady_clock::now() - t;
+        return delta.count() * 1000.F;
+    }
+
+} // namespace
+
+int main(int argc, char ** argv)
+{
+    int r = 1;
+    try
+    {
+        const size_t size = argc > 1 ? static_cast<size_t>(std::stoi(argv[1])) : 1000;
+        const GL::VBOType vboType = GL::VBOType::Pos3_F32_UV_F32_Normal_F32;
+
+        auto t = std::chrono::steady_clock::now();
+        Geom::TriangleMesh mesh;
+        gridMesh(size, mesh);
+        std::cout << "Triangles: " << mesh.triangles.size() << std::endl;
+        std::cout << "TriangleMesh build: " << elapsed(t) << "ms" << std::endl;
+        std::cout << "TriangleMesh bytes: " << mesh.getByteCount() << std::endl;
+
+        t = std::chrono::steady_clock::now();
+        auto data = GL::VBO::convert(mesh, vboType);
+        std::cout << "TriangleMesh VBO convert: " << elapsed(t) << "ms" << std::endl;
+
+        t = std::chrono::steady_clock::now();
+        Geom::IndexedTriangleMesh indexedMesh;
+        Geom::toIndexedMesh(mesh, indexedMesh);
+        std::cout << "IndexedTriangleMesh build: " << elapsed(t) << "ms" << std::endl;
+        std::cout << "IndexedTriangleMesh vertices: " << indexedMesh.getVertexCount() << std::endl;
+        std::cout << "IndexedTriangleMesh bytes: " << indexedMesh.getByteCount() << std::endl;
+
+        t = std::chrono::steady_clock::now();
+        auto indexedData = GL::VBO::convert(indexedMesh, vboType);
+        std::cout << "IndexedTriangleMesh VBO convert: " << elapsed(t) << "ms" << std::endl;
+
+        std::cout << "VBO bytes: " << data.size() << " " << indexedData.size() << std::endl;
+        r = data.size() == indexedData.size() ? 0 : 1;
+    }
+    catch (const std::exception& e)
+    {
+        std::cout << e.what() << std::endl;
+    }
+    return r;
+}
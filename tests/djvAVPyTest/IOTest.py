@@ -0,0 +1,47 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Copyright (c) 2020 Darby Johnston
+# All rights reserved.
+
+import djvAVPy
+
+import os
+import shutil
+import tempfile
+import unittest
+
+class IOTest(unittest.TestCase):
+
+    def setUp(self):
+        self.tempPath = tempfile.mkdtemp()
+        self.fileName = os.path.join(self.tempPath, "IOTest.ppm")
+        self.width = 3
+        self.height = 2
+        self.pixels = bytes(range(self.width * self.height * 3))
+        with open(self.fileName, "wb") as f:
+            f.write(b"P6\n%d %d\n255\n" % (self.width, self.height))
+            f.write(self.pixels)
+
+    def tearDown(self):
+        shutil.rmtree(self.tempPath)
+
+    def test_info(self):
+        info = djvAVPy.IO.Reader(self.fileName).getInfo()
+        self.assertEqual(len(info.video), 1)
+        self.assertEqual(info.video[0].width, self.width)
+        self.assertEqual(info.video[0].height, self.height)
+        self.assertEqual(info.video[0].type, djvAVPy.Image.Type.RGB_U8)
+
+    def test_readFrames(self):
+        reader = djvAVPy.IO.Reader(self.fileName)
+        self.assertEqual(reader.readFrames(1, 0), [])
+        frames = reader.readFrames(0, 0)
+        self.assertEqual(len(frames), 1)
+        self.assertEqual(frames[0].getWidth(), self.width)
+        self.assertEqual(frames[0].getHeight(), self.height)
+        view = memoryview(frames[0])
+        self.assertTrue(view.readonly)
+        self.assertEqual(view.shape, (self.height, self.width, 3))
+        self.assertEqual(view.tobytes(), self.pixels)
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,186 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAVTest/PNGFuncTest.h>
+
+#include <djvAV/IOSystem.h>
+#include <djvAV/PNGFunc.h>
+
+#include <djvSystem/Context.h>
+#include <djvSystem/TimerFunc.h>
+
+#include <djvCore/ErrorFunc.h>
+
+#include <sstream>
+#include <thread>
+
+using namespace djv::Core;
+using namespace djv::AV;
+using namespace djv::AV::IO;
+
+namespace djv
+{
+    namespace AVTest
+    {
+        namespace
+        {
+            void writeImage(
+                const System::File::Path& path,
+                const std::shared_ptr<Image::Data>& image,
+                const std::shared_ptr<IOSystem>& io)
+            {
+                Info info;
+                info.video.push_back(image->getInfo());
+                auto write = io->write(System::File::Info(path), info);
+                {
+                    std::lock_guard<std::mutex> lock(write->getMutex());
+                    auto& queue = write->getVideoQueue();
+                    queue.addFrame(VideoFrame(0, image));
+                    queue.setFinished(true);
+                }
+                while (write->isRunning())
+                {
+                    std::this_thread::sleep_for(System::getTimerDuration(System::TimerValue::Fast));
+                }
+            }
+
+            std::shared_ptr<Image::Data> createImage(const Image::Size& size, Image::Type type)
+            {
+                auto out = Image::Data::create(Image::Info(size, type));
+                uint8_t* p = out->getData();
+                for (size_t i = 0; i < out->getDataByteCount(); ++i)
+                {
+                    p[i] = static_cast<uint8_t>(i * 7 + i / 251);
+                }
+                return out;
+            }
+
+            bool compareImages(const std::shared_ptr<Image::Data>& a, const std::shared_ptr<Image::Data>& b)
+            {
+                bool out =
+                    a && b &&
+                    a->getWidth() == b->getWidth() &&
+                    a->getHeight() == b->getHeight() &&
+                    a->getType() == b->getType();
+                for (uint16_t y = 0; out && y < a->getHeight(); ++y)
+                {
+                    out = 0 == memcmp(a->getData(y), b->getData(y), a->getScanlineByteCount());
+                }
+                return out;
+            }
+
+            std::shared_ptr<Image::Data> readImage(
+                const System::File::Path& path,
+                const std::shared_ptr<IOSystem>& io)
+            {
+                std::shared_ptr<Image::Data> out;
+                auto read = io->read(System::File::Info(path));
+                bool running = true;
+                while (running)
+                {
+                    {
+                        std::lock_guard<std::mutex> lock(read->getMutex());
+                        auto& queue = read->getVideoQueue();
+                        if (!queue.isEmpty())
+                        {
+                            out = queue.popFrame().data;
+                            running = false;
+                        }
+                        else if (queue.isFinished())
+                        {
+                            running = false;
+                        }
+                    }
+                    if (running)
+                    {
+                        std::this_thread::sleep_for(System::getTimerDuration(System::TimerValue::Fast));
+                    }
+                }
+                return out;
+            }
+
+        } // namespace
+
+        PNGFuncTest::PNGFuncTest(
+            const System::File::Path& tempPath,
+            const std::shared_ptr<System::Context>& context) :
+            ITest(
+                "djv::AVTest::PNGFuncTest",
+                System::File::Path(tempPath, "PNGFuncTest"),
+                context)
+        {}
+        
+        void PNGFuncTest::run()
+        {
+            _serialize();
+            _io();
+        }
+
+        void PNGFuncTest::_serialize()
+        {
+            {
+                PNG::Options options;
+                options.compressionLevel = 9;
+                options.threadCount = 1;
+                rapidjson::Document document;
+                auto& allocator = document.GetAllocator();
+                auto json = toJSON(options, allocator);
+                PNG::Options options2;
+                fromJSON(json, options2);
+                DJV_ASSERT(options == options2);
+            }
+            
+            try
+            {
+                auto json = rapidjson::Value(rapidjson::kObjectType);
+                PNG::Options options;
+                fromJSON(json, options);
+                DJV_ASSERT(options == options);
+            }
+            catch (const std::exception& e)
+            {
+                _print(Error::format(e.what()));
+            }
+        }
+
+        void PNGFuncTest::_io()
+        {
+            if (auto context = getContext().lock())
+            {
+                // Write and read back images using one thread and several
+                // threads, so that both libpng and the bands that are
+                // compressed in parallel and joined into one zlib stream are
+                // checked. The small image has too few rows to be split.
+                auto io = context->getSystemT<IOSystem>();
+                rapidjson::Document document;
+                const auto optionsPrev = io->getOptions(PNG::pluginName, document.GetAllocator());
+                for (const int compressionLevel : { 0, 1, 6, 9 })
+                {
+                    for (const size_t threadCount : { 1, 4 })
+                    {
+                        PNG::Options options;
+                        options.compressionLevel = compressionLevel;
+                        options.threadCount = threadCount;
+                        io->setOptions(PNG::pluginName, toJSON(options, document.GetAllocator()));
+                        for (const auto type : { Image::Type::L_U8, Image::Type::RGB_U8, Image::Type::RGBA_U16 })
+                        {
+                            for (const auto& size : { Image::Size(100, 70), Image::Size(33, 5) })
+                            {
+                                std::stringstream ss;
+                                ss << "io_" << compressionLevel << "_" << threadCount << "_" << type << "_" << size.w << "x" << size.h << ".png";
+                                const System::File::Path path(getTempPath(), ss.str());
+                                const auto image = createImage(size, type);
+                                writeImage(path, image, io);
+                                DJV_ASSERT(compareImages(image, readImage(path, io)));
+                            }
+                        }
+                    }
+                }
+                io->setOptions(PNG::pluginName, optionsPrev);
+            }
+        }
+        
+    } // namespace AVTest
+} // namespace djv
+
@@ -0,0 +1,258 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAVTest/SGIFuncTest.h>
+
+#include <djvAV/IOSystem.h>
+#include <djvAV/SGI.h>
+
+#include <djvSystem/Context.h>
+#include <djvSystem/FileIO.h>
+#include <djvSystem/TimerFunc.h>
+
+#include <sstream>
+#include <thread>
+
+using namespace djv::Core;
+using namespace djv::AV;
+using namespace djv::AV::IO;
+
+namespace djv
+{
+    namespace AVTest
+    {
+        namespace
+        {
+            //! Get a sample value. The left half of each scanline is constant
+            //! so that it is compressed with runs, and the right half changes
+            //! with every pixel so that it is compressed as literals.
+            uint16_t getValue(size_t c, size_t x, size_t y, size_t w, size_t bytes)
+            {
+                const size_t value = x < w / 2 ? (y * 3 + c) : (x * 7 + y * 13 + c * 29);
+                return static_cast<uint16_t>(1 == bytes ? (value & 0xff) : (value * 257) & 0xffff);
+            }
+
+            //! Append a big endian value.
+            void append(std::vector<uint8_t>& data, uint32_t value, size_t bytes)
+            {
+                for (size_t i = 0; i < bytes; ++i)
+                {
+                    data.push_back(static_cast<uint8_t>(value >> ((bytes - 1 - i) * 8)));
+                }
+            }
+
+            //! Compress a scanline with SGI run length encoding.
+            void appendRle(std::vector<uint8_t>& data, const std::vector<uint16_t>& in, size_t bytes)
+            {
+                const size_t size = in.size();
+                size_t i = 0;
+                while (i < size)
+                {
+                    size_t run = 1;
+                    while (i + run < size && run < 127 && in[i + run] == in[i])
+                    {
+                        ++run;
+                    }
+                    if (run >= 3)
+                    {
+                        append(data, static_cast<uint32_t>(run), bytes);
+                        append(data, in[i], bytes);
+                        i += run;
+                    }
+                    else
+                    {
+                        size_t j = i;
+                        while (j < size && j - i < 127 &&
+                            !(j + 2 < size && in[j] == in[j + 1] && in[j] == in[j + 2]))
+                        {
+                            ++j;
+                        }
+                        append(data, static_cast<uint32_t>(0x80 | (j - i)), bytes);
+                        for (; i < j; ++i)
+                        {
+                            append(data, in[i], bytes);
+                        }
+                    }
+                }
+                append(data, 0, bytes);
+            }
+
+            void writeSGI(
+                const System::File::Path& path,
+                const Image::Size& size,
+                size_t channels,
+                size_t bytes,
+                bool compression)
+            {
+                const size_t w = size.w;
+                const size_t h = size.h;
+                std::vector<uint8_t> data;
+                append(data, 474, 2);
+                append(data, compression ? 1 : 0, 1);
+                append(data, static_cast<uint32_t>(bytes), 1);
+                append(data, 3, 2);
+                append(data, static_cast<uint32_t>(w), 2);
+                append(data, static_cast<uint32_t>(h), 2);
+                append(data, static_cast<uint32_t>(channels), 2);
+                append(data, 0, 4);
+                append(data, 1 == bytes ? 255 : 65535, 4);
+                data.resize(512, 0);
+                if (!compression)
+                {
+                    for (size_t c = 0; c < channels; ++c)
+                    {
+                        for (size_t y = 0; y < h; ++y)
+                        {
+                            for (size_t x = 0; x < w; ++x)
+                            {
+                                append(data, getValue(c, x, y, w, bytes), bytes);
+                            }
+                        }
+                    }
+                }
+                else
+                {
+                    // The scanline offset and length tables are followed by
+                    // the compressed scanlines, in channel major order.
+                    std::vector<uint8_t> rleData;
+                    std::vector<uint32_t> offsets;
+                    std::vector<uint32_t> lengths;
+                    const size_t tableByteCount = h * channels * 4 * 2;
+                    std::vector<uint16_t> scanline(w);
+                    for (size_t c = 0; c < channels; ++c)
+                    {
+                        for (size_t y = 0; y < h; ++y)
+                        {
+                            for (size_t x = 0; x < w; ++x)
+                            {
+                                scanline[x] = getValue(c, x, y, w, bytes);
+                            }
+                            const size_t pos = rleData.size();
+                            appendRle(rleData, scanline, bytes);
+                            offsets.push_back(static_cast<uint32_t>(512 + tableByteCount + pos));
+                            lengths.push_back(static_cast<uint32_t>(rleData.size() - pos));
+                        }
+                    }
+                    for (const auto i : offsets)
+                    {
+                        append(data, i, 4);
+                    }
+                    for (const auto i : lengths)
+                    {
+                        append(data, i, 4);
+                    }
+                    data.insert(data.end(), rleData.begin(), rleData.end());
+                }
+                auto io = System::File::IO::create();
+                io->open(std::string(path), System::File::Mode::Write);
+                io->write(data.data(), data.size());
+            }
+
+            std::shared_ptr<Image::Data> readImage(
+                const System::File::Path& path,
+                const std::shared_ptr<IOSystem>& io)
+            {
+                std::shared_ptr<Image::Data> out;
+                auto read = io->read(System::File::Info(path));
+                bool running = true;
+                while (running)
+                {
+                    {
+                        std::lock_guard<std::mutex> lock(read->getMutex());
+                        auto& queue = read->getVideoQueue();
+                        if (!queue.isEmpty())
+                        {
+                            out = queue.popFrame().data;
+                            running = false;
+                        }
+                        else if (queue.isFinished())
+                        {
+                            running = false;
+                        }
+                    }
+                    if (running)
+                    {
+                        std::this_thread::sleep_for(System::getTimerDuration(System::TimerValue::Fast));
+                    }
+                }
+                return out;
+            }
+
+            bool compareImage(
+                const std::shared_ptr<Image::Data>& image,
+                const Image::Size& size,
+                size_t channels,
+                size_t bytes)
+            {
+                bool out =
+                    image &&
+                    image->getWidth() == size.w &&
+                    image->getHeight() == size.h &&
+                    Image::getChannelCount(image->getType()) == channels &&
+                    Image::getByteCount(Image::getDataType(image->getType())) == bytes &&
+                    image->getLayout().mirror.y &&
+                    Memory::Endian::MSB == image->getLayout().endian;
+                for (uint16_t y = 0; out && y < size.h; ++y)
+                {
+                    const uint8_t* p = image->getData(y);
+                    for (uint16_t x = 0; out && x < size.w; ++x)
+                    {
+                        for (size_t c = 0; out && c < channels; ++c, p += bytes)
+                        {
+                            const uint16_t value = 1 == bytes ? p[0] : ((p[0] << 8) | p[1]);
+                            out = getValue(c, x, y, size.w, bytes) == value;
+                        }
+                    }
+                }
+                return out;
+            }
+
+        } // namespace
+
+        SGIFuncTest::SGIFuncTest(
+            const System::File::Path& tempPath,
+            const std::shared_ptr<System::Context>& context) :
+            ITest(
+                "djv::AVTest::SGIFuncTest",
+                System::File::Path(tempPath, "SGIFuncTest"),
+                context)
+        {}
+        
+        void SGIFuncTest::run()
+        {
+            _io();
+        }
+
+        void SGIFuncTest::_io()
+        {
+            if (auto context = getContext().lock())
+            {
+                // Write images with and without run length encoding and read
+                // them back. The images are tall enough for the scanlines to
+                // be decoded in several bands, and wider than the maximum run
+                // length.
+                auto io = context->getSystemT<IOSystem>();
+                for (const bool compression : { false, true })
+                {
+                    for (const size_t channels : { 1, 2, 3, 4 })
+                    {
+                        for (const size_t bytes : { 1, 2 })
+                        {
+                            for (const auto& size : { Image::Size(300, 70), Image::Size(33, 5) })
+                            {
+                                std::stringstream ss;
+                                ss << "io_" << compression << "_" << channels << "_" << bytes << "_" << size.w << "x" << size.h << ".sgi";
+                                const System::File::Path path(getTempPath(), ss.str());
+                                writeSGI(path, size, channels, bytes, compression);
+                                DJV_ASSERT(compareImage(readImage(path, io), size, channels, bytes));
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        
+    } // namespace AVTest
+} // namespace djv
+
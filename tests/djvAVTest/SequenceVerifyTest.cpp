@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAVTest/SequenceVerifyTest.h>
+
+#include <djvAV/IOSystem.h>
+#include <djvAV/SequenceVerify.h>
+
+#include <djvSystem/Context.h>
+#include <djvSystem/FileIO.h>
+
+#include <djvMath/FrameNumberFunc.h>
+
+#include <djvCore/MemoryFunc.h>
+
+using namespace djv::Core;
+using namespace djv::AV::IO;
+
+namespace djv
+{
+    namespace AVTest
+    {
+        SequenceVerifyTest::SequenceVerifyTest(
+            const System::File::Path& tempPath,
+            const std::shared_ptr<System::Context>& context) :
+            ITest(
+                "djv::AVTest::SequenceVerifyTest",
+                System::File::Path(tempPath, "SequenceVerifyTest"),
+                context)
+        {}
+        
+        void SequenceVerifyTest::run()
+        {
+            if (auto context = getContext().lock())
+            {
+                // Write a sequence with a missing frame (4) and a truncated
+                // frame (5). Frame 7 is in the sequence but does not exist.
+                const std::string data(1000, 'x');
+                for (const auto i : { 1, 2, 3, 5, 6 })
+                {
+                    auto io = System::File::IO::create();
+                    io->open(
+                        System::File::Path(getTempPath(), "verify." + std::to_string(i) + ".ppm").get(),
+                        System::File::Mode::Write);
+                    io->write(5 == i ? data.substr(0, 10) : data);
+                }
+                const Math::Frame::Sequence sequence(
+                    { Math::Frame::Range(1, 3), Math::Frame::Range(5, 7) });
+                const System::File::Info fileInfo(
+                    System::File::Path(getTempPath(), "verify.1.ppm"),
+                    System::File::Type::Sequence,
+                    sequence);
+
+                auto io = context->getSystemT<IOSystem>();
+                VerifyOptions options;
+                options.checksums = true;
+                const auto report = verify(fileInfo, options, io);
+                {
+                    std::stringstream ss;
+                    ss << "Missing: " << report.missing << ", truncated: " << report.truncated << ", errors: " << report.errors;
+                    _print(ss.str());
+                }
+                DJV_ASSERT(report.hasProblems());
+                DJV_ASSERT(6 == report.frames.size());
+                DJV_ASSERT(Math::Frame::Sequence(Math::Frame::Range(4)) == report.missing);
+                DJV_ASSERT(Math::Frame::Sequence(Math::Frame::Range(5)) == report.truncated);
+                DJV_ASSERT(Math::Frame::Sequence(Math::Frame::Range(7)) == report.errors);
+                const uint64_t checksum = Memory::xxHash64(data.data(), data.size());
+                for (const auto& i : report.frames)
+                {
+                    switch (i.number)
+                    {
+                    case 1:
+                    case 2:
+                    case 3:
+                    case 6:
+                        DJV_ASSERT(VerifyStatus::OK == i.status);
+                        DJV_ASSERT(data.size() == i.size);
+                        DJV_ASSERT(checksum == i.checksum);
+                        break;
+                    default: break;
+                    }
+                }
+
+                const auto indices = report.getProblemIndices(sequence);
+                DJV_ASSERT(Math::Frame::fromFrames({ 3, 5 }) == indices);
+
+                options.checksums = false;
+                options.mode = VerifyMode::Header;
+                const System::File::Info fileInfo2(
+                    System::File::Path(getTempPath(), "verify.1.ppm"),
+                    System::File::Type::Sequence,
+                    Math::Frame::Sequence(Math::Frame::Range(1, 3)));
+                const auto report2 = verify(fileInfo2, options, io);
+                DJV_ASSERT(Math::Frame::Sequence(Math::Frame::Range(1, 3)) == report2.errors);
+
+                // A cancelled verification does not check any more frames.
+                options.cancel.reset(new std::atomic<bool>(true));
+                const auto report3 = verify(fileInfo2, options, io);
+                DJV_ASSERT(report3.cancelled);
+                DJV_ASSERT(!report3.errors.isValid());
+            }
+        }
+        
+    } // namespace AVTest
+} // namespace djv
@@ -4,10 +4,18 @@
 
 #include <djvAVTest/TIFFFuncTest.h>
 
+#include <djvAV/IOSystem.h>
 #include <djvAV/TIFFFunc.h>
 
+#include <djvSystem/Context.h>
+#include <djvSystem/TimerFunc.h>
+
 #include <djvCore/ErrorFunc.h>
 
+#include <algorithm>
+#include <sstream>
+#include <thread>
+
 using namespace djv::Core;
 using namespace djv::AV;
 using namespace djv::AV::IO;
@@ -16,21 +24,108 @@ namespace djv
 {
     namespace AVTest
     {
+        namespace
+        {
+            void writeImage(
+                const System::File::Path& path,
+                const std::shared_ptr<Image::Data>& image,
+                const std::shared_ptr<IOSystem>& io)
+            {
+                Info info;
+                info.video.push_back(image->getInfo());
+                auto write = io->write(System::File::Info(path), info);
+                {
+                    std::lock_guard<std::mutex> lock(write->getMutex());
+                    auto& queue = write->getVideoQueue();
+                    queue.addFrame(VideoFrame(0, image));
+                    queue.setFinished(true);
+                }
+                while (write->isRunning())
+                {
+                    std::this_thread::sleep_for(System::getTimerDuration(System::TimerValue::Fast));
+                }
+            }
+
+            std::shared_ptr<Image::Data> createImage(const Image::Size& size, Image::Type type)
+            {
+                auto out = Image::Data::create(Image::Info(size, type));
+                uint8_t* p = out->getData();
+                for (size_t i = 0; i < out->getDataByteCount(); ++i)
+                {
+                    p[i] = static_cast<uint8_t>(i * 7 + i / 251);
+                }
+                return out;
+            }
+
+            bool compareImages(const std::shared_ptr<Image::Data>& a, const std::shared_ptr<Image::Data>& b)
+            {
+                bool out =
+                    a && b &&
+                    a->getWidth() == b->getWidth() &&
+                    a->getHeight() == b->getHeight() &&
+                    a->getType() == b->getType();
+                for (uint16_t y = 0; out && y < a->getHeight(); ++y)
+                {
+                    out = 0 == memcmp(a->getData(y), b->getData(y), a->getScanlineByteCount());
+                }
+                return out;
+            }
+
+            std::shared_ptr<Image::Data> readImage(
+                const System::File::Path& path,
+                const std::shared_ptr<IOSystem>& io)
+            {
+                std::shared_ptr<Image::Data> out;
+                auto read = io->read(System::File::Info(path));
+                bool running = true;
+                while (running)
+                {
+                    {
+                        std::lock_guard<std::mutex> lock(read->getMutex());
+                        auto& queue = read->getVideoQueue();
+                        if (!queue.isEmpty())
+                        {
+                            out = queue.popFrame().data;
+                            running = false;
+                        }
+                        else if (queue.isFinished())
+                        {
+                            running = false;
+                        }
+                    }
+                    if (running)
+                    {
+                        std::this_thread::sleep_for(System::getTimerDuration(System::TimerValue::Fast));
+                    }
+                }
+                return out;
+            }
+
+        } // namespace
+
         TIFFFuncTest::TIFFFuncTest(
             const System::File::Path& tempPath,
             const std::shared_ptr<System::Context>& context) :
-            ITest("djv::AVTest::TIFFFuncTest", tempPath, context)
+            ITest(
+                "djv::AVTest::TIFFFuncTest",
+                System::File::Path(tempPath, "TIFFFuncTest"),
+                context)
         {}
         
         void TIFFFuncTest::run()
         {
             _serialize();
+            _io();
+            _tiles();
         }
 
         void TIFFFuncTest::_serialize()
         {
             {
                 IO::TIFF::Options options;
+                options.compression = IO::TIFF::Compression::Deflate;
+                options.compressionLevel = 9;
+                options.threadCount = 1;
                 rapidjson::Document document;
                 auto& allocator = document.GetAllocator();
                 auto json = toJSON(options, allocator);
@@ -52,6 +147,100 @@ namespace djv
             }
         }
 
+        void TIFFFuncTest::_io()
+        {
+            if (auto context = getContext().lock())
+            {
+                // Write and read back images with each compression, using one
+                // thread and several threads so that both the serial strips
+                // and the strips that are compressed in parallel are checked.
+                auto io = context->getSystemT<IOSystem>();
+                rapidjson::Document document;
+                const auto optionsPrev = io->getOptions(IO::TIFF::pluginName, document.GetAllocator());
+                for (const auto compression : IO::TIFF::getCompressionEnums())
+                {
+                    for (const size_t threadCount : { 1, 4 })
+                    {
+                        IO::TIFF::Options options;
+                        options.compression = compression;
+                        options.threadCount = threadCount;
+                        io->setOptions(IO::TIFF::pluginName, toJSON(options, document.GetAllocator()));
+                        for (const auto type : { Image::Type::L_U8, Image::Type::RGB_U8, Image::Type::RGBA_U16 })
+                        {
+                            for (const auto& size : { Image::Size(100, 70), Image::Size(33, 5) })
+                            {
+                                std::stringstream ss;
+                                ss << "io_" << compression << "_" << threadCount << "_" << type << "_" << size.w << "x" << size.h << ".tif";
+                                const System::File::Path path(getTempPath(), ss.str());
+                                const auto image = createImage(size, type);
+                                writeImage(path, image, io);
+                                DJV_ASSERT(compareImages(image, readImage(path, io)));
+                            }
+                        }
+                    }
+                }
+                io->setOptions(IO::TIFF::pluginName, optionsPrev);
+            }
+        }
+
+        void TIFFFuncTest::_tiles()
+        {
+            if (auto context = getContext().lock())
+            {
+                // Write a tiled image with partial tiles on the right and
+                // bottom edges.
+                const uint32 w = 70;
+                const uint32 h = 50;
+                const uint32 tileSize = 16;
+                std::vector<uint8_t> pixels(w * h * 3);
+                for (size_t i = 0; i < pixels.size(); ++i)
+                {
+                    pixels[i] = static_cast<uint8_t>(i * 7);
+                }
+                const System::File::Path path(getTempPath(), "tiles.tif");
+                ::TIFF* f = TIFFOpen(path.get().c_str(), "w");
+                DJV_ASSERT(f);
+                TIFFSetField(f, TIFFTAG_IMAGEWIDTH, w);
+                TIFFSetField(f, TIFFTAG_IMAGELENGTH, h);
+                TIFFSetField(f, TIFFTAG_BITSPERSAMPLE, 8);
+                TIFFSetField(f, TIFFTAG_SAMPLESPERPIXEL, 3);
+                TIFFSetField(f, TIFFTAG_PHOTOMETRIC, PHOTOMETRIC_RGB);
+                TIFFSetField(f, TIFFTAG_PLANARCONFIG, PLANARCONFIG_CONTIG);
+                TIFFSetField(f, TIFFTAG_COMPRESSION, COMPRESSION_ADOBE_DEFLATE);
+                TIFFSetField(f, TIFFTAG_TILEWIDTH, tileSize);
+                TIFFSetField(f, TIFFTAG_TILELENGTH, tileSize);
+                std::vector<uint8_t> tile(tileSize * tileSize * 3);
+                for (uint32 y = 0; y < h; y += tileSize)
+                {
+                    for (uint32 x = 0; x < w; x += tileSize)
+                    {
+                        std::fill(tile.begin(), tile.end(), 0);
+                        for (uint32 j = 0; j < tileSize && y + j < h; ++j)
+                        {
+                            const uint32 columns = std::min(tileSize, w - x);
+                            memcpy(
+                                tile.data() + j * tileSize * 3,
+                                pixels.data() + ((y + j) * w + x) * 3,
+                                columns * 3);
+                        }
+                        DJV_ASSERT(TIFFWriteTile(f, tile.data(), x, y, 0, 0) != -1);
+                    }
+                }
+                TIFFClose(f);
+
+                auto io = context->getSystemT<IOSystem>();
+                const auto image = readImage(path, io);
+                DJV_ASSERT(image);
+                DJV_ASSERT(Image::Type::RGB_U8 == image->getType());
+                DJV_ASSERT(w == image->getWidth());
+                DJV_ASSERT(h == image->getHeight());
+                for (uint16_t y = 0; y < h; ++y)
+                {
+                    DJV_ASSERT(0 == memcmp(image->getData(y), pixels.data() + y * w * 3, w * 3));
+                }
+            }
+        }
+
     } // namespace AVTest
 } // namespace djv
 
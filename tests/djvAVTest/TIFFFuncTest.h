@@ -19,6 +19,8 @@ namespace djv
         
         private:
             void _serialize();
+            void _io();
+            void _tiles();
         };
         
     } // namespace AVTest
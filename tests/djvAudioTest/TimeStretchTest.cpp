@@ -0,0 +1,131 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAudioTest/TimeStretchTest.h>
+
+#include <djvAudio/TimeStretch.h>
+
+#include <djvMath/Math.h>
+
+#include <cmath>
+#include <vector>
+
+using namespace djv::Core;
+using namespace djv::Audio;
+
+namespace djv
+{
+    namespace AudioTest
+    {
+        TimeStretchTest::TimeStretchTest(
+            const System::File::Path& tempPath,
+            const std::shared_ptr<System::Context>& context) :
+            ITest("djv::AudioTest::TimeStretchTest", tempPath, context)
+        {}
+        
+        void TimeStretchTest::run()
+        {
+            _info();
+            _render();
+            _stream();
+        }
+
+        void TimeStretchTest::_info()
+        {
+            auto timeStretch = TimeStretch::create(2, 44100, 48000);
+            DJV_ASSERT(2 == timeStretch->getChannelCount());
+            DJV_ASSERT(44100 == timeStretch->getInputSampleRate());
+            DJV_ASSERT(48000 == timeStretch->getOutputSampleRate());
+            DJV_ASSERT(1.F == timeStretch->getSpeed());
+            timeStretch->setSpeed(2.F);
+            DJV_ASSERT(2.F == timeStretch->getSpeed());
+            DJV_ASSERT(0 == timeStretch->getInputSampleCount());
+            DJV_ASSERT(0.0 == timeStretch->getPosition());
+        }
+
+        void TimeStretchTest::_render()
+        {
+            const size_t sampleRate = 48000;
+            std::vector<S16_T> input(sampleRate * 2);
+            for (size_t i = 0; i < sampleRate; ++i)
+            {
+                const float v = sinf(i / static_cast<float>(sampleRate) * 440.F * Math::pi2);
+                input[i * 2] = input[i * 2 + 1] = static_cast<S16_T>(v * S16Range.getMax());
+            }
+
+            struct Data
+            {
+                size_t outputSampleRate;
+                float speed;
+            };
+            const std::vector<Data> data =
+            {
+                { 48000, 1.F },
+                { 48000, .5F },
+                { 48000, 2.F },
+                { 44100, 1.F },
+                { 96000, 1.5F }
+            };
+            for (const auto& i : data)
+            {
+                auto timeStretch = TimeStretch::create(2, sampleRate, i.outputSampleRate);
+                timeStretch->setSpeed(i.speed);
+                timeStretch->addInput(reinterpret_cast<const uint8_t*>(input.data()), sampleRate, Type::S16);
+                DJV_ASSERT(sampleRate == timeStretch->getInputSampleCount());
+
+                std::vector<F32_T> output(sampleRate * 8 * 2);
+                const size_t outputSampleCount = timeStretch->render(output.data(), sampleRate * 8);
+                const double expected = sampleRate / i.speed * i.outputSampleRate / static_cast<double>(sampleRate);
+                std::stringstream ss;
+                ss << "speed " << i.speed << ", " << i.outputSampleRate << ": " << outputSampleCount << " samples";
+                _print(ss.str());
+                DJV_ASSERT(outputSampleCount <= expected);
+                DJV_ASSERT(outputSampleCount > expected * .9);
+                DJV_ASSERT(timeStretch->getPosition() <= sampleRate);
+
+                // The output should be continuous.
+                float maxStep = 0.F;
+                for (size_t j = 0; j < outputSampleCount - 1; ++j)
+                {
+                    maxStep = std::max(maxStep, fabsf(output[(j + 1) * 2] - output[j * 2]));
+                }
+                DJV_ASSERT(maxStep < .1F);
+
+                timeStretch->reset();
+                DJV_ASSERT(0 == timeStretch->getInputSampleCount());
+                DJV_ASSERT(0 == timeStretch->render(output.data(), 1));
+                DJV_ASSERT(0.0 == timeStretch->getPosition());
+            }
+        }
+        
+        void TimeStretchTest::_stream()
+        {
+            // Stream more audio than the buffers hold in small blocks, the
+            // way the audio callback does, and check that the audio passes
+            // through unchanged.
+            const size_t sampleRate = 1000;
+            const size_t blockSize = 64;
+            auto timeStretch = TimeStretch::create(1, sampleRate, sampleRate);
+            std::vector<F32_T> output(blockSize);
+            size_t inputCount = 0;
+            size_t outputCount = 0;
+            for (size_t i = 0; i < sampleRate * 10 / blockSize; ++i)
+            {
+                std::vector<F32_T> input(blockSize);
+                for (size_t j = 0; j < blockSize; ++j, ++inputCount)
+                {
+                    input[j] = static_cast<F32_T>(inputCount % 1000) / 1000.F;
+                }
+                timeStretch->addInput(reinterpret_cast<const uint8_t*>(input.data()), blockSize, Type::F32);
+                const size_t count = timeStretch->render(output.data(), blockSize);
+                for (size_t j = 0; j < count; ++j, ++outputCount)
+                {
+                    DJV_ASSERT(static_cast<F32_T>(outputCount % 1000) / 1000.F == output[j]);
+                }
+            }
+            DJV_ASSERT(inputCount == outputCount);
+        }
+        
+    } // namespace AudioTest
+} // namespace djv
@@ -0,0 +1,27 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvTestLib/Test.h>
+
+namespace djv
+{
+    namespace AudioTest
+    {
+        class TimeStretchTest : public Test::ITest
+        {
+        public:
+            TimeStretchTest(
+                const System::File::Path& tempPath,
+                const std::shared_ptr<System::Context>&);
+            
+            void run() override;
+            
+        private:
+            void _info();
+            void _render();
+            void _stream();
+        };
+        
+    } // namespace AudioTest
+} // namespace djv
@@ -43,6 +43,24 @@ namespace djv
                 DJV_ASSERT(cache.getKeys() == std::vector<int>({ 2, 3 }));
                 DJV_ASSERT(cache.getValues() == std::vector<std::string>({ "b", "c" }));
             }
+
+            {
+                Memory::Cache<int, std::string> cache;
+                cache.setMax(2);
+                std::vector<std::string> removed;
+                cache.add(1, "a", removed);
+                cache.add(2, "b", removed);
+                DJV_ASSERT(removed.empty());
+                cache.add(2, "c", removed);
+                DJV_ASSERT(removed == std::vector<std::string>({ "b" }));
+                removed.clear();
+                cache.add(3, "d", removed);
+                DJV_ASSERT(removed == std::vector<std::string>({ "a" }));
+                removed.clear();
+                cache.setMax(1, removed);
+                DJV_ASSERT(removed == std::vector<std::string>({ "c" }));
+                DJV_ASSERT(cache.getValues() == std::vector<std::string>({ "d" }));
+            }
         }
         
     } // namespace CoreTest
@@ -6,6 +6,7 @@
 
 #include <djvCore/MemoryFunc.h>
 
+#include <algorithm>
 #include <iostream>
 
 using namespace djv::Core;
@@ -161,6 +162,33 @@ namespace djv
                 ss << "Hash: " << hash;
                 _print(ss.str());
             }
+
+            {
+                DJV_ASSERT(0xEF46DB3751D8E999ULL == Memory::xxHash64("", 0));
+                DJV_ASSERT(0xD24EC4F1A98C6E5BULL == Memory::xxHash64("a", 1));
+                DJV_ASSERT(0x44BC2CF5AD770999ULL == Memory::xxHash64("abc", 3));
+                const std::string s = "Nobody inspects the spammish repetition";
+                DJV_ASSERT(0xFBCEA83C8A378BF1ULL == Memory::xxHash64(s.data(), s.size()));
+                DJV_ASSERT(Memory::xxHash64(s.data(), s.size()) != Memory::xxHash64(s.data(), s.size(), 1));
+            }
+
+            {
+                std::vector<uint8_t> data(1000);
+                for (size_t i = 0; i < data.size(); ++i)
+                {
+                    data[i] = static_cast<uint8_t>(i * 7);
+                }
+                for (const size_t chunk : { 1, 5, 31, 32, 33, 100, 1000 })
+                {
+                    Memory::XXHash64State state;
+                    Memory::xxHash64Reset(state, 1);
+                    for (size_t i = 0; i < data.size(); i += chunk)
+                    {
+                        Memory::xxHash64Update(state, data.data() + i, std::min(chunk, data.size() - i));
+                    }
+                    DJV_ASSERT(Memory::xxHash64(data.data(), data.size(), 1) == Memory::xxHash64Digest(state));
+                }
+            }
         }
         
     } // namespace CoreTest
@@ -35,6 +35,16 @@ namespace djv
                 _print(ss.str());
             }
 
+            {
+                const OS::MemoryStatus status = OS::getMemoryStatus();
+                DJV_ASSERT(status.available <= status.total);
+                DJV_ASSERT(status == status);
+                std::stringstream ss;
+                ss << "Memory status: " << status.available << "/" << status.total << ", process: " <<
+                    status.process << ", pressure: " << status.pressure;
+                _print(ss.str());
+            }
+
             {
                 std::stringstream ss;
                 ss << "User name: " << OS::getUserName();
@@ -7,6 +7,7 @@
 #include <djvCore/StringFunc.h>
 
 #include <iostream>
+#include <limits>
 #include <sstream>
 
 using namespace djv::Core;
@@ -330,6 +331,68 @@ namespace djv
                     DJV_ASSERT(d.value == value);
                 }
             }
+
+            {
+                struct Data
+                {
+                    std::string string;
+                    int64_t value;
+                    size_t size;
+                };
+                std::vector<Data> data =
+                {
+                    { "-100", -100, 4 },
+                    { "", 0, 0 },
+                    { "-", 0, 0 },
+                    { "10/20", 10, 2 },
+                    { "+100", 100, 4 },
+                    { "9223372036854775807", std::numeric_limits<int64_t>::max(), 19 },
+                    { "-9223372036854775808", std::numeric_limits<int64_t>::min(), 20 },
+                    { "99999999999999999999", std::numeric_limits<int64_t>::max(), 20 },
+                    { "-99999999999999999999", std::numeric_limits<int64_t>::min(), 21 }
+                };
+                for (const auto & d : data)
+                {
+                    int64_t value = 0;
+                    const char* first = d.string.c_str();
+                    const char* last = String::fromChars(first, first + d.string.size(), value);
+                    DJV_ASSERT(d.value == value);
+                    DJV_ASSERT(d.size == static_cast<size_t>(last - first));
+                }
+            }
+
+            {
+                struct Data
+                {
+                    std::string string;
+                    float value;
+                    size_t size;
+                };
+                std::vector<Data> data =
+                {
+                    { "-100.5", -100.5F, 6 },
+                    { "", 0.F, 0 },
+                    { ".", 0.F, 0 },
+                    { "10.5 ", 10.5F, 4 },
+                    { "+100.5", 100.5F, 6 },
+                    { "1E-1", .1F, 4 },
+                    { "1e", 1.F, 1 },
+                    { ".25", .25F, 3 },
+                    { "3.14159265358979323846", 3.14159265358979323846F, 22 },
+                    { "6.02214076e23", 6.02214076e23F, 13 },
+                    { "1e99999999999999999999", std::numeric_limits<float>::infinity(), 22 },
+                    { "1e-99999999999999999999", 0.F, 23 },
+                    { "-1e-99999999999999999999", -0.F, 24 }
+                };
+                for (const auto & d : data)
+                {
+                    float value = 0.F;
+                    const char* first = d.string.c_str();
+                    const char* last = String::fromChars(first, first + d.string.size(), value);
+                    DJV_ASSERT(d.value == value);
+                    DJV_ASSERT(d.size == static_cast<size_t>(last - first));
+                }
+            }
             
             {
                 std::vector<std::string> data =
@@ -41,19 +41,29 @@ namespace djv
                 MeshCache cache(100, i);
                 DJV_ASSERT(cache.getVBOSize() == 100);
                 DJV_ASSERT(cache.getVBOType() == i);
+                DJV_ASSERT(cache.getPageCount() == 1);
+                DJV_ASSERT(cache.getPageCountMax() == 1);
                 DJV_ASSERT(cache.getVBO());
                 DJV_ASSERT(cache.getVAO());
+                DJV_ASSERT(0.F == cache.getFragmentation());
 
+                size_t page = 0;
                 Math::SizeTRange range;
                 for (size_t j = 0; j < 100; ++j)
                 {
-                    UID uid = cache.add(data, range);
+                    UID uid = cache.add(data, page, range);
+                    DJV_ASSERT(uid);
+                    size_t page2 = 0;
                     Math::SizeTRange range2;
-                    DJV_ASSERT(cache.get(uid, range2));
+                    DJV_ASSERT(cache.get(uid, page2, range2));
+                    DJV_ASSERT(page == page2);
                     DJV_ASSERT(range == range2);
+                    DJV_ASSERT(cache.contains(uid));
                 }
+                DJV_ASSERT(cache.getEvictionCount() > 0);
                 
-                DJV_ASSERT(!cache.get(invalid, range));
+                DJV_ASSERT(!cache.get(invalid, page, range));
+                DJV_ASSERT(!cache.contains(invalid));
                 
                 {
                     std::stringstream ss;
@@ -63,6 +73,104 @@ namespace djv
                     _print(_getText(ss.str()) + " percentage used: " + ss2.str());
                 }
             }
+
+            const VBOType type = VBOType::Pos3_F32;
+            const auto data = VBO::convert(mesh, type);
+            const size_t size = mesh.v.size();
+
+            {
+                // Test adding pages and evicting the least recently used
+                // meshes that are not acquired.
+                MeshCache cache(size * 2, type, 2);
+                size_t page = 0;
+                Math::SizeTRange range;
+                const UID uid0 = cache.add(data, page, range);
+                DJV_ASSERT(0 == page);
+                const UID uid1 = cache.add(data, page, range);
+                DJV_ASSERT(0 == page);
+                DJV_ASSERT(Math::SizeTRange(size, size * 2 - 1) == range);
+                const UID uid2 = cache.add(data, page, range);
+                DJV_ASSERT(1 == page);
+                DJV_ASSERT(2 == cache.getPageCount());
+                const UID uid3 = cache.add(data, page, range);
+                DJV_ASSERT(1 == page);
+                DJV_ASSERT(100.F == cache.getPercentageUsed());
+                DJV_ASSERT(0 == cache.getEvictionCount());
+
+                cache.acquire(uid0);
+                const UID uid4 = cache.add(data, page, range);
+                DJV_ASSERT(uid4);
+                DJV_ASSERT(0 == page);
+                DJV_ASSERT(1 == cache.getEvictionCount());
+                DJV_ASSERT(!cache.get(uid1, page, range));
+                DJV_ASSERT(cache.get(uid0, page, range));
+
+                DJV_ASSERT(cache.get(uid2, page, range));
+                DJV_ASSERT(cache.add(data, page, range));
+                DJV_ASSERT(1 == page);
+                DJV_ASSERT(!cache.get(uid3, page, range));
+                DJV_ASSERT(cache.get(uid2, page, range));
+                DJV_ASSERT(cache.get(uid4, page, range));
+                cache.release(uid0);
+
+                DJV_ASSERT(!cache.add(std::vector<uint8_t>(data.size() * 3), page, range));
+            }
+
+            {
+                // Test that free space is merged before evicting more meshes.
+                MeshCache cache(size * 4, type);
+                size_t page = 0;
+                Math::SizeTRange range;
+                const UID uid0 = cache.add(data, page, range);
+                const UID uid1 = cache.add(data, page, range);
+                const UID uid2 = cache.add(data, page, range);
+                const UID uid3 = cache.add(data, page, range);
+                DJV_ASSERT(cache.get(uid0, page, range));
+                DJV_ASSERT(cache.get(uid2, page, range));
+                DJV_ASSERT(0 == cache.defragment(size));
+
+                std::vector<uint8_t> data2 = data;
+                data2.insert(data2.end(), data.begin(), data.end());
+                DJV_ASSERT(cache.add(data2, page, range));
+                DJV_ASSERT(Math::SizeTRange(size * 2, size * 4 - 1) == range);
+                DJV_ASSERT(2 == cache.getEvictionCount());
+                DJV_ASSERT(!cache.get(uid1, page, range));
+                DJV_ASSERT(!cache.get(uid3, page, range));
+                DJV_ASSERT(cache.get(uid0, page, range));
+                DJV_ASSERT(Math::SizeTRange(0, size - 1) == range);
+                DJV_ASSERT(cache.get(uid2, page, range));
+                DJV_ASSERT(Math::SizeTRange(size, size * 2 - 1) == range);
+                DJV_ASSERT(0.F == cache.getFragmentation());
+            }
+
+            {
+                // Test that reducing the maximum page count evicts the meshes
+                // in the pages above the maximum, except those in use.
+                MeshCache cache(size * 2, type, 3);
+                size_t page = 0;
+                Math::SizeTRange range;
+                std::vector<UID> uids;
+                for (size_t i = 0; i < 6; ++i)
+                {
+                    uids.push_back(cache.add(data, page, range));
+                }
+                DJV_ASSERT(3 == cache.getPageCount());
+                cache.acquire(uids[5]);
+                cache.setPageCountMax(1);
+                DJV_ASSERT(1 == cache.getPageCountMax());
+                DJV_ASSERT(3 == cache.getEvictionCount());
+                DJV_ASSERT(cache.get(uids[0], page, range));
+                DJV_ASSERT(!cache.get(uids[2], page, range));
+                DJV_ASSERT(cache.get(uids[5], page, range));
+                DJV_ASSERT(2 == page);
+                DJV_ASSERT(cache.add(data, page, range));
+                DJV_ASSERT(0 == page);
+
+                cache.release(uids[5]);
+                cache.defragment(0);
+                DJV_ASSERT(1 == cache.getPageCount());
+                DJV_ASSERT(!cache.get(uids[5], page, range));
+            }
         }
 
     } // namespace GLTest
@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvGLTest/PixelBufferRingTest.h>
+
+#include <djvGL/PixelBufferRing.h>
+#include <djvGL/Texture.h>
+
+#include <cstring>
+
+using namespace djv::Core;
+using namespace djv::GL;
+
+namespace djv
+{
+    namespace GLTest
+    {
+        PixelBufferRingTest::PixelBufferRingTest(
+            const System::File::Path& tempPath,
+            const std::shared_ptr<System::Context>& context) :
+            ITest("djv::GLTest::PixelBufferRingTest", tempPath, context)
+        {}
+        
+        void PixelBufferRingTest::run()
+        {
+            auto ring = PixelBufferRing::create(2);
+#if !defined(DJV_GL_ES2)
+            DJV_ASSERT(2 == ring->getCount());
+#endif // DJV_GL_ES2
+            DJV_ASSERT(0 == ring->getByteCount());
+            
+            // The last image is large enough to be copied by the worker
+            // threads.
+            const std::vector<Image::Info> infos =
+            {
+                Image::Info(64, 64, Image::Type::L_U8),
+                Image::Info(64, 64, Image::Type::RGBA_F16),
+                Image::Info(64, 64, Image::Type::RGB_F32),
+                Image::Info(2048, 2048, Image::Type::RGBA_F16)
+            };
+            for (const auto& info : infos)
+            {
+                auto texture = Texture::create(info);
+                auto data = Image::Data::create(info);
+                for (size_t i = 0; i < 3; ++i)
+                {
+                    uint8_t* p = data->getData();
+                    for (size_t j = 0; j < data->getDataByteCount(); ++j)
+                    {
+                        p[j] = static_cast<uint8_t>((j * 13 + i) % 251);
+                    }
+                    ring->copy(*data, *texture);
+#if !defined(DJV_GL_ES2)
+                    std::vector<uint8_t> result(data->getDataByteCount());
+                    texture->bind();
+                    glPixelStorei(GL_PACK_ALIGNMENT, info.layout.alignment);
+                    glGetTexImage(GL_TEXTURE_2D, 0, info.getGLFormat(), info.getGLType(), result.data());
+                    DJV_ASSERT(0 == memcmp(result.data(), data->getData(), result.size()));
+#endif // DJV_GL_ES2
+                }
+#if !defined(DJV_GL_ES2)
+                DJV_ASSERT(ring->getByteCount() >= data->getDataByteCount());
+#endif // DJV_GL_ES2
+            }
+        }
+
+    } // namespace GLTest
+} // namespace djv
@@ -0,0 +1,160 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvGeomTest/IndexedTriangleMeshFuncTest.h>
+
+#include <djvGeom/IndexedTriangleMeshFunc.h>
+
+#include <djvCore/MemoryFunc.h>
+
+#include <glm/geometric.hpp>
+
+#include <map>
+
+using namespace djv::Core;
+using namespace djv::Geom;
+
+namespace djv
+{
+    namespace GeomTest
+    {
+        IndexedTriangleMeshFuncTest::IndexedTriangleMeshFuncTest(
+            const System::File::Path& tempPath,
+            const std::shared_ptr<System::Context>& context) :
+            ITest("djv::GeomTest::IndexedTriangleMeshFuncTest", tempPath, context)
+        {}
+
+        namespace
+        {
+            //! Create a unit grid in the XY plane. The left and right halves
+            //! have separate vertices with different texture coordinates, so
+            //! the mesh has a seam down the middle.
+            void createGrid(size_t size, IndexedTriangleMesh& out)
+            {
+                const size_t half = size / 2;
+                for (size_t side = 0; side < 2; ++side)
+                {
+                    const uint32_t offset = static_cast<uint32_t>(out.v.size());
+                    for (size_t y = 0; y <= size; ++y)
+                    {
+                        for (size_t x = 0; x <= half; ++x)
+                        {
+                            const float fx = (side * half + x) / static_cast<float>(size);
+                            const float fy = y / static_cast<float>(size);
+                            out.v.push_back(glm::vec3(fx, fy, 0.F));
+                            out.t.push_back(glm::vec2(static_cast<float>(side), fy));
+                            out.n.push_back(glm::vec3(0.F, 0.F, 1.F));
+                        }
+                    }
+                    for (size_t y = 0; y < size; ++y)
+                    {
+                        for (size_t x = 0; x < half; ++x)
+                        {
+                            const uint32_t i = offset + static_cast<uint32_t>(y * (half + 1) + x);
+                            const uint32_t row = static_cast<uint32_t>(half + 1);
+                            for (const auto j : { i, i + 1, i + row + 1, i, i + row + 1, i + row })
+                            {
+                                out.indices.push_back(j);
+                            }
+                        }
+                    }
+                }
+                out.bboxUpdate();
+            }
+
+            //! Get the length of the edges that are only used by one
+            //! triangle, with vertices at the same position merged.
+            float getBoundaryLength(const IndexedTriangleMesh& mesh)
+            {
+                std::map<std::pair<float, float>, size_t> positions;
+                std::vector<size_t> weld(mesh.v.size());
+                for (size_t i = 0; i < mesh.v.size(); ++i)
+                {
+                    const auto j = positions.insert(std::make_pair(
+                        std::make_pair(mesh.v[i].x, mesh.v[i].y),
+                        positions.size()));
+                    weld[i] = j.first->second;
+                }
+                std::map<std::pair<size_t, size_t>, size_t> edges;
+                std::map<std::pair<size_t, size_t>, float> lengths;
+                for (size_t i = 0; i < mesh.indices.size(); i += 3)
+                {
+                    for (size_t j = 0; j < 3; ++j)
+                    {
+                        const uint32_t a = mesh.indices[i + j];
+                        const uint32_t b = mesh.indices[i + (j + 1) % 3];
+                        const auto key = std::make_pair(
+                            std::min(weld[a], weld[b]),
+                            std::max(weld[a], weld[b]));
+                        ++edges[key];
+                        lengths[key] = glm::distance(mesh.v[a], mesh.v[b]);
+                    }
+                }
+                float out = 0.F;
+                for (const auto& i : edges)
+                {
+                    if (1 == i.second)
+                    {
+                        out += lengths[i.first];
+                    }
+                }
+                return out;
+            }
+
+        } // namespace
+
+        void IndexedTriangleMeshFuncTest::run()
+        {
+            {
+                IndexedTriangleMesh mesh;
+                IndexedTriangleMesh out;
+                simplify(mesh, 0, out);
+                DJV_ASSERT(0 == out.getTriangleCount());
+            }
+
+            {
+                IndexedTriangleMesh mesh;
+                createGrid(16, mesh);
+                DJV_ASSERT(512 == mesh.getTriangleCount());
+                IndexedTriangleMesh out;
+                simplify(mesh, mesh.getTriangleCount(), out);
+                DJV_ASSERT(512 == out.getTriangleCount());
+                DJV_ASSERT(mesh.v.size() == out.v.size());
+            }
+
+            for (const size_t triangleCount : { 256, 128, 32 })
+            {
+                IndexedTriangleMesh mesh;
+                createGrid(16, mesh);
+                IndexedTriangleMesh out;
+                simplify(mesh, triangleCount, out);
+                {
+                    std::stringstream ss;
+                    ss << "Simplify " << mesh.getTriangleCount() << " to " << triangleCount << ": " <<
+                        out.getTriangleCount() << " triangles, " << out.getVertexCount() << " vertices";
+                    _print(ss.str());
+                }
+                DJV_ASSERT(out.getTriangleCount() > 0);
+                DJV_ASSERT(out.getTriangleCount() <= triangleCount);
+                DJV_ASSERT(out.t.size() == out.v.size());
+                DJV_ASSERT(out.n.size() == out.v.size());
+                for (const auto i : out.indices)
+                {
+                    DJV_ASSERT(i < out.v.size());
+                }
+                for (const auto& i : out.v)
+                {
+                    DJV_ASSERT(0.F == i.z);
+                }
+
+                // The seam should stay closed and the outline should be
+                // preserved.
+                DJV_ASSERT(std::abs(getBoundaryLength(out) - 4.F) < .001F);
+                DJV_ASSERT(glm::distance(out.bbox.min, mesh.bbox.min) < .001F);
+                DJV_ASSERT(glm::distance(out.bbox.max, mesh.bbox.max) < .001F);
+            }
+        }
+
+    } // namespace GeomTest
+} // namespace djv
@@ -0,0 +1,96 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvGeomTest/IndexedTriangleMeshTest.h>
+
+#include <djvGeom/IndexedTriangleMesh.h>
+#include <djvGeom/TriangleMesh.h>
+#include <djvGeom/TriangleMeshFunc.h>
+
+#include <djvMath/VectorFunc.h>
+
+using namespace djv::Core;
+using namespace djv::Geom;
+
+namespace djv
+{
+    namespace GeomTest
+    {
+        IndexedTriangleMeshTest::IndexedTriangleMeshTest(
+            const System::File::Path& tempPath,
+            const std::shared_ptr<System::Context>& context) :
+            ITest("djv::GeomTest::IndexedTriangleMeshTest", tempPath, context)
+        {}
+        
+        void IndexedTriangleMeshTest::run()
+        {
+            {
+                IndexedTriangleMesh mesh;
+                std::stringstream ss;
+                ss << mesh.getUID();
+                _print("UID: " + ss.str());
+            }
+            
+            {
+                IndexedTriangleMesh mesh;
+                DJV_ASSERT(0 == mesh.getVertexCount());
+                DJV_ASSERT(0 == mesh.getTriangleCount());
+                mesh.v.push_back(glm::vec3());
+                mesh.c.push_back(glm::vec3());
+                mesh.t.push_back(glm::vec2());
+                mesh.n.push_back(glm::vec3());
+                mesh.indices.push_back(0);
+                mesh.indices.push_back(0);
+                mesh.indices.push_back(0);
+                DJV_ASSERT(1 == mesh.getVertexCount());
+                DJV_ASSERT(1 == mesh.getTriangleCount());
+                DJV_ASSERT(mesh.getByteCount() > 0);
+                mesh.clear();
+                DJV_ASSERT(0 == mesh.v.size());
+                DJV_ASSERT(0 == mesh.c.size());
+                DJV_ASSERT(0 == mesh.t.size());
+                DJV_ASSERT(0 == mesh.n.size());
+                DJV_ASSERT(0 == mesh.indices.size());
+            }
+            
+            {
+                IndexedTriangleMesh mesh;
+                mesh.v.push_back(glm::vec3(0.F, 1.F, 2.F));
+                mesh.v.push_back(glm::vec3(3.F, 4.F, 5.F));
+                mesh.bboxUpdate();
+                DJV_ASSERT(mesh.bbox == Math::BBox3f(0.F, 1.F, 2.F, 3.F, 4.F, 5.F));
+            }
+            
+            {
+                // Two triangles sharing an edge should use four vertices.
+                TriangleMesh mesh;
+                mesh.v.push_back(glm::vec3(0.F, 0.F, 0.F));
+                mesh.v.push_back(glm::vec3(1.F, 0.F, 0.F));
+                mesh.v.push_back(glm::vec3(1.F, 1.F, 0.F));
+                mesh.v.push_back(glm::vec3(0.F, 1.F, 0.F));
+                TriangleMesh::Triangle triangle;
+                triangle.v0 = TriangleMesh::Vertex(1);
+                triangle.v1 = TriangleMesh::Vertex(2);
+                triangle.v2 = TriangleMesh::Vertex(3);
+                mesh.triangles.push_back(triangle);
+                triangle.v0 = TriangleMesh::Vertex(1);
+                triangle.v1 = TriangleMesh::Vertex(3);
+                triangle.v2 = TriangleMesh::Vertex(4);
+                mesh.triangles.push_back(triangle);
+                IndexedTriangleMesh indexedMesh;
+                toIndexedMesh(mesh, indexedMesh);
+                DJV_ASSERT(4 == indexedMesh.getVertexCount());
+                DJV_ASSERT(2 == indexedMesh.getTriangleCount());
+                DJV_ASSERT(6 == indexedMesh.indices.size());
+                DJV_ASSERT(0 == indexedMesh.t.size());
+                DJV_ASSERT(0 == indexedMesh.n.size());
+                DJV_ASSERT(indexedMesh.indices[0] == indexedMesh.indices[3]);
+                DJV_ASSERT(indexedMesh.indices[2] == indexedMesh.indices[4]);
+                DJV_ASSERT(indexedMesh.bbox == Math::BBox3f(0.F, 0.F, 0.F, 1.F, 1.F, 0.F));
+                DJV_ASSERT(indexedMesh.getByteCount() < mesh.getByteCount());
+            }
+        }
+        
+    } // namespace GeomTest
+} // namespace djv
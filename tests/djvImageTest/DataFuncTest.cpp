@@ -24,6 +24,7 @@ namespace djv
         void DataFuncTest::run()
         {
             _util();
+            _pack();
         }
         
         void DataFuncTest::_util()
@@ -122,6 +123,39 @@ namespace djv
                 }
             }
         }
+
+        void DataFuncTest::_pack()
+        {
+            {
+                auto data = Image::Data::create(Image::Info(3, 2, Image::Type::RGBA_U8));
+                for (size_t i = 0; i < data->getDataByteCount(); ++i)
+                {
+                    data->getData()[i] = static_cast<uint8_t>(i);
+                }
+                std::vector<uint8_t> packed(Image::getPackedByteCount(data->getInfo()));
+                Image::pack(data, packed.data());
+                auto owner = std::make_shared<int>(0);
+                auto unpacked = Image::unpack(packed.data(), packed.size(), owner);
+                DJV_ASSERT(unpacked);
+                DJV_ASSERT(unpacked->getInfo() == data->getInfo());
+                DJV_ASSERT(*unpacked == *data);
+                DJV_ASSERT(unpacked->getData() != data->getData());
+                const Image::Data& constUnpacked = *unpacked;
+                DJV_ASSERT(unpacked->getData() == constUnpacked.getData());
+                DJV_ASSERT(unpacked->getData(1) == constUnpacked.getData(1));
+                DJV_ASSERT(unpacked->getData(2, 1) == constUnpacked.getData(2, 1));
+                DJV_ASSERT(*unpacked->getData(2, 1) == *data->getData(2, 1));
+                DJV_ASSERT(Image::getAverageColor(unpacked) == Image::getAverageColor(data));
+                DJV_ASSERT(owner.use_count() == 2);
+                unpacked.reset();
+                DJV_ASSERT(owner.use_count() == 1);
+            }
+
+            {
+                const uint8_t packed[] = { 0, 1, 2, 3 };
+                DJV_ASSERT(!Image::unpack(packed, sizeof(packed), nullptr));
+            }
+        }
         
     } // namespace ImageTest
 } // namespace djv
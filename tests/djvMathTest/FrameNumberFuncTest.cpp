@@ -24,10 +24,33 @@ namespace djv
         
         void FrameNumberFuncTest::run()
         {
+            _util();
             _conversion();
             _serialize();
         }
         
+        void FrameNumberFuncTest::_util()
+        {
+            {
+                DJV_ASSERT(!Frame::getMissing(Frame::Sequence()).isValid());
+                DJV_ASSERT(!Frame::getMissing(Frame::Sequence(Frame::Range(1, 10))).isValid());
+            }
+            
+            {
+                const Frame::Sequence sequence({ Frame::Range(1, 3), Frame::Range(5, 5), Frame::Range(8, 10) }, 4);
+                const auto missing = Frame::getMissing(sequence);
+                {
+                    std::stringstream ss;
+                    ss << missing;
+                    _print("Missing: " + ss.str());
+                }
+                DJV_ASSERT(2 == missing.getRanges().size());
+                DJV_ASSERT(Frame::Range(4, 4) == missing.getRanges()[0]);
+                DJV_ASSERT(Frame::Range(6, 7) == missing.getRanges()[1]);
+                DJV_ASSERT(4 == missing.getPad());
+            }
+        }
+        
         void FrameNumberFuncTest::_conversion()
         {
             {
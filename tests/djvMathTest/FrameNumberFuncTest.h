@@ -20,6 +20,7 @@ namespace djv
             void run() override;
             
         private:
+            void _util();
             void _conversion();
             void _serialize();
         };
@@ -89,6 +89,33 @@ namespace djv
                 sequence.add(Frame::Range(12, 100));
                 DJV_ASSERT(sequence.getRanges()[0] == Frame::Range(1, 10));
             }
+
+            {
+                Frame::Sequence sequence;
+                for (Frame::Number i = 0; i < 1000; i += 2)
+                {
+                    sequence.add(Frame::Range(i));
+                }
+                DJV_ASSERT(500 == sequence.getRanges().size());
+                DJV_ASSERT(500 == sequence.getFrameCount());
+                DJV_ASSERT(499 == sequence.getLastIndex());
+                for (Frame::Index i = 0; i < 500; ++i)
+                {
+                    DJV_ASSERT(i * 2 == sequence.getFrame(i));
+                    DJV_ASSERT(i == sequence.getIndex(i * 2));
+                    DJV_ASSERT(sequence.contains(i * 2));
+                    DJV_ASSERT(!sequence.contains(i * 2 + 1));
+                    DJV_ASSERT(Frame::invalidIndex == sequence.getIndex(i * 2 + 1));
+                }
+                DJV_ASSERT(Frame::invalid == sequence.getFrame(-1));
+                DJV_ASSERT(Frame::invalid == sequence.getFrame(500));
+
+                sequence.add(Frame::Range(1, 997));
+                DJV_ASSERT(1 == sequence.getRanges().size());
+                DJV_ASSERT(sequence.getRanges()[0] == Frame::Range(0, 998));
+                DJV_ASSERT(999 == sequence.getFrameCount());
+                DJV_ASSERT(998 == sequence.getIndex(998));
+            }
         }
                 
         void FrameNumberTest::_operators()
@@ -0,0 +1,203 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+#include <djvOCIOTest/CPUProcessorTest.h>
+
+#include <djvOCIO/CPUProcessor.h>
+#include <djvOCIO/CPUProcessorFunc.h>
+
+#include <djvImage/Data.h>
+
+#include <djvMath/MathFunc.h>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+using namespace djv::Core;
+using namespace djv::OCIO;
+namespace _OCIO = OCIO_NAMESPACE;
+
+namespace djv
+{
+    namespace OCIOTest
+    {
+        CPUProcessorTest::CPUProcessorTest(
+            const System::File::Path& tempPath,
+            const std::shared_ptr<System::Context>& context) :
+            ITest("djv::OCIOTest::CPUProcessorTest", tempPath, context)
+        {}
+        
+        void CPUProcessorTest::run()
+        {
+            _options();
+            _lut3D();
+            _process();
+        }
+
+        void CPUProcessorTest::_options()
+        {
+            auto processor = CPUProcessor::create();
+            DJV_ASSERT(processor->getThreadCount() > 0);
+            DJV_ASSERT(processor->hasLUT3D());
+            DJV_ASSERT(cpuLUT3DSizeDefault == processor->getLUT3DSize());
+            DJV_ASSERT(cpuProcessorCacheMaxDefault == processor->getCacheMax());
+            DJV_ASSERT(0 == processor->getCacheSize());
+
+            processor->setThreadCount(0);
+            DJV_ASSERT(1 == processor->getThreadCount());
+            processor->setLUT3D(false);
+            DJV_ASSERT(!processor->hasLUT3D());
+            processor->setLUT3DSize(17);
+            DJV_ASSERT(17 == processor->getLUT3DSize());
+            processor->setCacheMax(2);
+            DJV_ASSERT(2 == processor->getCacheMax());
+        }
+
+        void CPUProcessorTest::_lut3D()
+        {
+            {
+                // Test each of the tetrahedra with a 2x2x2 LUT where the
+                // corner values are not a linear function of the input.
+                std::vector<float> lut;
+                for (size_t b = 0; b < 2; ++b)
+                {
+                    for (size_t g = 0; g < 2; ++g)
+                    {
+                        for (size_t r = 0; r < 2; ++r)
+                        {
+                            const int k = static_cast<int>(r + g * 2 + b * 4);
+                            lut.push_back(static_cast<float>(k * k));
+                            lut.push_back(static_cast<float>((7 - k) * (7 - k)));
+                            lut.push_back(static_cast<float>(k % 3));
+                        }
+                    }
+                }
+                const struct
+                {
+                    float in[4];
+                    float out[4];
+                }
+                data[] =
+                {
+                    { {  .75F,  .5F,  .25F,  .1F }, { 14.75F, 25.25F,  .5F,  .1F } },
+                    { {  .75F,  .25F, .5F,   .2F }, { 18.75F, 22.25F, 1.F,   .2F } },
+                    { {  .5F,   .25F, .75F,  .3F }, { 22.5F,  15.5F,  1.F,   .3F } },
+                    { {  .25F,  .5F,  .75F,  .4F }, { 25.25F, 14.75F,  .5F,  .4F } },
+                    { {  .25F,  .75F, .5F,   .5F }, { 22.25F, 18.75F,  .75F, .5F } },
+                    { {  .5F,   .75F, .25F,  .6F }, { 15.5F,  22.5F,   .75F, .6F } },
+                    { { -1.F,  2.F,   .5F,   .7F }, { 20.F,   13.F,   1.F,   .7F } },
+                    { { 0.F,   0.F,   0.F,   .8F }, { 0.F,    49.F,   0.F,   .8F } },
+                    { { 1.F,   1.F,   1.F,   .9F }, { 49.F,   0.F,    1.F,   .9F } }
+                };
+                for (const auto& i : data)
+                {
+                    float rgb[3] = { i.in[0], i.in[1], i.in[2] };
+                    applyLUT3D(rgb, 1, 3, lut.data(), 2);
+                    float rgba[4] = { i.in[0], i.in[1], i.in[2], i.in[3] };
+                    applyLUT3D(rgba, 1, 4, lut.data(), 2);
+                    for (size_t c = 0; c < 3; ++c)
+                    {
+                        DJV_ASSERT(fuzzyCompare(i.out[c], rgb[c], .0001F));
+                        DJV_ASSERT(fuzzyCompare(i.out[c], rgba[c], .0001F));
+                    }
+                    DJV_ASSERT(i.out[3] == rgba[3]);
+                }
+            }
+
+            {
+                // Tetrahedral interpolation is exact for linear functions,
+                // so a larger LUT sampled from one reproduces it everywhere.
+                const size_t size = 5;
+                std::vector<float> lut;
+                for (size_t b = 0; b < size; ++b)
+                {
+                    for (size_t g = 0; g < size; ++g)
+                    {
+                        for (size_t r = 0; r < size; ++r)
+                        {
+                            const float rf = r / static_cast<float>(size - 1);
+                            const float gf = g / static_cast<float>(size - 1);
+                            const float bf = b / static_cast<float>(size - 1);
+                            lut.push_back(gf);
+                            lut.push_back(bf * .5F + .25F);
+                            lut.push_back(1.F - rf);
+                        }
+                    }
+                }
+                std::vector<float> pixels;
+                for (size_t i = 0; i < 100; ++i)
+                {
+                    pixels.push_back((i % 7) / 6.F);
+                    pixels.push_back((i % 11) / 10.F);
+                    pixels.push_back((i % 13) / 12.F);
+                }
+                const std::vector<float> in = pixels;
+                applyLUT3D(pixels.data(), 100, 3, lut.data(), size);
+                for (size_t i = 0; i < 100; ++i)
+                {
+                    const float* p = in.data() + i * 3;
+                    const float* q = pixels.data() + i * 3;
+                    DJV_ASSERT(fuzzyCompare(p[1], q[0], .0001F));
+                    DJV_ASSERT(fuzzyCompare(p[2] * .5F + .25F, q[1], .0001F));
+                    DJV_ASSERT(fuzzyCompare(1.F - p[0], q[2], .0001F));
+                }
+            }
+        }
+
+        void CPUProcessorTest::_process()
+        {
+            // Convert between the same color space so the output can be
+            // compared with the input.
+            auto config = _OCIO::GetCurrentConfig();
+            if (config && config->getNumColorSpaces() > 0)
+            {
+                const std::string colorSpace = config->getColorSpaceNameByIndex(0);
+                const Convert convert(colorSpace, colorSpace);
+                for (size_t threadCount : { 1, 3, 16 })
+                {
+                    auto processor = CPUProcessor::create();
+                    processor->setThreadCount(threadCount);
+
+                    {
+                        auto data = Image::Data::create(Image::Info(3, 5, Image::Type::L_U8));
+                        for (size_t i = 0; i < data->getDataByteCount(); ++i)
+                        {
+                            data->getData()[i] = static_cast<uint8_t>(i * 10);
+                        }
+                        auto out = processor->process(data, convert);
+                        DJV_ASSERT(Image::Type::RGB_U8 == out->getType());
+                        DJV_ASSERT(data->getSize() == out->getSize());
+                        for (uint16_t y = 0; y < 5; ++y)
+                        {
+                            for (uint16_t x = 0; x < 3; ++x)
+                            {
+                                const uint8_t* p = out->getData(x, y);
+                                DJV_ASSERT(p[0] == *data->getData(x, y));
+                                DJV_ASSERT(p[1] == *data->getData(x, y));
+                                DJV_ASSERT(p[2] == *data->getData(x, y));
+                            }
+                        }
+                        DJV_ASSERT(1 == processor->getCacheSize());
+                    }
+
+                    {
+                        auto data = Image::Data::create(Image::Info(4, 3, Image::Type::RGBA_F32));
+                        float* p = reinterpret_cast<float*>(data->getData());
+                        for (size_t i = 0; i < 4 * 3 * 4; ++i)
+                        {
+                            p[i] = i / 10.F;
+                        }
+                        auto out = processor->process(data, convert);
+                        DJV_ASSERT(Image::Type::RGBA_F32 == out->getType());
+                        DJV_ASSERT(*out == *data);
+                    }
+
+                    processor->clearCache();
+                    DJV_ASSERT(0 == processor->getCacheSize());
+                }
+            }
+        }
+
+    } // namespace OCIOTest
+} // namespace djv
+
@@ -205,6 +205,33 @@ namespace djv
                     _print(ss.str());
                 }
                 
+                {
+                    Font::Metrics cachedMetrics;
+                    DJV_ASSERT(system->getCachedMetrics(fontInfo, cachedMetrics));
+                    DJV_ASSERT(metrics.lineHeight == cachedMetrics.lineHeight);
+                    glm::vec2 cachedSize = glm::vec2(0.F, 0.F);
+                    DJV_ASSERT(system->getCachedSize(text, fontInfo, 0, cachedSize));
+                    DJV_ASSERT(measure == cachedSize);
+                    DJV_ASSERT(!system->getCachedSize(text, fontInfo, 1, cachedSize));
+                    std::vector<std::shared_ptr<Font::Glyph> > cachedGlyphs;
+                    DJV_ASSERT(system->getCachedGlyphs(text, fontInfo, 0, cachedGlyphs));
+                    DJV_ASSERT(glyphs == cachedGlyphs);
+                    std::vector<Font::TextLine> cachedTextLines;
+                    DJV_ASSERT(system->getCachedTextLines(text, 100, fontInfo, cachedTextLines));
+                    DJV_ASSERT(textLines.size() == cachedTextLines.size());
+                    measureFuture = system->measure(text, fontInfo);
+                    DJV_ASSERT(measureFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+                    DJV_ASSERT(measure == measureFuture.get());
+                }
+                {
+                    std::stringstream ss;
+                    ss << "Text cache size: " << system->getTextCacheSize();
+                    _print(ss.str());
+                }
+                DJV_ASSERT(system->getTextCacheSize() > 0);
+                system->setLCDRendering(false);
+                DJV_ASSERT(0 == system->getTextCacheSize());
+
                 system->setLCDRendering(true);
                 system->setLCDRendering(true);
                 const uint16_t elide = text.size() / 2;
@@ -0,0 +1,165 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvRender2DTest/ImageSamplerTest.h>
+
+#include <djvRender2D/ImageSampler.h>
+
+#include <djvImage/Data.h>
+
+#include <djvMath/MathFunc.h>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include <cstring>
+
+using namespace djv::Core;
+using namespace djv::Render2D;
+namespace _OCIO = OCIO_NAMESPACE;
+
+namespace djv
+{
+    namespace Render2DTest
+    {
+        namespace
+        {
+            //! Create an image where the left half is black and the right
+            //! half is white.
+            std::shared_ptr<Image::Data> createImage(Image::Type type, const Image::Layout& layout = Image::Layout())
+            {
+                const Image::Info info(4, 2, type, layout);
+                auto out = Image::Data::create(info);
+                const size_t pixelByteCount = out->getPixelByteCount();
+                for (uint16_t y = 0; y < info.size.h; ++y)
+                {
+                    for (uint16_t x = 0; x < info.size.w; ++x)
+                    {
+                        Image::Color color(x < info.size.w / 2 ? 0.F : 1.F);
+                        color = color.convert(type);
+                        memcpy(out->getData(x, y), color.getData(), pixelByteCount);
+                    }
+                }
+                return out;
+            }
+
+        } // namespace
+
+        ImageSamplerTest::ImageSamplerTest(
+            const System::File::Path& tempPath,
+            const std::shared_ptr<System::Context>& context) :
+            ITest("djv::Render2DTest::ImageSamplerTest", tempPath, context)
+        {}
+        
+        void ImageSamplerTest::run()
+        {
+            _average();
+            _mirror();
+            _channels();
+            _colorSpace();
+        }
+        
+        void ImageSamplerTest::_average()
+        {
+            auto sampler = ImageSampler::create();
+            {
+                const auto color = sampler->sample(nullptr, Math::BBox2i(0, 0, 1, 1));
+                DJV_ASSERT(Image::Type::None == color.getType());
+            }
+            for (const auto type : { Image::Type::L_U8, Image::Type::RGB_U16, Image::Type::RGBA_F32 })
+            {
+                auto image = createImage(type);
+                {
+                    const auto color = sampler->sample(image, Math::BBox2i(0, 0, 4, 2), ImageOptions(), Image::Type::L_F32);
+                    DJV_ASSERT(fuzzyCompare(color.getF32(0), .5F));
+                }
+                {
+                    const auto color = sampler->sample(image, Math::BBox2i(2, 0, 2, 2), ImageOptions(), Image::Type::L_F32);
+                    DJV_ASSERT(fuzzyCompare(color.getF32(0), 1.F));
+                }
+                {
+                    const auto color = sampler->sample(image, Math::BBox2i(-10, -10, 11, 11), ImageOptions(), Image::Type::L_F32);
+                    DJV_ASSERT(fuzzyCompare(color.getF32(0), 0.F));
+                }
+                {
+                    const auto color = sampler->sample(image, Math::BBox2i(0, 0, 1, 1));
+                    DJV_ASSERT(type == color.getType());
+                }
+            }
+        }
+        
+        void ImageSamplerTest::_mirror()
+        {
+            auto sampler = ImageSampler::create();
+            auto image = createImage(Image::Type::L_U8);
+            ImageOptions options;
+            options.mirror.x = true;
+            {
+                const auto color = sampler->sample(image, Math::BBox2i(0, 0, 2, 2), options, Image::Type::L_F32);
+                DJV_ASSERT(fuzzyCompare(color.getF32(0), 1.F));
+            }
+            image = createImage(Image::Type::L_U8, Image::Layout(Image::Mirror(true, false)));
+            {
+                const auto color = sampler->sample(image, Math::BBox2i(0, 0, 2, 2), options, Image::Type::L_F32);
+                DJV_ASSERT(fuzzyCompare(color.getF32(0), 0.F));
+            }
+        }
+        
+        void ImageSamplerTest::_channels()
+        {
+            auto sampler = ImageSampler::create();
+            auto image = createImage(Image::Type::RGBA_F32);
+            ImageOptions options;
+            options.channelsDisplay = ImageChannelsDisplay::Alpha;
+            {
+                const auto color = sampler->sample(image, Math::BBox2i(0, 0, 2, 2), options, Image::Type::RGB_F32);
+                DJV_ASSERT(fuzzyCompare(color.getF32(0), 1.F));
+            }
+            options.channelsDisplay = ImageChannelsDisplay::Color;
+            options.colorEnabled = true;
+            options.color.invert = true;
+            {
+                const auto color = sampler->sample(image, Math::BBox2i(0, 0, 2, 2), options, Image::Type::RGB_F32);
+                DJV_ASSERT(fuzzyCompare(color.getF32(0), 1.F));
+            }
+        }
+        
+        void ImageSamplerTest::_colorSpace()
+        {
+            // Images that wrap memory they do not own, like memory mapped
+            // files, only provide const access to the data.
+            auto image = createImage(Image::Type::RGBA_F32);
+            auto buf = std::make_shared<std::vector<uint8_t> >(image->getData(), image->getData() + image->getDataByteCount());
+            auto wrapped = Image::Data::create(image->getInfo(), buf->data(), buf);
+
+            auto sampler = ImageSampler::create();
+            ImageOptions options;
+            {
+                const auto color = sampler->sample(wrapped, Math::BBox2i(0, 0, 4, 2), options, Image::Type::L_F32);
+                DJV_ASSERT(fuzzyCompare(color.getF32(0), .5F));
+            }
+
+            // Convert between the same color space so the result is the
+            // same as without a conversion.
+            auto config = _OCIO::GetCurrentConfig();
+            if (config && config->getNumColorSpaces() > 0)
+            {
+                const std::string colorSpace = config->getColorSpaceNameByIndex(0);
+                options.colorSpace = OCIO::Convert(colorSpace, colorSpace);
+                for (const auto& i : { image, wrapped })
+                {
+                    {
+                        const auto color = sampler->sample(i, Math::BBox2i(0, 0, 4, 2), options, Image::Type::L_F32);
+                        DJV_ASSERT(fuzzyCompare(color.getF32(0), .5F));
+                    }
+                    {
+                        const auto color = sampler->sample(i, Math::BBox2i(2, 0, 2, 2), options, Image::Type::L_F32);
+                        DJV_ASSERT(fuzzyCompare(color.getF32(0), 1.F));
+                    }
+                }
+            }
+        }
+        
+    } // namespace Render2DTest
+} // namespace djv
+
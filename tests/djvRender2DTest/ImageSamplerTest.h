@@ -0,0 +1,29 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvTestLib/Test.h>
+
+namespace djv
+{
+    namespace Render2DTest
+    {
+        class ImageSamplerTest : public Test::ITest
+        {
+        public:
+            ImageSamplerTest(
+                const System::File::Path& tempPath,
+                const std::shared_ptr<System::Context>&);
+            
+            void run() override;
+            
+        private:
+            void _average();
+            void _mirror();
+            void _channels();
+            void _colorSpace();
+        };
+        
+    } // namespace Render2DTest
+} // namespace djv
+
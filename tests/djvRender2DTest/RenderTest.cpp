@@ -131,6 +131,13 @@ namespace djv
                     image = Image::Data::create(imageInfo);
                     render->drawImage(image, glm::vec2(200.f, 300.f), imageOptions);
                 }
+                imageOptions.cache = ImageCache::Tiled;
+                for (const auto& i : { Image::Mirror(), Image::Mirror(true, true) })
+                {
+                    image = Image::Data::create(Image::Info(imageTileSize * 2 + 1, imageTileSize + 1, Image::Type::L_U8, i));
+                    image->zero();
+                    render->drawImage(image, glm::vec2(-100.f, -100.f), imageOptions);
+                }
                 render->setFillColor(Image::Color(.6F, 1.F, .4F));
                 render->drawFilledImage(image, glm::vec2(400.f, 500.f));
                 
@@ -11,6 +11,7 @@
 
 #include <djvGL/OffscreenBuffer.h>
 
+#include <djvGeom/IndexedTriangleMesh.h>
 #include <djvGeom/PointList.h>
 #include <djvGeom/TriangleMeshFunc.h>
 
@@ -105,6 +106,16 @@ namespace djv
                 render->drawTriangleMesh(*mesh);
                 render->drawTriangleMeshes({ *mesh, *mesh });
                 render->drawTriangleMeshes({ mesh, mesh });
+
+                std::vector<InstanceData> instances(2);
+                instances[0].color = Image::Color(1.F, 1.F, 1.F);
+                instances[1].transform[3][0] = 100.F;
+                instances[1].color = Image::Color(1.F, 0.F, 0.F);
+                render->drawPointsInstanced({ pointList }, instances);
+                render->drawPointsInstanced({ pointList }, {});
+                render->drawPolyLinesInstanced({ pointList, pointList }, instances);
+                auto indexedMesh = std::shared_ptr<Geom::IndexedTriangleMesh>(new Geom::IndexedTriangleMesh);
+                render->drawTriangleMeshesInstanced({ indexedMesh }, instances);
                 
                 render->popTransform();
                 render->popTransform();
@@ -0,0 +1,210 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvScene3DTest/BVHTest.h>
+
+#include <djvScene3D/BVH.h>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <algorithm>
+#include <set>
+#include <sstream>
+
+using namespace djv::Core;
+using namespace djv::Scene3D;
+
+namespace djv
+{
+    namespace Scene3DTest
+    {
+        BVHTest::BVHTest(
+            const System::File::Path& tempPath,
+            const std::shared_ptr<System::Context>& context) :
+            ITest("djv::Scene3DTest::BVHTest", tempPath, context)
+        {}
+        
+        void BVHTest::run()
+        {
+            _frustum();
+            _build();
+            _cull();
+            _intersect();
+            _refit();
+        }
+
+        namespace
+        {
+            //! Create a grid of unit boxes centered on the origin.
+            std::vector<Math::BBox3f> getGrid(int size)
+            {
+                std::vector<Math::BBox3f> out;
+                for (int z = 0; z < size; ++z)
+                {
+                    for (int y = 0; y < size; ++y)
+                    {
+                        for (int x = 0; x < size; ++x)
+                        {
+                            const glm::vec3 min(
+                                (x - size / 2) * 2.F,
+                                (y - size / 2) * 2.F,
+                                (z - size / 2) * 2.F);
+                            out.push_back(Math::BBox3f(min, min + glm::vec3(1.F, 1.F, 1.F)));
+                        }
+                    }
+                }
+                return out;
+            }
+
+        } // namespace
+
+        void BVHTest::_frustum()
+        {
+            const Frustum frustum(glm::ortho(-1.F, 1.F, -1.F, 1.F, -1.F, 1.F));
+            DJV_ASSERT(frustum.intersects(Math::BBox3f(-.5F, -.5F, -.5F, 1.F, 1.F, 1.F)));
+            DJV_ASSERT(frustum.intersects(Math::BBox3f(.5F, .5F, .5F, 1.F, 1.F, 1.F)));
+            DJV_ASSERT(!frustum.intersects(Math::BBox3f(2.F, 0.F, 0.F, 1.F, 1.F, 1.F)));
+            DJV_ASSERT(!frustum.intersects(Math::BBox3f(0.F, -3.F, 0.F, 1.F, 1.F, 1.F)));
+            DJV_ASSERT(!frustum.intersects(Math::BBox3f(0.F, 0.F, 2.F, 1.F, 1.F, 1.F)));
+
+            // Flat boxes are handled.
+            DJV_ASSERT(frustum.intersects(Math::BBox3f(0.F, 0.F, 0.F, 1.F, 1.F, 0.F)));
+        }
+
+        void BVHTest::_build()
+        {
+            {
+                BVH bvh;
+                bvh.build({});
+                DJV_ASSERT(0 == bvh.getItemCount());
+                DJV_ASSERT(0 == bvh.getNodeCount());
+                std::vector<size_t> items;
+                bvh.cull(Frustum(glm::mat4x4(1.F)), items);
+                DJV_ASSERT(items.empty());
+            }
+            for (const int size : { 1, 4, 20 })
+            {
+                const auto bboxes = getGrid(size);
+                BVH bvh;
+                bvh.build(bboxes);
+                {
+                    std::stringstream ss;
+                    ss << "Items: " << bvh.getItemCount() << ", nodes: " << bvh.getNodeCount();
+                    _print(ss.str());
+                }
+                DJV_ASSERT(bboxes.size() == bvh.getItemCount());
+                DJV_ASSERT(bvh.getNodeCount() > 0);
+                DJV_ASSERT(bvh.getNodeCount() < bboxes.size() * 2);
+                Math::BBox3f bbox = bboxes[0];
+                for (const auto& i : bboxes)
+                {
+                    bbox.expand(i);
+                }
+                DJV_ASSERT(bbox == bvh.getBBox());
+                bvh.clear();
+                DJV_ASSERT(0 == bvh.getItemCount());
+            }
+        }
+
+        void BVHTest::_cull()
+        {
+            const auto bboxes = getGrid(20);
+            BVH bvh;
+            bvh.build(bboxes);
+
+            // Everything is visible.
+            std::vector<size_t> items;
+            bvh.cull(Frustum(glm::ortho(-100.F, 100.F, -100.F, 100.F, -100.F, 100.F)), items);
+            DJV_ASSERT(bboxes.size() == items.size());
+
+            // Some items are visible. Items outside of the frustum may be
+            // returned, but items inside of it may not be skipped.
+            items.clear();
+            const Frustum frustum(glm::ortho(-3.F, 3.F, -3.F, 3.F, -3.F, 3.F));
+            bvh.cull(frustum, items);
+            DJV_ASSERT(items.size() < bboxes.size());
+            const std::set<size_t> itemsSet(items.begin(), items.end());
+            DJV_ASSERT(itemsSet.size() == items.size());
+            for (size_t i = 0; i < bboxes.size(); ++i)
+            {
+                if (frustum.intersects(bboxes[i]))
+                {
+                    DJV_ASSERT(itemsSet.find(i) != itemsSet.end());
+                }
+            }
+
+            // Nothing is visible.
+            items.clear();
+            bvh.cull(Frustum(glm::ortho(500.F, 600.F, 500.F, 600.F, -1.F, 1.F)), items);
+            DJV_ASSERT(items.empty());
+        }
+
+        void BVHTest::_intersect()
+        {
+            const auto bboxes = getGrid(20);
+            BVH bvh;
+            bvh.build(bboxes);
+
+            // Find the closest item along a ray through a row of boxes.
+            const Math::Ray3f ray(glm::vec3(-100.F, .5F, .5F), glm::vec3(100.F, .5F, .5F));
+            size_t closest = bboxes.size();
+            std::set<size_t> visited;
+            bvh.intersect(
+                ray,
+                [&bboxes, &ray, &closest, &visited](size_t item, float& tMax)
+                {
+                    visited.insert(item);
+                    const float t = (bboxes[item].min.x - ray.start.x) / (ray.end.x - ray.start.x);
+                    if (t >= 0.F && t < tMax &&
+                        bboxes[item].min.y <= ray.start.y && bboxes[item].max.y >= ray.start.y &&
+                        bboxes[item].min.z <= ray.start.z && bboxes[item].max.z >= ray.start.z)
+                    {
+                        tMax = t;
+                        closest = item;
+                    }
+                });
+            DJV_ASSERT(closest < bboxes.size());
+            DJV_ASSERT(-20.F == bboxes[closest].min.x);
+            DJV_ASSERT(0.F == bboxes[closest].min.y);
+            DJV_ASSERT(0.F == bboxes[closest].min.z);
+            DJV_ASSERT(visited.size() < bboxes.size());
+
+            // Miss.
+            visited.clear();
+            bvh.intersect(
+                Math::Ray3f(glm::vec3(-100.F, 500.F, 0.F), glm::vec3(100.F, 500.F, 0.F)),
+                [&visited](size_t item, float&)
+                {
+                    visited.insert(item);
+                });
+            DJV_ASSERT(visited.empty());
+        }
+
+        void BVHTest::_refit()
+        {
+            auto bboxes = getGrid(10);
+            BVH bvh;
+            bvh.build(bboxes);
+            const size_t nodeCount = bvh.getNodeCount();
+
+            const glm::vec3 offset(100.F, 0.F, 0.F);
+            for (auto& i : bboxes)
+            {
+                i.min += offset;
+                i.max += offset;
+            }
+            bvh.refit(bboxes);
+            DJV_ASSERT(nodeCount == bvh.getNodeCount());
+            DJV_ASSERT(bvh.getBBox().min.x > 80.F);
+
+            std::vector<size_t> items;
+            bvh.cull(Frustum(glm::ortho(-10.F, 10.F, -10.F, 10.F, -10.F, 10.F)), items);
+            DJV_ASSERT(items.empty());
+            bvh.cull(Frustum(glm::ortho(90.F, 110.F, -10.F, 10.F, -10.F, 10.F)), items);
+            DJV_ASSERT(bboxes.size() == items.size());
+        }
+
+    } // namespace Scene3DTest
+} // namespace djv
+
@@ -0,0 +1,30 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvTestLib/Test.h>
+
+namespace djv
+{
+    namespace Scene3DTest
+    {
+        class BVHTest : public Test::ITest
+        {
+        public:
+            BVHTest(
+                const System::File::Path& tempPath,
+                const std::shared_ptr<System::Context>&);
+            
+            void run() override;
+
+        private:
+            void _frustum();
+            void _build();
+            void _cull();
+            void _intersect();
+            void _refit();
+        };
+        
+    } // namespace Scene3DTest
+} // namespace djv
+
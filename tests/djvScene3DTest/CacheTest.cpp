@@ -0,0 +1,294 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvScene3DTest/CacheTest.h>
+
+#include <djvScene3D/Cache.h>
+#include <djvScene3D/InstancePrimitive.h>
+#include <djvScene3D/LOD.h>
+#include <djvScene3D/Layer.h>
+#include <djvScene3D/Light.h>
+#include <djvScene3D/Material.h>
+#include <djvScene3D/MeshPrimitive.h>
+#include <djvScene3D/NullPrimitive.h>
+#include <djvScene3D/Scene.h>
+
+#include <djvSystem/FileIO.h>
+#include <djvSystem/FileInfo.h>
+#include <djvSystem/PathFunc.h>
+
+#include <djvGeom/IndexedTriangleMesh.h>
+
+#include <cstdio>
+#include <ctime>
+
+#if defined(DJV_PLATFORM_WINDOWS)
+#include <sys/utime.h>
+#else // DJV_PLATFORM_WINDOWS
+#include <utime.h>
+#endif // DJV_PLATFORM_WINDOWS
+
+using namespace djv::Core;
+using namespace djv::Scene3D;
+
+namespace djv
+{
+    namespace Scene3DTest
+    {
+        CacheTest::CacheTest(
+            const System::File::Path& tempPath,
+            const std::shared_ptr<System::Context>& context) :
+            ITest("djv::Scene3DTest::CacheTest", tempPath, context)
+        {}
+        
+        void CacheTest::run()
+        {
+            _key();
+            _io();
+            _errors();
+            _cleanup();
+        }
+
+        namespace
+        {
+            void setTime(const std::string& fileName, time_t value)
+            {
+#if defined(DJV_PLATFORM_WINDOWS)
+                struct _utimbuf t;
+                t.actime = value;
+                t.modtime = value;
+                _utime(fileName.c_str(), &t);
+#else // DJV_PLATFORM_WINDOWS
+                struct utimbuf t;
+                t.actime = value;
+                t.modtime = value;
+                utime(fileName.c_str(), &t);
+#endif // DJV_PLATFORM_WINDOWS
+            }
+
+            bool exists(const std::string& fileName)
+            {
+                return System::File::Info(System::File::Path(fileName)).doesExist();
+            }
+
+            std::shared_ptr<Scene> createScene()
+            {
+                auto out = Scene::create();
+                out->setSceneOrient(SceneOrient::ZUp);
+
+                auto material = DefaultMaterial::create();
+                material->setDiffuse(Image::Color(1.F, 0.F, 0.F));
+                material->setShine(0.5F);
+
+                auto layer = Layer::create();
+                layer->setName("layer");
+                layer->setColor(Image::Color(0.F, 1.F, 0.F));
+                layer->setMaterial(material);
+                auto childLayer = Layer::create();
+                childLayer->setName("childLayer");
+                childLayer->setVisible(false);
+                layer->addItem(childLayer);
+                out->addLayer(layer);
+
+                auto mesh = std::shared_ptr<Geom::IndexedTriangleMesh>(new Geom::IndexedTriangleMesh);
+                mesh->v.push_back(glm::vec3(0.F, 0.F, 0.F));
+                mesh->v.push_back(glm::vec3(1.F, 0.F, 0.F));
+                mesh->v.push_back(glm::vec3(1.F, 1.F, 0.F));
+                mesh->n.push_back(glm::vec3(0.F, 0.F, 1.F));
+                mesh->n.push_back(glm::vec3(0.F, 0.F, 1.F));
+                mesh->n.push_back(glm::vec3(0.F, 0.F, 1.F));
+                mesh->indices.push_back(0);
+                mesh->indices.push_back(1);
+                mesh->indices.push_back(2);
+                mesh->bboxUpdate();
+                auto meshPrimitive = MeshPrimitive::create();
+                meshPrimitive->setName("mesh");
+                meshPrimitive->addMesh(mesh);
+                meshPrimitive->setLODs({ { mesh } });
+                meshPrimitive->setMaterialAssignment(MaterialAssignment::Primitive);
+                meshPrimitive->setMaterial(material);
+                out->addDefinition(meshPrimitive);
+
+                auto group = NullPrimitive::create();
+                group->setName("group");
+                childLayer->addItem(group);
+                auto instance = InstancePrimitive::create();
+                instance->setName("instance");
+                instance->setXForm(glm::mat4x4(2.F));
+                instance->addInstance(meshPrimitive);
+                group->addChild(instance);
+                out->addPrimitive(group);
+
+                auto light = DirectionalLight::create();
+                light->setIntensity(0.5F);
+                light->setDirection(glm::vec3(0.F, -1.F, 0.F));
+                out->addPrimitive(light);
+
+                return out;
+            }
+
+        } // namespace
+
+        void CacheTest::_key()
+        {
+            const System::File::Path path(getTempPath(), "CacheTest.obj");
+            {
+                auto io = System::File::IO::create();
+                io->open(path.get(), System::File::Mode::Write);
+                io->write("v 0 0 0\n");
+            }
+            const System::File::Info fileInfo(path);
+            const uint64_t key = IO::Cache::getKey(fileInfo, "options");
+            DJV_ASSERT(key == IO::Cache::getKey(fileInfo, "options"));
+            DJV_ASSERT(key != IO::Cache::getKey(fileInfo, "other"));
+            {
+                auto io = System::File::IO::create();
+                io->open(path.get(), System::File::Mode::Append);
+                io->write("v 1 0 0\n");
+            }
+            DJV_ASSERT(key != IO::Cache::getKey(fileInfo, "options"));
+
+            const System::File::Path cachePath = IO::Cache::getPath(getTempPath(), key);
+            DJV_ASSERT(cachePath.getExtension() == IO::Cache::fileExtension);
+            DJV_ASSERT(cachePath != IO::Cache::getPath(getTempPath(), key + 1));
+        }
+
+        void CacheTest::_io()
+        {
+            const std::string fileName = System::File::Path(getTempPath(), "CacheTest.djvscene").get();
+            auto scene = createScene();
+            IO::Cache::write(fileName, 1, scene);
+            DJV_ASSERT(!IO::Cache::read(fileName, 2));
+            auto scene2 = IO::Cache::read(fileName, 1);
+            DJV_ASSERT(scene2);
+            DJV_ASSERT(SceneOrient::ZUp == scene2->getSceneOrient());
+
+            const auto& layers = scene2->getLayers();
+            DJV_ASSERT(1 == layers.size());
+            DJV_ASSERT("layer" == layers[0]->getName());
+            DJV_ASSERT(Image::Color(0.F, 1.F, 0.F) == layers[0]->getColor());
+            auto material = std::dynamic_pointer_cast<DefaultMaterial>(layers[0]->getMaterial());
+            DJV_ASSERT(material);
+            DJV_ASSERT(Image::Color(1.F, 0.F, 0.F) == material->getDiffuse());
+            DJV_ASSERT(0.5F == material->getShine());
+            DJV_ASSERT(1 == layers[0]->getItems().size());
+            auto childLayer = std::dynamic_pointer_cast<Layer>(layers[0]->getItems()[0]);
+            DJV_ASSERT(childLayer);
+            DJV_ASSERT(!childLayer->isVisible());
+
+            const auto& definitions = scene2->getDefinitions();
+            DJV_ASSERT(1 == definitions.size());
+            DJV_ASSERT(definitions[0]->getMaterial() == material);
+            const auto& meshes = definitions[0]->getMeshes();
+            DJV_ASSERT(1 == meshes.size());
+            const auto& mesh = scene->getDefinitions()[0]->getMeshes()[0];
+            DJV_ASSERT(mesh->v == meshes[0]->v);
+            DJV_ASSERT(mesh->n == meshes[0]->n);
+            DJV_ASSERT(mesh->indices == meshes[0]->indices);
+            DJV_ASSERT(mesh->bbox == meshes[0]->bbox);
+            const auto& lods = definitions[0]->getLODs();
+            DJV_ASSERT(1 == lods.size());
+            DJV_ASSERT(1 == lods[0].size());
+            DJV_ASSERT(mesh->indices == lods[0][0]->indices);
+
+            const auto& primitives = scene2->getPrimitives();
+            DJV_ASSERT(2 == primitives.size());
+            DJV_ASSERT("group" == primitives[0]->getName());
+            DJV_ASSERT(primitives[0]->getLayer().lock() == childLayer);
+            DJV_ASSERT(1 == primitives[0]->getChildren().size());
+            auto instance = std::dynamic_pointer_cast<InstancePrimitive>(primitives[0]->getChildren()[0]);
+            DJV_ASSERT(instance);
+            DJV_ASSERT(glm::mat4x4(2.F) == instance->getXForm());
+            DJV_ASSERT(1 == instance->getInstances().size());
+            DJV_ASSERT(instance->getInstances()[0] == definitions[0]);
+            auto light = std::dynamic_pointer_cast<DirectionalLight>(primitives[1]);
+            DJV_ASSERT(light);
+            DJV_ASSERT(0.5F == light->getIntensity());
+            DJV_ASSERT(glm::vec3(0.F, -1.F, 0.F) == light->getDirection());
+
+            // Computed levels of detail are written instead of the ones in
+            // the primitives.
+            auto meshPrimitive = std::dynamic_pointer_cast<MeshPrimitive>(scene->getDefinitions()[0]);
+            LOD::PrimitiveLevels primitiveLevels;
+            primitiveLevels.push_back(std::make_pair(meshPrimitive, LOD::Levels({ { mesh }, { mesh } })));
+            IO::Cache::write(fileName, 1, scene, primitiveLevels);
+            DJV_ASSERT(1 == meshPrimitive->getLODs().size());
+            auto scene3 = IO::Cache::read(fileName, 1);
+            DJV_ASSERT(scene3);
+            DJV_ASSERT(2 == scene3->getDefinitions()[0]->getLODs().size());
+        }
+
+        void CacheTest::_errors()
+        {
+            const std::string fileName = System::File::Path(getTempPath(), "CacheTest2.djvscene").get();
+            std::remove(fileName.c_str());
+            DJV_ASSERT(!IO::Cache::read(fileName, 1));
+            IO::Cache::write(fileName, 1, createScene());
+            {
+                auto io = System::File::IO::create();
+                io->open(fileName, System::File::Mode::ReadWrite);
+                io->seek(io->getSize() / 2);
+                io->write("corrupt");
+            }
+            try
+            {
+                IO::Cache::read(fileName, 1);
+                DJV_ASSERT(false);
+            }
+            catch (const std::exception& e)
+            {
+                _print(e.what());
+            }
+        }
+
+        void CacheTest::_cleanup()
+        {
+            const System::File::Path path(getTempPath(), "CacheTestCleanup");
+            if (!System::File::Info(path).doesExist())
+            {
+                System::File::mkdir(path);
+            }
+
+            // Write cache files with increasing times, so the first file is
+            // the least recently used.
+            std::vector<std::string> fileNames;
+            for (uint64_t i = 0; i < 3; ++i)
+            {
+                fileNames.push_back(IO::Cache::getPath(path, i).get());
+                IO::Cache::write(fileNames[i], i, createScene());
+                setTime(fileNames[i], 1000 + i * 10);
+            }
+            const size_t size = System::File::Info(System::File::Path(fileNames[0])).getSize();
+
+            // Write an old file that looks like an interrupted write.
+            const std::string tmpFileName = System::File::Path(path, "tmp").get();
+            {
+                auto io = System::File::IO::create();
+                io->open(tmpFileName, System::File::Mode::Write);
+                io->write("tmp");
+            }
+            setTime(tmpFileName, 1000);
+
+            IO::Cache::cleanup(path, size * 3);
+            for (const auto& i : fileNames)
+            {
+                DJV_ASSERT(exists(i));
+            }
+            DJV_ASSERT(!exists(tmpFileName));
+
+            IO::Cache::cleanup(path, size * 2);
+            DJV_ASSERT(!exists(fileNames[0]));
+            DJV_ASSERT(exists(fileNames[1]));
+            DJV_ASSERT(exists(fileNames[2]));
+
+            IO::Cache::cleanup(path, 0);
+            for (const auto& i : fileNames)
+            {
+                DJV_ASSERT(!exists(i));
+            }
+        }
+
+    } // namespace Scene3DTest
+} // namespace djv
+
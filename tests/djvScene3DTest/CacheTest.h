@@ -0,0 +1,29 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvTestLib/Test.h>
+
+namespace djv
+{
+    namespace Scene3DTest
+    {
+        class CacheTest : public Test::ITest
+        {
+        public:
+            CacheTest(
+                const System::File::Path& tempPath,
+                const std::shared_ptr<System::Context>&);
+            
+            void run() override;
+
+        private:
+            void _key();
+            void _io();
+            void _errors();
+            void _cleanup();
+        };
+        
+    } // namespace Scene3DTest
+} // namespace djv
+
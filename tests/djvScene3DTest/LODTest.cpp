@@ -0,0 +1,136 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvScene3DTest/LODTest.h>
+
+#include <djvScene3D/InstancePrimitive.h>
+#include <djvScene3D/LOD.h>
+#include <djvScene3D/MeshPrimitive.h>
+#include <djvScene3D/NullPrimitive.h>
+#include <djvScene3D/Scene.h>
+
+#include <djvGeom/IndexedTriangleMesh.h>
+
+#include <atomic>
+#include <cmath>
+#include <sstream>
+
+using namespace djv::Core;
+using namespace djv::Scene3D;
+
+namespace djv
+{
+    namespace Scene3DTest
+    {
+        LODTest::LODTest(
+            const System::File::Path& tempPath,
+            const std::shared_ptr<System::Context>& context) :
+            ITest("djv::Scene3DTest::LODTest", tempPath, context)
+        {}
+
+        void LODTest::run()
+        {
+            _level();
+            _generate();
+        }
+
+        void LODTest::_level()
+        {
+            DJV_ASSERT(0 == LOD::getLevel(512.F, 256.F, 3));
+            DJV_ASSERT(0 == LOD::getLevel(256.F, 256.F, 3));
+            DJV_ASSERT(1 == LOD::getLevel(255.F, 256.F, 3));
+            DJV_ASSERT(1 == LOD::getLevel(128.F, 256.F, 3));
+            DJV_ASSERT(2 == LOD::getLevel(127.F, 256.F, 3));
+            DJV_ASSERT(3 == LOD::getLevel(1.F, 256.F, 3));
+            DJV_ASSERT(1 == LOD::getLevel(1.F, 256.F, 1));
+            DJV_ASSERT(0 == LOD::getLevel(1.F, 256.F, 0));
+            DJV_ASSERT(0 == LOD::getLevel(1.F, 0.F, 3));
+        }
+
+        namespace
+        {
+            std::shared_ptr<Geom::IndexedTriangleMesh> createGrid(size_t size)
+            {
+                auto out = std::shared_ptr<Geom::IndexedTriangleMesh>(new Geom::IndexedTriangleMesh);
+                for (size_t y = 0; y <= size; ++y)
+                {
+                    for (size_t x = 0; x <= size; ++x)
+                    {
+                        const float fx = x / static_cast<float>(size);
+                        const float fy = y / static_cast<float>(size);
+                        out->v.push_back(glm::vec3(fx, fy, std::sin(fx * 6.F) * std::cos(fy * 6.F) * .1F));
+                    }
+                }
+                const uint32_t row = static_cast<uint32_t>(size + 1);
+                for (size_t y = 0; y < size; ++y)
+                {
+                    for (size_t x = 0; x < size; ++x)
+                    {
+                        const uint32_t i = static_cast<uint32_t>(y * row + x);
+                        for (const auto j : { i, i + 1, i + row + 1, i, i + row + 1, i + row })
+                        {
+                            out->indices.push_back(j);
+                        }
+                    }
+                }
+                out->bboxUpdate();
+                return out;
+            }
+
+        } // namespace
+
+        void LODTest::_generate()
+        {
+            auto scene = Scene::create();
+            auto large = MeshPrimitive::create();
+            large->addMesh(createGrid(32));
+            large->addMesh(createGrid(16));
+            scene->addDefinition(large);
+            auto small = MeshPrimitive::create();
+            small->addMesh(createGrid(1));
+            auto group = NullPrimitive::create();
+            group->addChild(small);
+            auto instance = InstancePrimitive::create();
+            instance->addInstance(large);
+            group->addChild(instance);
+            scene->addPrimitive(group);
+
+            LOD::generate(scene, 0);
+            DJV_ASSERT(large->getLODs().empty());
+
+            // Computing the levels of detail does not modify the scene.
+            std::atomic<bool> cancel(true);
+            DJV_ASSERT(LOD::compute(scene, LOD::levelsDefault, &cancel).empty());
+            const auto primitiveLevels = LOD::compute(scene, LOD::levelsDefault);
+            DJV_ASSERT(1 == primitiveLevels.size());
+            DJV_ASSERT(large == primitiveLevels[0].first);
+            DJV_ASSERT(large->getLODs().empty());
+            LOD::apply(primitiveLevels);
+            DJV_ASSERT(primitiveLevels[0].second == large->getLODs());
+            large->setLODs(LOD::Levels());
+
+            LOD::generate(scene, LOD::levelsDefault);
+            const auto& lods = large->getLODs();
+            DJV_ASSERT(lods.size() > 0);
+            DJV_ASSERT(lods.size() <= LOD::levelsDefault);
+            DJV_ASSERT(small->getLODs().empty());
+            size_t triangleCount = large->getMeshes()[0]->getTriangleCount();
+            for (const auto& i : lods)
+            {
+                DJV_ASSERT(large->getMeshes().size() == i.size());
+                std::stringstream ss;
+                ss << "Level triangles: " << i[0]->getTriangleCount();
+                _print(ss.str());
+                DJV_ASSERT(i[0]->getTriangleCount() < triangleCount);
+                triangleCount = i[0]->getTriangleCount();
+            }
+
+            // Primitives that already have levels of detail are skipped.
+            const auto mesh = lods[0][0];
+            LOD::generate(scene, LOD::levelsDefault);
+            DJV_ASSERT(mesh == large->getLODs()[0][0]);
+        }
+
+    } // namespace Scene3DTest
+} // namespace djv
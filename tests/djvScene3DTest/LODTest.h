@@ -0,0 +1,27 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvTestLib/Test.h>
+
+namespace djv
+{
+    namespace Scene3DTest
+    {
+        class LODTest : public Test::ITest
+        {
+        public:
+            LODTest(
+                const System::File::Path& tempPath,
+                const std::shared_ptr<System::Context>&);
+            
+            void run() override;
+
+        private:
+            void _level();
+            void _generate();
+        };
+        
+    } // namespace Scene3DTest
+} // namespace djv
+
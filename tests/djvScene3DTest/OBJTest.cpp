@@ -0,0 +1,118 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvScene3DTest/OBJTest.h>
+
+#include <djvScene3D/IPrimitive.h>
+#include <djvScene3D/OBJ.h>
+#include <djvScene3D/Scene.h>
+
+#include <djvSystem/Context.h>
+#include <djvSystem/FileIO.h>
+#include <djvSystem/FileInfo.h>
+#include <djvSystem/LogSystem.h>
+#include <djvSystem/ResourceSystem.h>
+#include <djvSystem/TextSystem.h>
+
+#include <djvGeom/IndexedTriangleMesh.h>
+
+using namespace djv::Core;
+using namespace djv::Scene3D;
+
+namespace djv
+{
+    namespace Scene3DTest
+    {
+        OBJTest::OBJTest(
+            const System::File::Path& tempPath,
+            const std::shared_ptr<System::Context>& context) :
+            ITest("djv::Scene3DTest::OBJTest", tempPath, context)
+        {}
+        
+        void OBJTest::run()
+        {
+            _read();
+        }
+
+        void OBJTest::_read()
+        {
+            if (auto context = getContext().lock())
+            {
+                struct Data
+                {
+                    std::string fileName;
+                    std::string contents;
+                };
+                const std::vector<Data> data =
+                {
+                    {
+                        "OBJTest.obj",
+                        "# Quad\n"
+                        "v 0 0 0\n"
+                        "v 1 0 0\n"
+                        "v 1 1 0\n"
+                        "v 0 1 0\n"
+                        "vn 0 0 1\n"
+                        "f 1//1 2//1 3//1 4//1\n"
+                        "\n"
+                        "# Triangle with relative indices\n"
+                        "v 0 0 1.5e0\n"
+                        "v 1 0 1.5\n"
+                        "v 1 1 \\\n"
+                        "  1.5\n"
+                        "\tf\t-3//-1 -2//-1 -1//-1\n"
+                    },
+                    {
+                        "OBJTestCRLF.obj",
+                        "# Quad\r\n"
+                        "v 0 0 0\r\n"
+                        "v 1 0 0\r\n"
+                        "v 1 1 0\r\n"
+                        "v 0 1 0\r\n"
+                        "vn 0 0 1\r\n"
+                        "f 1//1 2//1 3//1 4//1\r\n"
+                        "\r\n"
+                        "# Triangle with relative indices\r\n"
+                        "v 0 0 1.5e0\r\n"
+                        "v 1 0 1.5\r\n"
+                        "v 1 1 \\\r\n"
+                        "  1.5\r\n"
+                        "\tf\t-3//-1 -2//-1 -1//-1\r\n"
+                    }
+                };
+                for (const auto& d : data)
+                {
+                    const System::File::Path path(getTempPath(), d.fileName);
+                    {
+                        auto io = System::File::IO::create();
+                        io->open(path.get(), System::File::Mode::Write);
+                        io->write(d.contents);
+                    }
+                    auto read = IO::OBJ::Read::create(
+                        System::File::Info(path),
+                        context->getSystemT<System::TextSystem>(),
+                        context->getSystemT<System::ResourceSystem>(),
+                        context->getSystemT<System::LogSystem>());
+                    auto scene = read->getScene().get();
+                    DJV_ASSERT(scene);
+                    DJV_ASSERT(1 == scene->getPrimitives().size());
+                    const auto& meshes = scene->getPrimitives()[0]->getMeshes();
+                    DJV_ASSERT(1 == meshes.size());
+                    const auto& mesh = meshes[0];
+                    _print(d.fileName + " vertices: " + std::to_string(mesh->v.size()));
+                    _print(d.fileName + " triangles: " + std::to_string(mesh->getTriangleCount()));
+                    DJV_ASSERT(7 == mesh->v.size());
+                    DJV_ASSERT(7 == mesh->n.size());
+                    DJV_ASSERT(3 == mesh->getTriangleCount());
+                    for (size_t i = 6; i < 9; ++i)
+                    {
+                        DJV_ASSERT(1.5F == mesh->v[mesh->indices[i]].z);
+                    }
+                }
+            }
+        }
+
+    } // namespace Scene3DTest
+} // namespace djv
+
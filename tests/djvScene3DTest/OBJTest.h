@@ -0,0 +1,26 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvTestLib/Test.h>
+
+namespace djv
+{
+    namespace Scene3DTest
+    {
+        class OBJTest : public Test::ITest
+        {
+        public:
+            OBJTest(
+                const System::File::Path& tempPath,
+                const std::shared_ptr<System::Context>&);
+            
+            void run() override;
+
+        private:
+            void _read();
+        };
+        
+    } // namespace Scene3DTest
+} // namespace djv
+
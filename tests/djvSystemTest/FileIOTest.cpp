@@ -7,6 +7,7 @@
 #include <djvSystem/FileIO.h>
 #include <djvSystem/Path.h>
 
+#include <cstdio>
 #include <limits>
 #include <sstream>
 
@@ -245,6 +246,20 @@ namespace djv
             {
                 io->writeU8(i);
             }
+
+            // Temporary files in the same directory have unique names.
+            auto io2 = File::IO::create();
+            io2->openTemp(getTempPath().get());
+            auto io3 = File::IO::create();
+            io3->openTemp(getTempPath().get());
+            const std::string fileName2 = io2->getFileName();
+            const std::string fileName3 = io3->getFileName();
+            DJV_ASSERT(fileName2 != fileName3);
+            DJV_ASSERT(File::Path(fileName2).getDirectoryName() == File::Path(getTempPath(), "x").getDirectoryName());
+            io2->close();
+            io3->close();
+            std::remove(fileName2.c_str());
+            std::remove(fileName3.c_str());
         }
         
     } // namespace SystemTest
@@ -47,12 +47,17 @@ namespace djv
         public:
             static std::shared_ptr<TestObject2> create(const std::shared_ptr<Context>&);
 
+            void enableUpdates();
+            size_t getUpdateCount() const;
+
         protected:
             bool _eventFilter(const std::shared_ptr<IObject>&, Event::Event&) override;
+            void _updateEvent(System::Event::Update&) override;
 
         private:
             size_t _moveCount = 0;
             bool _buttonPress = false;
+            size_t _updateCount = 0;
         };
 
         class TestEventSystem : public Event::IEventSystem
@@ -74,7 +79,6 @@ namespace djv
 
         protected:
             void _init(System::Event::Init&) override;
-            void _update(System::Event::Update&) override;
 
             void _hover(const std::shared_ptr<IObject>&, Event::PointerMove&, std::shared_ptr<IObject>&);
             void _hover(System::Event::PointerMove&, std::shared_ptr<IObject>&) override;
@@ -182,12 +186,31 @@ namespace djv
             out->_init(context);
             return out;
         }
+
+        void TestObject2::enableUpdates()
+        {
+            _setUpdateEnabled(true);
+        }
+
+        size_t TestObject2::getUpdateCount() const
+        {
+            return _updateCount;
+        }
             
         bool TestObject2::_eventFilter(const std::shared_ptr<IObject> &, Event::Event &)
         {
             return false;
         }
 
+        void TestObject2::_updateEvent(System::Event::Update&)
+        {
+            ++_updateCount;
+            if (_updateCount >= 10)
+            {
+                _setUpdateEnabled(false);
+            }
+        }
+
         void TestEventSystem::_init(
             const std::shared_ptr<IObject>& parent,
             const std::shared_ptr<Context>& context)
@@ -251,11 +274,6 @@ namespace djv
             _initRecursive(_parent, event);
         }
         
-        void TestEventSystem::_update(System::Event::Update& event)
-        {
-            _updateRecursive(_parent, event);
-        }
-            
         void TestEventSystem::_hover(const std::shared_ptr<IObject>& object, Event::PointerMove& event, std::shared_ptr<IObject>& hover)
         {
             const auto children = object->getChildrenT<IObject>();
@@ -388,7 +406,9 @@ namespace djv
                         }
                     });
 
+                _object2->enableUpdates();
                 _tickFor(std::chrono::milliseconds(2000));
+                DJV_ASSERT(10 == _object2->getUpdateCount());
 
                 _object2->removeEventFilter(_object);
             }
@@ -0,0 +1,167 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvSystemTest/MemorySystemTest.h>
+
+#include <djvSystem/Context.h>
+#include <djvSystem/MemorySystemFunc.h>
+
+#include <djvCore/Memory.h>
+
+#include <sstream>
+
+using namespace djv::Core;
+using namespace djv::System;
+
+namespace djv
+{
+    namespace SystemTest
+    {
+        MemorySystemTest::MemorySystemTest(
+            const File::Path& tempPath,
+            const std::shared_ptr<Context>& context) :
+            ITest("djv::SystemTest::MemorySystemTest", tempPath, context)
+        {}
+
+        void MemorySystemTest::run()
+        {
+            _enum();
+            _pressure();
+            _caches();
+        }
+
+        void MemorySystemTest::_enum()
+        {
+            for (auto i : getMemoryCachePriorityEnums())
+            {
+                std::stringstream ss;
+                ss << i;
+                _print("Memory cache priority: " + _getText(ss.str()));
+            }
+            for (auto i : getMemoryPressureEnums())
+            {
+                std::stringstream ss;
+                ss << i;
+                _print("Memory pressure: " + _getText(ss.str()));
+            }
+        }
+
+        void MemorySystemTest::_pressure()
+        {
+            OS::MemoryStatus status;
+            DJV_ASSERT(MemoryPressure::None == getMemoryPressure(status));
+            status.total = 100 * Memory::gigabyte;
+            status.available = 50 * Memory::gigabyte;
+            DJV_ASSERT(MemoryPressure::None == getMemoryPressure(status));
+            status.available = 15 * Memory::gigabyte;
+            DJV_ASSERT(MemoryPressure::Moderate == getMemoryPressure(status));
+            status.available = 5 * Memory::gigabyte;
+            DJV_ASSERT(MemoryPressure::High == getMemoryPressure(status));
+            status.available = 50 * Memory::gigabyte;
+            status.pressure = 15.F;
+            DJV_ASSERT(MemoryPressure::Moderate == getMemoryPressure(status));
+            status.pressure = 50.F;
+            DJV_ASSERT(MemoryPressure::High == getMemoryPressure(status));
+            status.pressure = 0.F;
+            status.process = 60 * Memory::gigabyte;
+            DJV_ASSERT(MemoryPressure::Moderate == getMemoryPressure(status));
+            status.process = 80 * Memory::gigabyte;
+            DJV_ASSERT(MemoryPressure::High == getMemoryPressure(status));
+        }
+
+        void MemorySystemTest::_caches()
+        {
+            if (auto context = getContext().lock())
+            {
+                auto system = context->getSystemT<MemorySystem>();
+                DJV_ASSERT(system);
+
+                float lowScale = 1.F;
+                MemoryCacheData lowData;
+                lowData.name = "Low";
+                lowData.priority = MemoryCachePriority::Low;
+                lowData.byteCount = [] { return Memory::megabyte; };
+                lowData.scale = [&lowScale](float value) { lowScale = value; };
+                const UID lowUID = system->addCache(lowData);
+
+                float highScale = 1.F;
+                MemoryCacheData highData;
+                highData.name = "High";
+                highData.priority = MemoryCachePriority::High;
+                highData.byteCount = [] { return Memory::kilobyte; };
+                highData.scale = [&highScale](float value) { highScale = value; };
+                const UID highUID = system->addCache(highData);
+
+                MemoryCacheData reportData;
+                reportData.name = "Report";
+                reportData.priority = MemoryCachePriority::Low;
+                reportData.byteCount = [] { return Memory::kilobyte; };
+                const UID reportUID = system->addCache(reportData);
+
+                size_t count = 0;
+                for (const auto& i : system->observeCaches()->get())
+                {
+                    if (lowUID == i.uid)
+                    {
+                        DJV_ASSERT("Low" == i.name);
+                        DJV_ASSERT(MemoryCachePriority::Low == i.priority);
+                        DJV_ASSERT(Memory::megabyte == i.byteCount);
+                        DJV_ASSERT(i.resizable);
+                        ++count;
+                    }
+                    else if (reportUID == i.uid)
+                    {
+                        DJV_ASSERT(!i.resizable);
+                        ++count;
+                    }
+                }
+                DJV_ASSERT(2 == count);
+
+                // The lowest priority caches are reduced first.
+                OS::MemoryStatus status;
+                status.total = 100 * Memory::gigabyte;
+                status.available = 5 * Memory::gigabyte;
+                system->update(status);
+                DJV_ASSERT(status == system->observeStatus()->get());
+                DJV_ASSERT(MemoryPressure::High == system->observePressure()->get());
+                DJV_ASSERT(.5F == lowScale);
+                DJV_ASSERT(1.F == highScale);
+                for (size_t i = 0; i < 20; ++i)
+                {
+                    system->update(status);
+                }
+                DJV_ASSERT(lowScale < .5F);
+                DJV_ASSERT(highScale < 1.F);
+                const float lowScaleMin = lowScale;
+
+                // Moderate pressure leaves the caches alone.
+                status.available = 15 * Memory::gigabyte;
+                system->update(status);
+                DJV_ASSERT(lowScaleMin == lowScale);
+
+                // The highest priority caches are grown back first.
+                status.available = 50 * Memory::gigabyte;
+                system->update(status);
+                DJV_ASSERT(lowScaleMin == lowScale);
+                for (size_t i = 0; i < 20; ++i)
+                {
+                    system->update(status);
+                }
+                DJV_ASSERT(1.F == lowScale);
+                DJV_ASSERT(1.F == highScale);
+
+                system->removeCache(lowUID);
+                system->removeCache(highUID);
+                system->removeCache(reportUID);
+                for (const auto& i : system->observeCaches()->get())
+                {
+                    DJV_ASSERT(i.uid != lowUID);
+                    DJV_ASSERT(i.uid != highUID);
+                    DJV_ASSERT(i.uid != reportUID);
+                }
+            }
+        }
+
+    } // namespace SystemTest
+} // namespace djv
@@ -116,6 +116,12 @@ namespace djv
                     child2->setEnabled(false);
                     DJV_ASSERT(!child2->isEnabled());
                     parent->addChild(child2);
+                    parent->setEnabled(false);
+                    DJV_ASSERT(!child->isEnabled(true));
+                    DJV_ASSERT(child->isEnabled());
+                    parent->setEnabled(true);
+                    DJV_ASSERT(child->isEnabled(true));
+                    DJV_ASSERT(!child2->isEnabled(true));
                     child2->moveToFront();
                     child2->moveToBack();
                     
@@ -141,6 +147,12 @@ namespace djv
                     DJV_ASSERT(parent->getChildren().size() == 0);
                     DJV_ASSERT(!child->getParent().lock());
                     DJV_ASSERT(!child2->getParent().lock());
+                    parent->setEnabled(false);
+                    parent->addChild(child);
+                    DJV_ASSERT(!child->isEnabled(true));
+                    parent->removeChild(child);
+                    DJV_ASSERT(child->isEnabled(true));
+                    parent->setEnabled(true);
                     
                     parent->addChild(child);
                     parent->addChild(child2);
@@ -0,0 +1,116 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvSystemTest/ResourcePackTest.h>
+
+#include <djvSystem/FileIO.h>
+#include <djvSystem/Path.h>
+#include <djvSystem/ResourcePack.h>
+
+#include <limits>
+
+using namespace djv::Core;
+using namespace djv::System;
+
+namespace djv
+{
+    namespace SystemTest
+    {
+        ResourcePackTest::ResourcePackTest(
+            const File::Path& tempPath,
+            const std::shared_ptr<Context>& context) :
+            ITest(
+                "djv::SystemTest::ResourcePackTest",
+                File::Path(tempPath, "ResourcePackTest"),
+                context)
+        {}
+        
+        void ResourcePackTest::run()
+        {
+            _pack();
+            _error();
+        }
+
+        void ResourcePackTest::_pack()
+        {
+            const std::string fileName = File::Path(getTempPath(), "pack.pack").get();
+            std::vector<std::pair<std::string, std::vector<uint8_t> > > entries;
+            entries.push_back(std::make_pair("Text/b", std::vector<uint8_t>({ 1, 2, 3 })));
+            entries.push_back(std::make_pair("Icons/a", std::vector<uint8_t>({ 4 })));
+            entries.push_back(std::make_pair("Fonts/c", std::vector<uint8_t>()));
+            File::writeResourcePack(fileName, entries);
+
+            auto pack = File::ResourcePack::create(fileName);
+            DJV_ASSERT(fileName == pack->getFileName());
+            DJV_ASSERT(pack->getSize() > 0);
+            DJV_ASSERT(3 == pack->getEntryCount());
+            const std::vector<std::string> names = { "Fonts/c", "Icons/a", "Text/b" };
+            DJV_ASSERT(names == pack->getNames());
+            for (const auto& i : entries)
+            {
+                File::ResourcePackEntry entry;
+                DJV_ASSERT(pack->hasEntry(i.first));
+                DJV_ASSERT(pack->getEntry(i.first, entry));
+                DJV_ASSERT(entry.size == i.second.size());
+                DJV_ASSERT(0 == reinterpret_cast<size_t>(entry.data) % File::resourcePackAlignment);
+                DJV_ASSERT(std::vector<uint8_t>(entry.data, entry.data + entry.size) == i.second);
+            }
+            File::ResourcePackEntry entry;
+            DJV_ASSERT(!pack->hasEntry("Text"));
+            DJV_ASSERT(!pack->getEntry("Text/bb", entry));
+            DJV_ASSERT(!entry.data);
+        }
+
+        void ResourcePackTest::_error()
+        {
+            try
+            {
+                File::ResourcePack::create(File::Path(getTempPath(), "missing.pack").get());
+                DJV_ASSERT(false);
+            }
+            catch (const std::exception& e)
+            {
+                _print(e.what());
+            }
+
+            try
+            {
+                const std::string fileName = File::Path(getTempPath(), "invalid.pack").get();
+                auto io = File::IO::create();
+                io->open(fileName, File::Mode::Write);
+                io->write("Hello world!");
+                io->close();
+                File::ResourcePack::create(fileName);
+                DJV_ASSERT(false);
+            }
+            catch (const std::exception& e)
+            {
+                _print(e.what());
+            }
+
+            try
+            {
+                // Write an entry whose offset and size wrap around when they
+                // are added together.
+                const std::string fileName = File::Path(getTempPath(), "corrupt.pack").get();
+                std::vector<std::pair<std::string, std::vector<uint8_t> > > entries;
+                entries.push_back(std::make_pair("a", std::vector<uint8_t>({ 1 })));
+                File::writeResourcePack(fileName, entries);
+                auto io = File::IO::create();
+                io->open(fileName, File::Mode::ReadWrite);
+                io->seek(16 + 16);
+                const uint64_t dataSize = std::numeric_limits<uint64_t>::max();
+                io->write(&dataSize, sizeof(dataSize));
+                io->close();
+                File::ResourcePack::create(fileName);
+                DJV_ASSERT(false);
+            }
+            catch (const std::exception& e)
+            {
+                _print(e.what());
+            }
+        }
+        
+    } // namespace SystemTest
+} // namespace djv
@@ -47,10 +47,12 @@
 #include <djvSystemTest/IEventSystemTest.h>
 #include <djvSystemTest/ISystemTest.h>
 #include <djvSystemTest/LogSystemTest.h>
+#include <djvSystemTest/MemorySystemTest.h>
 #include <djvSystemTest/ObjectTest.h>
 #include <djvSystemTest/PathFuncTest.h>
 #include <djvSystemTest/PathTest.h>
 #include <djvSystemTest/RecentFilesModelTest.h>
+#include <djvSystemTest/ResourcePackTest.h>
 #include <djvSystemTest/TextSystemTest.h>
 #include <djvSystemTest/TimerFuncTest.h>
 #include <djvSystemTest/TimerTest.h>
@@ -70,9 +72,12 @@
 #include <djvAudioTest/DataFuncTest.h>
 #include <djvAudioTest/DataTest.h>
 #include <djvAudioTest/InfoTest.h>
+#include <djvAudioTest/TimeStretchTest.h>
 #include <djvAudioTest/TypeFuncTest.h>
 #include <djvAudioTest/TypeTest.h>
 
+#include <djvGeomTest/IndexedTriangleMeshFuncTest.h>
+#include <djvGeomTest/IndexedTriangleMeshTest.h>
 #include <djvGeomTest/ShapeTest.h>
 #include <djvGeomTest/TriangleMeshFuncTest.h>
 #include <djvGeomTest/TriangleMeshTest.h>
@@ -84,11 +89,13 @@
 #include <djvGLTest/MeshTest.h>
 #include <djvGLTest/OffscreenBufferFuncTest.h>
 #include <djvGLTest/OffscreenBufferTest.h>
+#include <djvGLTest/PixelBufferRingTest.h>
 #include <djvGLTest/ShaderTest.h>
 #include <djvGLTest/TextureFuncTest.h>
 #include <djvGLTest/TextureTest.h>
 #include <djvGLTest/TextureAtlasTest.h>
 
+#include <djvOCIOTest/CPUProcessorTest.h>
 #include <djvOCIOTest/OCIOSystemFuncTest.h>
 #include <djvOCIOTest/OCIOSystemTest.h>
 #include <djvOCIOTest/OCIOTest.h>
@@ -97,6 +104,7 @@
 #include <djvRender2DTest/DataTest.h>
 #include <djvRender2DTest/EnumFuncTest.h>
 #include <djvRender2DTest/FontSystemTest.h>
+#include <djvRender2DTest/ImageSamplerTest.h>
 #include <djvRender2DTest/RenderSystemTest.h>
 #include <djvRender2DTest/RenderTest.h>
 
@@ -105,11 +113,18 @@
 #include <djvRender3DTest/MaterialTest.h>
 #include <djvRender3DTest/RenderTest.h>
 
+#include <djvScene3DTest/BVHTest.h>
+#include <djvScene3DTest/CacheTest.h>
+#include <djvScene3DTest/LODTest.h>
+#include <djvScene3DTest/OBJTest.h>
+
 #include <djvAVTest/AVSystemTest.h>
 #include <djvAVTest/CineonFuncTest.h>
 #include <djvAVTest/DPXFuncTest.h>
 #include <djvAVTest/IOTest.h>
 #include <djvAVTest/PPMFuncTest.h>
+#include <djvAVTest/SequenceVerifyTest.h>
+#include <djvAVTest/SGIFuncTest.h>
 #include <djvAVTest/SpeedFuncTest.h>
 #include <djvAVTest/ThumbnailSystemTest.h>
 #include <djvAVTest/TimeFuncTest.h>
@@ -119,6 +134,9 @@
 #if defined(JPEG_FOUND)
 #include <djvAVTest/JPEGFuncTest.h>
 #endif // JPEG_FOUND
+#if defined(PNG_FOUND)
+#include <djvAVTest/PNGFuncTest.h>
+#endif // PNG_FOUND
 #if defined(OpenEXR_FOUND)
 #include <djvAVTest/OpenEXRFuncTest.h>
 #endif // OpenEXR_FOUND
@@ -128,8 +146,10 @@
 
 #include <djvUITest/ActionGroupTest.h>
 #include <djvUITest/ButtonGroupTest.h>
+#include <djvUITest/DrawListTest.h>
 #include <djvUITest/EnumFuncTest.h>
 #include <djvUITest/SelectionModelTest.h>
+#include <djvUITest/SpatialIndexTest.h>
 #include <djvUITest/WidgetTest.h>
 
 #if !defined(DJV_BUILD_TINY) && !defined(DJV_BUILD_MINIMAL)
@@ -215,10 +235,12 @@ int main(int argc, char ** argv)
         tests.emplace_back(new SystemTest::IEventSystemTest(tempPath, context));
         tests.emplace_back(new SystemTest::ISystemTest(tempPath, context));
         tests.emplace_back(new SystemTest::LogSystemTest(tempPath, context));
+        tests.emplace_back(new SystemTest::MemorySystemTest(tempPath, context));
         tests.emplace_back(new SystemTest::ObjectTest(tempPath, context));
         tests.emplace_back(new SystemTest::PathFuncTest(tempPath, context));
         tests.emplace_back(new SystemTest::PathTest(tempPath, context));
         tests.emplace_back(new SystemTest::RecentFilesModelTest(tempPath, context));
+        tests.emplace_back(new SystemTest::ResourcePackTest(tempPath, context));
         tests.emplace_back(new SystemTest::TextSystemTest(tempPath, context));
         tests.emplace_back(new SystemTest::TimerFuncTest(tempPath, context));
         tests.emplace_back(new SystemTest::TimerTest(tempPath, context));
@@ -238,9 +260,12 @@ int main(int argc, char ** argv)
         tests.emplace_back(new AudioTest::DataFuncTest(tempPath, context));
         tests.emplace_back(new AudioTest::DataTest(tempPath, context));
         tests.emplace_back(new AudioTest::InfoTest(tempPath, context));
+        tests.emplace_back(new AudioTest::TimeStretchTest(tempPath, context));
         tests.emplace_back(new AudioTest::TypeFuncTest(tempPath, context));
         tests.emplace_back(new AudioTest::TypeTest(tempPath, context));
 
+        tests.emplace_back(new GeomTest::IndexedTriangleMeshFuncTest(tempPath, context));
+        tests.emplace_back(new GeomTest::IndexedTriangleMeshTest(tempPath, context));
         tests.emplace_back(new GeomTest::ShapeTest(tempPath, context));
         tests.emplace_back(new GeomTest::TriangleMeshFuncTest(tempPath, context));
         tests.emplace_back(new GeomTest::TriangleMeshTest(tempPath, context));
@@ -252,11 +277,13 @@ int main(int argc, char ** argv)
         tests.emplace_back(new GLTest::MeshTest(tempPath, context));
         tests.emplace_back(new GLTest::OffscreenBufferFuncTest(tempPath, context));
         tests.emplace_back(new GLTest::OffscreenBufferTest(tempPath, context));
+        tests.emplace_back(new GLTest::PixelBufferRingTest(tempPath, context));
         tests.emplace_back(new GLTest::ShaderTest(tempPath, context));
         tests.emplace_back(new GLTest::TextureAtlasTest(tempPath, context));
         tests.emplace_back(new GLTest::TextureFuncTest(tempPath, context));
         tests.emplace_back(new GLTest::TextureTest(tempPath, context));
 
+        tests.emplace_back(new OCIOTest::CPUProcessorTest(tempPath, context));
         tests.emplace_back(new OCIOTest::OCIOSystemFuncTest(tempPath, context));
         tests.emplace_back(new OCIOTest::OCIOSystemTest(tempPath, context));
         tests.emplace_back(new OCIOTest::OCIOTest(tempPath, context));
@@ -265,6 +292,7 @@ int main(int argc, char ** argv)
         tests.emplace_back(new Render2DTest::DataTest(tempPath, context));
         tests.emplace_back(new Render2DTest::EnumFuncTest(tempPath, context));
         tests.emplace_back(new Render2DTest::FontSystemTest(tempPath, context));
+        tests.emplace_back(new Render2DTest::ImageSamplerTest(tempPath, context));
         tests.emplace_back(new Render2DTest::RenderSystemTest(tempPath, context));
         tests.emplace_back(new Render2DTest::RenderTest(tempPath, context));
 
@@ -273,11 +301,18 @@ int main(int argc, char ** argv)
         tests.emplace_back(new Render3DTest::MaterialTest(tempPath, context));
         tests.emplace_back(new Render3DTest::RenderTest(tempPath, context));
 
+        tests.emplace_back(new Scene3DTest::BVHTest(tempPath, context));
+        tests.emplace_back(new Scene3DTest::CacheTest(tempPath, context));
+        tests.emplace_back(new Scene3DTest::LODTest(tempPath, context));
+        tests.emplace_back(new Scene3DTest::OBJTest(tempPath, context));
+
         tests.emplace_back(new AVTest::AVSystemTest(tempPath, context));
         tests.emplace_back(new AVTest::CineonFuncTest(tempPath, context));
         tests.emplace_back(new AVTest::DPXFuncTest(tempPath, context));
         tests.emplace_back(new AVTest::IOTest(tempPath, context));
         tests.emplace_back(new AVTest::PPMFuncTest(tempPath, context));
+        tests.emplace_back(new AVTest::SequenceVerifyTest(tempPath, context));
+        tests.emplace_back(new AVTest::SGIFuncTest(tempPath, context));
         tests.emplace_back(new AVTest::SpeedFuncTest(tempPath, context));
         tests.emplace_back(new AVTest::ThumbnailSystemTest(tempPath, context));
         tests.emplace_back(new AVTest::TimeFuncTest(tempPath, context));
@@ -287,6 +322,9 @@ int main(int argc, char ** argv)
 #if defined(JPEG_FOUND)
         tests.emplace_back(new AVTest::JPEGFuncTest(tempPath, context));
 #endif // JPEG_FOUND
+#if defined(PNG_FOUND)
+        tests.emplace_back(new AVTest::PNGFuncTest(tempPath, context));
+#endif // PNG_FOUND
 #if defined(OpenEXR_FOUND)
         tests.emplace_back(new AVTest::OpenEXRFuncTest(tempPath, context));
 #endif // OpenEXR_FOUND
@@ -296,8 +334,10 @@ int main(int argc, char ** argv)
 
         tests.emplace_back(new UITest::ActionGroupTest(tempPath, context));
         tests.emplace_back(new UITest::ButtonGroupTest(tempPath, context));
+        tests.emplace_back(new UITest::DrawListTest(tempPath, context));
         tests.emplace_back(new UITest::EnumFuncTest(tempPath, context));
         tests.emplace_back(new UITest::SelectionModelTest(tempPath, context));
+        tests.emplace_back(new UITest::SpatialIndexTest(tempPath, context));
         tests.emplace_back(new UITest::WidgetTest(tempPath, context));
 
 #if !defined(DJV_BUILD_TINY) && !defined(DJV_BUILD_MINIMAL)
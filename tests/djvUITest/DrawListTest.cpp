@@ -0,0 +1,177 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+#include <djvUITest/DrawListTest.h>
+
+#include <djvUI/EventSystem.h>
+#include <djvUI/ImageWidget.h>
+#include <djvUI/Label.h>
+
+#include <djvSystem/Context.h>
+
+#include <djvImage/Data.h>
+
+using namespace djv::Core;
+using namespace djv::UI;
+
+namespace djv
+{
+    namespace UITest
+    {
+        namespace
+        {
+            class DrawListEventSystem : public EventSystem
+            {
+                DJV_NON_COPYABLE(DrawListEventSystem);
+
+                void _init(const std::shared_ptr<System::Context>& context)
+                {
+                    EventSystem::_init("DrawListEventSystem", context);
+                }
+
+                DrawListEventSystem()
+                {}
+
+            public:
+                static std::shared_ptr<DrawListEventSystem> create(const std::shared_ptr<System::Context>& context)
+                {
+                    auto out = std::shared_ptr<DrawListEventSystem>(new DrawListEventSystem);
+                    out->_init(context);
+                    return out;
+                }
+
+                // Lay out the widget and paint the region that has changed.
+                void paint(const std::shared_ptr<Widget>& widget)
+                {
+                    const Math::BBox2f bbox(0.F, 0.F, 100.F, 100.F);
+                    System::Event::InitLayout initLayout;
+                    _initLayoutRecursive(widget, initLayout);
+                    System::Event::PreLayout preLayout;
+                    _preLayoutRecursive(widget, preLayout);
+                    widget->setGeometry(bbox);
+                    System::Event::Layout layout;
+                    _layoutRecursive(widget, layout);
+                    System::Event::Clip clip(bbox);
+                    _clipRecursive(widget, clip);
+
+                    Math::BBox2f paintRect(0.F, 0.F, 0.F, 0.F);
+                    _paintRectRecursive(widget, bbox, 1.F, false, paintRect);
+                    if (paintRect.isValid())
+                    {
+                        System::Event::Paint paintEvent(bbox);
+                        System::Event::PaintOverlay paintOverlayEvent(bbox);
+                        _paintRecursive(widget, paintEvent, paintOverlayEvent, paintRect);
+                    }
+                }
+
+            protected:
+                void _hover(System::Event::PointerMove&, std::shared_ptr<System::IObject>&) override
+                {}
+            };
+
+            class TestLabel : public Text::Label
+            {
+                DJV_NON_COPYABLE(TestLabel);
+
+            protected:
+                TestLabel()
+                {}
+
+            public:
+                static std::shared_ptr<TestLabel> create(const std::shared_ptr<System::Context>& context)
+                {
+                    auto out = std::shared_ptr<TestLabel>(new TestLabel);
+                    out->_init(context);
+                    return out;
+                }
+
+                size_t paintCount = 0;
+
+            protected:
+                void _paintEvent(System::Event::Paint& event) override
+                {
+                    Label::_paintEvent(event);
+                    ++paintCount;
+                }
+            };
+
+            class TestImageWidget : public ImageWidget
+            {
+                DJV_NON_COPYABLE(TestImageWidget);
+
+            protected:
+                TestImageWidget()
+                {}
+
+            public:
+                static std::shared_ptr<TestImageWidget> create(const std::shared_ptr<System::Context>& context)
+                {
+                    auto out = std::shared_ptr<TestImageWidget>(new TestImageWidget);
+                    out->_init(context);
+                    return out;
+                }
+
+                size_t paintCount = 0;
+
+            protected:
+                void _paintEvent(System::Event::Paint& event) override
+                {
+                    ImageWidget::_paintEvent(event);
+                    ++paintCount;
+                }
+            };
+
+        } // namespace
+
+        DrawListTest::DrawListTest(
+            const System::File::Path& tempPath,
+            const std::shared_ptr<System::Context>& context) :
+            ITest("djv::UITest::DrawListTest", tempPath, context)
+        {}
+        
+        void DrawListTest::run()
+        {
+            if (auto context = getContext().lock())
+            {
+                auto system = DrawListEventSystem::create(context);
+
+                {
+                    // Changing the text alignment does not change the size of
+                    // the label, but the draw lists need to be rebuilt.
+                    auto label = TestLabel::create(context);
+                    label->setText("Hello world!");
+                    system->paint(label);
+                    DJV_ASSERT(1 == label->paintCount);
+                    system->paint(label);
+                    DJV_ASSERT(1 == label->paintCount);
+                    label->setTextHAlign(TextHAlign::Right);
+                    system->paint(label);
+                    DJV_ASSERT(2 == label->paintCount);
+                    label->setTextVAlign(TextVAlign::Bottom);
+                    system->paint(label);
+                    DJV_ASSERT(3 == label->paintCount);
+                }
+
+                {
+                    // Changing to another image with the same size.
+                    auto imageWidget = TestImageWidget::create(context);
+                    const Image::Info info(16, 16, Image::Type::RGBA_U8);
+                    imageWidget->setImage(Image::Data::create(info));
+                    system->paint(imageWidget);
+                    DJV_ASSERT(1 == imageWidget->paintCount);
+                    system->paint(imageWidget);
+                    DJV_ASSERT(1 == imageWidget->paintCount);
+                    imageWidget->setImage(Image::Data::create(info));
+                    system->paint(imageWidget);
+                    DJV_ASSERT(2 == imageWidget->paintCount);
+                    imageWidget->setImageRotate(ImageRotate::_180);
+                    system->paint(imageWidget);
+                    DJV_ASSERT(3 == imageWidget->paintCount);
+                }
+            }
+        }
+
+    } // namespace UITest
+} // namespace djv
+
@@ -0,0 +1,141 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvUITest/SpatialIndexTest.h>
+
+#include <djvUI/PushButton.h>
+#include <djvUI/RowLayout.h>
+#include <djvUI/SpatialIndex.h>
+#include <djvUI/StackLayout.h>
+
+#include <djvSystem/Context.h>
+
+#include <algorithm>
+#include <sstream>
+
+using namespace djv::Core;
+using namespace djv::UI;
+
+namespace djv
+{
+    namespace UITest
+    {
+        SpatialIndexTest::SpatialIndexTest(
+            const System::File::Path& tempPath,
+            const std::shared_ptr<System::Context>& context) :
+            ITest("djv::UITest::SpatialIndexTest", tempPath, context)
+        {}
+
+        namespace
+        {
+            void preLayoutRecursive(const std::shared_ptr<Widget>& widget)
+            {
+                for (const auto& child : widget->getChildWidgets())
+                {
+                    preLayoutRecursive(child);
+                }
+                System::Event::PreLayout event;
+                widget->event(event);
+            }
+
+            void layoutRecursive(const std::shared_ptr<Widget>& widget)
+            {
+                if (widget->isVisible())
+                {
+                    System::Event::Layout event;
+                    widget->event(event);
+                    for (const auto& child : widget->getChildWidgets())
+                    {
+                        layoutRecursive(child);
+                    }
+                }
+            }
+
+            void clipRecursive(const std::shared_ptr<Widget>& widget, const Math::BBox2f& clipRect)
+            {
+                System::Event::Clip event(clipRect);
+                widget->event(event);
+                for (const auto& child : widget->getChildWidgets())
+                {
+                    clipRecursive(child, clipRect.intersect(child->getGeometry()));
+                }
+            }
+
+            void layout(const std::shared_ptr<Widget>& widget, const Math::BBox2f& geometry)
+            {
+                preLayoutRecursive(widget);
+                widget->setGeometry(geometry);
+                layoutRecursive(widget);
+                clipRecursive(widget, geometry);
+            }
+
+            size_t getIndex(const std::vector<std::shared_ptr<Widget> >& widgets, const std::shared_ptr<Widget>& widget)
+            {
+                return std::find(widgets.begin(), widgets.end(), widget) - widgets.begin();
+            }
+
+        } // namespace
+
+        void SpatialIndexTest::run()
+        {
+            if (auto context = getContext().lock())
+            {
+                auto button0 = PushButton::create(context);
+                button0->setText("Button 0");
+                auto button1 = PushButton::create(context);
+                button1->setText("Button 1");
+                auto rowLayout = VerticalLayout::create(context);
+                rowLayout->addChild(button0);
+                rowLayout->addChild(button1);
+                auto stackLayout = StackLayout::create(context);
+                stackLayout->addChild(rowLayout);
+                const Math::BBox2f geometry(0.F, 0.F, 400.F, 300.F);
+                layout(stackLayout, geometry);
+
+                auto spatialIndex = SpatialIndex::create();
+                DJV_ASSERT(0 == spatialIndex->getWidgetCount());
+                DJV_ASSERT(spatialIndex->getWidgets(geometry.getCenter()).empty());
+
+                spatialIndex->build(stackLayout);
+                const size_t widgetCount = spatialIndex->getWidgetCount();
+                {
+                    std::stringstream ss;
+                    ss << "Widget count: " << widgetCount;
+                    _print(ss.str());
+                }
+                DJV_ASSERT(widgetCount >= 3);
+
+                for (const auto& button : { button0, button1 })
+                {
+                    // Children are returned before their parents.
+                    const auto widgets = spatialIndex->getWidgets(button->getGeometry().getCenter());
+                    const size_t buttonIndex = getIndex(widgets, button);
+                    const size_t rowLayoutIndex = getIndex(widgets, rowLayout);
+                    DJV_ASSERT(buttonIndex < widgets.size());
+                    DJV_ASSERT(rowLayoutIndex < widgets.size());
+                    DJV_ASSERT(buttonIndex < rowLayoutIndex);
+                    DJV_ASSERT(getIndex(widgets, stackLayout) == widgets.size());
+                }
+                {
+                    const auto widgets = spatialIndex->getWidgets(button0->getGeometry().getCenter());
+                    DJV_ASSERT(getIndex(widgets, button1) == widgets.size());
+                }
+                DJV_ASSERT(spatialIndex->getWidgets(glm::vec2(-1.F, -1.F)).empty());
+
+                button1->setVisible(false);
+                layout(stackLayout, geometry);
+                spatialIndex->build(stackLayout);
+                DJV_ASSERT(spatialIndex->getWidgetCount() < widgetCount);
+                for (const auto& widget : spatialIndex->getWidgets(button1->getGeometry().getCenter()))
+                {
+                    DJV_ASSERT(widget != button1);
+                }
+
+                spatialIndex->clear();
+                DJV_ASSERT(0 == spatialIndex->getWidgetCount());
+            }
+        }
+
+    } // namespace UITest
+} // namespace djv